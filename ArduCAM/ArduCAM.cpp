@@ -5,11 +5,35 @@
 #include "pico/binary_info.h"
 #include "ov2640_regs.h"
 #include "ov5642_regs.h"
+#include "ov2640_jpeg_deltas.h"
+
+// Software reset of the OV2640; the table writer waits for it to settle.
+static const struct sensor_reg OV2640_RESET[] =
+{
+  { 0xff, 0x01 },
+  { 0x12, 0x80 },
+  { 0xff, 0xff },
+};
+
+static const struct sensor_reg* const OV2640_JPEG_TABLES[] =
+{
+  OV2640_160x120_JPEG,
+  OV2640_176x144_JPEG,
+  OV2640_320x240_JPEG,
+  OV2640_352x288_JPEG,
+  OV2640_640x480_JPEG,
+  OV2640_800x600_JPEG,
+  OV2640_1024x768_JPEG,
+  OV2640_1280x1024_JPEG,
+  OV2640_1600x1200_JPEG,
+};
 
 ArduCAM::ArduCAM()
 {
   sensor_model = OV7670;
   sensor_addr = 0x42;
+  jpeg_size = OV2640_SIZE_UNKNOWN;
+  i2c_dma_chan = -1;
 }
 ArduCAM::ArduCAM(byte model ,int CS)
 {
@@ -17,6 +41,8 @@ ArduCAM::ArduCAM(byte model ,int CS)
 	*P_CS=CS;
   sbi(P_CS, B_CS);
 	sensor_model = model;
+	jpeg_size = OV2640_SIZE_UNKNOWN;
+	i2c_dma_chan = -1;
 	switch (sensor_model)
 	{
     case OV2640:
@@ -37,9 +63,8 @@ void ArduCAM::InitCAM()
   switch (sensor_model)
   {
     case OV2640:
-        wrSensorReg8_8(0xff, 0x01);
-        wrSensorReg8_8(0x12, 0x80);
-        sleep_ms(100);
+        wrSensorRegs8_8(OV2640_RESET);
+        jpeg_size = OV2640_SIZE_UNKNOWN;
         if (m_fmt == JPEG)
         {
           wrSensorRegs8_8(OV2640_JPEG_INIT);
@@ -47,7 +72,7 @@ void ArduCAM::InitCAM()
           wrSensorRegs8_8(OV2640_JPEG);
           wrSensorReg8_8(0xff, 0x01);
           wrSensorReg8_8(0x15, 0x00);
-          wrSensorRegs8_8(OV2640_320x240_JPEG);
+          OV2640_set_JPEG_size(OV2640_320x240);
         }
         else
         {
@@ -113,11 +138,39 @@ void ArduCAM::flush_fifo(void)
 	write_reg(ARDUCHIP_FIFO, FIFO_CLEAR_MASK);
 }
 
+#ifdef CAP_DONE_PIN
+static volatile bool cap_done_irq = false;
+
+// A raw handler for CAP_DONE_PIN alone, so that the application keeps the
+// shared GPIO callback.
+static void on_cap_done(void)
+{
+	if (gpio_get_irq_event_mask(CAP_DONE_PIN) & GPIO_IRQ_EDGE_RISE)
+	{
+		gpio_acknowledge_irq(CAP_DONE_PIN, GPIO_IRQ_EDGE_RISE);
+		cap_done_irq = true;
+	}
+}
+#endif
+
 void ArduCAM::start_capture(void)
 {
+#ifdef CAP_DONE_PIN
+	cap_done_irq = false;
+#endif
 	write_reg(ARDUCHIP_FIFO, FIFO_START_MASK);
 }
 
+// Returns whether the capture started last is in the FIFO, without waiting.
+bool ArduCAM::capture_done(void)
+{
+#ifdef CAP_DONE_PIN
+	return cap_done_irq;
+#else
+	return get_bit(ARDUCHIP_TRIG, CAP_DONE_MASK) != 0;
+#endif
+}
+
 
 void ArduCAM::clear_fifo_flag(void )
 {
@@ -154,7 +207,6 @@ void ArduCAM::write_reg(uint8_t addr, uint8_t data)
     cbi(P_CS, B_CS);
     spi_write_blocking(SPI_PORT, buf, 2);
     sbi(P_CS, B_CS);
-    sleep_ms(1); 
 }
 
 
@@ -224,18 +276,7 @@ uint8_t ArduCAM:: bus_read(int address)
 	// Write 8 bit values to 8 bit register address
 int ArduCAM::wrSensorRegs8_8(const struct sensor_reg reglist[])
 {
-		int err = 0;
-	  uint16_t reg_addr = 0;
-	  uint16_t reg_val = 0;
-	  const struct sensor_reg *next = reglist;
-	  while ((reg_addr != 0xff) | (reg_val != 0xff))
-	  {
-	    reg_addr = next->reg;
-	    reg_val = next->val;
-	    err = wrSensorReg8_8(reg_addr, reg_val);
-	    next++;
-	  }
-	return 1;
+	return wrSensorRegsDma(&OV2640_REG_FORMAT, reglist);
 }
 
 	// Write 16 bit values to 8 bit register address
@@ -258,17 +299,92 @@ int ArduCAM::wrSensorRegs8_16(const struct sensor_reg reglist[])
 // Write 8 bit values to 16 bit register address
 int ArduCAM::wrSensorRegs16_8(const struct sensor_reg reglist[])
 {
-		int err = 0;
-	  unsigned int reg_addr;
-	  unsigned char reg_val;
-	  const struct sensor_reg *next = reglist;
-	  while ((reg_addr != 0xffff) | (reg_val != 0xff))
-	  {
-	     reg_addr = next->reg;
-	     reg_val = next->val;
-	    err = wrSensorReg16_8(reg_addr, reg_val);
-	    next++;
-	  }
+	return wrSensorRegsDma(&OV5642_REG_FORMAT, reglist);
+}
+
+// Queues the writes of a table on the I2C controller with DMA, a STOP after
+// each register as SCCB has no auto-increment. The controller sends the
+// START of the next write by itself. Tables are cut after the writes the
+// sensor needs settle time for, and only those sleep.
+int ArduCAM::wrSensorRegsDma(const struct sensor_reg_format* fmt,
+                             const struct sensor_reg reglist[])
+{
+	static uint16_t cmds[SENSOR_REG_DMA_BATCH * 3];
+	i2c_hw_t *hw = i2c_get_hw(I2C_PORT);
+	uint16_t bank = 0;
+	const struct sensor_reg *next = reglist;
+	while ((next->reg != fmt->end_reg) || (next->val != fmt->end_val))
+	{
+		int count = 0;
+		int settle_ms = 0;
+		for (int i = 0; i < SENSOR_REG_DMA_BATCH; i++)
+		{
+			if ((next->reg == fmt->end_reg) && (next->val == fmt->end_val))
+				break;
+			if (fmt->addr_bytes == 2)
+				cmds[count++] = (next->reg >> 8) & 0xff;
+			cmds[count++] = next->reg & 0xff;
+			cmds[count++] = (next->val & 0xff) | I2C_IC_DATA_CMD_STOP_BITS;
+			if (next->reg == fmt->bank_reg)
+				bank = next->val;
+			else
+				settle_ms = sensor_reg_settle_ms(fmt, bank, next->reg,
+				                                 next->val);
+			next++;
+			if (settle_ms > 0)
+				break;
+		}
+		if (i2c_dma_chan < 0)
+		{
+			// Arducam_init() hasn't run; write one register at a time.
+			uint8_t buf[3];
+			for (int i = 0; i < count; i++)
+			{
+				int len = 0;
+				while (!(cmds[i] & I2C_IC_DATA_CMD_STOP_BITS))
+					buf[len++] = cmds[i++];
+				buf[len++] = cmds[i];
+				if (i2c_write_blocking(I2C_PORT, sensor_addr, buf, len,
+				                       false) != len)
+					return 0;
+			}
+		}
+		else
+		{
+			hw->enable = 0;
+			hw->tar = sensor_addr;
+			hw->enable = 1;
+			dma_channel_config c = dma_channel_get_default_config(i2c_dma_chan);
+			channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+			channel_config_set_read_increment(&c, true);
+			channel_config_set_write_increment(&c, false);
+			channel_config_set_dreq(&c, i2c_get_dreq(I2C_PORT, true));
+			dma_channel_configure(i2c_dma_chan, &c, &hw->data_cmd, cmds, count,
+			                      true);
+			// Done once the last STOP is out and the controller is idle.
+			absolute_time_t timeout =
+			    make_timeout_time_ms(SENSOR_REG_DMA_TIMEOUT_MS);
+			while (dma_channel_is_busy(i2c_dma_chan) ||
+			       !(hw->status & I2C_IC_STATUS_TFE_BITS) ||
+			       (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS))
+			{
+				if (time_reached(timeout))
+				{
+					dma_channel_abort(i2c_dma_chan);
+					return 0;
+				}
+				tight_loop_contents();
+			}
+			if (hw->tx_abrt_source)
+			{
+				// A NACK flushed the rest of the batch.
+				(void)hw->clr_tx_abrt;
+				return 0;
+			}
+		}
+		if (settle_ms > 0)
+			sleep_ms(settle_ms);
+	}
 	return 1;
 }
 
@@ -280,7 +396,11 @@ byte ArduCAM::wrSensorReg16_8(int regID, int regDat)
     buf[1]=(regID)&0xff;
     buf[2]=regDat;
     i2c_write_blocking(I2C_PORT, sensor_addr, buf,  3, true );
-		sleep_ms(2);
+    // Only a software reset needs time before the next write.
+    uint16_t settle_ms = sensor_reg_settle_ms(&OV5642_REG_FORMAT, 0, regID,
+                                              regDat);
+    if (settle_ms > 0)
+      sleep_ms(settle_ms);
 	  return 1;
 }
 
@@ -600,43 +720,21 @@ byte ArduCAM::rdSensorReg16_8(uint16_t regID, uint8_t* regDat)
 }
 
 
+// Writes only the registers that differ from the size set last, from the
+// deltas precompiled in ov2640_jpeg_deltas.h.
 void ArduCAM::OV2640_set_JPEG_size(uint8_t size)
 {
-// #if (defined (OV2640_CAM)||defined (OV2640_MINI_2MP)||defined (OV2640_MINI_2MP_PLUS))
-	switch(size)
-	{
-		case OV2640_160x120:
-			wrSensorRegs8_8(OV2640_160x120_JPEG);
-			break;
-		case OV2640_176x144:
-			wrSensorRegs8_8(OV2640_176x144_JPEG);
-			break;
-		case OV2640_320x240:
-			wrSensorRegs8_8(OV2640_320x240_JPEG);
-			break;
-		case OV2640_352x288:
-	  	wrSensorRegs8_8(OV2640_352x288_JPEG);
-			break;
-		case OV2640_640x480:
-			wrSensorRegs8_8(OV2640_640x480_JPEG);
-			break;
-		case OV2640_800x600:
-			wrSensorRegs8_8(OV2640_800x600_JPEG);
-			break;
-		case OV2640_1024x768:
-			wrSensorRegs8_8(OV2640_1024x768_JPEG);
-			break;
-		case OV2640_1280x1024:
-			wrSensorRegs8_8(OV2640_1280x1024_JPEG);
-			break;
-		case OV2640_1600x1200:
-			wrSensorRegs8_8(OV2640_1600x1200_JPEG);
-			break;
-		default:
-			wrSensorRegs8_8(OV2640_320x240_JPEG);
-			break;
-	}
-//#endif
+	if (size > OV2640_1600x1200)
+		size = OV2640_320x240;
+	if (size == jpeg_size)
+		return;
+	const struct sensor_reg* table = OV2640_JPEG_TABLES[size];
+	if (jpeg_size != OV2640_SIZE_UNKNOWN)
+		table = OV2640_JPEG_DELTAS[jpeg_size][size];
+	if (wrSensorRegs8_8(table))
+		jpeg_size = size;
+	else
+		jpeg_size = OV2640_SIZE_UNKNOWN;
 }
 
 
@@ -661,7 +759,9 @@ void on_uart_rx() {
 void ArduCAM:: Arducam_init(void)
 {
     // This example will use I2C0 on GPIO4 (SDA) and GPIO5 (SCL)
-  i2c_init(I2C_PORT, 100 * 1000);
+  i2c_init(I2C_PORT, SENSOR_I2C_BAUDRATE);
+  if (i2c_dma_chan < 0)
+    i2c_dma_chan = dma_claim_unused_channel(true);
   gpio_set_function(PIN_SDA, GPIO_FUNC_I2C);
   gpio_set_function(PIN_SCL, GPIO_FUNC_I2C);
   gpio_pull_up(PIN_SDA);
@@ -673,6 +773,13 @@ void ArduCAM:: Arducam_init(void)
   gpio_set_function(PIN_MISO, GPIO_FUNC_SPI);
   gpio_set_function(PIN_SCK, GPIO_FUNC_SPI);
   gpio_set_function(PIN_MOSI, GPIO_FUNC_SPI);
+#ifdef CAP_DONE_PIN
+  gpio_init(CAP_DONE_PIN);
+  gpio_set_dir(CAP_DONE_PIN, GPIO_IN);
+  gpio_add_raw_irq_handler(CAP_DONE_PIN, &on_cap_done);
+  gpio_set_irq_enabled(CAP_DONE_PIN, GPIO_IRQ_EDGE_RISE, true);
+  irq_set_enabled(IO_IRQ_BANK0, true);
+#endif
 }
 
 
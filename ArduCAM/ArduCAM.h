@@ -4,6 +4,7 @@
 #include "pico/stdlib.h"
 #include "hardware/dma.h"
 #include "hardware/clocks.h"
+#include "sensor_reg_table.h"
 
 
 #define regtype volatile uint8_t
@@ -45,6 +46,7 @@
 #define OV2640_1024x768		6	//1024x768
 #define OV2640_1280x1024	7	//1280x1024
 #define OV2640_1600x1200	8	//1600x1200
+#define OV2640_SIZE_UNKNOWN	0xff
 
 
 
@@ -341,6 +343,19 @@
 #define PIN_SDA  8
 #define PIN_SCL  9
 #define WRITE_BIT 0x80
+// The OV2640 and OV5642 specify their SCCB bus up to 400 kHz. Boards whose
+// sensor keeps up may set 1 MHz (fast mode plus).
+#ifndef SENSOR_I2C_BAUDRATE
+#define SENSOR_I2C_BAUDRATE (400 * 1000)
+#endif
+// Register writes queued on the I2C controller per DMA transfer.
+#define SENSOR_REG_DMA_BATCH 64
+#define SENSOR_REG_DMA_TIMEOUT_MS 100
+
+/*capture done*/
+// Boards that wire a GPIO to the capture done signal define
+// CAP_DONE_PIN; capture_done() then checks a flag set by its rising edge
+// instead of reading CAP_DONE over SPI.
 
 #define UART_ID uart0
 #define BAUD_RATE 921600
@@ -359,16 +374,6 @@
 extern unsigned char usart_symbol;
 extern unsigned char usart_Command;
 
-/****************************************************************/
-/* define a structure for sensor register initialization values */
-/****************************************************************/
-struct sensor_reg {
-	uint16_t reg;
-	uint16_t val;
-};
-
-
-
 /****************************************************************/
 /* define a structure for sensor register initialization values */
 /****************************************************************/
@@ -386,6 +391,7 @@ class ArduCAM
 	void flush_fifo(void);
 	void start_capture(void);
 	void clear_fifo_flag(void);
+	bool capture_done(void);
 	uint8_t read_fifo(void);
 	
 	uint8_t read_reg(uint8_t addr);
@@ -402,6 +408,11 @@ class ArduCAM
   uint8_t bus_write(int address, int value);
 	uint8_t bus_read(int address);	
  
+	// Write a register table through DMA, sleeping only where the sensor
+	// needs settle time
+	int wrSensorRegsDma(const struct sensor_reg_format* fmt,
+	                    const struct sensor_reg* reglist);
+
 	// Write 8 bit values to 8 bit register address
 	int wrSensorRegs8_8(const struct sensor_reg*);
 	
@@ -496,6 +507,8 @@ class ArduCAM
 	byte m_fmt;
 	byte sensor_model;
 	byte sensor_addr;
+	byte jpeg_size;
+	int i2c_dma_chan;
 };
 
 #if defined OV7660_CAM	
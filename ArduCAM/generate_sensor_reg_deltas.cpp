@@ -0,0 +1,100 @@
+// Host tool that precompiles the OV2640 resolution switches. For every pair
+// of OV2640_*_JPEG tables in ov2640_regs.h it writes the delta that
+// sensor_regs_delta() computes into ov2640_jpeg_deltas.h, so that
+// ArduCAM::OV2640_set_JPEG_size() only writes the registers that change.
+//
+// The tool is not part of the firmware build. Build and run it on the host
+// whenever the tables in ov2640_regs.h change:
+//
+//   g++ -std=c++17 -O2 -IArduCAM ArduCAM/generate_sensor_reg_deltas.cpp
+//     ArduCAM/sensor_reg_table.cpp -o generate_sensor_reg_deltas
+//   ./generate_sensor_reg_deltas > ArduCAM/ov2640_jpeg_deltas.h
+
+#include <stdio.h>
+
+#include "ov2640_regs.h"
+#include "sensor_reg_table.h"
+
+namespace {
+
+struct jpeg_size {
+	const char* name;
+	const struct sensor_reg* table;
+};
+
+// In the order of the OV2640_160x120 ... OV2640_1600x1200 sizes.
+const jpeg_size kSizes[] = {
+	{ "160x120", OV2640_160x120_JPEG },
+	{ "176x144", OV2640_176x144_JPEG },
+	{ "320x240", OV2640_320x240_JPEG },
+	{ "352x288", OV2640_352x288_JPEG },
+	{ "640x480", OV2640_640x480_JPEG },
+	{ "800x600", OV2640_800x600_JPEG },
+	{ "1024x768", OV2640_1024x768_JPEG },
+	{ "1280x1024", OV2640_1280x1024_JPEG },
+	{ "1600x1200", OV2640_1600x1200_JPEG },
+};
+const int kSizeCount = sizeof(kSizes) / sizeof(kSizes[0]);
+const int kMaxDeltaLength = 256;
+
+}  // namespace
+
+int main() {
+	printf("#ifndef OV2640_JPEG_DELTAS_H\n");
+	printf("#define OV2640_JPEG_DELTAS_H\n");
+	printf("// Generated by generate_sensor_reg_deltas.cpp from ov2640_regs.h."
+	       " Don't edit.\n");
+	printf("//\n");
+	printf("// OV2640_JPEG_DELTAS[from][to] switches the sensor from the "
+	       "OV2640_<from>_JPEG\n");
+	printf("// table to the OV2640_<to>_JPEG table, with sizes as in "
+	       "OV2640_set_JPEG_size().\n");
+	printf("#include \"sensor_reg_table.h\"\n");
+
+	int total = 0;
+	for (int from = 0; from < kSizeCount; from++) {
+		for (int to = 0; to < kSizeCount; to++) {
+			if (from == to) {
+				continue;
+			}
+			struct sensor_reg delta[kMaxDeltaLength];
+			int length = sensor_regs_delta(&OV2640_REG_FORMAT,
+			                               kSizes[from].table, kSizes[to].table,
+			                               delta, kMaxDeltaLength);
+			if (length < 0) {
+				fprintf(stderr, "delta from %s to %s is too long\n",
+				        kSizes[from].name, kSizes[to].name);
+				return 1;
+			}
+			total += length;
+			printf("\nconst struct sensor_reg OV2640_JPEG_DELTA_%s_TO_%s[] =\n",
+			       kSizes[from].name, kSizes[to].name);
+			printf("{\n");
+			for (int i = 0; i < length; i++) {
+				printf("\t{0x%02x, 0x%02x},\n", delta[i].reg, delta[i].val);
+			}
+			printf("};\n");
+		}
+	}
+
+	printf("\nconst struct sensor_reg* const OV2640_JPEG_DELTAS[%d][%d] =\n{\n",
+	       kSizeCount, kSizeCount);
+	for (int from = 0; from < kSizeCount; from++) {
+		printf("\t{\n");
+		for (int to = 0; to < kSizeCount; to++) {
+			if (from == to) {
+				printf("\t\tNULL,\n");
+			} else {
+				printf("\t\tOV2640_JPEG_DELTA_%s_TO_%s,\n", kSizes[from].name,
+				       kSizes[to].name);
+			}
+		}
+		printf("\t},\n");
+	}
+	printf("};\n");
+	printf("\n#endif\n");
+
+	fprintf(stderr, "%d delta entries for %d switches\n", total,
+	        kSizeCount * (kSizeCount - 1));
+	return 0;
+}
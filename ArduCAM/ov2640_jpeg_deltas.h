@@ -0,0 +1,2132 @@
+#ifndef OV2640_JPEG_DELTAS_H
+#define OV2640_JPEG_DELTAS_H
+// Generated by generate_sensor_reg_deltas.cpp from ov2640_regs.h. Don't edit.
+//
+// OV2640_JPEG_DELTAS[from][to] switches the sensor from the OV2640_<from>_JPEG
+// table to the OV2640_<to>_JPEG table, with sizes as in OV2640_set_JPEG_size().
+#include "sensor_reg_table.h"
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_176x144[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_320x240[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_352x288[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x89},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x50, 0x89},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x8c, 0x00},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_160x120_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_160x120[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_320x240[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_352x288[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x89},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x50, 0x89},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x8c, 0x00},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_176x144_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_160x120[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x92},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_176x144[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x92},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_352x288[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x8c, 0x00},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_320x240_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_160x120[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x92},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_176x144[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x92},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_320x240[] =
+{
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x8c, 0x00},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_352x288_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0x12, 0x00},
+	{0x17, 0x11},
+	{0x18, 0x75},
+	{0x32, 0x36},
+	{0x19, 0x01},
+	{0x1a, 0x97},
+	{0x03, 0x0f},
+	{0x37, 0x40},
+	{0x4f, 0xbb},
+	{0x50, 0x9c},
+	{0x5a, 0x57},
+	{0x6d, 0x80},
+	{0x3d, 0x34},
+	{0x39, 0x02},
+	{0x35, 0x88},
+	{0x22, 0x0a},
+	{0x34, 0xa0},
+	{0x06, 0x02},
+	{0x0d, 0xb7},
+	{0x0e, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0xc8},
+	{0xc1, 0x96},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x51, 0x90},
+	{0x52, 0x2c},
+	{0x55, 0x88},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_160x120[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_176x144[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_320x240[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_352x288[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x35},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0x8c, 0x00},
+	{0x50, 0x00},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x00},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_640x480_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x00},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xd3, 0x02},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_160x120[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_176x144[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_320x240[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_352x288[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x3d},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0x8c, 0x00},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_800x600_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x3d},
+	{0x50, 0x00},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_160x120[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x57, 0x00},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_176x144[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x57, 0x00},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_320x240[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x57, 0x00},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_352x288[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x57, 0x00},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x57, 0x00},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0x5c, 0x00},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x57, 0x00},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x57, 0x00},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1024x768_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x57, 0x00},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_160x120[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_176x144[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_320x240[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_352x288[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0x5c, 0x00},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0x8c, 0x00},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1280x1024_TO_1600x1200[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x5a, 0x90},
+	{0x5b, 0x2c},
+	{0x5c, 0x05},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_160x120[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x28},
+	{0x5b, 0x1e},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_176x144[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x92},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x2c},
+	{0x5b, 0x24},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_320x240[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x50},
+	{0x5b, 0x3c},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_352x288[] =
+{
+	{0xff, 0x01},
+	{0x12, 0x40},
+	{0x17, 0x11},
+	{0x18, 0x43},
+	{0x19, 0x00},
+	{0x1a, 0x4b},
+	{0x32, 0x09},
+	{0x4f, 0xca},
+	{0x50, 0xa8},
+	{0x5a, 0x23},
+	{0x6d, 0x00},
+	{0x39, 0x12},
+	{0x35, 0xda},
+	{0x22, 0x1a},
+	{0x37, 0xc3},
+	{0x23, 0x00},
+	{0x34, 0xc0},
+	{0x36, 0x1a},
+	{0x06, 0x88},
+	{0x07, 0xc0},
+	{0x0d, 0x87},
+	{0x0e, 0x41},
+	{0x4c, 0x00},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0xc0, 0x64},
+	{0xc1, 0x4b},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x51, 0xc8},
+	{0x52, 0x96},
+	{0x55, 0x00},
+	{0x5a, 0x58},
+	{0x5b, 0x48},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_640x480[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x50, 0x89},
+	{0x5a, 0xa0},
+	{0x5b, 0x78},
+	{0x5c, 0x00},
+	{0xd3, 0x04},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_800x600[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x86, 0x35},
+	{0x50, 0x89},
+	{0x5a, 0xc8},
+	{0x5b, 0x96},
+	{0x5c, 0x00},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_1024x768[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0x8c, 0x00},
+	{0x5a, 0x00},
+	{0x5b, 0xc0},
+	{0x5c, 0x01},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg OV2640_JPEG_DELTA_1600x1200_TO_1280x1024[] =
+{
+	{0xff, 0x01},
+	{0x11, 0x01},
+	{0xff, 0x00},
+	{0xe0, 0x04},
+	{0x5a, 0x40},
+	{0x5b, 0xf0},
+	{0x5c, 0x01},
+	{0xe0, 0x00},
+	{0xff, 0xff},
+};
+
+const struct sensor_reg* const OV2640_JPEG_DELTAS[9][9] =
+{
+	{
+		NULL,
+		OV2640_JPEG_DELTA_160x120_TO_176x144,
+		OV2640_JPEG_DELTA_160x120_TO_320x240,
+		OV2640_JPEG_DELTA_160x120_TO_352x288,
+		OV2640_JPEG_DELTA_160x120_TO_640x480,
+		OV2640_JPEG_DELTA_160x120_TO_800x600,
+		OV2640_JPEG_DELTA_160x120_TO_1024x768,
+		OV2640_JPEG_DELTA_160x120_TO_1280x1024,
+		OV2640_JPEG_DELTA_160x120_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_176x144_TO_160x120,
+		NULL,
+		OV2640_JPEG_DELTA_176x144_TO_320x240,
+		OV2640_JPEG_DELTA_176x144_TO_352x288,
+		OV2640_JPEG_DELTA_176x144_TO_640x480,
+		OV2640_JPEG_DELTA_176x144_TO_800x600,
+		OV2640_JPEG_DELTA_176x144_TO_1024x768,
+		OV2640_JPEG_DELTA_176x144_TO_1280x1024,
+		OV2640_JPEG_DELTA_176x144_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_320x240_TO_160x120,
+		OV2640_JPEG_DELTA_320x240_TO_176x144,
+		NULL,
+		OV2640_JPEG_DELTA_320x240_TO_352x288,
+		OV2640_JPEG_DELTA_320x240_TO_640x480,
+		OV2640_JPEG_DELTA_320x240_TO_800x600,
+		OV2640_JPEG_DELTA_320x240_TO_1024x768,
+		OV2640_JPEG_DELTA_320x240_TO_1280x1024,
+		OV2640_JPEG_DELTA_320x240_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_352x288_TO_160x120,
+		OV2640_JPEG_DELTA_352x288_TO_176x144,
+		OV2640_JPEG_DELTA_352x288_TO_320x240,
+		NULL,
+		OV2640_JPEG_DELTA_352x288_TO_640x480,
+		OV2640_JPEG_DELTA_352x288_TO_800x600,
+		OV2640_JPEG_DELTA_352x288_TO_1024x768,
+		OV2640_JPEG_DELTA_352x288_TO_1280x1024,
+		OV2640_JPEG_DELTA_352x288_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_640x480_TO_160x120,
+		OV2640_JPEG_DELTA_640x480_TO_176x144,
+		OV2640_JPEG_DELTA_640x480_TO_320x240,
+		OV2640_JPEG_DELTA_640x480_TO_352x288,
+		NULL,
+		OV2640_JPEG_DELTA_640x480_TO_800x600,
+		OV2640_JPEG_DELTA_640x480_TO_1024x768,
+		OV2640_JPEG_DELTA_640x480_TO_1280x1024,
+		OV2640_JPEG_DELTA_640x480_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_800x600_TO_160x120,
+		OV2640_JPEG_DELTA_800x600_TO_176x144,
+		OV2640_JPEG_DELTA_800x600_TO_320x240,
+		OV2640_JPEG_DELTA_800x600_TO_352x288,
+		OV2640_JPEG_DELTA_800x600_TO_640x480,
+		NULL,
+		OV2640_JPEG_DELTA_800x600_TO_1024x768,
+		OV2640_JPEG_DELTA_800x600_TO_1280x1024,
+		OV2640_JPEG_DELTA_800x600_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_1024x768_TO_160x120,
+		OV2640_JPEG_DELTA_1024x768_TO_176x144,
+		OV2640_JPEG_DELTA_1024x768_TO_320x240,
+		OV2640_JPEG_DELTA_1024x768_TO_352x288,
+		OV2640_JPEG_DELTA_1024x768_TO_640x480,
+		OV2640_JPEG_DELTA_1024x768_TO_800x600,
+		NULL,
+		OV2640_JPEG_DELTA_1024x768_TO_1280x1024,
+		OV2640_JPEG_DELTA_1024x768_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_1280x1024_TO_160x120,
+		OV2640_JPEG_DELTA_1280x1024_TO_176x144,
+		OV2640_JPEG_DELTA_1280x1024_TO_320x240,
+		OV2640_JPEG_DELTA_1280x1024_TO_352x288,
+		OV2640_JPEG_DELTA_1280x1024_TO_640x480,
+		OV2640_JPEG_DELTA_1280x1024_TO_800x600,
+		OV2640_JPEG_DELTA_1280x1024_TO_1024x768,
+		NULL,
+		OV2640_JPEG_DELTA_1280x1024_TO_1600x1200,
+	},
+	{
+		OV2640_JPEG_DELTA_1600x1200_TO_160x120,
+		OV2640_JPEG_DELTA_1600x1200_TO_176x144,
+		OV2640_JPEG_DELTA_1600x1200_TO_320x240,
+		OV2640_JPEG_DELTA_1600x1200_TO_352x288,
+		OV2640_JPEG_DELTA_1600x1200_TO_640x480,
+		OV2640_JPEG_DELTA_1600x1200_TO_800x600,
+		OV2640_JPEG_DELTA_1600x1200_TO_1024x768,
+		OV2640_JPEG_DELTA_1600x1200_TO_1280x1024,
+		NULL,
+	},
+};
+
+#endif
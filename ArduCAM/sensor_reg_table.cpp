@@ -0,0 +1,210 @@
+#include "sensor_reg_table.h"
+
+// COM7 of bank 1 selects the resolution (bits 6:4) and resets the sensor
+// (bit 7). InitCAM() has always waited 100 ms after the reset.
+static const struct sensor_reg_rule OV2640_REG_RULES[] = {
+	{ 0x01, 0x12, 0x70, 0x80, 100 },
+};
+
+// SYSTEM CTROL0 resets the sensor (bit 7); the OV5642 tables start with it.
+static const struct sensor_reg_rule OV5642_REG_RULES[] = {
+	{ 0x00, 0x3008, 0x00, 0x80, 5 },
+};
+
+const struct sensor_reg_format OV2640_REG_FORMAT = {
+	1, 0xff, 0xff, 0xff, OV2640_REG_RULES,
+	sizeof(OV2640_REG_RULES) / sizeof(OV2640_REG_RULES[0]),
+};
+
+const struct sensor_reg_format OV5642_REG_FORMAT = {
+	2, 0xffff, 0xff, SENSOR_REG_NO_BANK, OV5642_REG_RULES,
+	sizeof(OV5642_REG_RULES) / sizeof(OV5642_REG_RULES[0]),
+};
+
+namespace {
+
+const uint16_t kUnknownBank = 0xffff;
+const int kMaxTrackedRegs = 256;
+
+// The register values known to be in the sensor.
+class sensor_reg_state {
+ public:
+	sensor_reg_state() : count_(0) {}
+
+	bool get(uint16_t bank, uint16_t reg, uint16_t* val) const {
+		for (int i = 0; i < count_; i++) {
+			if (regs_[i].bank == bank && regs_[i].reg == reg) {
+				*val = regs_[i].val;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool set(uint16_t bank, uint16_t reg, uint16_t val) {
+		for (int i = 0; i < count_; i++) {
+			if (regs_[i].bank == bank && regs_[i].reg == reg) {
+				regs_[i].val = val;
+				return true;
+			}
+		}
+		if (count_ == kMaxTrackedRegs) {
+			return false;
+		}
+		regs_[count_].bank = bank;
+		regs_[count_].reg = reg;
+		regs_[count_].val = val;
+		count_++;
+		return true;
+	}
+
+	void forget_bank(uint16_t bank) {
+		int kept = 0;
+		for (int i = 0; i < count_; i++) {
+			if (regs_[i].bank != bank) {
+				regs_[kept++] = regs_[i];
+			}
+		}
+		count_ = kept;
+	}
+
+	void forget_all() { count_ = 0; }
+
+ private:
+	struct tracked_reg {
+		uint16_t bank;
+		uint16_t reg;
+		uint16_t val;
+	};
+	tracked_reg regs_[kMaxTrackedRegs];
+	int count_;
+};
+
+bool is_end(const struct sensor_reg_format* fmt, const struct sensor_reg* r) {
+	return r->reg == fmt->end_reg && r->val == fmt->end_val;
+}
+
+bool is_bank_select(const struct sensor_reg_format* fmt,
+                    const struct sensor_reg* r) {
+	return fmt->bank_reg != SENSOR_REG_NO_BANK && r->reg == fmt->bank_reg;
+}
+
+const struct sensor_reg_rule* find_rule(const struct sensor_reg_format* fmt,
+                                        uint16_t bank, uint16_t reg) {
+	for (size_t i = 0; i < fmt->rule_count; i++) {
+		if (fmt->rules[i].bank == bank && fmt->rules[i].reg == reg) {
+			return &fmt->rules[i];
+		}
+	}
+	return NULL;
+}
+
+// Records a write in state, with the side effects of the register. A write
+// to an unknown bank makes nothing known.
+bool apply_write(const struct sensor_reg_format* fmt, sensor_reg_state* state,
+                 uint16_t bank, uint16_t reg, uint16_t val) {
+	if (bank == kUnknownBank) {
+		return true;
+	}
+	const struct sensor_reg_rule* rule = find_rule(fmt, bank, reg);
+	if (rule != NULL) {
+		uint16_t old_val;
+		if ((val & rule->reset_mask) != 0) {
+			state->forget_all();
+			return true;
+		}
+		if (rule->mode_mask != 0 &&
+		    (!state->get(bank, reg, &old_val) ||
+		     ((old_val ^ val) & rule->mode_mask) != 0)) {
+			state->forget_bank(bank);
+		}
+	}
+	return state->set(bank, reg, val);
+}
+
+bool append(struct sensor_reg* out, int out_size, int* count, uint16_t reg,
+            uint16_t val) {
+	if (*count == out_size) {
+		return false;
+	}
+	out[*count].reg = reg;
+	out[*count].val = val;
+	(*count)++;
+	return true;
+}
+
+}  // namespace
+
+int sensor_regs_length(const struct sensor_reg_format* fmt,
+                       const struct sensor_reg* table) {
+	int length = 0;
+	while (!is_end(fmt, &table[length])) {
+		length++;
+	}
+	return length;
+}
+
+uint16_t sensor_reg_settle_ms(const struct sensor_reg_format* fmt,
+                              uint16_t bank, uint16_t reg, uint16_t val) {
+	const struct sensor_reg_rule* rule = find_rule(fmt, bank, reg);
+	if (rule == NULL || (val & rule->reset_mask) == 0) {
+		return 0;
+	}
+	return rule->settle_ms;
+}
+
+int sensor_regs_delta(const struct sensor_reg_format* fmt,
+                      const struct sensor_reg* from,
+                      const struct sensor_reg* to,
+                      struct sensor_reg* out, int out_size) {
+	const bool banked = fmt->bank_reg != SENSOR_REG_NO_BANK;
+	sensor_reg_state state;
+
+	uint16_t bank = banked ? kUnknownBank : 0;
+	for (const struct sensor_reg* r = from; r != NULL && !is_end(fmt, r); r++) {
+		if (is_bank_select(fmt, r)) {
+			bank = r->val;
+		} else if (!apply_write(fmt, &state, bank, r->reg, r->val)) {
+			return -1;
+		}
+	}
+
+	int count = 0;
+	uint16_t out_bank = kUnknownBank;
+	bank = banked ? kUnknownBank : 0;
+	for (const struct sensor_reg* r = to; !is_end(fmt, r); r++) {
+		if (is_bank_select(fmt, r)) {
+			bank = r->val;
+			continue;
+		}
+		uint16_t val;
+		bool needed = bank == kUnknownBank ||
+		              !state.get(bank, r->reg, &val) || val != r->val ||
+		              sensor_reg_settle_ms(fmt, bank, r->reg, r->val) != 0;
+		if (!apply_write(fmt, &state, bank, r->reg, r->val)) {
+			return -1;
+		}
+		if (!needed) {
+			continue;
+		}
+		if (banked && bank != kUnknownBank && bank != out_bank) {
+			if (!append(out, out_size, &count, fmt->bank_reg, bank)) {
+				return -1;
+			}
+			out_bank = bank;
+		}
+		if (!append(out, out_size, &count, r->reg, r->val)) {
+			return -1;
+		}
+	}
+	// Leave the bank selected that the whole table would have left selected.
+	if (banked && bank != kUnknownBank && bank != out_bank) {
+		if (!append(out, out_size, &count, fmt->bank_reg, bank)) {
+			return -1;
+		}
+	}
+	if (!append(out, out_size, &count, fmt->end_reg, fmt->end_val)) {
+		return -1;
+	}
+	return count;
+}
@@ -0,0 +1,71 @@
+#ifndef SENSOR_REG_TABLE_H
+#define SENSOR_REG_TABLE_H
+#include <stddef.h>
+#include <stdint.h>
+
+// Register tables and the logic that works on them without touching the bus,
+// so that it builds and is tested on the host. ArduCAM.cpp writes the tables;
+// generate_sensor_reg_deltas.cpp uses sensor_regs_delta() to precompile the
+// resolution switch tables.
+
+/****************************************************************/
+/* define a structure for sensor register initialization values */
+/****************************************************************/
+struct sensor_reg {
+	uint16_t reg;
+	uint16_t val;
+};
+
+#define SENSOR_REG_NO_BANK 0xffff
+
+// A register with side effects on other registers.
+//
+// Writing a value whose mode_mask bits differ from the current ones (or are
+// unknown) puts the other registers of the bank back to their defaults, as
+// COM7 does on the OV2640 when the resolution changes. Writing a value with
+// any of the reset_mask bits set resets every register, and the sensor needs
+// settle_ms before the next write.
+struct sensor_reg_rule {
+	uint16_t bank;
+	uint16_t reg;
+	uint8_t mode_mask;
+	uint8_t reset_mask;
+	uint16_t settle_ms;
+};
+
+// The layout of the register tables of one sensor.
+struct sensor_reg_format {
+	uint8_t addr_bytes;  // 1 or 2; values are always one byte
+	uint16_t end_reg;    // the {end_reg, end_val} entry terminates a table
+	uint16_t end_val;
+	uint16_t bank_reg;   // selects the bank; SENSOR_REG_NO_BANK if none
+	const struct sensor_reg_rule* rules;
+	size_t rule_count;
+};
+
+extern const struct sensor_reg_format OV2640_REG_FORMAT;
+extern const struct sensor_reg_format OV5642_REG_FORMAT;
+
+// Number of entries in the table, without the terminator.
+int sensor_regs_length(const struct sensor_reg_format* fmt,
+                       const struct sensor_reg* table);
+
+// Milliseconds the sensor needs after val is written to reg of bank.
+uint16_t sensor_reg_settle_ms(const struct sensor_reg_format* fmt,
+                              uint16_t bank, uint16_t reg, uint16_t val);
+
+// Writes to out the entries that take a sensor from the state the table from
+// left it in to the state the table to would leave it in. Writes that would
+// not change a register are dropped, and the bank select is only written
+// where the bank changes, starting with one select so that the delta doesn't
+// depend on the bank other code left selected. from may be NULL when the
+// state is unknown, which only drops the writes to repeats within to.
+//
+// Returns the number of entries in out, including the terminator, or -1 if
+// out_size entries aren't enough.
+int sensor_regs_delta(const struct sensor_reg_format* fmt,
+                      const struct sensor_reg* from,
+                      const struct sensor_reg* to,
+                      struct sensor_reg* out, int out_size);
+
+#endif
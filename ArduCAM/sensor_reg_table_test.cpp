@@ -0,0 +1,200 @@
+#include "sensor_reg_table.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "ov2640_jpeg_deltas.h"
+#include "ov2640_regs.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr int kMaxDeltaLength = 256;
+// What a register reads after a reset, unlike any value a table writes.
+constexpr uint16_t kDefault = 0x100;
+
+const struct sensor_reg* const kJpegTables[] = {
+    OV2640_160x120_JPEG,  OV2640_176x144_JPEG,   OV2640_320x240_JPEG,
+    OV2640_352x288_JPEG,  OV2640_640x480_JPEG,   OV2640_800x600_JPEG,
+    OV2640_1024x768_JPEG, OV2640_1280x1024_JPEG, OV2640_1600x1200_JPEG,
+};
+constexpr int kJpegTableCount = sizeof(kJpegTables) / sizeof(kJpegTables[0]);
+
+// The rest of InitCAM() for JPEG, and a light mode that leaves bank 0
+// selected, as other code may between two size switches.
+const struct sensor_reg kInitTail[] = {
+    {0xff, 0x01}, {0x15, 0x00}, {0xff, 0xff}};
+const struct sensor_reg kLightMode[] = {
+    {0xff, 0x00}, {0xc7, 0x40}, {0xcc, 0x5e}, {0xff, 0xff}};
+
+// An OV2640 as far as register writes go: COM7 puts bank 1 back to defaults
+// when the resolution changes, and its reset bit resets both banks.
+struct SimulatedOv2640 {
+  uint16_t regs[2][256];
+  uint16_t bank;
+
+  void Reset() {
+    for (int b = 0; b < 2; ++b) {
+      for (int r = 0; r < 256; ++r) {
+        regs[b][r] = kDefault;
+      }
+    }
+    bank = 0;
+  }
+
+  void Write(const struct sensor_reg* table) {
+    for (; table->reg != 0xff || table->val != 0xff; ++table) {
+      if (table->reg == 0xff) {
+        bank = table->val;
+        continue;
+      }
+      if (bank == 1 && table->reg == 0x12) {
+        if (table->val & 0x80) {
+          Reset();
+          continue;
+        }
+        if ((regs[1][0x12] ^ table->val) & 0x70) {
+          const uint16_t com7 = regs[1][0x12];
+          for (int r = 0; r < 256; ++r) {
+            regs[1][r] = kDefault;
+          }
+          regs[1][0x12] = com7;
+        }
+      }
+      regs[bank][table->reg] = table->val;
+    }
+  }
+
+  bool Equals(const SimulatedOv2640& other) const {
+    return bank == other.bank &&
+           std::memcmp(regs, other.regs, sizeof(regs)) == 0;
+  }
+};
+
+SimulatedOv2640 g_full;
+SimulatedOv2640 g_delta;
+
+void InitJpeg(SimulatedOv2640* sensor) {
+  sensor->Reset();
+  sensor->Write(OV2640_JPEG_INIT);
+  sensor->Write(OV2640_YUV422);
+  sensor->Write(OV2640_JPEG);
+  sensor->Write(kInitTail);
+}
+
+bool SameTables(const struct sensor_reg* a, const struct sensor_reg* b,
+                int length) {
+  for (int i = 0; i < length; ++i) {
+    if (a[i].reg != b[i].reg || a[i].val != b[i].val) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestDeltaMatchesFullTableForEverySizeSwitch) {
+  struct sensor_reg delta[kMaxDeltaLength];
+  for (int from = 0; from < kJpegTableCount; ++from) {
+    for (int to = 0; to < kJpegTableCount; ++to) {
+      if (from == to) {
+        continue;
+      }
+      const int length =
+          sensor_regs_delta(&OV2640_REG_FORMAT, kJpegTables[from],
+                            kJpegTables[to], delta, kMaxDeltaLength);
+      TF_LITE_MICRO_EXPECT_GT(length, 0);
+      TF_LITE_MICRO_EXPECT_LE(
+          length, sensor_regs_length(&OV2640_REG_FORMAT, kJpegTables[to]));
+
+      InitJpeg(&g_full);
+      g_full.Write(kJpegTables[from]);
+      g_full.Write(kLightMode);
+      g_delta = g_full;
+      g_full.Write(kJpegTables[to]);
+      g_delta.Write(delta);
+      TF_LITE_MICRO_EXPECT_TRUE(g_full.Equals(g_delta));
+
+      // ov2640_jpeg_deltas.h is current.
+      TF_LITE_MICRO_EXPECT_EQ(
+          length - 1,
+          sensor_regs_length(&OV2640_REG_FORMAT, OV2640_JPEG_DELTAS[from][to]));
+      TF_LITE_MICRO_EXPECT_TRUE(
+          SameTables(delta, OV2640_JPEG_DELTAS[from][to], length));
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(TestDeltaBetweenCifSizesOnlyRewritesTheDsp) {
+  struct sensor_reg delta[kMaxDeltaLength];
+  const int length =
+      sensor_regs_delta(&OV2640_REG_FORMAT, OV2640_160x120_JPEG,
+                        OV2640_176x144_JPEG, delta, kMaxDeltaLength);
+  // Bank select, DSP reset, zoom output size, DSP release, terminator.
+  TF_LITE_MICRO_EXPECT_EQ(6, length);
+  for (int i = 0; i < length - 1; ++i) {
+    TF_LITE_MICRO_EXPECT_FALSE(delta[i].reg == 0xff && delta[i].val == 0x01);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestUnknownStateDropsOnlyRepeats) {
+  struct sensor_reg delta[kMaxDeltaLength];
+  // OV2640_640x480_JPEG writes 0x37 = 0x40 twice.
+  const int length = sensor_regs_delta(&OV2640_REG_FORMAT, nullptr,
+                                       OV2640_640x480_JPEG, delta,
+                                       kMaxDeltaLength);
+  TF_LITE_MICRO_EXPECT_EQ(
+      sensor_regs_length(&OV2640_REG_FORMAT, OV2640_640x480_JPEG), length);
+
+  InitJpeg(&g_full);
+  g_full.Write(OV2640_1600x1200_JPEG);
+  g_delta = g_full;
+  g_full.Write(OV2640_640x480_JPEG);
+  g_delta.Write(delta);
+  TF_LITE_MICRO_EXPECT_TRUE(g_full.Equals(g_delta));
+}
+
+TF_LITE_MICRO_TEST(TestResetIsKeptAndSettles) {
+  const struct sensor_reg reset[] = {{0xff, 0x01}, {0x12, 0x80}, {0xff, 0xff}};
+  struct sensor_reg delta[kMaxDeltaLength];
+  const int length = sensor_regs_delta(&OV2640_REG_FORMAT, reset, reset,
+                                       delta, kMaxDeltaLength);
+  TF_LITE_MICRO_EXPECT_EQ(3, length);
+  TF_LITE_MICRO_EXPECT_EQ(0x12, delta[1].reg);
+
+  TF_LITE_MICRO_EXPECT_EQ(100,
+                          sensor_reg_settle_ms(&OV2640_REG_FORMAT, 1, 0x12,
+                                               0x80));
+  TF_LITE_MICRO_EXPECT_EQ(0, sensor_reg_settle_ms(&OV2640_REG_FORMAT, 1, 0x12,
+                                                  0x40));
+  TF_LITE_MICRO_EXPECT_EQ(0, sensor_reg_settle_ms(&OV2640_REG_FORMAT, 0, 0x12,
+                                                  0x80));
+  TF_LITE_MICRO_EXPECT_EQ(5, sensor_reg_settle_ms(&OV5642_REG_FORMAT, 0,
+                                                  0x3008, 0x82));
+}
+
+TF_LITE_MICRO_TEST(TestDeltaOfUnbankedSixteenBitTables) {
+  const struct sensor_reg from[] = {
+      {0x3008, 0x82}, {0x3800, 0x01}, {0x3801, 0xb0}, {0xffff, 0xff}};
+  const struct sensor_reg to[] = {
+      {0x3800, 0x01}, {0x3801, 0x50}, {0x3804, 0x05}, {0xffff, 0xff}};
+  struct sensor_reg delta[kMaxDeltaLength];
+  const int length = sensor_regs_delta(&OV5642_REG_FORMAT, from, to, delta,
+                                       kMaxDeltaLength);
+  TF_LITE_MICRO_EXPECT_EQ(3, length);
+  TF_LITE_MICRO_EXPECT_EQ(0x3801, delta[0].reg);
+  TF_LITE_MICRO_EXPECT_EQ(0x3804, delta[1].reg);
+  TF_LITE_MICRO_EXPECT_EQ(0xffff, delta[2].reg);
+}
+
+TF_LITE_MICRO_TEST(TestDeltaFailsWhenOutputIsTooSmall) {
+  struct sensor_reg delta[4];
+  TF_LITE_MICRO_EXPECT_EQ(
+      -1, sensor_regs_delta(&OV2640_REG_FORMAT, OV2640_160x120_JPEG,
+                            OV2640_1600x1200_JPEG, delta, 4));
+}
+
+TF_LITE_MICRO_TESTS_END
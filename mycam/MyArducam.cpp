@@ -20,14 +20,18 @@
 
 #include "XBee.h"
 #include "XBeePico.h"
+#include "frame_ring.h"
+#include "xfer.h"
 
 //#include "detection_responder.h"
 //#include "image_provider.h"
 #include "model_settings.h"
 #include "person_detect_model_data.h"
+#include "tensorflow/lite/micro/arena_snapshot.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/rp2/flash_arena_snapshot.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
 
@@ -38,21 +42,14 @@
 
 #define LED_PIN 25
 
+// The write commands and their acks are in xfer.h.
 #define CMD_HELLO 0x01
-#define CMD_WRITE_REQUEST 0x02
-#define CMD_WRITE_DATA 0x03
-#define CMD_WRITE_DONE 0x04
 
 #define CMD_CONFIG 0x11
 #define CMD_RECV_STAT 0x12
-#define CMD_WRITE_REQUEST_ACK 0x13
-#define CMD_WRITE_DATA_ACK 0x14
-#define CMD_WRITE_DONE_ACK 0x15
 #define CMD_WRITE_RESEND 0x16
 #define CMD_ARDUCAM_CMD 0x17
 
-#define DATA_SIZE 80
-
 namespace {
     tflite::ErrorReporter    *error_reporter = nullptr;
     const tflite::Model      *model          = nullptr;
@@ -61,106 +58,22 @@ namespace {
 
     constexpr int  kTensorArenaSize = 54 * 1024 + 27 * 1024;
     static uint8_t tensor_arena[kTensorArenaSize];
-}  // namespace
-
-
-// manage state controll for send request
-enum send_stat {
-  ST_INIT,
-  ST_SEND,
-  ST_RECD,
-  ST_RSND,
-};
-
-// store transmit request params.
-struct xmit_status {
-  uint32_t time;
-  uint32_t seq;
-  uint8_t * dat;
-  send_stat stat = ST_INIT;
-  uint8_t fid;
-  uint8_t rid;
-  size_t len;
-  uint8_t count;
-  alarm_id_t alarm_id;
-};
-typedef struct xmit_status xmit_status_t;
 
-#define BUFF_SIZE 24
-static xmit_status_t stats[BUFF_SIZE];
-static uint8_t req_id = 7; // request id
-static bool req_done = false; // request status
+    // The last 64 KB of flash keep a snapshot of the prepared tensor arena
+    // (about 30 KB for the person model), so that boots after the first one
+    // skip AllocateTensors(). The firmware must stay clear of them.
+    constexpr uint32_t kArenaSnapshotFlashBytes  = 64 * 1024;
+    constexpr uint32_t kArenaSnapshotFlashOffset =
+        PICO_FLASH_SIZE_BYTES - kArenaSnapshotFlashBytes;
+}  // namespace
 
-struct ack_status {
-  uint8_t fid;
-  uint8_t rid;
-  bool success;
-};
-typedef struct ack_status ack_status_t;
 
 static mutex_t xbee_send_mutex;
 static XBeePico xbee = XBeePico();
 
-
-
-int64_t add_missing_queue(alarm_id_t id, void *user_data);
-
-// next available index
-uint8_t get_xmit_st_idx(uint8_t seq){
-    int sqidx = seq % BUFF_SIZE;
-    if(stats[sqidx].stat == ST_INIT || stats[sqidx].stat == ST_RECD){
-        stats[sqidx].stat = ST_INIT;
-        return sqidx;
-    }
-    for(uint8_t i = 1; i < BUFF_SIZE; i++){
-        int s = seq - i;
-        if(s < 0){
-            s = BUFF_SIZE + s;
-        }
-        sqidx = s % BUFF_SIZE;
-        if(stats[sqidx].stat == ST_INIT || stats[sqidx].stat == ST_RECD){
-            stats[sqidx].stat = ST_INIT;
-            return sqidx;
-        }
-    }
-    return BUFF_SIZE;
-}
-
-uint8_t find_xmit_st_idx(uint8_t seq){
-    int sqidx = seq % BUFF_SIZE;
-    if(stats[sqidx].seq == seq){
-        return sqidx;
-    }
-    for(uint8_t i = 0; i < BUFF_SIZE; i++){
-        if(stats[i].seq == seq){
-            return i;
-        }
-    }
-    return BUFF_SIZE;
-}
-
-uint8_t find_xmit_st_fid(uint8_t fid){
-    for(uint8_t i = 0; i < BUFF_SIZE; i++){
-        if(stats[i].fid == fid){
-            return i;
-        }
-    }
-    return BUFF_SIZE;
-}
-
-uint8_t get_xmit_st_cnt(){
-    uint8_t cnt = 0;
-    for(uint8_t i = 0; i < BUFF_SIZE; i++){
-        if(stats[i].stat == ST_SEND || stats[i].stat == ST_RSND){
-            cnt++;
-        }
-    }
-    return cnt;
-}
-
-bool is_xmit_st_open(){
-    return (get_xmit_st_cnt() > 0);
-}
+// Set while send_msg() waits for a transmit status; the others go to the
+// transfer dispatcher.
+static volatile bool xbee_sync_send = false;
 
 // stores XBee Status Response 0x8B
 struct xbee_response {
@@ -170,16 +83,34 @@ struct xbee_response {
 };
 typedef struct xbee_response xbee_response_t;
 
-XBeeAddress64 addr = XBeeAddress64(0x0013A200, 0x41C17206);
+// Collectors the pictures go to. A picture is read out once and sent from
+// the same buffer to each of them, with a transfer each. The hello goes to
+// the first one.
+#define MAX_DESTINATIONS 4
+#define NO_DESTINATION 0xff
+XBeeAddress64 destinations[MAX_DESTINATIONS] = {
+  XBeeAddress64(0x0013A200, 0x41C17206),
+};
+int destination_count = 1;
+
+uint8_t find_destination(XBeeAddress64& addr){
+    for(int i = 0; i < destination_count; i++){
+        if(destinations[i].get() == addr.get()){
+            return i;
+        }
+    }
+    return NO_DESTINATION;
+}
 
 queue_t hello_ack_queue;
 queue_t xbee_ack_queue;
-queue_t request_ack_queue;
-queue_t done_ack_queue;
-queue_t complete_queue;
-queue_t missing_seq_queue;
+queue_t xfer_event_queue;
 queue_t arducam_cmd_queue;
 
+// Pictures go out through the dispatcher, from the main loop. The XBee
+// callback only queues the events.
+static xfer_dispatcher_t xfer_dispatcher;
+
 
 
 // ------------------
@@ -197,18 +128,6 @@ int64_t hello_timeout(alarm_id_t id, void *user_data) {
     return 0;
 }
 
-// application response missing
-int64_t add_missing_queue(alarm_id_t id, void *user_data) {
-    uint8_t *seq = (uint8_t *)user_data;
-
-    if(!queue_try_add(&missing_seq_queue, seq)){
-      printf("fail to add user data in the missing_seq_queue %d\n", *seq);
-      return 200;
-    }
-
-    return 0;
-}
-
 // xbee response missing
 int64_t xbee_resp_timeout(alarm_id_t id, void *user_data) {
     uint8_t *fidp = (uint8_t *)user_data; // need to check
@@ -225,41 +144,6 @@ int64_t xbee_resp_timeout(alarm_id_t id, void *user_data) {
     return 0;
 }
 
-// 
-int64_t request_timeout(alarm_id_t id, void *user_data) {
-    ack_status_t *stp = (ack_status_t *)user_data; // need to check
-
-    stp->success = false;
-    if(!queue_try_add(&request_ack_queue, stp)){
-      printf("fail to add user data in the xbee_ack_queue %d:%d\n", stp->fid, stp->rid);
-      return 200;
-    }
-
-    return 0;
-}
-
-int64_t done_timeout(alarm_id_t id, void *user_data) {
-    uint8_t *ridp = (uint8_t *)user_data; // need to check
-
-    if(!queue_try_add(&done_ack_queue, ridp)){
-      printf("fail to add user data in the xbee_ack_queue %d\n", *ridp);
-      return 200;
-    }
-
-    return 0;
-}
-
-int64_t complete_timeout(alarm_id_t id, void *user_data) {
-    uint8_t *ridp = (uint8_t *)user_data;
-
-    if(!queue_try_add(&complete_queue, ridp)){
-      printf("fail to add user data in the complete_queue %d\n", *ridp);
-      return 200;
-    }
-
-    return 0;
-}
-
 
 // ------------------
 //  Request Handlers
@@ -285,83 +169,20 @@ void arducam_cmd_handler(uint8_t tt[]){
     }
 }
 
-void write_data_ack_handler(uint8_t tt[]){
-    uint8_t rid;
-    uint32_t seq;
-
-    rid = tt[1];
-    seq = tt[2] << 24;
-    seq |= tt[3] << 16;
-    seq |= tt[4] << 8;
-    seq |= tt[5];
+// write request, data and done acks
+void write_ack_handler(uint8_t tt[], size_t len, uint8_t dest){
+    xfer_event_t ev;
 
-    printf("ack_hndlr: %d %d %d\n", rid, req_id, seq);
-    if(rid != req_id){
+    if(dest == NO_DESTINATION){
+        printf("ack_hndlr: ack 0x%02x from an unknown collector\n", tt[0]);
         return;
     }
-
-    int sqidx = find_xmit_st_idx(seq);
-    if(sqidx == BUFF_SIZE){
-        printf("ack_hndlr: no buffer available for %d:%d\n", rid, seq);
+    if(!xfer_parse_ack(dest, tt, len, &ev)){
+        printf("ack_hndlr: bad ack 0x%02x of %d bytes\n", tt[0], len);
         return;
     }
-    stats[sqidx].stat = ST_RECD;
-
-    if(req_done && !is_xmit_st_open()){
-        // send done message.
-        if(!queue_try_add(&complete_queue, &rid)){
-            printf("ack_hndlr: cannot add queue for %d:%d\n", rid, seq);
-        }
-    }
-
-    printf("ack_hndlr: %d %d\n", rid, seq);
-
-    if(!cancel_alarm(stats[sqidx].alarm_id)){
-        printf("ack_hndlr: cancel alarm error for %d:%d\n", rid, seq);
-    }
-}
-
-void write_data_request_handler(uint8_t tt[]){
-    uint8_t rid;
-    uint32_t len;
-    ack_status_t st;
-
-    rid = tt[1];
-    len = tt[2] << 24;
-    len |= tt[3] << 16;
-    len |= tt[4] << 8;
-    len |= tt[5];
-
-    st.rid = rid;
-    st.success = true;
-    if(!queue_try_add(&request_ack_queue, &st)){
-        printf("data_req_hndlr: adding queue error for %d:%d\n", rid, len);
-    }
-}
-
-void write_data_done_handler(uint8_t tt[]){
-    uint8_t rid;
-    uint32_t len;
-    uint32_t seq;
-    ack_status_t st;
-
-    rid = tt[1];
-    len = tt[2] << 24;
-    len |= tt[3] << 16;
-    len |= tt[4] << 8;
-    len |= tt[5];
-    seq = tt[6] << 24;
-    seq |= tt[7] << 16;
-    seq |= tt[8] << 8;
-    seq |= tt[9];
-
-    printf("done_hndlr: %d %d\n", rid, seq);
-
-    st.success = true;
-    st.rid = rid;
-  
-    if(!queue_try_add(&done_ack_queue, &st)){
-        printf("done_hndlr: adding queue error for %d\n", rid);
+    if(!queue_try_add(&xfer_event_queue, &ev)){
+        printf("ack_hndlr: adding queue error for %d:%d\n", ev.id, ev.seq);
     }
 }
 
@@ -382,6 +203,7 @@ bool send_msg(XBeePico& xbee, ZBTxRequest& tx){
     }
     // add cancel timer for xbee_resp blocking
     alarm_id_t aid = add_alarm_in_ms(200, xbee_resp_timeout, &fid, false);
+    xbee_sync_send = true;
     xbee.send(tx);
     //printf("after send:%d\n", fid);
 
@@ -408,6 +230,7 @@ bool send_msg(XBeePico& xbee, ZBTxRequest& tx){
             // queue_add_blocking(&xbee_ack_queue, &xbee_resp);
         }  
     }
+    xbee_sync_send = false;
     mutex_exit(&xbee_send_mutex);
     return res;
 }
@@ -424,7 +247,7 @@ bool send_hello(XBeePico& xbee)
   sprintf((payload+1), "Hello Burst %d", fid);
   size_t len = strlen((payload + 1)) + 1;
 
-  MyZBTxRequest tx = MyZBTxRequest(addr, (uint8_t*)payload, len);
+  MyZBTxRequest tx = MyZBTxRequest(destinations[0], (uint8_t*)payload, len);
 
   tx.setFrameId(fid);
 
@@ -434,184 +257,27 @@ bool send_hello(XBeePico& xbee)
   return res;
 }
 
-bool send_write_request(XBeePico& xbee, uint8_t fid, uint8_t rid, uint32_t len, uint32_t pkt_cnt){
-    printf("\nstart send_write_request %d:%d:%d:%d\n", fid, rid, len, pkt_cnt);
-
-    uint8_t payload[10];
-
-    payload[0] = CMD_WRITE_REQUEST;
-    payload[1] = rid;
-    payload[2] = (len >> 24) & 0xff;
-    payload[3] = (len >> 16) & 0xff;
-    payload[4] = (len >> 8) & 0xff;
-    payload[5] = len & 0xff;
-    payload[6] = (pkt_cnt >> 24) & 0xff;
-    payload[7] = (pkt_cnt >> 16) & 0xff;
-    payload[8] = (pkt_cnt >> 8) & 0xff;
-    payload[9] = pkt_cnt & 0xff;
-  
-    ZBTxRequest tx = ZBTxRequest(addr, (uint8_t*)payload, sizeof(payload));
+// The dispatcher's link: queues the frame on the XBee without waiting for
+// its transmit status, which comes back as an event.
+uint8_t xbee_link_send(void * ctx, uint8_t dest, const uint8_t * payload, size_t len){
+    XBeePico * xb = (XBeePico *)ctx;
+    uint8_t fid = xb->getNextFrameId();
 
+    ZBTxRequest tx = ZBTxRequest(destinations[dest], (uint8_t*)payload, len);
     tx.setFrameId(fid);
-
-    bool res = send_msg(xbee, tx);
-
-    //printf("end send_write_request %d:%d:%d:%d\n", fid, rid, len, pkt_cnt);
-
-    return res;
+    xb->send(tx);
+    return fid;
 }
 
-bool send_write_data(XBeePico& xbee, uint8_t fid, uint8_t rid, uint32_t seq, uint8_t* dt, size_t len){
-
-    uint8_t payload[len+6];
-
-    printf("\nstart send_write_data [%d][%d][%d][%d]\n", fid, rid, seq, len);
+// Hands the queued events to the dispatcher and runs its timers.
+void dispatch_transfers(){
+    xfer_event_t ev;
+    uint32_t now = to_ms_since_boot(get_absolute_time());
 
-    payload[0] = CMD_WRITE_DATA;
-    payload[1] = rid;
-    payload[2] = (seq >> 24) & 0xff;
-    payload[3] = (seq >> 16) & 0xff;
-    payload[4] = (seq >> 8) & 0xff;
-    payload[5] = seq & 0xff;
-
-    memcpy(payload + 6, dt, len);
-
-    ZBTxRequest tx = ZBTxRequest(addr, (uint8_t*)payload, (len + 6));
-    tx.setFrameId(fid);
-
-    if(!send_msg(xbee, tx)){
-        return false;
+    while(queue_try_remove(&xfer_event_queue, &ev)){
+        xfer_handle_event(&xfer_dispatcher, &ev, now);
     }
-
-    //printf("end send_write_data [%d][%d][%d][%d]\n", fid, rid, seq, len);
-
-    return true;
-}
-
-void send_write_done(XBeePico& xbee, uint8_t fid, uint8_t rid, uint32_t len, uint32_t pkt_cnt){
-    printf("\nstart send_write_done %d %d\n", len, pkt_cnt);
-
-    uint8_t payload[10];
-  
-    payload[0] = CMD_WRITE_DONE;
-    payload[1] = rid;
-    payload[2] = (len >> 24) & 0xff;
-    payload[3] = (len >> 16) & 0xff;
-    payload[4] = (len >> 8) & 0xff;
-    payload[5] = len & 0xff;
-    payload[6] = (pkt_cnt >> 24) & 0xff;
-    payload[7] = (pkt_cnt >> 16) & 0xff;
-    payload[8] = (pkt_cnt >> 8) & 0xff;
-    payload[9] = pkt_cnt & 0xff;
-  
-    ZBTxRequest tx = ZBTxRequest(addr, (uint8_t*)payload, sizeof(payload));
-    tx.setFrameId(fid);
-
-    send_msg(xbee, tx);
-    printf("end send_write_done %d\n", fid);
-}
-
-
-void send_picture_by_xbee(XBeePico& xbee, uint8_t * buff, const int len){
-    int wrote = 0;
-    int seq = 0;
-
-    printf("\nstart send_picture_by_xbee %d\n", len);
-
-    size_t hdr_size = 6;
-    size_t data_size = DATA_SIZE - hdr_size;
-    int pkt_cnt = 0;
-
-    if((len % data_size) > 0){
-        pkt_cnt = (int)(len / data_size) + 1;
-    } else {
-        pkt_cnt = (int)(len / data_size);
-    }
-
-    uint8_t fid, rid, rr;
-    alarm_id_t aid;
-    ack_status_t st;
-    bool res;
-    st.success = false;
-    req_done = false;
-    while(!st.success) {
-        fid = xbee.getNextFrameId();
-        rid = ++req_id;
-        st.fid = fid;
-        st.rid = rid;
-        aid = add_alarm_in_ms(200, request_timeout, &st, false);
-        if(!send_write_request(xbee, fid, rid, len, pkt_cnt)){
-            if(!cancel_alarm(aid)){
-                printf("cancel write request timeout 1! [%d]\n", aid);
-            }
-            continue;
-        }
-
-        // wait response from server to get ready to receive data.
-        queue_remove_blocking(&request_ack_queue, &st);
-        if(st.success){
-            if(!cancel_alarm(aid)){
-                printf("cancel write request timeout 2! [%d]\n", aid);
-            }
-        }
-    }
-
-    uint32_t mseq;
-    uint8_t * b = buff;
-    int l = len;
-    size_t s = 0;
-    for(int seq = 0; seq < pkt_cnt; seq++){
-        int sqidx = BUFF_SIZE;
-        uint8_t sqidx_cnt = 0;
-        while(1){
-            sqidx = get_xmit_st_idx(seq);
-
-            if(sqidx == BUFF_SIZE){
-                printf(".");
-                sleep_ms(100);
-                if(sqidx_cnt++ > 100){
-                    return;
-                }
-            } else {
-                break;
-            }
-        }
-
-        s = min(l, data_size);
-        fid = xbee.getNextFrameId();
-        stats[sqidx].time = time_us_32();
-        stats[sqidx].seq = seq;
-        stats[sqidx].len = s;
-        stats[sqidx].dat = b;
-        stats[sqidx].fid = fid;
-        stats[sqidx].rid = rid;
-        stats[sqidx].stat = ST_SEND;
-        stats[sqidx].alarm_id = add_alarm_in_ms(200, add_missing_queue, &stats[sqidx].seq, false);
-
-        if(!send_write_data(xbee, fid, rid, seq, b, s)){
-            if(!cancel_alarm(stats[sqidx].alarm_id)){
-                printf("cancel_alarm returns false: %d %d\n", seq, stats[sqidx].alarm_id);
-            }
-            queue_add_blocking(&missing_seq_queue, &seq);
-        }
-        b = b + s;
-        l = l - s;
-    }
-    req_done = true;
-    aid = add_alarm_in_ms(200, complete_timeout, &rid, false);
-    queue_remove_blocking(&complete_queue, &rr);
-    
-    fid = xbee.getNextFrameId();
-    st.fid = fid;
-    st.success = false;
-    alarm_id_t done_aid = add_alarm_in_ms(200, done_timeout, &st, false);
-    send_write_done(xbee, fid, rid, len, pkt_cnt);
-
-    queue_remove_blocking(&done_ack_queue, &st);
-    if(!cancel_alarm(done_aid)){
-    }
-
-    printf("end send_picture_by_xbee\n");
+    xfer_poll(&xfer_dispatcher, now);
 }
 
 // ----------------------------
@@ -637,8 +303,19 @@ void func(XBeeResponse& resp, uintptr_t ptr){
 
             //printf("stat:fid=%d:retry=%d:dlvry=%d:dscvry=%d:sucs=%d\n",
             //        stat.getFrameId(), stat.getTxRetryCount(), stat.getDeliveryStatus(), stat.getDiscoveryStatus(), stat.isSuccess());
-            uint8_t fid = stat.getFrameId();
-            queue_add_blocking(&xbee_ack_queue, &xbee_resp);
+            if(xbee_sync_send){
+                queue_try_add(&xbee_ack_queue, &xbee_resp);
+                break;
+            }
+            xfer_event_t ev;
+            ev.type = XFER_EV_TX_STATUS;
+            ev.dest = 0;
+            ev.id = xbee_resp.fid;
+            ev.seq = 0;
+            ev.success = xbee_resp.success;
+            if(!queue_try_add(&xfer_event_queue, &ev)){
+                printf("stat: adding queue error for %d\n", ev.id);
+            }
             break;
         }
         case ZBExplicitRxResponse::API_ID: {
@@ -659,13 +336,10 @@ void func(XBeeResponse& resp, uintptr_t ptr){
                 case CMD_RECV_STAT: // 0x12
                     break;
                 case CMD_WRITE_REQUEST_ACK: // 0x13
-                    write_data_request_handler(tt);
-                    break;
                 case CMD_WRITE_DATA_ACK: // 0x14
-                    write_data_ack_handler(tt);
-                    break;
                 case CMD_WRITE_DONE_ACK: // 0x15
-                    write_data_done_handler(tt);
+                    write_ack_handler(tt, rx.getDataLength(),
+                                      find_destination(rx.getRemoteAddress64()));
                     break;
                 case CMD_WRITE_RESEND: // 0x16
                     break;
@@ -693,35 +367,6 @@ uint8_t bmp_header[BMPIMAGEOFFSET] =
   0x00, 0x00
 };
 
-// ------------------
-//   Multi Core1
-// ------------------
-
-void core1_entry(){
-    uint32_t seq, mseq;
-    while(1){
-        queue_remove_blocking(&missing_seq_queue, &mseq);
-        int msqidx = find_xmit_st_idx(mseq);
-        if(msqidx == BUFF_SIZE){
-            printf("no buff available for missing: %d\n", mseq);
-            continue;
-        }
-        if(stats[msqidx].stat == ST_SEND || stats[msqidx].stat == ST_RSND){
-            seq = stats[msqidx].seq;
-            stats[msqidx].stat == ST_RSND;
-            stats[msqidx].alarm_id = add_alarm_in_ms(200, add_missing_queue, &stats[msqidx].seq, false);
-            if(!send_write_data(xbee, stats[msqidx].fid, stats[msqidx].rid, stats[msqidx].seq, stats[msqidx].dat, stats[msqidx].len)){
-                queue_add_blocking(&missing_seq_queue, &stats[msqidx].seq);
-                if(!cancel_alarm(stats[msqidx].alarm_id)){
-                    printf("cancel_alarm returns false: %d %d\n", seq, stats[msqidx].alarm_id);
-                }
-            }
-        } else {
-            printf("process_missing ... %d %d\n", stats[msqidx].seq, stats[msqidx].stat);
-        }
-    }
-}
-
 // set pin 10 as the slave select for the digital pot:
 const uint8_t CS = 5;
 bool is_header = false;
@@ -729,7 +374,178 @@ int mode = 0;
 uint8_t start_capture = 0;
 ArduCAM myCAM( OV2640, CS );
 uint8_t read_fifo_burst(ArduCAM myCAM);
-uint8_t read_fifo_burst_xbee(ArduCAM myCAM, XBeePico& xbee);
+uint8_t read_fifo_burst_xbee(ArduCAM& myCAM);
+
+// A capture is armed while the sensor fills the ArduCAM FIFO with a frame.
+// The next one is armed as soon as a frame is read out, so that it is
+// captured while the frame goes out over the radio.
+bool capture_armed = false;
+uint32_t capture_armed_us;
+#define CAPTURE_TIMEOUT_MS 1000
+
+void arm_capture(ArduCAM& myCAM)
+{
+  myCAM.flush_fifo();
+  myCAM.clear_fifo_flag();
+  myCAM.start_capture();
+  capture_armed = true;
+  capture_armed_us = time_us_32();
+}
+
+// Gives up on a capture that doesn't finish, so that it is armed again.
+bool capture_timed_out()
+{
+  if (!capture_armed ||
+      time_us_32() - capture_armed_us < CAPTURE_TIMEOUT_MS * 1000)
+    return false;
+  printf("capture timeout\n");
+  capture_armed = false;
+  return true;
+}
+
+// Every frame read out of the FIFO gets the next sequence number, including
+// frames dropped before they are sent.
+uint32_t frame_seq = 0;
+
+// Streaming mode (0x20) double buffers the frames: the ArduCAM FIFO holds
+// the frame being captured, and stream_ring the frames read out of it until
+// they are sent. When the radio falls behind, the oldest frames are dropped.
+#define STREAM_BUFFER_SIZE (48 * 1024)
+#define STREAM_REPORT_INTERVAL_US (10 * 1000 * 1000)
+uint8_t stream_buffer[STREAM_BUFFER_SIZE];
+frame_ring_t stream_ring;
+uint32_t stream_start_us;
+uint32_t stream_report_us;
+
+// Pictures being sent, with a transfer to each collector. The next single
+// shot is read out as soon as a slot is free, while the last one still
+// waits for its acks. Shots go at high priority and preempt the stream
+// frame on the link; stream_ring lets out one frame at a time.
+#define PICTURE_SLOTS 2
+#if PICTURE_SLOTS * MAX_DESTINATIONS > XFER_MAX_TRANSFERS
+#error "more picture transfers than the dispatcher runs"
+#endif
+
+struct picture {
+  xfer_t xfers[MAX_DESTINATIONS];
+  int count;           // transfers started, 0 if the slot is free
+  uint8_t * shot_buf;  // single shot, else a stream_ring frame
+};
+typedef struct picture picture_t;
+
+picture_t pictures[PICTURE_SLOTS];
+bool shot_pending = false;
+bool sending_stream_frame = false;
+
+picture_t * free_picture()
+{
+  for (int i = 0; i < PICTURE_SLOTS; i++)
+  {
+    if (pictures[i].count == 0)
+      return &pictures[i];
+  }
+  return NULL;
+}
+
+bool start_picture(picture_t * p, const uint8_t * dat, uint32_t len,
+                   uint32_t seq, uint8_t * shot_buf)
+{
+  uint8_t prio = (shot_buf != NULL) ? XFER_PRIO_HIGH : XFER_PRIO_LOW;
+  uint32_t now = to_ms_since_boot(get_absolute_time());
+  p->count = 0;
+  for (int dest = 0; dest < destination_count; dest++)
+  {
+    if (xfer_start(&xfer_dispatcher, &p->xfers[p->count], dest, dat, len,
+                   seq, prio, now))
+      p->count++;
+  }
+  if (p->count == 0)
+    return false;
+  printf("start picture %d of %d bytes to %d collectors\n", seq, len,
+         p->count);
+  p->shot_buf = shot_buf;
+  if (shot_buf == NULL)
+    sending_stream_frame = true;
+  return true;
+}
+
+// Frees the pictures whose transfers are all over.
+void finish_pictures()
+{
+  for (int i = 0; i < PICTURE_SLOTS; i++)
+  {
+    picture_t * p = &pictures[i];
+    if (p->count == 0)
+      continue;
+    int delivered = 0;
+    int k;
+    for (k = 0; k < p->count && !xfer_busy(&p->xfers[k]); k++)
+    {
+      if (p->xfers[k].state == XFER_COMPLETE)
+        delivered++;
+    }
+    if (k < p->count)
+      continue;
+    for (k = 0; k < p->count; k++)
+    {
+      const xfer_t * x = &p->xfers[k];
+      printf("picture %d to %d %s: %d frames, %d resent, %d ms\n",
+             x->frame_seq, x->dest,
+             x->state == XFER_COMPLETE ? "sent" : "failed", x->sent,
+             x->resent, x->end_ms - x->start_ms);
+    }
+    if (p->shot_buf != NULL)
+    {
+      free(p->shot_buf);
+    }
+    else
+    {
+      frame_ring_release(&stream_ring, delivered == p->count);
+      sending_stream_frame = false;
+    }
+    p->count = 0;
+  }
+}
+
+// Reads a finished capture into stream_ring and arms the next one, without
+// waiting for the capture.
+void poll_stream_capture()
+{
+  if (mode != 2 || !capture_armed || !myCAM.capture_done())
+    return;
+  uint32_t seq = frame_seq++;
+  uint32_t length = myCAM.read_fifo_length();
+  uint8_t * dat = NULL;
+  if (length > 0 && length < MAX_FIFO_SIZE)
+    dat = frame_ring_reserve(&stream_ring, length);
+  if (dat != NULL)
+  {
+    myCAM.CS_LOW();
+    myCAM.set_fifo_burst();
+    spi_read_blocking(SPI_PORT, BURST_FIFO_READ, dat, length);
+    myCAM.CS_HIGH();
+    frame_ring_commit(&stream_ring, seq, time_us_32());
+  }
+  else
+  {
+    printf("stream: frame %d of %d bytes dropped\n", seq, length);
+  }
+  arm_capture(myCAM);
+}
+
+void report_stream_metrics(bool force)
+{
+  uint32_t now = time_us_32();
+  if (!force && now - stream_report_us < STREAM_REPORT_INTERVAL_US)
+    return;
+  stream_report_us = now;
+  uint32_t elapsed_us = max(now - stream_start_us, 1);
+  uint32_t fps_x100 =
+    (uint32_t)((uint64_t)stream_ring.sent * 100 * 1000 * 1000 / elapsed_us);
+  printf("stream: %d captured, %d sent, %d dropped, %d.%02d fps\n",
+         stream_ring.captured, stream_ring.sent, stream_ring.dropped,
+         fps_x100 / 100, fps_x100 % 100);
+}
 
 int main() 
 {
@@ -744,10 +560,7 @@ int main()
 
   queue_init(&hello_ack_queue, sizeof(uint8_t), 24);
   queue_init(&xbee_ack_queue, sizeof(xbee_response), 24);
-  queue_init(&request_ack_queue, sizeof(ack_status_t), 8);
-  queue_init(&done_ack_queue, sizeof(ack_status_t), 8);
-  queue_init(&complete_queue, sizeof(uint8_t), 8);
-  queue_init(&missing_seq_queue, sizeof(uint32_t), 24);
+  queue_init(&xfer_event_queue, sizeof(xfer_event_t), 48);
   queue_init(&arducam_cmd_queue, sizeof(uint8_t), 8);
 
   gpio_init(LED_PIN);
@@ -765,8 +578,11 @@ int main()
     return -1;
   }
 
-  static tflite::MicroMutableOpResolver<5> micro_op_resolver;
+  // Block sparse fully connected runs the pointwise convolutions of models
+  // pruned and rewritten by tools/sparsify_model_weights.cpp.
+  static tflite::MicroMutableOpResolver<6> micro_op_resolver;
   micro_op_resolver.AddAveragePool2D();
+  micro_op_resolver.AddBlockSparseFullyConnected();
   micro_op_resolver.AddConv2D();
   micro_op_resolver.AddDepthwiseConv2D();
   micro_op_resolver.AddReshape();
@@ -776,11 +592,29 @@ int main()
     model, micro_op_resolver, tensor_arena, kTensorArenaSize, error_reporter);
   interpreter = &static_interpreter;
 
-  // Allocate memory from the tensor_arena for the model's tensors.
-  TfLiteStatus allocate_status = interpreter->AllocateTensors();
-  if (allocate_status != kTfLiteOk) {
-    TF_LITE_REPORT_ERROR(error_reporter, "AllocateTensors() failed");
-    return -2;
+  // Restore the arena prepared on an earlier boot, or prepare it and save it
+  // for the next one. Core 1 isn't running yet, so flash can be written.
+  const uint32_t model_hash = tflite::ArenaSnapshotHash(
+    g_person_detect_model_data, g_person_detect_model_data_len);
+  const uint8_t *snapshot_data = nullptr;
+  const tflite::ArenaSnapshotHeader *snapshot =
+    tflite::FindArenaSnapshotInFlash(kArenaSnapshotFlashOffset, &snapshot_data);
+  if (snapshot == nullptr ||
+      interpreter->RestoreArenaSnapshot(model_hash, *snapshot,
+                                        snapshot_data) != kTfLiteOk) {
+    // Allocate memory from the tensor_arena for the model's tensors.
+    TfLiteStatus allocate_status = interpreter->AllocateTensors();
+    if (allocate_status != kTfLiteOk) {
+      TF_LITE_REPORT_ERROR(error_reporter, "AllocateTensors() failed");
+      return -2;
+    }
+    tflite::ArenaSnapshot new_snapshot;
+    if (interpreter->GetArenaSnapshot(model_hash, &new_snapshot) != kTfLiteOk ||
+        tflite::WriteArenaSnapshotToFlash(
+          new_snapshot, kArenaSnapshotFlashOffset,
+          kArenaSnapshotFlashBytes) != kTfLiteOk) {
+      printf("arena snapshot not saved\n");
+    }
   }
 
   // Get information about the memory area to use for the model's input.
@@ -789,6 +623,7 @@ int main()
   gpio_put(LED_PIN, 1);
 
   mutex_init(&xbee_send_mutex);
+  xfer_dispatcher_init(&xfer_dispatcher, xbee_link_send, &xbee, 7);
 
   xbee.onResponse(func);
 
@@ -841,10 +676,8 @@ int main()
   myCAM.InitCAM();
   myCAM.OV2640_set_JPEG_size(OV2640_320x240);
   //myCAM.OV2640_set_JPEG_size(OV2640_160x120);
-  sleep_ms(1000);
   myCAM.clear_fifo_flag();
-
-  multicore_launch_core1(core1_entry);
+  frame_ring_init(&stream_ring, stream_buffer, STREAM_BUFFER_SIZE);
 
   alarm_id_t hello_alarm_id;
   uint8_t hello_fid = 2;
@@ -866,7 +699,6 @@ int main()
 
   while (1) 
   {
-    printf("start loop 1\n");
     uint8_t cameraCommand_last = 0;
     uint8_t is_header = 0;
     
@@ -876,52 +708,56 @@ int main()
     {
       //usart_Command=SerialUsbRead();
       if(!queue_try_remove(&arducam_cmd_queue, &usart_Command)){
-          usart_Command = 0x10;
+          // Keep streaming, or else take the next single shot.
+          usart_Command = (mode == 2 || shot_pending) ? 0xff : 0x10;
+      } else {
+          // The frame in the FIFO predates the command.
+          capture_armed = false;
       }
       switch (usart_Command)
       {
         case 0:
-          myCAM.OV2640_set_JPEG_size(OV2640_160x120);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_160x120);
           printf("ACK CMD switch to OV2640_160x120 END\n");
           usart_Command = 0xff;
           break;
         case 1:
-          myCAM.OV2640_set_JPEG_size(OV2640_176x144);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_176x144);
           printf("ACK CMD switch to OV2640_176x144 END\n");
           usart_Command = 0xff;
           break;
         case 2: 
-          myCAM.OV2640_set_JPEG_size(OV2640_320x240);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_320x240);
           printf("ACK CMD switch to OV2640_320x240 END\n");
           usart_Command = 0xff;
           break;
         case 3:
-          myCAM.OV2640_set_JPEG_size(OV2640_352x288);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_352x288);
           printf("ACK CMD switch to OV2640_352x288 END\n");
           usart_Command = 0xff;
           break;
         case 4:
-          myCAM.OV2640_set_JPEG_size(OV2640_640x480);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_640x480);
           printf("ACK CMD switch to OV2640_640x480 END\n");
           usart_Command = 0xff;
           break;
         case 5:
-          myCAM.OV2640_set_JPEG_size(OV2640_800x600);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_800x600);
           printf("ACK CMD switch to OV2640_800x600 END\n");
           usart_Command = 0xff;
           break;
         case 6:
-          myCAM.OV2640_set_JPEG_size(OV2640_1024x768);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_1024x768);
           printf("ACK CMD switch to OV2640_1024x768 END\n");
           usart_Command = 0xff;
           break;
         case 7:
-          myCAM.OV2640_set_JPEG_size(OV2640_1280x1024);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_1280x1024);
           printf("ACK CMD switch to OV2640_1280x1024 END\n");
           usart_Command = 0xff;
           break;
         case 8:
-          myCAM.OV2640_set_JPEG_size(OV2640_1600x1200);sleep_ms(1000);
+          myCAM.OV2640_set_JPEG_size(OV2640_1600x1200);
           printf("ACK CMD switch to OV2640_1600x1200 END\n");
           usart_Command = 0xff;
           break;
@@ -942,6 +778,14 @@ int main()
           start_capture = 2;
           printf("ACK CMD CAM start video streaming. END\n");
           break;
+        case 0x21:
+          if (mode == 2)
+            report_stream_metrics(true);
+          mode = 0;
+          shot_pending = false;
+          usart_Command = 0xff;
+          printf("ACK CMD CAM stop video streaming. END\n");
+          break;
         case 0x30:
           mode = 3;
           usart_Command = 0xff;
@@ -1046,39 +890,75 @@ int main()
     }
     if (mode == 1)
     {
-      printf("mode 1\n");
       if (start_capture == 1)
       {
         printf("start_capture 1\n");
-        myCAM.flush_fifo();
-        myCAM.clear_fifo_flag();
-        //Start capture
-        myCAM.start_capture();
         start_capture = 0;
-        printf("end_capture 0\n");
-        sleep_ms(1000);
-
-        if (myCAM.get_bit(ARDUCHIP_TRIG, CAP_DONE_MASK))
+        shot_pending = true;
+      }
+      //Start capture, unless the last readout already did
+      if (shot_pending && !capture_armed)
+        arm_capture(myCAM);
+      if (shot_pending && free_picture() != NULL)
+      {
+        if (myCAM.capture_done())
         {
-          printf("burst to xbee start\n");
+          printf("capture done after %d us\n",
+                 time_us_32() - capture_armed_us);
           //read_fifo_burst(myCAM);
-          read_fifo_burst_xbee(myCAM, xbee);
-          //Clear the capture done flag
-          myCAM.clear_fifo_flag();
-          printf("burst to xbee end\n");
-          sleep_ms(5000);
+          read_fifo_burst_xbee(myCAM);
+          shot_pending = false;
+        }
+        else if (capture_timed_out())
+        {
+          shot_pending = false;
         }
       }
     }
+    else if (mode == 2)
+    {
+      if (start_capture == 2)
+      {
+        printf("start streaming\n");
+        frame_ring_reset(&stream_ring);
+        stream_start_us = time_us_32();
+        stream_report_us = stream_start_us;
+        start_capture = 0;
+      }
+      if (!capture_armed)
+        arm_capture(myCAM);
+      poll_stream_capture();
+      capture_timed_out();
+      picture_t * p = free_picture();
+      if (p != NULL && !sending_stream_frame)
+      {
+        const frame_t * f = frame_ring_acquire(&stream_ring);
+        if (f != NULL && !start_picture(p, f->dat, f->len, f->seq, NULL))
+          frame_ring_release(&stream_ring, false);
+      }
+      report_stream_metrics(false);
+    }
+
+    // Nothing above waits for the radio: the transfer moves on here.
+    dispatch_transfers();
+    finish_pictures();
   }
 }
 
-uint8_t read_fifo_burst_xbee(ArduCAM myCAM, XBeePico& xbee)
+uint8_t read_fifo_burst_xbee(ArduCAM& myCAM)
 {
-    int i , count;
     int length = myCAM.read_fifo_length();
+    if (length == 0 || length >= MAX_FIFO_SIZE) {
+        printf("bad fifo length %d\n", length);
+        arm_capture(myCAM);
+        return 0;
+    }
     uint8_t * imageBuf =(uint8_t *) malloc(length*sizeof(uint8_t));
-    i = 0 ;
+    if (imageBuf == NULL) {
+        printf("no memory for a %d byte frame\n", length);
+        arm_capture(myCAM);
+        return 0;
+    }
 
     printf("start read_fifo_burst_xbee\n");
 
@@ -1086,13 +966,17 @@ uint8_t read_fifo_burst_xbee(ArduCAM myCAM, XBeePico& xbee)
     myCAM.set_fifo_burst();//Set fifo burst mode
     spi_read_blocking(SPI_PORT, BURST_FIFO_READ,imageBuf, length);
     myCAM.CS_HIGH();
-    bool stop = false;
 
-    send_picture_by_xbee(xbee, imageBuf, length);
+    // The frame is out of the FIFO; capture the next one while this one is
+    // sent.
+    arm_capture(myCAM);
+    if (!start_picture(free_picture(), imageBuf, length, frame_seq++,
+                       imageBuf)) {
+        free(imageBuf);
+        return 0;
+    }
 
     printf("end read_fifo_burst_xbee\n");
-
-    free(imageBuf);
     return 1;
 }
 
@@ -0,0 +1,112 @@
+#include "frame_ring.h"
+
+#include <string.h>
+
+#define FRAME_RING_NO_ROOM ((size_t)-1)
+
+static void remove_frame(frame_ring_t * ring, int idx){
+    memmove(&ring->frames[idx], &ring->frames[idx + 1],
+            (ring->count - idx - 1) * sizeof(frame_t));
+    ring->count--;
+}
+
+// Offset of len free bytes after the newest frame, without passing the
+// oldest one.
+static size_t find_room(const frame_ring_t * ring, size_t len){
+    if(ring->count == 0){
+        return 0;
+    }
+    const frame_t * oldest = &ring->frames[0];
+    const frame_t * newest = &ring->frames[ring->count - 1];
+    size_t begin = oldest->dat - ring->buf;
+    size_t end = (newest->dat - ring->buf) + newest->len;
+    if(end > begin){
+        if(ring->size - end >= len){
+            return end;
+        }
+        if(begin >= len){
+            return 0;
+        }
+    } else if(begin - end >= len){
+        return end;
+    }
+    return FRAME_RING_NO_ROOM;
+}
+
+void frame_ring_init(frame_ring_t * ring, uint8_t * buf, size_t size){
+    ring->buf = buf;
+    ring->size = size;
+    ring->count = 0;
+    ring->sending = false;
+    frame_ring_reset(ring);
+}
+
+void frame_ring_reset(frame_ring_t * ring){
+    ring->count = ring->sending ? 1 : 0;
+    ring->reserved = false;
+    ring->captured = 0;
+    ring->dropped = 0;
+    ring->sent = 0;
+}
+
+uint8_t * frame_ring_reserve(frame_ring_t * ring, size_t len){
+    ring->reserved = false;
+    if(len == 0 || len > ring->size){
+        ring->dropped++;
+        return NULL;
+    }
+    while(1){
+        size_t offset = FRAME_RING_NO_ROOM;
+        if(ring->count < FRAME_RING_MAX_FRAMES){
+            offset = find_room(ring, len);
+        }
+        if(offset != FRAME_RING_NO_ROOM){
+            frame_t * f = &ring->frames[ring->count];
+            f->dat = ring->buf + offset;
+            f->len = len;
+            ring->reserved = true;
+            return f->dat;
+        }
+        // Drop the oldest frame that isn't being sent.
+        int oldest = ring->sending ? 1 : 0;
+        if(oldest >= ring->count){
+            ring->dropped++;
+            return NULL;
+        }
+        remove_frame(ring, oldest);
+        ring->dropped++;
+    }
+}
+
+void frame_ring_commit(frame_ring_t * ring, uint32_t seq, uint32_t time_us){
+    if(!ring->reserved){
+        return;
+    }
+    frame_t * f = &ring->frames[ring->count];
+    f->seq = seq;
+    f->time_us = time_us;
+    ring->count++;
+    ring->captured++;
+    ring->reserved = false;
+}
+
+const frame_t * frame_ring_acquire(frame_ring_t * ring){
+    if(ring->count == 0){
+        return NULL;
+    }
+    ring->sending = true;
+    return &ring->frames[0];
+}
+
+void frame_ring_release(frame_ring_t * ring, bool sent){
+    if(!ring->sending){
+        return;
+    }
+    remove_frame(ring, 0);
+    ring->sending = false;
+    if(sent){
+        ring->sent++;
+    } else {
+        ring->dropped++;
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+#include <stddef.h>
+#include <stdint.h>
+
+// Captured frames waiting to be sent, in one SRAM buffer. In streaming mode
+// the ArduCAM FIFO holds the frame being captured and the ring the frames
+// read out of it, so the next capture starts as soon as the FIFO is drained.
+//
+// Each frame is contiguous in the buffer, so that it can be sent straight
+// from it. Frames are sent oldest first. When a new frame doesn't fit, the
+// oldest frames are dropped, except the one being sent.
+
+#define FRAME_RING_MAX_FRAMES 8
+
+struct frame {
+  uint32_t seq;      // frame sequence number
+  uint32_t time_us;  // when the capture was read out
+  uint8_t * dat;
+  size_t len;
+};
+typedef struct frame frame_t;
+
+struct frame_ring {
+  uint8_t * buf;
+  size_t size;
+  frame_t frames[FRAME_RING_MAX_FRAMES];  // oldest first
+  int count;
+  bool sending;       // frames[0] is being sent
+  bool reserved;      // frames[count] is being read out
+  uint32_t captured;  // frames committed
+  uint32_t dropped;   // frames dropped, or not read out for lack of room
+  uint32_t sent;      // frames released after they were sent
+};
+typedef struct frame_ring frame_ring_t;
+
+void frame_ring_init(frame_ring_t * ring, uint8_t * buf, size_t size);
+
+// Drops every frame that isn't being sent and clears the counters.
+void frame_ring_reset(frame_ring_t * ring);
+
+// Returns room for a frame of len bytes, dropping the oldest frames as
+// needed, or NULL if it can't fit (the frame then counts as dropped).
+uint8_t * frame_ring_reserve(frame_ring_t * ring, size_t len);
+
+// Queues the frame read into the room frame_ring_reserve() returned.
+void frame_ring_commit(frame_ring_t * ring, uint32_t seq, uint32_t time_us);
+
+// Returns the oldest frame and keeps it until frame_ring_release(), or NULL
+// if there is none.
+const frame_t * frame_ring_acquire(frame_ring_t * ring);
+
+// Removes the frame frame_ring_acquire() returned. sent says whether it got
+// to the receiver.
+void frame_ring_release(frame_ring_t * ring, bool sent);
+
+#endif
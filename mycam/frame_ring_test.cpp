@@ -0,0 +1,138 @@
+#include "frame_ring.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr size_t kBufferSize = 100;
+
+uint8_t g_buffer[kBufferSize];
+frame_ring_t g_ring;
+
+tflite::testing::Random g_random;
+
+// Reads a frame of len bytes filled with its sequence number into the ring.
+bool Capture(uint32_t seq, size_t len) {
+  uint8_t* dat = frame_ring_reserve(&g_ring, len);
+  if (dat == nullptr) {
+    return false;
+  }
+  memset(dat, static_cast<uint8_t>(seq), len);
+  frame_ring_commit(&g_ring, seq, seq * 1000);
+  return true;
+}
+
+bool Intact(const frame_t* f) {
+  for (size_t i = 0; i < f->len; ++i) {
+    if (f->dat[i] != static_cast<uint8_t>(f->seq)) {
+      return false;
+    }
+  }
+  return f->dat >= g_buffer && f->dat + f->len <= g_buffer + kBufferSize;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestFramesComeOutOldestFirst) {
+  frame_ring_init(&g_ring, g_buffer, kBufferSize);
+  TF_LITE_MICRO_EXPECT_TRUE(frame_ring_acquire(&g_ring) == nullptr);
+  for (uint32_t seq = 1; seq <= 3; ++seq) {
+    TF_LITE_MICRO_EXPECT_TRUE(Capture(seq, 30));
+  }
+  for (uint32_t seq = 1; seq <= 3; ++seq) {
+    const frame_t* f = frame_ring_acquire(&g_ring);
+    TF_LITE_MICRO_EXPECT_TRUE(f != nullptr);
+    TF_LITE_MICRO_EXPECT_EQ(seq, f->seq);
+    TF_LITE_MICRO_EXPECT_EQ(30u, f->len);
+    TF_LITE_MICRO_EXPECT_TRUE(Intact(f));
+    frame_ring_release(&g_ring, true);
+  }
+  TF_LITE_MICRO_EXPECT_TRUE(frame_ring_acquire(&g_ring) == nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(3u, g_ring.captured);
+  TF_LITE_MICRO_EXPECT_EQ(3u, g_ring.sent);
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_ring.dropped);
+}
+
+TF_LITE_MICRO_TEST(TestDropsOldestFramesWhenFull) {
+  frame_ring_init(&g_ring, g_buffer, kBufferSize);
+  for (uint32_t seq = 1; seq <= 3; ++seq) {
+    TF_LITE_MICRO_EXPECT_TRUE(Capture(seq, 30));
+  }
+  // 10 bytes are left after frame 3 and 30 before it once frame 1 goes, so
+  // frame 2 goes too.
+  TF_LITE_MICRO_EXPECT_TRUE(Capture(4, 40));
+  TF_LITE_MICRO_EXPECT_EQ(2u, g_ring.dropped);
+
+  const frame_t* f = frame_ring_acquire(&g_ring);
+  TF_LITE_MICRO_EXPECT_EQ(3u, f->seq);
+  TF_LITE_MICRO_EXPECT_TRUE(Intact(f));
+  frame_ring_release(&g_ring, true);
+  f = frame_ring_acquire(&g_ring);
+  TF_LITE_MICRO_EXPECT_EQ(4u, f->seq);
+  TF_LITE_MICRO_EXPECT_TRUE(f->dat == g_buffer);
+  TF_LITE_MICRO_EXPECT_TRUE(Intact(f));
+  frame_ring_release(&g_ring, true);
+}
+
+TF_LITE_MICRO_TEST(TestKeepsTheFrameBeingSent) {
+  frame_ring_init(&g_ring, g_buffer, kBufferSize);
+  TF_LITE_MICRO_EXPECT_TRUE(Capture(1, 60));
+  const frame_t* f = frame_ring_acquire(&g_ring);
+  TF_LITE_MICRO_EXPECT_FALSE(Capture(2, 50));
+  TF_LITE_MICRO_EXPECT_EQ(1u, g_ring.dropped);
+  TF_LITE_MICRO_EXPECT_TRUE(Capture(3, 40));
+  TF_LITE_MICRO_EXPECT_TRUE(Intact(f));
+
+  // A bigger frame drops frame 3, not frame 1.
+  TF_LITE_MICRO_EXPECT_FALSE(Capture(4, 41));
+  TF_LITE_MICRO_EXPECT_EQ(3u, g_ring.dropped);
+  TF_LITE_MICRO_EXPECT_TRUE(Intact(f));
+  frame_ring_release(&g_ring, true);
+  TF_LITE_MICRO_EXPECT_TRUE(frame_ring_acquire(&g_ring) == nullptr);
+  TF_LITE_MICRO_EXPECT_FALSE(Capture(5, kBufferSize + 1));
+  TF_LITE_MICRO_EXPECT_TRUE(Capture(6, kBufferSize));
+}
+
+TF_LITE_MICRO_TEST(TestDropsOldestWhenOutOfDescriptors) {
+  frame_ring_init(&g_ring, g_buffer, kBufferSize);
+  for (uint32_t seq = 1; seq <= FRAME_RING_MAX_FRAMES + 2; ++seq) {
+    TF_LITE_MICRO_EXPECT_TRUE(Capture(seq, 1));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(2u, g_ring.dropped);
+  TF_LITE_MICRO_EXPECT_EQ(3u, frame_ring_acquire(&g_ring)->seq);
+  frame_ring_release(&g_ring, false);
+  TF_LITE_MICRO_EXPECT_EQ(3u, g_ring.dropped);
+}
+
+TF_LITE_MICRO_TEST(TestRandomTrafficKeepsFramesIntactAndInOrder) {
+  frame_ring_init(&g_ring, g_buffer, kBufferSize);
+  uint32_t next_seq = 1;
+  uint32_t last_sent = 0;
+  const frame_t* sending = nullptr;
+  for (int step = 0; step < 20000; ++step) {
+    if (g_random.Below(3) != 0) {
+      Capture(next_seq++, 1 + g_random.Below(45));
+    } else if (sending == nullptr) {
+      sending = frame_ring_acquire(&g_ring);
+    } else {
+      TF_LITE_MICRO_EXPECT_TRUE(Intact(sending));
+      TF_LITE_MICRO_EXPECT_GT(sending->seq, last_sent);
+      last_sent = sending->seq;
+      frame_ring_release(&g_ring, true);
+      sending = nullptr;
+    }
+    for (int i = 0; i < g_ring.count; ++i) {
+      TF_LITE_MICRO_EXPECT_TRUE(Intact(&g_ring.frames[i]));
+    }
+  }
+  TF_LITE_MICRO_EXPECT_GT(g_ring.sent, 0u);
+  TF_LITE_MICRO_EXPECT_GT(g_ring.dropped, 0u);
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -1,6 +1,6 @@
 #ifndef OV2640_REGS_H
 #define OV2640_REGS_H
-#include "ArduCAM.h"
+#include "sensor_reg_table.h"
 
 //#include <avr/pgmspace.h>
 
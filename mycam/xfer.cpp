@@ -0,0 +1,340 @@
+#include "xfer.h"
+
+#include <string.h>
+
+static bool is_due(uint32_t now_ms, uint32_t due_ms){
+    return (int32_t)(now_ms - due_ms) >= 0;
+}
+
+static void put_u32(uint8_t * p, uint32_t v){
+    p[0] = (v >> 24) & 0xff;
+    p[1] = (v >> 16) & 0xff;
+    p[2] = (v >> 8) & 0xff;
+    p[3] = v & 0xff;
+}
+
+static uint32_t get_u32(const uint8_t * p){
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | p[3];
+}
+
+// The frame sequence number follows the fields of earlier versions, so that
+// receivers can tell dropped frames from lost requests.
+static size_t write_request(const xfer_t * x, uint8_t * payload){
+    payload[0] = CMD_WRITE_REQUEST;
+    payload[1] = x->rid;
+    put_u32(payload + 2, x->len);
+    put_u32(payload + 6, x->pkt_cnt);
+    put_u32(payload + 10, x->frame_seq);
+    return 14;
+}
+
+static size_t write_data(const xfer_t * x, uint32_t seq, uint8_t * payload){
+    uint32_t offset = seq * XFER_DATA_SIZE;
+    uint32_t len = x->len - offset;
+    if(len > XFER_DATA_SIZE){
+        len = XFER_DATA_SIZE;
+    }
+    payload[0] = CMD_WRITE_DATA;
+    payload[1] = x->rid;
+    put_u32(payload + 2, seq);
+    memcpy(payload + XFER_HEADER_SIZE, x->dat + offset, len);
+    return XFER_HEADER_SIZE + len;
+}
+
+static size_t write_done(const xfer_t * x, uint8_t * payload){
+    payload[0] = CMD_WRITE_DONE;
+    payload[1] = x->rid;
+    put_u32(payload + 2, x->len);
+    put_u32(payload + 6, x->pkt_cnt);
+    return 10;
+}
+
+static void finish(xfer_dispatcher_t * d, xfer_t * x, xfer_state state,
+                   uint32_t now_ms){
+    x->state = state;
+    x->end_ms = now_ms;
+    for(int i = 0; i < XFER_MAX_TRANSFERS; i++){
+        if(d->active[i] == x){
+            d->active[i] = NULL;
+        }
+    }
+}
+
+// Request ids are unique among the transfers running, whatever their
+// destination.
+static xfer_t * find_rid(xfer_dispatcher_t * d, uint8_t rid){
+    for(int i = 0; i < XFER_MAX_TRANSFERS; i++){
+        if(d->active[i] != NULL && d->active[i]->rid == rid){
+            return d->active[i];
+        }
+    }
+    return NULL;
+}
+
+// Whether x has a frame to send now.
+static bool wants_link(const xfer_t * x, uint32_t now_ms){
+    switch(x->state){
+        case XFER_REQUEST:
+        case XFER_DONE:
+            return is_due(now_ms, x->ctl_due_ms);
+        case XFER_DATA:
+        case XFER_DRAIN:
+            for(uint32_t s = x->base; s != x->next; s++){
+                int i = s % XFER_WINDOW;
+                if(!x->acked[i] && is_due(now_ms, x->due_ms[i])){
+                    return true;
+                }
+            }
+            return x->state == XFER_DATA && x->next - x->base < XFER_WINDOW;
+        default:
+            return false;
+    }
+}
+
+// The transfer to send next: the highest priority one that wants the link,
+// and the first one after the last to send among equals.
+static int pick(const xfer_dispatcher_t * d, uint32_t now_ms){
+    int best = -1;
+    for(int n = 1; n <= XFER_MAX_TRANSFERS; n++){
+        int i = (d->turn + n) % XFER_MAX_TRANSFERS;
+        const xfer_t * x = d->active[i];
+        if(x == NULL || !wants_link(x, now_ms)){
+            continue;
+        }
+        if(best < 0 || x->prio > d->active[best]->prio){
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void enter_done(xfer_t * x, uint32_t now_ms){
+    x->state = XFER_DONE;
+    x->ctl_tries = 0;
+    x->ctl_due_ms = now_ms;
+}
+
+// Builds the frame x sends next, if any is due, and returns its length.
+static size_t next_frame(xfer_dispatcher_t * d, xfer_t * x, uint32_t now_ms,
+                         uint8_t * payload, uint32_t * seq){
+    *seq = XFER_NO_SEQ;
+    switch(x->state){
+        case XFER_REQUEST:
+        case XFER_DONE:
+            if(!is_due(now_ms, x->ctl_due_ms)){
+                return 0;
+            }
+            if(x->ctl_tries > XFER_MAX_RETRIES){
+                finish(d, x, XFER_FAILED, now_ms);
+                return 0;
+            }
+            if(x->ctl_tries++ > 0){
+                x->resent++;
+            }
+            x->ctl_due_ms = now_ms + XFER_ACK_TIMEOUT_MS;
+            if(x->state == XFER_REQUEST){
+                return write_request(x, payload);
+            }
+            return write_done(x, payload);
+        case XFER_DATA:
+        case XFER_DRAIN:
+            // Packets whose ack is overdue go first, oldest first.
+            for(uint32_t s = x->base; s != x->next; s++){
+                int i = s % XFER_WINDOW;
+                if(x->acked[i] || !is_due(now_ms, x->due_ms[i])){
+                    continue;
+                }
+                if(x->tries[i] > XFER_MAX_RETRIES){
+                    finish(d, x, XFER_FAILED, now_ms);
+                    return 0;
+                }
+                x->tries[i]++;
+                x->resent++;
+                x->due_ms[i] = now_ms + XFER_ACK_TIMEOUT_MS;
+                *seq = s;
+                return write_data(x, s, payload);
+            }
+            if(x->state == XFER_DATA && x->next - x->base < XFER_WINDOW){
+                uint32_t s = x->next++;
+                int i = s % XFER_WINDOW;
+                x->acked[i] = false;
+                x->tries[i] = 1;
+                x->due_ms[i] = now_ms + XFER_ACK_TIMEOUT_MS;
+                if(x->next == x->pkt_cnt){
+                    x->state = XFER_DRAIN;
+                }
+                *seq = s;
+                return write_data(x, s, payload);
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+void xfer_dispatcher_init(xfer_dispatcher_t * d, xfer_send_fn send,
+                          void * ctx, uint8_t last_rid){
+    memset(d, 0, sizeof(*d));
+    d->send = send;
+    d->ctx = ctx;
+    d->last_rid = last_rid;
+}
+
+bool xfer_start(xfer_dispatcher_t * d, xfer_t * x, uint8_t dest,
+                const uint8_t * dat, uint32_t len, uint32_t frame_seq,
+                uint8_t prio, uint32_t now_ms){
+    int slot = -1;
+    for(int i = 0; i < XFER_MAX_TRANSFERS; i++){
+        if(d->active[i] == NULL){
+            slot = i;
+            break;
+        }
+    }
+    if(slot < 0 || len == 0){
+        return false;
+    }
+    memset(x, 0, sizeof(*x));
+    x->state = XFER_REQUEST;
+    do {
+        x->rid = ++d->last_rid;
+    } while(find_rid(d, x->rid) != NULL);
+    x->dest = dest;
+    x->prio = prio;
+    x->dat = dat;
+    x->len = len;
+    x->frame_seq = frame_seq;
+    x->pkt_cnt = (len + XFER_DATA_SIZE - 1) / XFER_DATA_SIZE;
+    x->ctl_due_ms = now_ms;
+    x->start_ms = now_ms;
+    d->active[slot] = x;
+    return true;
+}
+
+bool xfer_busy(const xfer_t * x){
+    return x->state >= XFER_REQUEST && x->state <= XFER_DONE;
+}
+
+int xfer_count(const xfer_dispatcher_t * d){
+    int count = 0;
+    for(int i = 0; i < XFER_MAX_TRANSFERS; i++){
+        if(d->active[i] != NULL){
+            count++;
+        }
+    }
+    return count;
+}
+
+void xfer_handle_event(xfer_dispatcher_t * d, const xfer_event_t * ev,
+                       uint32_t now_ms){
+    if(ev->type == XFER_EV_TX_STATUS){
+        if(!d->link_busy || ev->id != d->link_fid){
+            return;
+        }
+        d->link_busy = false;
+        // The XBee gave up on the frame: send it again without waiting for
+        // its ack to time out.
+        xfer_t * x = find_rid(d, d->link_rid);
+        if(ev->success || x == NULL){
+            return;
+        }
+        if(d->link_seq == XFER_NO_SEQ){
+            x->ctl_due_ms = now_ms;
+        } else if(d->link_seq - x->base < x->next - x->base){
+            x->due_ms[d->link_seq % XFER_WINDOW] = now_ms;
+        }
+        return;
+    }
+    xfer_t * x = find_rid(d, ev->id);
+    if(x == NULL || x->dest != ev->dest){
+        return;
+    }
+    switch(ev->type){
+        case XFER_EV_REQUEST_ACK:
+            if(x->state == XFER_REQUEST){
+                x->state = XFER_DATA;
+            }
+            break;
+        case XFER_EV_DATA_ACK:
+            if(x->state != XFER_DATA && x->state != XFER_DRAIN){
+                break;
+            }
+            if(ev->seq - x->base >= x->next - x->base){
+                break;  // not in flight
+            }
+            x->acked[ev->seq % XFER_WINDOW] = true;
+            while(x->base != x->next && x->acked[x->base % XFER_WINDOW]){
+                x->base++;
+            }
+            if(x->state == XFER_DRAIN && x->base == x->pkt_cnt){
+                enter_done(x, now_ms);
+            }
+            break;
+        case XFER_EV_DONE_ACK:
+            if(x->state == XFER_DONE){
+                finish(d, x, XFER_COMPLETE, now_ms);
+            }
+            break;
+    }
+}
+
+void xfer_poll(xfer_dispatcher_t * d, uint32_t now_ms){
+    if(d->link_busy){
+        if(!is_due(now_ms, d->link_due_ms)){
+            return;
+        }
+        // No transmit status; the ack timers cover the frame.
+        d->link_busy = false;
+    }
+    uint8_t payload[XFER_PACKET_SIZE];
+    uint32_t seq;
+    size_t len = 0;
+    xfer_t * x = NULL;
+    // A transfer that wants the link may fail instead of sending.
+    for(int n = 0; len == 0 && n < XFER_MAX_TRANSFERS; n++){
+        int i = pick(d, now_ms);
+        if(i < 0){
+            return;
+        }
+        x = d->active[i];
+        len = next_frame(d, x, now_ms, payload, &seq);
+        d->turn = i;
+    }
+    if(len == 0){
+        return;
+    }
+    x->sent++;
+    d->link_fid = d->send(d->ctx, x->dest, payload, len);
+    d->link_rid = x->rid;
+    d->link_seq = seq;
+    d->link_busy = (d->link_fid != 0);
+    d->link_due_ms = now_ms + XFER_LINK_TIMEOUT_MS;
+}
+
+bool xfer_parse_ack(uint8_t dest, const uint8_t * dat, size_t len,
+                    xfer_event_t * ev){
+    if(len < 2){
+        return false;
+    }
+    ev->dest = dest;
+    ev->id = dat[1];
+    ev->seq = 0;
+    ev->success = true;
+    switch(dat[0]){
+        case CMD_WRITE_REQUEST_ACK:
+            ev->type = XFER_EV_REQUEST_ACK;
+            return true;
+        case CMD_WRITE_DATA_ACK:
+            if(len < 6){
+                return false;
+            }
+            ev->type = XFER_EV_DATA_ACK;
+            ev->seq = get_u32(dat + 2);
+            return true;
+        case CMD_WRITE_DONE_ACK:
+            ev->type = XFER_EV_DONE_ACK;
+            return true;
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,153 @@
+#ifndef XFER_H
+#define XFER_H
+#include <stddef.h>
+#include <stdint.h>
+
+// Picture transfers to the server, as state machines that never block, so
+// that the main loop keeps capturing while a picture goes out.
+//
+// A transfer announces the picture with a write request, sends its packets
+// with up to XFER_WINDOW of them waiting for their acks, waits for the last
+// acks and closes the picture with a write done:
+//
+//   REQUEST -> DATA -> DRAIN -> DONE -> COMPLETE (or FAILED)
+//
+// The dispatcher owns the link. It sends one frame at a time, the next one
+// once the XBee reports the transmit status of the last one, and advances
+// the transfers on events (transmit status and the server's acks) and on
+// their timers. Time is passed in, so that the same code runs on the host
+// in virtual time (see xfer_sim.h).
+//
+// Up to XFER_MAX_TRANSFERS transfers run at once, told apart by their
+// request id, so that one fills the link while another waits for acks.
+// The next frame comes from the highest priority transfer that has one to
+// send, and in turns among transfers of the same priority. A high priority
+// picture thus preempts the packets of a low priority one, which only gets
+// the link while the other waits.
+//
+// Each transfer goes to one destination, an index into the sender's list
+// of receivers. A picture for several receivers is one transfer each, all
+// from the same buffer, so that each receiver acks and gets its resends on
+// its own and a lossy one doesn't hold the others back.
+
+#define CMD_WRITE_REQUEST 0x02
+#define CMD_WRITE_DATA 0x03
+#define CMD_WRITE_DONE 0x04
+#define CMD_WRITE_REQUEST_ACK 0x13
+#define CMD_WRITE_DATA_ACK 0x14
+#define CMD_WRITE_DONE_ACK 0x15
+
+#define XFER_PACKET_SIZE 80
+#define XFER_HEADER_SIZE 6
+#define XFER_DATA_SIZE (XFER_PACKET_SIZE - XFER_HEADER_SIZE)
+
+#define XFER_WINDOW 24            // packets waiting for their acks
+#define XFER_ACK_TIMEOUT_MS 200   // before a frame is sent again
+#define XFER_LINK_TIMEOUT_MS 200  // before a lost transmit status is ignored
+#define XFER_MAX_RETRIES 20       // resends of a frame before giving up
+#define XFER_MAX_TRANSFERS 8
+
+#define XFER_PRIO_LOW 0   // periodic pictures
+#define XFER_PRIO_HIGH 1  // pictures asked for, or worth seeing first
+
+enum xfer_state {
+  XFER_IDLE,
+  XFER_REQUEST,   // waiting for the write request ack
+  XFER_DATA,      // sending packets
+  XFER_DRAIN,     // every packet sent, waiting for the last acks
+  XFER_DONE,      // waiting for the write done ack
+  XFER_COMPLETE,
+  XFER_FAILED,
+};
+
+enum xfer_event_type {
+  XFER_EV_TX_STATUS,
+  XFER_EV_REQUEST_ACK,
+  XFER_EV_DATA_ACK,
+  XFER_EV_DONE_ACK,
+};
+
+struct xfer_event {
+  uint8_t type;
+  uint8_t dest;   // receiver an ack comes from
+  uint8_t id;     // frame id of a transmit status, else request id
+  uint32_t seq;   // packet of a data ack
+  bool success;   // transmit status
+};
+typedef struct xfer_event xfer_event_t;
+
+struct xfer {
+  xfer_state state;
+  uint8_t dest;
+  uint8_t rid;
+  uint8_t prio;
+  const uint8_t * dat;
+  uint32_t len;
+  uint32_t frame_seq;
+  uint32_t pkt_cnt;
+  uint32_t base;  // oldest packet not acked
+  uint32_t next;  // next packet sent for the first time
+  // Packets base to next - 1, by seq % XFER_WINDOW.
+  uint32_t due_ms[XFER_WINDOW];  // when it is sent again
+  uint8_t tries[XFER_WINDOW];
+  bool acked[XFER_WINDOW];
+  // The write request or write done.
+  uint32_t ctl_due_ms;
+  uint8_t ctl_tries;
+  uint32_t start_ms;
+  uint32_t end_ms;
+  uint32_t sent;    // frames sent
+  uint32_t resent;  // of which were sent again
+};
+typedef struct xfer xfer_t;
+
+// Queues a frame to dest on the link and returns its frame id, or 0 if it
+// can't.
+typedef uint8_t (*xfer_send_fn)(void * ctx, uint8_t dest,
+                                const uint8_t * payload, size_t len);
+
+struct xfer_dispatcher {
+  xfer_send_fn send;
+  void * ctx;
+  xfer_t * active[XFER_MAX_TRANSFERS];
+  int turn;  // the last one that sent
+  uint8_t last_rid;
+  // The frame on the link, until its transmit status.
+  bool link_busy;
+  uint8_t link_fid;
+  uint32_t link_due_ms;
+  uint8_t link_rid;
+  uint32_t link_seq;  // XFER_NO_SEQ for a write request or done
+};
+typedef struct xfer_dispatcher xfer_dispatcher_t;
+
+#define XFER_NO_SEQ 0xffffffff
+
+void xfer_dispatcher_init(xfer_dispatcher_t * d, xfer_send_fn send,
+                          void * ctx, uint8_t last_rid);
+
+// Starts sending len bytes from dat to dest. dat must stay until the
+// transfer is over. Returns false if XFER_MAX_TRANSFERS are running or len
+// is 0.
+bool xfer_start(xfer_dispatcher_t * d, xfer_t * x, uint8_t dest,
+                const uint8_t * dat, uint32_t len, uint32_t frame_seq,
+                uint8_t prio, uint32_t now_ms);
+
+// True until the transfer completes or fails.
+bool xfer_busy(const xfer_t * x);
+
+// Number of transfers running.
+int xfer_count(const xfer_dispatcher_t * d);
+
+void xfer_handle_event(xfer_dispatcher_t * d, const xfer_event_t * ev,
+                       uint32_t now_ms);
+
+// Runs the timers that are due and sends the next frame if the link is
+// free. Call it from the main loop.
+void xfer_poll(xfer_dispatcher_t * d, uint32_t now_ms);
+
+// Reads a write request, data or done ack from receiver dest into ev.
+bool xfer_parse_ack(uint8_t dest, const uint8_t * dat, size_t len,
+                    xfer_event_t * ev);
+
+#endif
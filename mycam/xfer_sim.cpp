@@ -0,0 +1,166 @@
+#include "xfer_sim.h"
+
+#include <string.h>
+
+static bool lost(xfer_sim_t * sim, uint8_t dest){
+    uint32_t loss_pct = sim->config.loss_pct;
+    if(dest < XFER_SIM_MAX_DESTS){
+        loss_pct += sim->extra_loss_pct[dest];
+    }
+    return sim->rng.Below(100) < loss_pct;
+}
+
+static void schedule(xfer_sim_t * sim, uint32_t at_ms,
+                     const xfer_event_t * ev){
+    if(sim->event_count == XFER_SIM_MAX_EVENTS){
+        return;
+    }
+    sim->events[sim->event_count].at_ms = at_ms;
+    sim->events[sim->event_count].ev = *ev;
+    sim->event_count++;
+}
+
+// A receiver's ack to a frame, parsed as the firmware would.
+static void ack(xfer_sim_t * sim, uint8_t dest, uint32_t at_ms, uint8_t cmd,
+                uint8_t rid, uint32_t seq){
+    if(lost(sim, dest)){
+        return;
+    }
+    uint8_t payload[6] = {cmd, rid, (uint8_t)(seq >> 24), (uint8_t)(seq >> 16),
+                          (uint8_t)(seq >> 8), (uint8_t)seq};
+    xfer_event_t ev;
+    if(xfer_parse_ack(dest, payload, sizeof(payload), &ev)){
+        schedule(sim, at_ms + sim->config.ack_delay_ms, &ev);
+    }
+}
+
+static uint32_t get_u32(const uint8_t * p){
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | p[3];
+}
+
+static xfer_sim_picture_t * find_picture(xfer_sim_t * sim, uint8_t dest,
+                                         uint8_t rid){
+    for(int i = 0; i < sim->picture_count; i++){
+        if(sim->pictures[i].dest == dest && sim->pictures[i].rid == rid){
+            return &sim->pictures[i];
+        }
+    }
+    return NULL;
+}
+
+static void receive(xfer_sim_t * sim, uint8_t dest, uint32_t at_ms,
+                    const uint8_t * payload, size_t len){
+    uint8_t rid = payload[1];
+    xfer_sim_picture_t * p = find_picture(sim, dest, rid);
+    if(p == NULL){
+        return;
+    }
+    switch(payload[0]){
+        case CMD_WRITE_REQUEST:
+            p->requested = true;
+            p->len = get_u32(payload + 2);
+            p->pkt_cnt = get_u32(payload + 6);
+            p->frame_seq = get_u32(payload + 10);
+            ack(sim, dest, at_ms, CMD_WRITE_REQUEST_ACK, rid, p->len);
+            break;
+        case CMD_WRITE_DATA: {
+            uint32_t seq = get_u32(payload + 2);
+            size_t n = len - XFER_HEADER_SIZE;
+            size_t offset = (size_t)seq * XFER_DATA_SIZE;
+            if(!p->requested || seq >= XFER_SIM_MAX_PACKETS ||
+               offset + n > p->size){
+                break;
+            }
+            memcpy(p->buf + offset, payload + XFER_HEADER_SIZE, n);
+            if(!p->got[seq]){
+                p->got[seq] = true;
+                p->packets++;
+            }
+            ack(sim, dest, at_ms, CMD_WRITE_DATA_ACK, rid, seq);
+            break;
+        }
+        case CMD_WRITE_DONE:
+            if(p->requested){
+                if(!p->done){
+                    p->done = true;
+                    p->done_ms = at_ms;
+                }
+                ack(sim, dest, at_ms, CMD_WRITE_DONE_ACK, rid, p->pkt_cnt);
+            }
+            break;
+    }
+}
+
+void xfer_sim_init(xfer_sim_t * sim, const xfer_sim_config_t * config){
+    *sim = xfer_sim_t();
+    sim->config = *config;
+    sim->rng = tflite::testing::Random(config->seed);
+}
+
+xfer_sim_picture_t * xfer_sim_expect(xfer_sim_t * sim, uint8_t dest,
+                                     uint8_t rid, uint8_t * buf, size_t size){
+    if(sim->picture_count == XFER_SIM_MAX_PICTURES){
+        return NULL;
+    }
+    xfer_sim_picture_t * p = &sim->pictures[sim->picture_count++];
+    memset(p, 0, sizeof(*p));
+    p->dest = dest;
+    p->rid = rid;
+    p->buf = buf;
+    p->size = size;
+    return p;
+}
+
+uint8_t xfer_sim_send(void * ctx, uint8_t dest, const uint8_t * payload,
+                      size_t len){
+    xfer_sim_t * sim = (xfer_sim_t *)ctx;
+    if((int32_t)(sim->link_free_ms - sim->now_ms) > 0){
+        sim->overlaps++;
+    } else {
+        sim->link_free_ms = sim->now_ms;
+    }
+    sim->link_free_ms += sim->config.frame_ms;
+    sim->frames++;
+    sim->busy_ms += sim->config.frame_ms;
+    if(++sim->last_fid == 0){
+        sim->last_fid = 1;
+    }
+
+    xfer_event_t status;
+    status.type = XFER_EV_TX_STATUS;
+    status.dest = dest;
+    status.id = sim->last_fid;
+    status.seq = 0;
+    status.success = !lost(sim, dest);
+    schedule(sim, sim->link_free_ms, &status);
+    if(status.success){
+        receive(sim, dest, sim->link_free_ms, payload, len);
+    }
+    return sim->last_fid;
+}
+
+void xfer_sim_step(xfer_sim_t * sim, xfer_dispatcher_t * d){
+    int i = 0;
+    while(i < sim->event_count){
+        struct xfer_sim_event * e = &sim->events[i];
+        if((int32_t)(sim->now_ms - e->at_ms) < 0){
+            i++;
+            continue;
+        }
+        xfer_event_t ev = e->ev;
+        *e = sim->events[--sim->event_count];
+        xfer_handle_event(d, &ev, sim->now_ms);
+    }
+    xfer_poll(d, sim->now_ms);
+    sim->now_ms++;
+}
+
+uint32_t xfer_sim_run(xfer_sim_t * sim, xfer_dispatcher_t * d,
+                      uint32_t max_ms){
+    uint32_t start_ms = sim->now_ms;
+    while(xfer_count(d) > 0 && sim->now_ms - start_ms < max_ms){
+        xfer_sim_step(sim, d);
+    }
+    return sim->now_ms - start_ms;
+}
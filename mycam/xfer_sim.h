@@ -0,0 +1,91 @@
+#ifndef XFER_SIM_H
+#define XFER_SIM_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/testing/random.h"
+#include "xfer.h"
+
+// A host model of the XBee link and of the receivers of the pictures, in
+// virtual time, to run transfers through the dispatcher without hardware.
+//
+// A frame keeps the link busy for frame_ms, after which the XBee reports
+// its transmit status: a failure if the frame was lost. A receiver acks
+// every frame it gets after ack_delay_ms, and acks can be lost too. Each
+// receiver takes the pictures it is told to expect, by request id, and can
+// be further away than the others.
+
+#define XFER_SIM_MAX_EVENTS 256
+#define XFER_SIM_MAX_PACKETS 1024
+#define XFER_SIM_MAX_PICTURES 8
+#define XFER_SIM_MAX_DESTS 4
+
+struct xfer_sim_config {
+  uint32_t frame_ms;
+  uint32_t ack_delay_ms;
+  uint32_t loss_pct;  // of the frames and of the acks
+  uint32_t seed;
+};
+typedef struct xfer_sim_config xfer_sim_config_t;
+
+struct xfer_sim_event {
+  uint32_t at_ms;
+  xfer_event_t ev;
+};
+
+// A picture as a receiver gets it.
+struct xfer_sim_picture {
+  uint8_t dest;
+  uint8_t rid;
+  uint8_t * buf;
+  size_t size;
+  bool requested;
+  uint32_t len;
+  uint32_t pkt_cnt;
+  uint32_t frame_seq;
+  uint32_t packets;  // distinct packets received
+  bool got[XFER_SIM_MAX_PACKETS];
+  bool done;
+  uint32_t done_ms;
+};
+typedef struct xfer_sim_picture xfer_sim_picture_t;
+
+struct xfer_sim {
+  xfer_sim_config_t config;
+  uint32_t now_ms;
+  tflite::testing::Random rng;
+  struct xfer_sim_event events[XFER_SIM_MAX_EVENTS];
+  int event_count;
+  uint8_t last_fid;
+  uint32_t link_free_ms;
+  uint32_t frames;   // sent by the dispatcher
+  uint32_t overlaps; // sent while the link was busy
+  uint32_t busy_ms;  // link time the frames took
+  // Loss to and from each receiver, on top of config.loss_pct.
+  uint32_t extra_loss_pct[XFER_SIM_MAX_DESTS];
+  xfer_sim_picture_t pictures[XFER_SIM_MAX_PICTURES];
+  int picture_count;
+};
+typedef struct xfer_sim xfer_sim_t;
+
+void xfer_sim_init(xfer_sim_t * sim, const xfer_sim_config_t * config);
+
+// Has receiver dest take the picture of request rid into size bytes at
+// buf.
+xfer_sim_picture_t * xfer_sim_expect(xfer_sim_t * sim, uint8_t dest,
+                                     uint8_t rid, uint8_t * buf, size_t size);
+
+// The dispatcher's send function, with the simulation as its context.
+uint8_t xfer_sim_send(void * ctx, uint8_t dest, const uint8_t * payload,
+                      size_t len);
+
+// Delivers the events due now, polls the dispatcher and moves time on by a
+// millisecond.
+void xfer_sim_step(xfer_sim_t * sim, xfer_dispatcher_t * d);
+
+// Steps until every transfer is over or max_ms have passed, and returns
+// the time taken.
+uint32_t xfer_sim_run(xfer_sim_t * sim, xfer_dispatcher_t * d,
+                      uint32_t max_ms);
+
+#endif
@@ -0,0 +1,250 @@
+#include "xfer.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "xfer_sim.h"
+
+namespace {
+
+constexpr size_t kPictureSize = 10000;
+constexpr int kPictures = XFER_MAX_TRANSFERS;
+constexpr int kReceivers = 3;
+
+uint8_t g_picture[kPictureSize];
+uint8_t g_received[kPictures][kPictureSize];
+xfer_sim_t g_sim;
+xfer_dispatcher_t g_dispatcher;
+xfer_t g_xfers[kPictures + 1];
+
+void Setup(uint32_t frame_ms, uint32_t ack_delay_ms, uint32_t loss_pct) {
+  for (size_t i = 0; i < kPictureSize; ++i) {
+    g_picture[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+  }
+  memset(g_received, 0, sizeof(g_received));
+  const xfer_sim_config_t config = {frame_ms, ack_delay_ms, loss_pct, 1};
+  xfer_sim_init(&g_sim, &config);
+  xfer_dispatcher_init(&g_dispatcher, xfer_sim_send, &g_sim, 7);
+}
+
+// Starts transfer n of len bytes of g_picture, for receiver dest to take
+// into g_received[n].
+xfer_sim_picture_t* Start(int n, uint32_t len, uint8_t prio,
+                          uint8_t dest = 0) {
+  if (!xfer_start(&g_dispatcher, &g_xfers[n], dest, g_picture, len, n, prio,
+                  g_sim.now_ms)) {
+    return nullptr;
+  }
+  return xfer_sim_expect(&g_sim, dest, g_xfers[n].rid, g_received[n],
+                         kPictureSize);
+}
+
+bool Received(const xfer_sim_picture_t* p, int n, size_t len) {
+  return p->done && p->len == len &&
+         memcmp(g_picture, g_received[n], len) == 0;
+}
+
+// Percent of the time the link carried frames.
+uint32_t Utilization(uint32_t elapsed_ms) {
+  return g_sim.busy_ms * 100 / elapsed_ms;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestSendsPictureOverCleanLink) {
+  Setup(5, 20, 0);
+  xfer_sim_picture_t* p = Start(0, 1000, XFER_PRIO_LOW);
+  TF_LITE_MICRO_EXPECT_EQ(8, g_xfers[0].rid);
+  TF_LITE_MICRO_EXPECT_EQ(14u, g_xfers[0].pkt_cnt);
+  xfer_sim_run(&g_sim, &g_dispatcher, 10000);
+
+  TF_LITE_MICRO_EXPECT_EQ(XFER_COMPLETE, g_xfers[0].state);
+  TF_LITE_MICRO_EXPECT_TRUE(Received(p, 0, 1000));
+  TF_LITE_MICRO_EXPECT_EQ(0u, p->frame_seq);
+  TF_LITE_MICRO_EXPECT_EQ(14u, p->pkt_cnt);
+  // Request, packets and done, each once and one at a time.
+  TF_LITE_MICRO_EXPECT_EQ(16u, g_xfers[0].sent);
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_xfers[0].resent);
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_sim.overlaps);
+  TF_LITE_MICRO_EXPECT_EQ(0, xfer_count(&g_dispatcher));
+}
+
+TF_LITE_MICRO_TEST(TestPacketsDoNotWaitForEachOthersAcks) {
+  // Acks take 20 frames to come back, so waiting for each one would take
+  // about 136 * 105 ms.
+  Setup(5, 100, 0);
+  xfer_sim_picture_t* p = Start(0, kPictureSize, XFER_PRIO_LOW);
+  const xfer_t* x = &g_xfers[0];
+  uint32_t in_flight = 0;
+  while (xfer_busy(x) && g_sim.now_ms < 60000) {
+    xfer_sim_step(&g_sim, &g_dispatcher);
+    if (x->next - x->base > in_flight) {
+      in_flight = x->next - x->base;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_EQ(XFER_COMPLETE, x->state);
+  TF_LITE_MICRO_EXPECT_TRUE(Received(p, 0, kPictureSize));
+  TF_LITE_MICRO_EXPECT_GT(in_flight, 1u);
+  TF_LITE_MICRO_EXPECT_LE(in_flight, static_cast<uint32_t>(XFER_WINDOW));
+  TF_LITE_MICRO_EXPECT_LE(x->end_ms - x->start_ms, 1500u);
+}
+
+TF_LITE_MICRO_TEST(TestResendsLostFramesAndAcks) {
+  Setup(5, 20, 20);
+  xfer_sim_picture_t* p = Start(0, kPictureSize, XFER_PRIO_LOW);
+  xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+
+  TF_LITE_MICRO_EXPECT_EQ(XFER_COMPLETE, g_xfers[0].state);
+  TF_LITE_MICRO_EXPECT_TRUE(Received(p, 0, kPictureSize));
+  TF_LITE_MICRO_EXPECT_EQ(p->pkt_cnt, p->packets);
+  TF_LITE_MICRO_EXPECT_GT(g_xfers[0].resent, 0u);
+  TF_LITE_MICRO_EXPECT_EQ(g_sim.frames, g_xfers[0].sent);
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_sim.overlaps);
+}
+
+TF_LITE_MICRO_TEST(TestFailsWhenTheServerIsGone) {
+  Setup(5, 20, 100);
+  Start(0, 1000, XFER_PRIO_LOW);
+  xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+
+  TF_LITE_MICRO_EXPECT_EQ(XFER_FAILED, g_xfers[0].state);
+  TF_LITE_MICRO_EXPECT_EQ(XFER_MAX_RETRIES + 1,
+                          static_cast<int>(g_xfers[0].sent));
+  TF_LITE_MICRO_EXPECT_EQ(0, xfer_count(&g_dispatcher));
+
+  // The next transfer gets the link and a new request id.
+  TF_LITE_MICRO_EXPECT_TRUE(Start(1, 1000, XFER_PRIO_LOW) != nullptr);
+  TF_LITE_MICRO_EXPECT_EQ(g_xfers[0].rid + 1, g_xfers[1].rid);
+}
+
+TF_LITE_MICRO_TEST(TestAcksGoToTheirOwnTransfer) {
+  Setup(5, 20, 0);
+  TF_LITE_MICRO_EXPECT_FALSE(xfer_start(&g_dispatcher, &g_xfers[0], 0,
+                                        g_picture, 0, 1, XFER_PRIO_LOW, 0));
+  for (int n = 0; n < kPictures; ++n) {
+    TF_LITE_MICRO_EXPECT_TRUE(Start(n, 1000, XFER_PRIO_LOW) != nullptr);
+  }
+  TF_LITE_MICRO_EXPECT_FALSE(xfer_start(&g_dispatcher, &g_xfers[kPictures],
+                                        0, g_picture, 1000, 1, XFER_PRIO_LOW,
+                                        0));
+
+  xfer_event_t ev = {XFER_EV_REQUEST_ACK, 0, 7, 0, true};
+  xfer_handle_event(&g_dispatcher, &ev, 0);
+  // Nor do acks from another receiver.
+  ev.dest = 1;
+  ev.id = g_xfers[1].rid;
+  xfer_handle_event(&g_dispatcher, &ev, 0);
+  TF_LITE_MICRO_EXPECT_EQ(XFER_REQUEST, g_xfers[1].state);
+  ev.dest = 0;
+  xfer_handle_event(&g_dispatcher, &ev, 0);
+  TF_LITE_MICRO_EXPECT_EQ(XFER_REQUEST, g_xfers[0].state);
+  TF_LITE_MICRO_EXPECT_EQ(XFER_DATA, g_xfers[1].state);
+  TF_LITE_MICRO_EXPECT_EQ(XFER_REQUEST, g_xfers[2].state);
+}
+
+TF_LITE_MICRO_TEST(TestConcurrentTransfersKeepTheLinkBusy) {
+  // One picture at a time leaves the link idle while the request, the last
+  // acks and the done go round.
+  constexpr int kTogether = 4;
+  Setup(5, 100, 0);
+  uint32_t one_at_a_time_ms = 0;
+  for (int n = 0; n < kTogether; ++n) {
+    Start(n, 3000, XFER_PRIO_LOW);
+    one_at_a_time_ms += xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+  }
+  const uint32_t one_at_a_time = Utilization(one_at_a_time_ms);
+
+  Setup(5, 100, 0);
+  xfer_sim_picture_t* p[kTogether];
+  for (int n = 0; n < kTogether; ++n) {
+    p[n] = Start(n, 3000, XFER_PRIO_LOW);
+  }
+  const uint32_t together_ms = xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+  for (int n = 0; n < kTogether; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(XFER_COMPLETE, g_xfers[n].state);
+    TF_LITE_MICRO_EXPECT_TRUE(Received(p[n], n, 3000));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_sim.overlaps);
+  TF_LITE_MICRO_EXPECT_LE(together_ms * 10, one_at_a_time_ms * 7);
+  TF_LITE_MICRO_EXPECT_GT(Utilization(together_ms), one_at_a_time + 20);
+  TF_LITE_MICRO_EXPECT_GT(Utilization(together_ms), 70u);
+}
+
+TF_LITE_MICRO_TEST(TestHighPriorityPicturePreemptsLowPriorityOne) {
+  Setup(5, 20, 0);
+  Start(0, 2000, XFER_PRIO_HIGH);
+  const uint32_t alone_ms = xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+
+  Setup(5, 20, 0);
+  xfer_sim_picture_t* low = Start(0, kPictureSize, XFER_PRIO_LOW);
+  while (g_sim.now_ms < 200) {
+    xfer_sim_step(&g_sim, &g_dispatcher);
+  }
+  xfer_sim_picture_t* high = Start(1, 2000, XFER_PRIO_HIGH);
+  xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+
+  TF_LITE_MICRO_EXPECT_TRUE(Received(high, 1, 2000));
+  TF_LITE_MICRO_EXPECT_TRUE(Received(low, 0, kPictureSize));
+  // The high priority picture only waits for the frame on the link.
+  TF_LITE_MICRO_EXPECT_LE(g_xfers[1].end_ms - g_xfers[1].start_ms,
+                          alone_ms + 5);
+  TF_LITE_MICRO_EXPECT_LE(high->done_ms, low->done_ms);
+}
+
+TF_LITE_MICRO_TEST(TestSendsOneCaptureToEveryReceiver) {
+  Setup(5, 100, 0);
+  xfer_sim_picture_t* p[kReceivers];
+  for (int n = 0; n < kReceivers; ++n) {
+    p[n] = Start(n, kPictureSize, XFER_PRIO_LOW, n);
+  }
+  const uint32_t elapsed_ms = xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+  for (int n = 0; n < kReceivers; ++n) {
+    TF_LITE_MICRO_EXPECT_EQ(XFER_COMPLETE, g_xfers[n].state);
+    TF_LITE_MICRO_EXPECT_TRUE(Received(p[n], n, kPictureSize));
+    TF_LITE_MICRO_EXPECT_TRUE(g_xfers[n].dat == g_picture);
+  }
+  // Each receiver got each packet once, in one pass over the link.
+  TF_LITE_MICRO_EXPECT_EQ(kReceivers * (g_xfers[0].pkt_cnt + 2), g_sim.frames);
+  TF_LITE_MICRO_EXPECT_GT(Utilization(elapsed_ms), 80u);
+}
+
+TF_LITE_MICRO_TEST(TestLossyReceiverDoesNotHoldBackTheOthers) {
+  Setup(5, 20, 0);
+  g_sim.extra_loss_pct[2] = 30;
+  xfer_sim_picture_t* p[kReceivers];
+  for (int n = 0; n < kReceivers; ++n) {
+    p[n] = Start(n, kPictureSize, XFER_PRIO_LOW, n);
+  }
+  xfer_sim_run(&g_sim, &g_dispatcher, 60000);
+  for (int n = 0; n < kReceivers; ++n) {
+    TF_LITE_MICRO_EXPECT_TRUE(Received(p[n], n, kPictureSize));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_xfers[0].resent);
+  TF_LITE_MICRO_EXPECT_EQ(0u, g_xfers[1].resent);
+  TF_LITE_MICRO_EXPECT_GT(g_xfers[2].resent, 0u);
+  TF_LITE_MICRO_EXPECT_LE(g_xfers[0].end_ms, g_xfers[2].end_ms);
+  TF_LITE_MICRO_EXPECT_LE(g_xfers[1].end_ms, g_xfers[2].end_ms);
+}
+
+TF_LITE_MICRO_TEST(TestParsesAcks) {
+  const uint8_t data_ack[] = {CMD_WRITE_DATA_ACK, 9, 0x01, 0x02, 0x03, 0x04};
+  const uint8_t done_ack[] = {CMD_WRITE_DONE_ACK, 9};
+  const uint8_t other[] = {0x16, 9, 0, 0, 0, 0};
+  xfer_event_t ev;
+  TF_LITE_MICRO_EXPECT_TRUE(
+      xfer_parse_ack(2, data_ack, sizeof(data_ack), &ev));
+  TF_LITE_MICRO_EXPECT_EQ(XFER_EV_DATA_ACK, ev.type);
+  TF_LITE_MICRO_EXPECT_EQ(2, ev.dest);
+  TF_LITE_MICRO_EXPECT_EQ(9, ev.id);
+  TF_LITE_MICRO_EXPECT_EQ(0x01020304u, ev.seq);
+  TF_LITE_MICRO_EXPECT_FALSE(xfer_parse_ack(2, data_ack, 5, &ev));
+  TF_LITE_MICRO_EXPECT_TRUE(
+      xfer_parse_ack(0, done_ack, sizeof(done_ack), &ev));
+  TF_LITE_MICRO_EXPECT_EQ(XFER_EV_DONE_ACK, ev.type);
+  TF_LITE_MICRO_EXPECT_FALSE(xfer_parse_ack(0, other, sizeof(other), &ev));
+}
+
+TF_LITE_MICRO_TESTS_END
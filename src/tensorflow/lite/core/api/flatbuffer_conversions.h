@@ -45,6 +45,11 @@ class BuiltinDataAllocator {
     // platform targets support that properly.
     static_assert(std::is_pod<T>::value, "Builtin data structure must be POD.");
     void* allocated_memory = this->Allocate(sizeof(T), alignof(T));
+    // Allocators backed by a fixed arena return nullptr when they run out of
+    // memory; the parse functions check for that, so don't construct into it.
+    if (allocated_memory == nullptr) {
+      return nullptr;
+    }
     return new (allocated_memory) T();
   }
 
@@ -23,6 +23,7 @@ AllOpsResolver::AllOpsResolver() {
   AddArgMax();
   AddArgMin();
   AddAveragePool2D();
+  AddBlockSparseFullyConnected();
   AddCeil();
   AddConcatenation();
   AddConv2D();
@@ -0,0 +1,33 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/arena_snapshot.h"
+
+#include <cstddef>
+
+namespace tflite {
+
+uint32_t ArenaSnapshotHash(const void* data, size_t bytes, uint32_t hash) {
+  const uint8_t* bytes_data = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < bytes; ++i) {
+    hash = (hash ^ bytes_data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t ArenaSnapshotHeaderHash(const ArenaSnapshotHeader& header) {
+  return ArenaSnapshotHash(&header, offsetof(ArenaSnapshotHeader, header_hash));
+}
+
+}  // namespace tflite
@@ -0,0 +1,97 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_ARENA_SNAPSHOT_H_
+#define TENSORFLOW_LITE_MICRO_ARENA_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// An arena snapshot is the persistent section of a tensor arena as left by
+// MicroInterpreter::AllocateTensors() - eval tensors, nodes, op data, kernel
+// state, scratch buffer handles and variable tensors - plus the few values
+// the interpreter and allocator keep outside of the arena. Restoring one with
+// MicroInterpreter::RestoreArenaSnapshot() skips parsing the flatbuffer, the
+// kernels' Init and Prepare and memory planning.
+//
+// The persistent section is full of absolute pointers into the arena, the
+// model, the op resolver and kernel code. A snapshot can therefore only be
+// restored by the same firmware, with the model, op resolver and arena at the
+// same addresses, which the header records and checks.
+
+constexpr uint32_t kArenaSnapshotMagic = 0x50414E53;  // "SNAP"
+constexpr uint32_t kArenaSnapshotVersion = 2;
+
+// Seed of ArenaSnapshotHash().
+constexpr uint32_t kArenaSnapshotHashSeed = 2166136261u;
+
+struct ArenaSnapshotHeader {
+  uint32_t magic;
+  uint32_t version;
+  // Identifies the contents of the model, e.g. ArenaSnapshotHash() of the
+  // flatbuffer, since constant data derived from it is part of the snapshot.
+  uint32_t model_hash;
+  // Hash of the kernel functions of every node and of the interpreter
+  // settings (workers, weight packing budget, operator fusion, compact tensor
+  // metadata). Changes with the firmware in practice.
+  uint32_t code_hash;
+  uintptr_t model_address;
+  uintptr_t op_resolver_address;
+  // The aligned arena managed by the allocator.
+  uintptr_t arena_address;
+  uint32_t arena_bytes;
+  // Bytes allocated from the tail of the arena before AllocateTensors(), e.g.
+  // the allocator itself, and by it. The snapshot data is the difference.
+  uint32_t tail_bytes_before;
+  uint32_t tail_bytes_after;
+  // Size of the head section, which holds the non-persistent buffers.
+  uint32_t head_bytes;
+  uintptr_t node_and_registrations;
+  uintptr_t eval_tensors;
+  // Only set with compact tensor metadata: the slot table of eval_tensors and
+  // the structs that constant tensors are rebuilt into.
+  uintptr_t eval_tensor_slots;
+  uintptr_t constant_tensors;
+  uint32_t constant_tensors_size;
+  uintptr_t scratch_buffer_handles;
+  uint32_t fused_operators_size;
+  uint32_t packed_weight_bytes;
+  // ArenaSnapshotHash() of the data.
+  uint32_t data_hash;
+  // ArenaSnapshotHash() of all the fields above.
+  uint32_t header_hash;
+
+  // Bytes of persistent arena data that follow the header.
+  size_t data_bytes() const { return tail_bytes_after - tail_bytes_before; }
+};
+
+// The header and the data of a snapshot. The data points into the arena, so
+// it must be saved before the arena is used for anything else.
+struct ArenaSnapshot {
+  ArenaSnapshotHeader header;
+  const uint8_t* data;
+};
+
+// 32-bit FNV-1a hash of `bytes` from `data`, continuing from `hash`.
+uint32_t ArenaSnapshotHash(const void* data, size_t bytes,
+                           uint32_t hash = kArenaSnapshotHashSeed);
+
+// Returns the hash of the fields of `header` that precede header_hash.
+uint32_t ArenaSnapshotHeaderHash(const ArenaSnapshotHeader& header);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_ARENA_SNAPSHOT_H_
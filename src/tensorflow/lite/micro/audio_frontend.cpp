@@ -0,0 +1,423 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/audio_frontend.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kWindowBits = 12;
+constexpr int kFilterbankBits = 12;
+constexpr int kNoiseReductionBits = 14;
+constexpr int kLogScaleLog2 = 16;
+constexpr int kLogScale = 1 << kLogScaleLog2;
+constexpr int kLogSegmentsLog2 = 7;
+// ln(2) in Q16.
+constexpr uint32_t kLogCoeff = 45426;
+// log2(1 + x) - x in Q16 at x = k / 128.
+constexpr uint16_t kLogLut[] = {
+    0, 224, 442, 654, 861, 1063, 1259, 1450, 1636, 1817, 1992, 2163, 2329, 2490,
+    2646, 2797, 2944, 3087, 3224, 3358, 3487, 3611, 3732, 3848, 3960, 4068,
+    4172, 4272, 4368, 4460, 4549, 4633, 4714, 4791, 4864, 4934, 5001, 5063,
+    5123, 5178, 5231, 5280, 5326, 5368, 5408, 5444, 5477, 5507, 5533, 5557,
+    5578, 5595, 5610, 5622, 5631, 5637, 5640, 5641, 5638, 5633, 5626, 5615,
+    5602, 5586, 5568, 5547, 5524, 5498, 5470, 5439, 5406, 5370, 5332, 5291,
+    5249, 5203, 5156, 5106, 5054, 5000, 4944, 4885, 4825, 4762, 4697, 4630,
+    4561, 4490, 4416, 4341, 4264, 4184, 4103, 4020, 3935, 3848, 3759, 3668,
+    3575, 3481, 3384, 3286, 3186, 3084, 2981, 2875, 2768, 2659, 2549, 2437,
+    2323, 2207, 2090, 1971, 1851, 1729, 1605, 1480, 1353, 1224, 1094, 963, 830,
+    695, 559, 421, 282, 142, 0,
+};
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Position of the highest set bit counting from 1, or 0 for 0.
+int MostSignificantBit(uint32_t x) {
+  return x == 0 ? 0 : 32 - CountLeadingZeros(x);
+}
+
+int16_t Saturate16(int32_t x) {
+  return static_cast<int16_t>(x > INT16_MAX ? INT16_MAX
+                                            : x < INT16_MIN ? INT16_MIN : x);
+}
+
+AudioFrontendComplex Twiddle(double phase) {
+  return {Saturate16(static_cast<int32_t>(std::round(std::cos(phase) * 32767))),
+          Saturate16(
+              static_cast<int32_t>(std::round(std::sin(phase) * 32767)))};
+}
+
+// a * b with b in Q15.
+AudioFrontendComplex Multiply(int32_t a_real, int32_t a_imag,
+                              AudioFrontendComplex b) {
+  return {static_cast<int16_t>(
+              (a_real * b.real - a_imag * b.imag + (1 << 14)) >> 15),
+          static_cast<int16_t>(
+              (a_real * b.imag + a_imag * b.real + (1 << 14)) >> 15)};
+}
+
+// Rounded square root.
+uint32_t Sqrt64(uint64_t x) {
+  uint64_t result = 0;
+  uint64_t bit = uint64_t{1} << 62;
+  while (bit > x) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (x >= result + bit) {
+      x -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  if (x > result) {
+    ++result;
+  }
+  return static_cast<uint32_t>(result);
+}
+
+// Fractional part of log2(x) in Q16, for x with its highest bit at `log2x`.
+uint32_t Log2FractionPart(uint32_t x, int log2x) {
+  int32_t frac = x - (uint32_t{1} << log2x);
+  if (log2x < kLogScaleLog2) {
+    frac <<= kLogScaleLog2 - log2x;
+  } else {
+    frac >>= log2x - kLogScaleLog2;
+  }
+  // Linear interpolation of the correction to log2(1 + frac) - frac.
+  const uint32_t base_segment = frac >> (kLogScaleLog2 - kLogSegmentsLog2);
+  const uint32_t segment_unit = kLogScale >> kLogSegmentsLog2;
+  const int32_t c0 = kLogLut[base_segment];
+  const int32_t c1 = kLogLut[base_segment + 1];
+  const int32_t segment_base = segment_unit * base_segment;
+  const int32_t relative = ((c1 - c0) * (frac - segment_base)) >> kLogScaleLog2;
+  return frac + c0 + relative;
+}
+
+// ln(x) << scale_shift, for x > 1.
+uint32_t Log(uint32_t x, int scale_shift) {
+  const int integer = MostSignificantBit(x) - 1;
+  const uint32_t log2 =
+      (static_cast<uint32_t>(integer) << kLogScaleLog2) +
+      Log2FractionPart(x, integer);
+  const uint32_t round = kLogScale / 2;
+  const uint32_t loge = (static_cast<uint64_t>(kLogCoeff) * log2 + round) >>
+                        kLogScaleLog2;
+  return ((loge << scale_shift) + round) >> kLogScaleLog2;
+}
+
+float Mel(float frequency) {
+  return 1127.0f * std::log(1.0f + frequency / 700.0f);
+}
+
+}  // namespace
+
+TfLiteStatus FixedPointRealFft::Init(int fft_size) {
+  if (fft_size < 4 || fft_size > kAudioFrontendMaxFftSize ||
+      (fft_size & (fft_size - 1)) != 0) {
+    return kTfLiteError;
+  }
+  fft_size_ = fft_size;
+  const int complex_size = fft_size / 2;
+  for (int k = 0; k < complex_size / 2; ++k) {
+    twiddles_[k] = Twiddle(-2 * kPi * k / complex_size);
+    split_twiddles_[k] =
+        Twiddle(-kPi * (static_cast<double>(k + 1) / complex_size + 0.5));
+  }
+  return kTfLiteOk;
+}
+
+void FixedPointRealFft::Compute(const int16_t* input,
+                                AudioFrontendComplex* output) {
+  const int complex_size = fft_size_ / 2;
+
+  // Pack pairs of real samples into complex ones, in bit-reversed order.
+  for (int i = 0, j = 0; i < complex_size; ++i) {
+    work_[j] = {input[2 * i], input[2 * i + 1]};
+    int bit = complex_size >> 1;
+    while (j & bit) {
+      j ^= bit;
+      bit >>= 1;
+    }
+    j |= bit;
+  }
+
+  // Radix-2 butterflies, each stage halving its results like kiss_fft.
+  for (int size = 2; size <= complex_size; size *= 2) {
+    const int half = size / 2;
+    const int twiddle_step = complex_size / size;
+    for (int start = 0; start < complex_size; start += size) {
+      AudioFrontendComplex* a = work_ + start;
+      AudioFrontendComplex* b = a + half;
+      for (int j = 0; j < half; ++j) {
+        const AudioFrontendComplex t =
+            Multiply(b[j].real, b[j].imag, twiddles_[j * twiddle_step]);
+        const int32_t real = a[j].real;
+        const int32_t imag = a[j].imag;
+        a[j].real = static_cast<int16_t>((real + t.real + 1) >> 1);
+        a[j].imag = static_cast<int16_t>((imag + t.imag + 1) >> 1);
+        b[j].real = static_cast<int16_t>((real - t.real + 1) >> 1);
+        b[j].imag = static_cast<int16_t>((imag - t.imag + 1) >> 1);
+      }
+    }
+  }
+
+  // Split the transform of the packed sequence into the real transform.
+  const int32_t dc_real = (work_[0].real + 1) >> 1;
+  const int32_t dc_imag = (work_[0].imag + 1) >> 1;
+  output[0] = {Saturate16(dc_real + dc_imag), 0};
+  output[complex_size] = {Saturate16(dc_real - dc_imag), 0};
+  for (int k = 1; k <= complex_size / 2; ++k) {
+    const int32_t pk_real = (work_[k].real + 1) >> 1;
+    const int32_t pk_imag = (work_[k].imag + 1) >> 1;
+    const int32_t pnk_real = (work_[complex_size - k].real + 1) >> 1;
+    const int32_t pnk_imag = -((work_[complex_size - k].imag + 1) >> 1);
+    const int32_t f1_real = pk_real + pnk_real;
+    const int32_t f1_imag = pk_imag + pnk_imag;
+    const AudioFrontendComplex t = Multiply(
+        pk_real - pnk_real, pk_imag - pnk_imag, split_twiddles_[k - 1]);
+    output[k] = {static_cast<int16_t>((f1_real + t.real) >> 1),
+                 static_cast<int16_t>((f1_imag + t.imag) >> 1)};
+    output[complex_size - k] = {
+        static_cast<int16_t>((f1_real - t.real) >> 1),
+        static_cast<int16_t>((t.imag - f1_imag) >> 1)};
+  }
+}
+
+TfLiteStatus AudioFrontend::Init(const AudioFrontendConfig& config) {
+  window_size_ = config.sample_rate * config.window_size_ms / 1000;
+  window_step_ = config.sample_rate * config.window_step_ms / 1000;
+  num_channels_ = config.num_channels;
+  if (window_size_ <= 0 || window_size_ > kAudioFrontendMaxFftSize ||
+      window_step_ <= 0 || window_step_ > window_size_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Unsupported window of %d samples every %d",
+                         window_size_, window_step_);
+    return kTfLiteError;
+  }
+  if (num_channels_ <= 0 || num_channels_ > kAudioFrontendMaxChannels ||
+      config.lower_band_limit <= 0 ||
+      config.lower_band_limit >= config.upper_band_limit ||
+      config.upper_band_limit > config.sample_rate / 2) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Unsupported filterbank");
+    return kTfLiteError;
+  }
+  int fft_size = 4;
+  while (fft_size < window_size_) {
+    fft_size *= 2;
+  }
+  TF_LITE_ENSURE_STATUS(fft_.Init(fft_size));
+
+  // Hann window in Q12.
+  for (int i = 0; i < window_size_; ++i) {
+    const double value =
+        0.5 - 0.5 * std::cos(2 * kPi * (i + 0.5) / window_size_);
+    window_coefficients_[i] =
+        static_cast<int16_t>(std::floor(value * (1 << kWindowBits) + 0.5));
+  }
+
+  // Filterbank segments between num_channels + 2 mel frequencies evenly
+  // spaced from the lower to the upper band limit.
+  const float hz_per_bin = static_cast<float>(config.sample_rate) / fft_size;
+  start_bin_ =
+      static_cast<int>(std::ceil(config.lower_band_limit / hz_per_bin));
+  end_bin_ = static_cast<int>(config.upper_band_limit / hz_per_bin) + 1;
+  if (end_bin_ > fft_size / 2 + 1) {
+    end_bin_ = fft_size / 2 + 1;
+  }
+  const float mel_low = Mel(config.lower_band_limit);
+  const float mel_spacing =
+      (Mel(config.upper_band_limit) - mel_low) / (num_channels_ + 1);
+  int segment = 0;
+  segment_starts_[0] = start_bin_;
+  for (int bin = start_bin_; bin < end_bin_; ++bin) {
+    const float mel = Mel(bin * hz_per_bin);
+    while (segment < num_channels_ &&
+           mel >= mel_low + (segment + 1) * mel_spacing) {
+      segment_starts_[++segment] = bin;
+    }
+    const float segment_end = mel_low + (segment + 1) * mel_spacing;
+    float weight = (segment_end - mel) / mel_spacing;
+    weight = weight < 0 ? 0 : weight > 1 ? 1 : weight;
+    bin_weights_[bin] =
+        static_cast<int16_t>(std::floor(weight * (1 << kFilterbankBits) + 0.5));
+  }
+  while (segment <= num_channels_) {
+    segment_starts_[++segment] = end_bin_;
+  }
+
+  smoothing_bits_ = config.smoothing_bits;
+  even_smoothing_ = static_cast<uint32_t>(
+      config.even_smoothing * (1 << kNoiseReductionBits) + 0.5f);
+  odd_smoothing_ = static_cast<uint32_t>(
+      config.odd_smoothing * (1 << kNoiseReductionBits) + 0.5f);
+  min_signal_remaining_ = static_cast<uint32_t>(
+      config.min_signal_remaining * (1 << kNoiseReductionBits) + 0.5f);
+  scale_shift_ = config.scale_shift;
+
+  Reset();
+  return kTfLiteOk;
+}
+
+void AudioFrontend::Reset() {
+  input_used_ = 0;
+  memset(noise_estimate_, 0, sizeof(noise_estimate_));
+  memset(features_, 0, sizeof(features_));
+}
+
+bool AudioFrontend::ProcessSamples(const int16_t* samples, size_t num_samples,
+                                   size_t* samples_read) {
+  size_t count = window_size_ - input_used_;
+  if (count > num_samples) {
+    count = num_samples;
+  }
+  memcpy(input_ + input_used_, samples, count * sizeof(int16_t));
+  input_used_ += count;
+  *samples_read = count;
+  if (input_used_ < window_size_) {
+    return false;
+  }
+  ComputeFeatures();
+  // Keep the overlap with the next window.
+  memmove(input_, input_ + window_step_,
+          (window_size_ - window_step_) * sizeof(int16_t));
+  input_used_ -= window_step_;
+  return true;
+}
+
+void AudioFrontend::ComputeFeatures() {
+  const int fft_size = fft_.fft_size();
+
+  // Window, then scale so the largest value has its top bit at 2^13, which
+  // keeps a bit of headroom for the FFT butterflies. Only loud windows need
+  // scaling down.
+  int32_t max_abs = 0;
+  for (int i = 0; i < window_size_; ++i) {
+    const int16_t value = static_cast<int16_t>(
+        (static_cast<int32_t>(input_[i]) * window_coefficients_[i]) >>
+        kWindowBits);
+    fft_input_[i] = value;
+    const int32_t abs_value = value < 0 ? -value : value;
+    max_abs = abs_value > max_abs ? abs_value : max_abs;
+  }
+  const int input_shift = 14 - MostSignificantBit(max_abs);
+  if (input_shift >= 0) {
+    for (int i = 0; i < window_size_; ++i) {
+      fft_input_[i] = static_cast<int16_t>(
+          static_cast<uint16_t>(fft_input_[i]) << input_shift);
+    }
+  } else {
+    for (int i = 0; i < window_size_; ++i) {
+      fft_input_[i] = static_cast<int16_t>(fft_input_[i] >> -input_shift);
+    }
+  }
+  memset(fft_input_ + window_size_, 0,
+         (fft_size - window_size_) * sizeof(int16_t));
+  fft_.Compute(fft_input_, spectrum_);
+
+  // Mel filterbank over the energies. The square root brings the Q12 weights
+  // to Q6 and undoes the input scaling.
+  uint64_t rising = 0;
+  for (int segment = 0; segment <= num_channels_; ++segment) {
+    uint64_t falling = 0;
+    uint64_t next_rising = 0;
+    for (int bin = segment_starts_[segment];
+         bin < segment_starts_[segment + 1]; ++bin) {
+      const int32_t real = spectrum_[bin].real;
+      const int32_t imag = spectrum_[bin].imag;
+      const uint32_t energy = static_cast<uint32_t>(real * real) +
+                              static_cast<uint32_t>(imag * imag);
+      const uint32_t weight = bin_weights_[bin];
+      falling += static_cast<uint64_t>(weight) * energy;
+      next_rising += static_cast<uint64_t>((1 << kFilterbankBits) - weight) *
+                     energy;
+    }
+    if (segment > 0) {
+      const uint32_t amplitude = Sqrt64(rising + falling);
+      channels_[segment - 1] = input_shift >= 0 ? amplitude >> input_shift
+                                                : amplitude << -input_shift;
+    }
+    rising = next_rising;
+  }
+
+  // Noise reduction: subtract a slow running estimate of each channel.
+  for (int i = 0; i < num_channels_; ++i) {
+    const uint32_t smoothing = (i & 1) == 0 ? even_smoothing_ : odd_smoothing_;
+    const uint32_t one_minus_smoothing =
+        (1 << kNoiseReductionBits) - smoothing;
+    const uint32_t signal = channels_[i];
+    const uint32_t signal_scaled_up = signal << smoothing_bits_;
+    uint32_t estimate =
+        (static_cast<uint64_t>(signal_scaled_up) * smoothing +
+         static_cast<uint64_t>(noise_estimate_[i]) * one_minus_smoothing) >>
+        kNoiseReductionBits;
+    noise_estimate_[i] = estimate;
+    if (estimate > signal_scaled_up) {
+      estimate = signal_scaled_up;
+    }
+    const uint32_t floor =
+        (static_cast<uint64_t>(signal) * min_signal_remaining_) >>
+        kNoiseReductionBits;
+    const uint32_t subtracted =
+        (signal_scaled_up - estimate) >> smoothing_bits_;
+    channels_[i] = subtracted > floor ? subtracted : floor;
+  }
+
+  // Log scale. The FFT divided the energies' square roots by fft_size and
+  // the filterbank left them in Q6.
+  const int correction_bits = MostSignificantBit(fft_size) - 1 - 6;
+  for (int i = 0; i < num_channels_; ++i) {
+    uint32_t value = channels_[i] << correction_bits;
+    value = value > 1 ? Log(value, scale_shift_) : 0;
+    features_[i] = static_cast<uint16_t>(value < UINT16_MAX ? value
+                                                            : UINT16_MAX);
+  }
+}
+
+TfLiteStatus FeaturesToTensor(const uint16_t* features, int count,
+                              float feature_scale, TfLiteTensor* tensor,
+                              int offset) {
+  if (offset < 0 || offset + count > ElementCount(*tensor->dims)) {
+    return kTfLiteError;
+  }
+  const float multiplier = feature_scale / tensor->params.scale;
+  const int32_t zero_point = tensor->params.zero_point;
+  for (int i = 0; i < count; ++i) {
+    const int32_t value =
+        static_cast<int32_t>(std::round(features[i] * multiplier)) +
+        zero_point;
+    switch (tensor->type) {
+      case kTfLiteInt8:
+        tensor->data.int8[offset + i] = static_cast<int8_t>(
+            value > INT8_MAX ? INT8_MAX : value < INT8_MIN ? INT8_MIN : value);
+        break;
+      case kTfLiteInt16:
+        tensor->data.i16[offset + i] = Saturate16(value);
+        break;
+      default:
+        return kTfLiteError;
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
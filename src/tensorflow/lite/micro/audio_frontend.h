@@ -0,0 +1,156 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_AUDIO_FRONTEND_H_
+#define TENSORFLOW_LITE_MICRO_AUDIO_FRONTEND_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+
+namespace tflite {
+
+// Largest supported analysis window and FFT, 32 ms at 16 kHz.
+constexpr int kAudioFrontendMaxFftSize = 512;
+constexpr int kAudioFrontendMaxChannels = 128;
+
+struct AudioFrontendComplex {
+  int16_t real;
+  int16_t imag;
+};
+
+// Fixed-point real FFT with the conventions of kiss_fftr() built with
+// FIXED_POINT=16: int16 input, and every stage halves its results, so the
+// output is the transform divided by the FFT size. The real input is
+// transformed as a complex sequence of half the length and then split.
+class FixedPointRealFft {
+ public:
+  // `fft_size` must be a power of two from 4 to kAudioFrontendMaxFftSize.
+  TfLiteStatus Init(int fft_size);
+
+  // Writes the fft_size / 2 + 1 non-negative frequency bins of `input`.
+  // Inputs within +/-2^14 cannot overflow the butterflies.
+  void Compute(const int16_t* input, AudioFrontendComplex* output);
+
+  int fft_size() const { return fft_size_; }
+
+ private:
+  int fft_size_ = 0;
+  AudioFrontendComplex work_[kAudioFrontendMaxFftSize / 2];
+  // exp(-2 pi i k / (fft_size / 2)) for the complex transform.
+  AudioFrontendComplex twiddles_[kAudioFrontendMaxFftSize / 4];
+  // exp(-i pi ((k + 1) / (fft_size / 2) + 1 / 2)) for the split.
+  AudioFrontendComplex split_twiddles_[kAudioFrontendMaxFftSize / 4];
+};
+
+struct AudioFrontendConfig {
+  int sample_rate = 16000;
+  // Each slice of features covers window_size_ms of audio, and a new slice
+  // starts every window_step_ms.
+  int window_size_ms = 30;
+  int window_step_ms = 20;
+  // Mel filterbank.
+  int num_channels = 40;
+  float lower_band_limit = 125.0f;
+  float upper_band_limit = 7500.0f;
+  // Noise reduction: each channel's noise estimate follows the signal with
+  // the given smoothing, and at least min_signal_remaining of the signal is
+  // kept after subtracting it.
+  int smoothing_bits = 10;
+  float even_smoothing = 0.025f;
+  float odd_smoothing = 0.06f;
+  float min_signal_remaining = 0.05f;
+  // The features are ln(filterbank energy) << scale_shift.
+  int scale_shift = 6;
+};
+
+// Streaming micro frontend that turns 16-bit PCM audio into log mel
+// spectrogram slices for keyword models: a Hann window, a fixed-point real
+// FFT, a triangular mel filterbank, per-channel noise reduction and log
+// scaling, all in integer arithmetic. Audio can be fed in chunks of any size
+// and every buffer is a member, so nothing is allocated after Init().
+class AudioFrontend {
+ public:
+  explicit AudioFrontend(ErrorReporter* error_reporter)
+      : error_reporter_(error_reporter) {}
+
+  // Builds the window, FFT and filterbank tables. The window must fit in
+  // kAudioFrontendMaxFftSize samples.
+  TfLiteStatus Init(const AudioFrontendConfig& config);
+
+  // Forgets the buffered audio and the noise estimates.
+  void Reset();
+
+  // Buffers up to `num_samples` samples and stores how many were used in
+  // `samples_read`. Returns true when a window was completed, in which case
+  // features() holds a new slice; call again with the remaining samples.
+  bool ProcessSamples(const int16_t* samples, size_t num_samples,
+                      size_t* samples_read);
+
+  // The num_channels() features of the last slice.
+  const uint16_t* features() const { return features_; }
+  int num_channels() const { return num_channels_; }
+  int window_step() const { return window_step_; }
+
+ private:
+  void ComputeFeatures();
+
+  ErrorReporter* error_reporter_;
+  int window_size_ = 0;
+  int window_step_ = 0;
+  int num_channels_ = 0;
+  int smoothing_bits_ = 0;
+  uint32_t even_smoothing_ = 0;
+  uint32_t odd_smoothing_ = 0;
+  uint32_t min_signal_remaining_ = 0;
+  int scale_shift_ = 0;
+
+  // Window.
+  int16_t window_coefficients_[kAudioFrontendMaxFftSize];
+  int16_t input_[kAudioFrontendMaxFftSize];
+  int input_used_ = 0;
+
+  // FFT, over the windowed input zero-padded to the FFT size.
+  FixedPointRealFft fft_;
+  int16_t fft_input_[kAudioFrontendMaxFftSize];
+  AudioFrontendComplex spectrum_[kAudioFrontendMaxFftSize / 2 + 1];
+
+  // Filterbank. The bins from start_bin_ up to end_bin_ are split into
+  // num_channels_ + 1 segments between consecutive mel center frequencies.
+  // In segment s a bin adds weight w to the falling edge of channel s - 1
+  // and 1 - w to the rising edge of channel s, with weights in Q12.
+  int start_bin_ = 0;
+  int end_bin_ = 0;
+  int16_t segment_starts_[kAudioFrontendMaxChannels + 2];
+  int16_t bin_weights_[kAudioFrontendMaxFftSize / 2 + 1];
+
+  // Noise estimates, scaled up by smoothing_bits_.
+  uint32_t noise_estimate_[kAudioFrontendMaxChannels];
+  uint32_t channels_[kAudioFrontendMaxChannels];
+  uint16_t features_[kAudioFrontendMaxChannels];
+};
+
+// Quantizes `count` features into `tensor`, an int8 or int16 model input,
+// starting at element `offset`. Keyword models are trained on features
+// divided by 25.6, so with a `feature_scale` of 1 / 25.6 a feature of v
+// becomes round(v / 25.6 / scale) + zero_point, saturated to the type.
+TfLiteStatus FeaturesToTensor(const uint16_t* features, int count,
+                              float feature_scale, TfLiteTensor* tensor,
+                              int offset);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_AUDIO_FRONTEND_H_
@@ -0,0 +1,243 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/audio_frontend.h"
+
+#include <cmath>
+#include <cstdint>
+
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kSampleRate = 16000;
+constexpr int kNumSamples = kSampleRate;
+constexpr int kMaxSlices = kNumSamples / 320 + 1;
+constexpr double kPi = 3.14159265358979323846;
+
+tflite::testing::Random g_random;
+
+tflite::MicroErrorReporter g_reporter;
+tflite::AudioFrontend g_frontend(&g_reporter);
+tflite::FixedPointRealFft g_fft;
+int16_t g_audio[kNumSamples];
+uint16_t g_features[kMaxSlices * tflite::kAudioFrontendMaxChannels];
+
+void FillTone(float frequency, int amplitude) {
+  for (int i = 0; i < kNumSamples; ++i) {
+    g_audio[i] = static_cast<int16_t>(
+        amplitude * std::sin(2 * kPi * frequency * i / kSampleRate));
+  }
+}
+
+// Feeds g_audio to g_frontend `chunk` samples at a time and stores the
+// features of each slice in `features`. Returns the number of slices.
+int RunFrontend(int chunk, uint16_t* features) {
+  g_frontend.Reset();
+  const int channels = g_frontend.num_channels();
+  int slices = 0;
+  for (int start = 0; start < kNumSamples; start += chunk) {
+    const int16_t* samples = g_audio + start;
+    size_t remaining = kNumSamples - start < chunk ? kNumSamples - start
+                                                   : chunk;
+    while (remaining > 0) {
+      size_t read;
+      if (g_frontend.ProcessSamples(samples, remaining, &read)) {
+        for (int c = 0; c < channels; ++c) {
+          features[slices * channels + c] = g_frontend.features()[c];
+        }
+        ++slices;
+      }
+      samples += read;
+      remaining -= read;
+    }
+  }
+  return slices;
+}
+
+float Mel(float frequency) {
+  return 1127.0f * std::log(1.0f + frequency / 700.0f);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestFftMatchesScaledDft) {
+  const int sizes[] = {4, 16, 64, 512};
+  int16_t input[tflite::kAudioFrontendMaxFftSize];
+  tflite::AudioFrontendComplex output[tflite::kAudioFrontendMaxFftSize / 2 +
+                                      1];
+  for (int size : sizes) {
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, g_fft.Init(size));
+    for (int i = 0; i < size; ++i) {
+      input[i] = static_cast<int16_t>(g_random.Int(-16384, 16384));
+    }
+    g_fft.Compute(input, output);
+    for (int k = 0; k <= size / 2; ++k) {
+      double real = 0;
+      double imag = 0;
+      for (int i = 0; i < size; ++i) {
+        real += input[i] * std::cos(2 * kPi * k * i / size);
+        imag -= input[i] * std::sin(2 * kPi * k * i / size);
+      }
+      TF_LITE_MICRO_EXPECT_NEAR(real / size, output[k].real, 4);
+      TF_LITE_MICRO_EXPECT_NEAR(imag / size, output[k].imag, 4);
+    }
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, g_fft.Init(48));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, g_fft.Init(1024));
+}
+
+TF_LITE_MICRO_TEST(TestFeaturesDoNotDependOnChunkSize) {
+  static uint16_t chunked[kMaxSlices * tflite::kAudioFrontendMaxChannels];
+  tflite::AudioFrontendConfig config;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, g_frontend.Init(config));
+  for (int i = 0; i < kNumSamples; ++i) {
+    g_audio[i] = static_cast<int16_t>(
+        g_random.Int(-2000, 2000) +
+        8000 * std::sin(2 * kPi * (300 + i / 20) * i / kSampleRate));
+  }
+  const int slices = RunFrontend(kNumSamples, g_features);
+  TF_LITE_MICRO_EXPECT_EQ((kNumSamples - 480) / 320 + 1, slices);
+  const int chunks[] = {1, 7, 160, 1000};
+  for (int chunk : chunks) {
+    TF_LITE_MICRO_EXPECT_EQ(slices, RunFrontend(chunk, chunked));
+    for (int i = 0; i < slices * config.num_channels; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(g_features[i], chunked[i]);
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(TestToneLandsInNearestChannel) {
+  tflite::AudioFrontendConfig config;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, g_frontend.Init(config));
+  const float mel_low = Mel(config.lower_band_limit);
+  const float mel_spacing =
+      (Mel(config.upper_band_limit) - mel_low) / (config.num_channels + 1);
+  // Full scale tones are scaled down before the FFT, quiet ones up.
+  const struct {
+    float frequency;
+    int amplitude;
+  } tones[] = {{440.0f, 10000}, {1000.0f, 32767}, {4000.0f, 300}};
+  for (const auto& tone : tones) {
+    const float frequency = tone.frequency;
+    FillTone(frequency, tone.amplitude);
+    RunFrontend(kNumSamples, g_features);
+    int expected = 0;
+    for (int c = 1; c < config.num_channels; ++c) {
+      const float center = mel_low + (c + 1) * mel_spacing;
+      const float best = mel_low + (expected + 1) * mel_spacing;
+      if (std::fabs(center - Mel(frequency)) <
+          std::fabs(best - Mel(frequency))) {
+        expected = c;
+      }
+    }
+    int loudest = 0;
+    for (int c = 1; c < config.num_channels; ++c) {
+      if (g_features[c] > g_features[loudest]) {
+        loudest = c;
+      }
+    }
+    TF_LITE_MICRO_EXPECT_EQ(expected, loudest);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestNoiseReductionFadesStationaryNoise) {
+  tflite::AudioFrontendConfig config;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, g_frontend.Init(config));
+  for (int i = 0; i < kNumSamples; ++i) {
+    g_audio[i] = static_cast<int16_t>(g_random.Int(-4000, 4000));
+  }
+  const int slices = RunFrontend(kNumSamples, g_features);
+  int first = 0;
+  int last = 0;
+  for (int c = 0; c < config.num_channels; ++c) {
+    first += g_features[c];
+    last += g_features[(slices - 1) * config.num_channels + c];
+  }
+  TF_LITE_MICRO_EXPECT_GT(first, last + 100 * config.num_channels);
+
+  // Without smoothing the estimate never moves and nothing is removed.
+  config.even_smoothing = 0.0f;
+  config.odd_smoothing = 0.0f;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, g_frontend.Init(config));
+  RunFrontend(kNumSamples, g_features);
+  last = 0;
+  for (int c = 0; c < config.num_channels; ++c) {
+    last += g_features[(slices - 1) * config.num_channels + c];
+  }
+  TF_LITE_MICRO_EXPECT_NEAR(first, last, 50 * config.num_channels);
+}
+
+TF_LITE_MICRO_TEST(TestInitRejectsUnsupportedConfigs) {
+  tflite::AudioFrontendConfig config;
+  config.window_size_ms = 40;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, g_frontend.Init(config));
+  config = tflite::AudioFrontendConfig();
+  config.window_step_ms = 35;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, g_frontend.Init(config));
+  config = tflite::AudioFrontendConfig();
+  config.upper_band_limit = 9000.0f;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, g_frontend.Init(config));
+  config = tflite::AudioFrontendConfig();
+  config.num_channels = tflite::kAudioFrontendMaxChannels + 1;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, g_frontend.Init(config));
+}
+
+TF_LITE_MICRO_TEST(TestFeaturesToTensorQuantizes) {
+  const uint16_t features[] = {0, 100, 200, 1000};
+  int dims_data[] = {2, 1, 6};
+  TfLiteIntArray* dims = tflite::testing::IntArrayFromInts(dims_data);
+
+  // The usual int8 keyword model input, with a scale of 1 / 25.6.
+  int8_t int8_data[6] = {};
+  TfLiteTensor int8_tensor = tflite::testing::CreateQuantizedTensor(
+      int8_data, dims, 0.0390625f, -128);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk,
+      tflite::FeaturesToTensor(features, 4, 1 / 25.6f, &int8_tensor, 2));
+  TF_LITE_MICRO_EXPECT_EQ(0, int8_data[1]);
+  TF_LITE_MICRO_EXPECT_EQ(-128, int8_data[2]);
+  TF_LITE_MICRO_EXPECT_EQ(-28, int8_data[3]);
+  TF_LITE_MICRO_EXPECT_EQ(72, int8_data[4]);
+  TF_LITE_MICRO_EXPECT_EQ(127, int8_data[5]);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError,
+      tflite::FeaturesToTensor(features, 4, 1 / 25.6f, &int8_tensor, 3));
+
+  int16_t int16_data[6] = {};
+  TfLiteTensor int16_tensor = tflite::testing::CreateQuantizedTensor(
+      int16_data, dims, 0.000625f, 0);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk,
+      tflite::FeaturesToTensor(features, 4, 1 / 25.6f, &int16_tensor, 0));
+  TF_LITE_MICRO_EXPECT_EQ(0, int16_data[0]);
+  TF_LITE_MICRO_EXPECT_EQ(6250, int16_data[1]);
+  TF_LITE_MICRO_EXPECT_EQ(12500, int16_data[2]);
+  TF_LITE_MICRO_EXPECT_EQ(32767, int16_data[3]);
+
+  float float_data[6] = {};
+  TfLiteTensor float_tensor =
+      tflite::testing::CreateTensor(float_data, dims);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError,
+      tflite::FeaturesToTensor(features, 4, 1 / 25.6f, &float_tensor, 0));
+}
+
+TF_LITE_MICRO_TESTS_END
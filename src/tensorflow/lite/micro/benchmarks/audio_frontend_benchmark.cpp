@@ -0,0 +1,240 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host benchmark of the streaming AudioFrontend: the time to turn one hop of
+// 16 kHz audio into a slice of log mel features, then the same slices fed to
+// the keyword model through FeaturesToTensor, as a wake word pipeline would.
+// The keyword model here has scrambled weights, so its outputs only show
+// that the slices reach it. Pass PCM16 mono WAV files to run them through the
+// pipeline, or run it without arguments on synthesized speech-like audio.
+// The benchmark is not part of the firmware build, and numbers from a
+// desktop CPU only show relative costs. Build it on the host with:
+//
+//   g++ -std=c++17 -O2 -DTF_LITE_STATIC_MEMORY -DCMSIS_NN
+//     -DTF_LITE_DISABLE_X86_NEON -Isrc
+//     -Isrc/third_party/flatbuffers/include -Isrc/third_party/gemmlowp
+//     -Isrc/third_party/ruy -Isrc/third_party/cmsis
+//     -Isrc/third_party/cmsis/CMSIS/NN/Include
+//     -Isrc/third_party/cmsis/CMSIS/DSP/Include
+//     -Isrc/third_party/cmsis/CMSIS/Core/Include
+//     src/tensorflow/lite/micro/benchmarks/audio_frontend_benchmark.cpp
+//     <TFLM and CMSIS-NN sources> -o audio_frontend_benchmark
+//
+//   ./audio_frontend_benchmark [file.wav ...]
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/audio_frontend.h"
+#include "tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kSampleRate = 16000;
+constexpr int kArenaSize = 16 * 1024;
+alignas(16) uint8_t g_arena[kArenaSize];
+
+// The keyword model takes one slice of 96 features per invocation.
+constexpr int kKeywordChannels = 96;
+constexpr float kFeatureScale = 1 / 25.6f;
+constexpr int kPrintedSlices = 5;
+
+constexpr int kIterations = 20;
+
+// Keeps the compiler from dropping the benchmarked work.
+volatile int32_t g_sink;
+
+tflite::testing::Random g_random;
+
+uint32_t ReadLittleEndian(const uint8_t* data, int bytes) {
+  uint32_t value = 0;
+  for (int i = bytes - 1; i >= 0; --i) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+// Reads the samples of a 16 kHz, 16-bit mono PCM WAV file.
+bool ReadWav(const char* path, std::vector<int16_t>* samples) {
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return false;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buffer[4096];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + read);
+  }
+  fclose(file);
+  if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 ||
+      memcmp(data.data() + 8, "WAVE", 4) != 0) {
+    fprintf(stderr, "%s is not a WAV file\n", path);
+    return false;
+  }
+  bool format_ok = false;
+  for (size_t offset = 12; offset + 8 <= data.size();) {
+    const uint8_t* chunk = data.data() + offset;
+    const size_t size = ReadLittleEndian(chunk + 4, 4);
+    const size_t available = data.size() - offset - 8;
+    if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+      format_ok = ReadLittleEndian(chunk + 8, 2) == 1 &&
+                  ReadLittleEndian(chunk + 10, 2) == 1 &&
+                  ReadLittleEndian(chunk + 12, 4) == kSampleRate &&
+                  ReadLittleEndian(chunk + 22, 2) == 16;
+    } else if (memcmp(chunk, "data", 4) == 0) {
+      if (!format_ok) {
+        break;
+      }
+      const size_t count = (size < available ? size : available) / 2;
+      samples->resize(count);
+      for (size_t i = 0; i < count; ++i) {
+        (*samples)[i] =
+            static_cast<int16_t>(ReadLittleEndian(chunk + 8 + 2 * i, 2));
+      }
+      return true;
+    }
+    offset += 8 + size + (size & 1);
+  }
+  fprintf(stderr, "%s is not 16 kHz 16-bit mono PCM\n", path);
+  return false;
+}
+
+// A second of syllable-like bursts of a gliding harmonic tone over noise.
+void Synthesize(std::vector<int16_t>* samples) {
+  samples->resize(kSampleRate);
+  double phase = 0;
+  for (int i = 0; i < kSampleRate; ++i) {
+    const double t = static_cast<double>(i) / kSampleRate;
+    const double envelope = std::sin(3.14159265358979 * 4 * t);
+    phase += 2 * 3.14159265358979 * (150 + 100 * t) / kSampleRate;
+    const double voice = std::sin(phase) + 0.5 * std::sin(3 * phase) +
+                         0.25 * std::sin(7 * phase);
+    (*samples)[i] = static_cast<int16_t>(6000 * envelope * envelope * voice +
+                                         g_random.Int(-300, 300));
+  }
+}
+
+// Runs `samples` through `frontend` one hop at a time, calling `on_slice`
+// after each completed slice. Returns the number of slices.
+template <typename Function>
+int RunHops(tflite::AudioFrontend* frontend,
+            const std::vector<int16_t>& samples, Function on_slice) {
+  frontend->Reset();
+  const size_t hop = frontend->window_step();
+  int slices = 0;
+  for (size_t start = 0; start < samples.size(); start += hop) {
+    const size_t count =
+        samples.size() - start < hop ? samples.size() - start : hop;
+    size_t used = 0;
+    while (used < count) {
+      size_t read;
+      if (frontend->ProcessSamples(samples.data() + start + used,
+                                   count - used, &read)) {
+        on_slice(slices++);
+      }
+      used += read;
+    }
+  }
+  return slices;
+}
+
+void Benchmark(const char* name, const std::vector<int16_t>& samples,
+               tflite::AudioFrontend* frontend,
+               tflite::MicroInterpreter* interpreter) {
+  printf("%s, %.2f s:\n", name,
+         static_cast<double>(samples.size()) / kSampleRate);
+  int slices = 0;
+  const auto frontend_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) {
+    slices = RunHops(frontend, samples,
+                     [&](int) { g_sink = frontend->features()[0]; });
+  }
+  const std::chrono::duration<double, std::nano> frontend_elapsed =
+      std::chrono::steady_clock::now() - frontend_start;
+  if (slices == 0) {
+    printf("  shorter than one window\n");
+    return;
+  }
+
+  TfLiteTensor* input = interpreter->input(0);
+  TfLiteTensor* output = interpreter->output(0);
+  double invoke_ns = 0;
+  RunHops(frontend, samples, [&](int slice) {
+    tflite::FeaturesToTensor(frontend->features(), kKeywordChannels,
+                             kFeatureScale, input, 0);
+    const auto start = std::chrono::steady_clock::now();
+    interpreter->Invoke();
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    invoke_ns += elapsed.count();
+    if (slice < kPrintedSlices) {
+      printf("  slice %d: features", slice);
+      for (int c = 0; c < 6; ++c) {
+        printf(" %u", frontend->features()[c]);
+      }
+      printf(" ..., keyword model outputs %d %d\n",
+             static_cast<int>(output->data.i32[0]),
+             static_cast<int>(output->data.i32[1]));
+    }
+  });
+  printf("  %d slices of %d channels every %d samples\n", slices,
+         frontend->num_channels(), frontend->window_step());
+  printf("  frontend       %9.0f ns per hop\n",
+         frontend_elapsed.count() / kIterations / slices);
+  printf("  keyword model  %9.0f ns per slice\n", invoke_ns / slices);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  tflite::MicroErrorReporter reporter;
+  static tflite::AudioFrontend frontend(&reporter);
+  tflite::AudioFrontendConfig config;
+  config.num_channels = kKeywordChannels;
+  if (frontend.Init(config) != kTfLiteOk) {
+    return 1;
+  }
+
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_keyword_scrambled_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    return 1;
+  }
+
+  std::vector<int16_t> samples;
+  if (argc < 2) {
+    Synthesize(&samples);
+    Benchmark("Synthesized audio", samples, &frontend, &interpreter);
+  }
+  for (int i = 1; i < argc; ++i) {
+    if (!ReadWav(argv[i], &samples)) {
+      return 1;
+    }
+    Benchmark(argv[i], samples, &frontend, &interpreter);
+  }
+  return 0;
+}
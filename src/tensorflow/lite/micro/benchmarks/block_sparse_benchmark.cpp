@@ -0,0 +1,186 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host microbenchmark of BLOCK_SPARSE_FULLY_CONNECTED against the dense
+// m0plus kernels it replaces, for a fully connected layer and for a pointwise
+// convolution shaped like the later layers of the person detection model, at
+// growing fractions of zero filter blocks. The sparse kernel skips the MACs
+// and the filter reads of zero blocks, so its time should fall with the
+// sparsity, less the cost of the block indices. The benchmark is not part of
+// the firmware build, and numbers from a desktop CPU only show relative
+// costs. Build it on the host with:
+//
+//   g++ -std=c++17 -O2 -DTF_LITE_STATIC_MEMORY -DCMSIS_NN
+//     -DTF_LITE_DISABLE_X86_NEON -Isrc
+//     -Isrc/third_party/flatbuffers/include -Isrc/third_party/gemmlowp
+//     -Isrc/third_party/ruy -Isrc/third_party/cmsis
+//     -Isrc/third_party/cmsis/CMSIS/NN/Include
+//     -Isrc/third_party/cmsis/CMSIS/DSP/Include
+//     -Isrc/third_party/cmsis/CMSIS/Core/Include
+//     src/tensorflow/lite/micro/benchmarks/block_sparse_benchmark.cpp
+//     <TFLM and CMSIS-NN sources> -o block_sparse_benchmark
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/micro/kernels/block_sparse_fully_connected.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/conv.h"
+#include "tensorflow/lite/micro/kernels/m0plus/fully_connected.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kBlockSize = 8;
+constexpr int kMaxRows = 12 * 12;
+constexpr int kMaxDepth = 256;
+constexpr int kMaxChannels = 256;
+
+int8_t g_input[kMaxRows * kMaxDepth];
+int8_t g_filter[kMaxChannels * kMaxDepth];
+int32_t g_bias[kMaxChannels];
+int32_t g_folded_bias[kMaxChannels];
+int8_t g_values[kMaxChannels * kMaxDepth];
+uint8_t g_block_indices[kMaxChannels * kMaxDepth / kBlockSize];
+int32_t g_row_offsets[kMaxChannels + 1];
+int32_t g_sparse_bias[kMaxChannels];
+int32_t g_multiplier[kMaxChannels];
+int32_t g_shift[kMaxChannels];
+int8_t g_output[kMaxRows * kMaxChannels];
+
+constexpr int kSparsities[] = {0, 25, 50, 75, 90};
+
+constexpr int kIterations = 200;
+
+constexpr int32_t kInputOffset = 5;
+constexpr int32_t kOutputOffset = -3;
+
+// Keeps the compiler from dropping the benchmarked work.
+volatile int32_t g_sink;
+
+tflite::testing::Random g_random;
+
+template <typename Function>
+double NanosecondsPerCall(int calls, Function function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) {
+    function();
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / kIterations / calls;
+}
+
+// Zeroes every block of the filter with probability `percent_zero` / 100
+// and encodes it.
+tflite::BlockSparseFilter PruneAndEncode(int channels, int depth,
+                                         int percent_zero) {
+  for (int i = 0; i < channels * depth; i += kBlockSize) {
+    const bool zero = g_random.Int(0, 99) < percent_zero;
+    for (int j = 0; j < kBlockSize; ++j) {
+      g_filter[i + j] =
+          zero ? 0 : static_cast<int8_t>(g_random.Int(-127, 127));
+    }
+  }
+  tflite::EncodeBlockSparse(g_filter, channels, depth, kBlockSize, g_values,
+                            g_block_indices, g_row_offsets);
+  const tflite::BlockSparseFilter filter = {channels,   depth,
+                                            kBlockSize, g_values,
+                                            g_block_indices, g_row_offsets};
+  tflite::FoldBlockSparseInputOffset(filter, g_bias, kInputOffset,
+                                     g_sparse_bias);
+  tflite::m0plus::FoldInputOffset(g_filter, channels, depth, g_bias,
+                                  kInputOffset, g_folded_bias);
+  return filter;
+}
+
+void BenchmarkLayer(const char* name, int rows, int depth, int channels,
+                    bool pointwise_conv) {
+  for (int i = 0; i < rows * depth; ++i) {
+    g_input[i] = static_cast<int8_t>(g_random.Int(-128, 127));
+  }
+  for (int c = 0; c < channels; ++c) {
+    g_bias[c] = g_random.Int(-1000, 1000);
+    int shift;
+    tflite::QuantizeMultiplier(0.0005, &g_multiplier[c], &shift);
+    g_shift[c] = shift;
+  }
+
+  tflite::FullyConnectedParams fc_params = {};
+  fc_params.input_offset = kInputOffset;
+  fc_params.output_offset = kOutputOffset;
+  fc_params.output_multiplier = g_multiplier[0];
+  fc_params.output_shift = g_shift[0];
+  fc_params.quantized_activation_min = -128;
+  fc_params.quantized_activation_max = 127;
+  tflite::ConvParams conv_params = {};
+  conv_params.input_offset = kInputOffset;
+  conv_params.output_offset = kOutputOffset;
+  conv_params.stride_width = 1;
+  conv_params.stride_height = 1;
+  conv_params.dilation_width_factor = 1;
+  conv_params.dilation_height_factor = 1;
+  conv_params.quantized_activation_min = -128;
+  conv_params.quantized_activation_max = 127;
+  const int size = pointwise_conv ? 12 : 1;
+
+  printf("%s, %d x %d input -> %d channels, block size %d:\n", name, rows,
+         depth, channels, kBlockSize);
+  printf("  zero blocks   dense ns   sparse ns   speedup   filter bytes\n");
+  for (int percent_zero : kSparsities) {
+    const tflite::BlockSparseFilter filter =
+        PruneAndEncode(channels, depth, percent_zero);
+    const double dense_ns = NanosecondsPerCall(1, [&] {
+      if (pointwise_conv) {
+        tflite::m0plus::ConvPerChannel(
+            conv_params, g_multiplier, g_shift,
+            tflite::RuntimeShape({1, size, size, depth}), g_input,
+            tflite::RuntimeShape({channels, 1, 1, depth}), g_filter,
+            tflite::RuntimeShape({channels}), g_bias,
+            tflite::RuntimeShape({1, size, size, channels}), g_output,
+            g_folded_bias);
+      } else {
+        tflite::m0plus::FullyConnected(
+            fc_params, tflite::RuntimeShape({rows, depth}), g_input,
+            tflite::RuntimeShape({channels, depth}), g_filter,
+            tflite::RuntimeShape({channels}), g_bias,
+            tflite::RuntimeShape({rows, channels}), g_output, g_folded_bias);
+      }
+      g_sink = g_output[0];
+    });
+    const double sparse_ns = NanosecondsPerCall(1, [&] {
+      tflite::BlockSparseFullyConnected(
+          filter, g_sparse_bias, g_multiplier, g_shift, kOutputOffset, -128,
+          127, rows, g_input, g_output);
+      g_sink = g_output[0];
+    });
+    const int blocks = g_row_offsets[channels];
+    printf("  %10d%%  %9.0f  %10.0f  %7.2fx  %6d -> %d\n", percent_zero,
+           dense_ns, sparse_ns, dense_ns / sparse_ns, channels * depth,
+           blocks * (kBlockSize + 1) +
+               (channels + 1) * static_cast<int>(sizeof(int32_t)));
+  }
+}
+
+}  // namespace
+
+int main() {
+  BenchmarkLayer("Fully connected", 1, 256, 256, false);
+  BenchmarkLayer("Pointwise conv", 12 * 12, 128, 128, true);
+  return 0;
+}
@@ -0,0 +1,171 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host microbenchmark of the classifier head of the person detection model:
+// the global average pool and the two-class softmax, each timed in its
+// generic form and in the forms the firmware uses, down to a bare decision
+// from TwoClassClassifierHead. The reshape in between costs nothing since
+// MicroAllocator lets it share its input buffer. The benchmark is not part of
+// the firmware build, and numbers from a desktop CPU only show relative costs.
+// Build it on the host with:
+//
+//   g++ -std=c++17 -O2 -DTF_LITE_STATIC_MEMORY -DCMSIS_NN
+//     -DTF_LITE_DISABLE_X86_NEON -Isrc -Imycam
+//     -Isrc/third_party/flatbuffers/include -Isrc/third_party/gemmlowp
+//     -Isrc/third_party/ruy -Isrc/third_party/cmsis
+//     -Isrc/third_party/cmsis/CMSIS/NN/Include
+//     -Isrc/third_party/cmsis/CMSIS/DSP/Include
+//     -Isrc/third_party/cmsis/CMSIS/Core/Include
+//     src/tensorflow/lite/micro/benchmarks/classifier_head_benchmark.cpp
+//     mycam/tensorflow/lite/micro/tools/make/downloads/person_model_int8/person_detect_model_data.cpp
+//     <TFLM and CMSIS-NN sources> -o classifier_head_benchmark
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "CMSIS/NN/Include/arm_nnfunctions.h"
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/classifier_head.h"
+#include "tensorflow/lite/micro/kernels/m0plus/pooling.h"
+#include "tensorflow/lite/micro/kernels/m0plus/softmax.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+namespace {
+
+constexpr int kArenaSize = 96 * 1024;
+alignas(16) uint8_t g_arena[kArenaSize];
+
+// Shape of the last feature map of the person detection model.
+constexpr int kFeatureSize = 3;
+constexpr int kFeatureDepth = 256;
+int8_t g_features[kFeatureSize * kFeatureSize * kFeatureDepth];
+int8_t g_pooled[kFeatureDepth];
+
+// Every pair of int8 logits.
+constexpr int kPairs = 256 * 256;
+int8_t g_logits[kPairs * 2];
+int8_t g_scores[kPairs * 2];
+
+constexpr int kIterations = 200;
+
+// Matches the int8 scaling of the softmax kernel.
+constexpr int kScaledDiffIntegerBits = 5;
+
+// Keeps the compiler from dropping the benchmarked work.
+volatile int32_t g_sink;
+
+template <typename Function>
+double NanosecondsPerCall(int calls, Function function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) {
+    function();
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / kIterations / calls;
+}
+
+}  // namespace
+
+int main() {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "AllocateTensors() failed\n");
+    return 1;
+  }
+  tflite::TwoClassClassifierHead head(&interpreter, &reporter);
+  // A score of 0 is a probability of one half.
+  if (head.Init(0) != kTfLiteOk) {
+    fprintf(stderr, "The model has no two-class classifier head\n");
+    return 1;
+  }
+  const tflite::NodeAndRegistration softmax =
+      interpreter.node_and_registration(interpreter.operators_size() - 1);
+  const float logits_scale =
+      interpreter.tensor(softmax.node.inputs->data[0])->params.scale;
+  const float beta =
+      static_cast<const TfLiteSoftmaxParams*>(softmax.node.builtin_data)->beta;
+  int32_t mult;
+  int shift;
+  tflite::PreprocessSoftmaxScaling(beta, logits_scale, kScaledDiffIntegerBits,
+                                   &mult, &shift);
+  const int32_t diff_min =
+      -1.0 * tflite::CalculateInputRadius(kScaledDiffIntegerBits, shift);
+
+  for (int i = 0; i < kPairs; ++i) {
+    g_logits[i * 2] = static_cast<int8_t>(i >> 8);
+    g_logits[i * 2 + 1] = static_cast<int8_t>(i);
+  }
+  for (size_t i = 0; i < sizeof(g_features); ++i) {
+    g_features[i] = static_cast<int8_t>(i * 7 + 3);
+  }
+
+  tflite::PoolParams pool_params = {};
+  pool_params.stride_height = 1;
+  pool_params.stride_width = 1;
+  pool_params.filter_height = kFeatureSize;
+  pool_params.filter_width = kFeatureSize;
+  pool_params.quantized_activation_min = -128;
+  pool_params.quantized_activation_max = 127;
+  const tflite::RuntimeShape features_shape(
+      {1, kFeatureSize, kFeatureSize, kFeatureDepth});
+  const tflite::RuntimeShape pooled_shape({1, 1, 1, kFeatureDepth});
+
+  printf("Average pool %dx%dx%d -> 1x1x%d, ns per call:\n", kFeatureSize,
+         kFeatureSize, kFeatureDepth, kFeatureDepth);
+  printf("  reference          %8.1f\n", NanosecondsPerCall(1, [&] {
+           tflite::reference_integer_ops::AveragePool(
+               pool_params, features_shape, g_features, pooled_shape,
+               g_pooled);
+           g_sink = g_pooled[0];
+         }));
+  printf("  m0plus             %8.1f\n", NanosecondsPerCall(1, [&] {
+           tflite::m0plus::AveragePool(pool_params, features_shape,
+                                       g_features, pooled_shape, g_pooled);
+           g_sink = g_pooled[0];
+         }));
+
+  printf("Two-class softmax, ns per row:\n");
+  printf("  arm_softmax_s8     %8.1f\n", NanosecondsPerCall(kPairs, [&] {
+           arm_softmax_s8(g_logits, kPairs, 2, mult, shift, diff_min,
+                          g_scores);
+           g_sink = g_scores[0];
+         }));
+  printf("  SoftmaxTwoClass    %8.1f\n", NanosecondsPerCall(kPairs, [&] {
+           tflite::m0plus::SoftmaxTwoClass(g_logits, kPairs, mult, shift,
+                                           diff_min, g_scores);
+           g_sink = g_scores[0];
+         }));
+  printf("  decision only      %8.1f\n", NanosecondsPerCall(kPairs, [&] {
+           int32_t confident = 0;
+           for (int i = 0; i < kPairs; ++i) {
+             const tflite::TwoClassDecision decision =
+                 head.Decide(g_logits[i * 2], g_logits[i * 2 + 1]);
+             confident += decision.label + decision.confident;
+           }
+           g_sink = confident;
+         }));
+  return 0;
+}
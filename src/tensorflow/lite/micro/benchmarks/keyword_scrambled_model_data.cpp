@@ -2842,4 +2842,4 @@ alignas(8) const unsigned char g_keyword_scrambled_model_data[] = {
     0x00, 0x09, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x1b};
 
-const unsigned int g_keyword_scrambled_model_data_length = 34520;
+const unsigned int g_keyword_scrambled_model_data_length = 33880;
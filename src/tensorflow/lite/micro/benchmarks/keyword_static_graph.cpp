@@ -0,0 +1,333 @@
+// Generated by tensorflow/lite/micro/tools/generate_static_graph from the model in
+// tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h.
+// Regenerate it whenever the model changes.
+
+#include "tensorflow/lite/micro/benchmarks/keyword_static_graph.h"
+
+#include "tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/static_graph.h"
+
+namespace {
+
+const TfLiteRegistration kRegistrationQuantize =
+    tflite::Register_QUANTIZE();
+const TfLiteRegistration kRegistrationSvdf =
+    tflite::Register_SVDF();
+const TfLiteRegistration kRegistrationFullyConnected =
+    tflite::Register_FULLY_CONNECTED();
+const TfLiteRegistration kRegistrationSoftmax =
+    tflite::Register_SOFTMAX();
+
+const tflite::StaticIntArray<1> kIntArray0 = {1, {-128}};
+const tflite::StaticFloatArray<1> kFloatArray0 = {1, {0.0535294116f}};
+const tflite::StaticAffineQuantization kQuantization0 = {&kFloatArray0, &kIntArray0, 0};
+const tflite::StaticIntArray<2> kIntArray1 = {2, {1, 96}};
+const tflite::StaticIntArray<1> kIntArray2 = {1, {0}};
+const tflite::StaticFloatArray<1> kFloatArray1 = {1, {0.0091712065f}};
+const tflite::StaticAffineQuantization kQuantization1 = {&kFloatArray1, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray3 = {2, {64, 96}};
+const tflite::StaticFloatArray<1> kFloatArray2 = {1, {0.00370550621f}};
+const tflite::StaticAffineQuantization kQuantization2 = {&kFloatArray2, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray4 = {2, {64, 8}};
+const tflite::StaticFloatArray<1> kFloatArray3 = {1, {1.39008762e-05f}};
+const tflite::StaticAffineQuantization kQuantization3 = {&kFloatArray3, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray5 = {1, {64}};
+const tflite::StaticFloatArray<1> kFloatArray4 = {1, {0.00375141087f}};
+const tflite::StaticAffineQuantization kQuantization4 = {&kFloatArray4, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray6 = {2, {1, 512}};
+const tflite::StaticFloatArray<1> kFloatArray5 = {1, {0.129548669f}};
+const tflite::StaticAffineQuantization kQuantization5 = {&kFloatArray5, &kIntArray0, 0};
+const tflite::StaticIntArray<2> kIntArray7 = {2, {1, 64}};
+const tflite::StaticFloatArray<1> kFloatArray6 = {1, {0.00597761152f}};
+const tflite::StaticAffineQuantization kQuantization6 = {&kFloatArray6, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray8 = {2, {16, 64}};
+const tflite::StaticFloatArray<1> kFloatArray7 = {1, {0.000774391636f}};
+const tflite::StaticAffineQuantization kQuantization7 = {&kFloatArray7, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray9 = {1, {16}};
+const tflite::StaticIntArray<1> kIntArray10 = {1, {-29}};
+const tflite::StaticFloatArray<1> kFloatArray8 = {1, {0.181597769f}};
+const tflite::StaticAffineQuantization kQuantization8 = {&kFloatArray8, &kIntArray10, 0};
+const tflite::StaticIntArray<2> kIntArray11 = {2, {1, 16}};
+const tflite::StaticFloatArray<1> kFloatArray9 = {1, {0.00518311793f}};
+const tflite::StaticAffineQuantization kQuantization9 = {&kFloatArray9, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray12 = {2, {64, 16}};
+const tflite::StaticFloatArray<1> kFloatArray10 = {1, {0.00171087857f}};
+const tflite::StaticAffineQuantization kQuantization10 = {&kFloatArray10, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray11 = {1, {1.46168964e-06f}};
+const tflite::StaticAffineQuantization kQuantization11 = {&kFloatArray11, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray12 = {1, {0.000854350277f}};
+const tflite::StaticAffineQuantization kQuantization12 = {&kFloatArray12, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray13 = {1, {0.0720473826f}};
+const tflite::StaticAffineQuantization kQuantization13 = {&kFloatArray13, &kIntArray0, 0};
+const tflite::StaticFloatArray<1> kFloatArray14 = {1, {0.00597273931f}};
+const tflite::StaticAffineQuantization kQuantization14 = {&kFloatArray14, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray15 = {1, {0.000430320244f}};
+const tflite::StaticAffineQuantization kQuantization15 = {&kFloatArray15, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray13 = {1, {2}};
+const tflite::StaticFloatArray<1> kFloatArray16 = {1, {0.10075444f}};
+const tflite::StaticAffineQuantization kQuantization16 = {&kFloatArray16, &kIntArray13, 0};
+const tflite::StaticFloatArray<1> kFloatArray17 = {1, {0.00649387995f}};
+const tflite::StaticAffineQuantization kQuantization17 = {&kFloatArray17, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray18 = {1, {0.00157135504f}};
+const tflite::StaticAffineQuantization kQuantization18 = {&kFloatArray18, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray19 = {1, {7.21204515e-07f}};
+const tflite::StaticAffineQuantization kQuantization19 = {&kFloatArray19, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray20 = {1, {0.000458969822f}};
+const tflite::StaticAffineQuantization kQuantization20 = {&kFloatArray20, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray21 = {1, {0.0514452569f}};
+const tflite::StaticAffineQuantization kQuantization21 = {&kFloatArray21, &kIntArray0, 0};
+const tflite::StaticFloatArray<1> kFloatArray22 = {1, {0.00565985963f}};
+const tflite::StaticAffineQuantization kQuantization22 = {&kFloatArray22, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray23 = {1, {0.000291172939f}};
+const tflite::StaticAffineQuantization kQuantization23 = {&kFloatArray23, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray14 = {1, {-9}};
+const tflite::StaticFloatArray<1> kFloatArray24 = {1, {0.0697849095f}};
+const tflite::StaticAffineQuantization kQuantization24 = {&kFloatArray24, &kIntArray14, 0};
+const tflite::StaticFloatArray<1> kFloatArray25 = {1, {0.00495964987f}};
+const tflite::StaticAffineQuantization kQuantization25 = {&kFloatArray25, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray26 = {1, {0.0014864523f}};
+const tflite::StaticAffineQuantization kQuantization26 = {&kFloatArray26, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray27 = {1, {4.61612927e-07f}};
+const tflite::StaticAffineQuantization kQuantization27 = {&kFloatArray27, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray28 = {1, {0.000310546748f}};
+const tflite::StaticAffineQuantization kQuantization28 = {&kFloatArray28, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray29 = {1, {0.0274916552f}};
+const tflite::StaticAffineQuantization kQuantization29 = {&kFloatArray29, &kIntArray0, 0};
+const tflite::StaticFloatArray<1> kFloatArray30 = {1, {0.00522478111f}};
+const tflite::StaticAffineQuantization kQuantization30 = {&kFloatArray30, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray31 = {1, {0.000143637881f}};
+const tflite::StaticAffineQuantization kQuantization31 = {&kFloatArray31, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray15 = {1, {-11}};
+const tflite::StaticFloatArray<1> kFloatArray32 = {1, {0.0581322387f}};
+const tflite::StaticAffineQuantization kQuantization32 = {&kFloatArray32, &kIntArray15, 0};
+const tflite::StaticFloatArray<1> kFloatArray33 = {1, {0.00512833055f}};
+const tflite::StaticAffineQuantization kQuantization33 = {&kFloatArray33, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray16 = {2, {32, 16}};
+const tflite::StaticFloatArray<1> kFloatArray34 = {1, {0.00242393091f}};
+const tflite::StaticAffineQuantization kQuantization34 = {&kFloatArray34, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray17 = {2, {32, 32}};
+const tflite::StaticFloatArray<1> kFloatArray35 = {1, {7.85910117e-07f}};
+const tflite::StaticAffineQuantization kQuantization35 = {&kFloatArray35, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray18 = {1, {32}};
+const tflite::StaticFloatArray<1> kFloatArray36 = {1, {0.000324229593f}};
+const tflite::StaticAffineQuantization kQuantization36 = {&kFloatArray36, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray19 = {2, {1, 1024}};
+const tflite::StaticFloatArray<1> kFloatArray37 = {1, {0.0620764382f}};
+const tflite::StaticAffineQuantization kQuantization37 = {&kFloatArray37, &kIntArray0, 0};
+const tflite::StaticIntArray<2> kIntArray20 = {2, {1, 32}};
+const tflite::StaticFloatArray<1> kFloatArray38 = {1, {0.00675093057f}};
+const tflite::StaticAffineQuantization kQuantization38 = {&kFloatArray38, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray39 = {1, {0.00233710418f}};
+const tflite::StaticAffineQuantization kQuantization39 = {&kFloatArray39, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray40 = {1, {1.07941037e-06f}};
+const tflite::StaticAffineQuantization kQuantization40 = {&kFloatArray40, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray41 = {1, {0.000461858028f}};
+const tflite::StaticAffineQuantization kQuantization41 = {&kFloatArray41, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray42 = {1, {0.0467459634f}};
+const tflite::StaticAffineQuantization kQuantization42 = {&kFloatArray42, &kIntArray0, 0};
+const tflite::StaticFloatArray<1> kFloatArray43 = {1, {0.00945538934f}};
+const tflite::StaticAffineQuantization kQuantization43 = {&kFloatArray43, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray44 = {1, {0.00244076154f}};
+const tflite::StaticAffineQuantization kQuantization44 = {&kFloatArray44, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray45 = {1, {1.12528437e-06f}};
+const tflite::StaticAffineQuantization kQuantization45 = {&kFloatArray45, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray46 = {1, {0.000461038231f}};
+const tflite::StaticAffineQuantization kQuantization46 = {&kFloatArray46, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray47 = {1, {0.0709736496f}};
+const tflite::StaticAffineQuantization kQuantization47 = {&kFloatArray47, &kIntArray0, 0};
+const tflite::StaticFloatArray<1> kFloatArray48 = {1, {0.00555803021f}};
+const tflite::StaticAffineQuantization kQuantization48 = {&kFloatArray48, &kIntArray2, 0};
+const tflite::StaticIntArray<2> kIntArray21 = {2, {2, 32}};
+const tflite::StaticFloatArray<1> kFloatArray49 = {1, {0.000394473696f}};
+const tflite::StaticAffineQuantization kQuantization49 = {&kFloatArray49, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray22 = {1, {14}};
+const tflite::StaticFloatArray<1> kFloatArray50 = {1, {0.0490932688f}};
+const tflite::StaticAffineQuantization kQuantization50 = {&kFloatArray50, &kIntArray22, 0};
+const tflite::StaticIntArray<2> kIntArray23 = {2, {1, 2}};
+const tflite::StaticIntArray<1> kIntArray24 = {1, {-32768}};
+const tflite::StaticFloatArray<1> kFloatArray51 = {1, {1.52590219e-05f}};
+const tflite::StaticAffineQuantization kQuantization51 = {&kFloatArray51, &kIntArray24, 0};
+const tflite::StaticFloatArray<1> kFloatArray52 = {1, {0.000624999986f}};
+const tflite::StaticAffineQuantization kQuantization52 = {&kFloatArray52, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray53 = {1, {3.05185094e-05f}};
+const tflite::StaticAffineQuantization kQuantization53 = {&kFloatArray53, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray25 = {1, {52}};
+const TfLiteSVDFParams kParams0 = {/*rank=*/1, kTfLiteActRelu, /*asymmetric_quantize_inputs=*/false};
+const tflite::StaticIntArray<5> kIntArray26 = {5, {0, 1, 2, 3, 4}};
+const tflite::StaticIntArray<1> kIntArray27 = {1, {5}};
+const TfLiteFullyConnectedParams kParams1 = {kTfLiteActNone,
+     static_cast<TfLiteFullyConnectedWeightsFormat>(0),
+     /*keep_num_dims=*/false, /*asymmetric_quantize_inputs=*/false};
+const tflite::StaticIntArray<3> kIntArray28 = {3, {5, 6, 7}};
+const tflite::StaticIntArray<1> kIntArray29 = {1, {8}};
+const tflite::StaticIntArray<5> kIntArray30 = {5, {8, 9, 10, 11, 12}};
+const tflite::StaticIntArray<1> kIntArray31 = {1, {13}};
+const tflite::StaticIntArray<3> kIntArray32 = {3, {13, 14, 15}};
+const tflite::StaticIntArray<5> kIntArray33 = {5, {16, 17, 18, 19, 20}};
+const tflite::StaticIntArray<1> kIntArray34 = {1, {21}};
+const tflite::StaticIntArray<3> kIntArray35 = {3, {21, 22, 23}};
+const tflite::StaticIntArray<1> kIntArray36 = {1, {24}};
+const tflite::StaticIntArray<5> kIntArray37 = {5, {24, 25, 26, 27, 28}};
+const tflite::StaticIntArray<1> kIntArray38 = {1, {29}};
+const tflite::StaticIntArray<3> kIntArray39 = {3, {29, 30, 31}};
+const tflite::StaticIntArray<5> kIntArray40 = {5, {32, 33, 34, 35, 36}};
+const tflite::StaticIntArray<1> kIntArray41 = {1, {37}};
+const tflite::StaticIntArray<5> kIntArray42 = {5, {37, 38, 39, 40, 41}};
+const tflite::StaticIntArray<1> kIntArray43 = {1, {42}};
+const tflite::StaticIntArray<5> kIntArray44 = {5, {42, 43, 44, 45, 46}};
+const tflite::StaticIntArray<1> kIntArray45 = {1, {47}};
+const tflite::StaticIntArray<3> kIntArray46 = {3, {47, 48, 49}};
+const tflite::StaticIntArray<1> kIntArray47 = {1, {50}};
+const TfLiteSoftmaxParams kParams2 = {/*beta=*/1.0f};
+const tflite::StaticIntArray<1> kIntArray48 = {1, {51}};
+const tflite::StaticIntArray<1> kIntArray49 = {1, {53}};
+
+const tflite::StaticTensor kTensors[] = {
+    {&kIntArray1, &kQuantization0, 512, 96, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray3, &kQuantization1, 22256, 6144, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization2, 21220, 1024, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray5, &kQuantization3, 20952, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray6, &kQuantization4, 672, 1024, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray7, &kQuantization5, 608, 64, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray8, &kQuantization6, 19916, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray9, &kQuantization7, 19840, 64, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray11, &kQuantization8, 576, 16, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray12, &kQuantization9, 18804, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization10, 17768, 1024, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray5, &kQuantization11, 17500, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray6, &kQuantization12, 1696, 1024, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray7, &kQuantization13, 512, 64, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray8, &kQuantization14, 16464, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray9, &kQuantization15, 16388, 64, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray11, &kQuantization16, 576, 16, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray12, &kQuantization17, 15352, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization18, 14316, 1024, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray5, &kQuantization19, 14048, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray6, &kQuantization20, 2720, 1024, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray7, &kQuantization21, 512, 64, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray8, &kQuantization22, 13012, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray9, &kQuantization23, 12936, 64, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray11, &kQuantization24, 576, 16, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray12, &kQuantization25, 11900, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization26, 10864, 1024, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray5, &kQuantization27, 10596, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray6, &kQuantization28, 3744, 1024, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray7, &kQuantization29, 512, 64, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray8, &kQuantization30, 9560, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray9, &kQuantization31, 9484, 64, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray11, &kQuantization32, 288, 16, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray16, &kQuantization33, 8960, 512, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray17, &kQuantization34, 6900, 2048, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray18, &kQuantization35, 6760, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray19, &kQuantization36, 4768, 2048, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray20, &kQuantization37, 256, 32, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray17, &kQuantization38, 5724, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray17, &kQuantization39, 3664, 2048, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray18, &kQuantization40, 3524, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray19, &kQuantization41, 6816, 2048, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray20, &kQuantization42, 288, 32, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray17, &kQuantization43, 2488, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray17, &kQuantization44, 428, 2048, kTfLiteInt16,
+     tflite::kStaticTensorConstant},
+    {&kIntArray18, &kQuantization45, 288, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray19, &kQuantization46, 8864, 2048, kTfLiteInt16,
+     tflite::kStaticTensorVariable},
+    {&kIntArray20, &kQuantization47, 256, 32, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray21, &kQuantization48, 212, 64, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray13, &kQuantization49, 192, 8, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray23, &kQuantization50, 0, 2, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray23, &kQuantization51, 16, 4, kTfLiteInt16,
+     tflite::kStaticTensorArena},
+    {&kIntArray1, &kQuantization52, 0, 192, kTfLiteInt16,
+     tflite::kStaticTensorArena},
+    {&kIntArray23, &kQuantization53, 0, 8, kTfLiteInt32,
+     tflite::kStaticTensorArena},
+};
+
+const tflite::StaticOperator kOperators[] = {
+    {&kRegistrationQuantize, &kIntArray25, &kIntArray2, nullptr, -1, 0},
+    {&kRegistrationSvdf, &kIntArray26, &kIntArray27, &kParams0, -1, 0},
+    {&kRegistrationFullyConnected, &kIntArray28, &kIntArray29, &kParams1, -1, 0},
+    {&kRegistrationSvdf, &kIntArray30, &kIntArray31, &kParams0, -1, 0},
+    {&kRegistrationFullyConnected, &kIntArray32, &kIntArray9, &kParams1, -1, 0},
+    {&kRegistrationSvdf, &kIntArray33, &kIntArray34, &kParams0, -1, 0},
+    {&kRegistrationFullyConnected, &kIntArray35, &kIntArray36, &kParams1, -1, 0},
+    {&kRegistrationSvdf, &kIntArray37, &kIntArray38, &kParams0, -1, 0},
+    {&kRegistrationFullyConnected, &kIntArray39, &kIntArray18, &kParams1, -1, 0},
+    {&kRegistrationSvdf, &kIntArray40, &kIntArray41, &kParams0, -1, 0},
+    {&kRegistrationSvdf, &kIntArray42, &kIntArray43, &kParams0, -1, 0},
+    {&kRegistrationSvdf, &kIntArray44, &kIntArray45, &kParams0, -1, 0},
+    {&kRegistrationFullyConnected, &kIntArray46, &kIntArray47, &kParams1, -1, 0},
+    {&kRegistrationSoftmax, &kIntArray47, &kIntArray48, &kParams2, -1, 0},
+    {&kRegistrationQuantize, &kIntArray48, &kIntArray49, nullptr, -1, 0},
+};
+
+const int32_t kScratchBufferOffsets[] = {256, 0, 256, 0, 256, 0, 256, 0, 128, 0, 128, 0, 128, 0};
+const int32_t kScratchBufferSizes[] = {256, 256, 256, 256, 256, 256, 256, 256, 128, 128, 128, 128, 128, 128};
+
+const tflite::StaticGraphPlan kPlan = {
+    kTensors, 54, kOperators, 15, &kIntArray25, &kIntArray49,
+    kScratchBufferOffsets, kScratchBufferSizes, 14,
+    /*planned_bytes=*/10912, /*max_temp_tensors=*/6,
+    /*model_size=*/33880};
+
+}  // namespace
+
+KeywordStaticGraph::KeywordStaticGraph(uint8_t* arena, size_t arena_size,
+                                       tflite::ErrorReporter* error_reporter)
+    : tflite::StaticGraph(kPlan, g_keyword_scrambled_model_data,
+                          g_keyword_scrambled_model_data_length, eval_tensors_,
+                          user_data_, arena, arena_size, error_reporter) {}
@@ -0,0 +1,122 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host microbenchmark of GreedyMemoryPlanner on synthetic graphs of 100 to
+// 2000 buffers, much larger than the models the firmware runs, to show how
+// the planning time at AllocateTensors() scales. Two shapes of graph are
+// planned: a chain, where each op's output dies an op or two later apart from
+// the odd skip connection, and a wide graph whose buffers stay alive for a
+// long stretch of ops. Numbers from a desktop CPU only show relative costs.
+// Build it on the host with:
+//
+//   g++ -std=c++17 -O2 -DTF_LITE_STATIC_MEMORY -Isrc
+//     src/tensorflow/lite/micro/benchmarks/memory_planner_benchmark.cpp
+//     src/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp
+//     src/tensorflow/lite/core/api/error_reporter.cpp
+//     -o memory_planner_benchmark
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kMaxBuffers = 2000;
+constexpr int kBufferCounts[] = {100, 250, 500, 1000, 2000};
+constexpr int kIterations = 20;
+
+unsigned char g_scratch[kMaxBuffers * 64];
+int g_sizes[kMaxBuffers];
+int g_first_times[kMaxBuffers];
+int g_last_times[kMaxBuffers];
+
+// Reports planner errors on the host without the firmware's DebugLog().
+class StderrReporter : public tflite::ErrorReporter {
+ public:
+  int Report(const char* format, va_list args) override {
+    const int written = vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    return written;
+  }
+};
+
+// Keeps the compiler from dropping the benchmarked work.
+volatile size_t g_sink;
+
+tflite::testing::Random g_random;
+
+void MakeChainGraph(int count) {
+  for (int i = 0; i < count; ++i) {
+    g_sizes[i] = 16 * (1 + g_random.Below(256));
+    g_first_times[i] = i;
+    const int reach =
+        g_random.Below(8) == 0 ? g_random.Below(20) : g_random.Below(2);
+    g_last_times[i] = i + 1 + reach;
+  }
+}
+
+void MakeWideGraph(int count) {
+  for (int i = 0; i < count; ++i) {
+    g_sizes[i] = 16 * (1 + g_random.Below(256));
+    g_first_times[i] = i / 4;
+    g_last_times[i] = g_first_times[i] + g_random.Below(count / 8 + 1);
+  }
+}
+
+// Returns the microseconds taken to plan the first `count` buffers, and the
+// arena size the plan needs in `arena_size`.
+double MicrosecondsToPlan(int count, size_t* arena_size) {
+  StderrReporter reporter;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; ++i) {
+    tflite::GreedyMemoryPlanner planner(g_scratch, sizeof(g_scratch));
+    for (int j = 0; j < count; ++j) {
+      planner.AddBuffer(&reporter, g_sizes[j], g_first_times[j],
+                        g_last_times[j]);
+    }
+    *arena_size = planner.GetMaximumMemorySize();
+    g_sink = *arena_size;
+  }
+  const std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / kIterations;
+}
+
+}  // namespace
+
+int main() {
+  if (sizeof(g_scratch) <
+      kMaxBuffers * tflite::GreedyMemoryPlanner::per_buffer_size()) {
+    fprintf(stderr, "Scratch buffer is too small\n");
+    return 1;
+  }
+  printf("buffers   chain us  chain arena    wide us   wide arena\n");
+  for (const int count : kBufferCounts) {
+    size_t chain_arena;
+    MakeChainGraph(count);
+    const double chain_us = MicrosecondsToPlan(count, &chain_arena);
+    size_t wide_arena;
+    MakeWideGraph(count);
+    const double wide_us = MicrosecondsToPlan(count, &wide_arena);
+    printf("%7d %10.1f %12zu %10.1f %12zu\n", count, chain_us, chain_arena,
+           wide_us, wide_arena);
+  }
+  return 0;
+}
@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/micro_workers.h"
 
 namespace micro_benchmark {
 extern tflite::ErrorReporter* reporter;
@@ -63,15 +64,19 @@ extern tflite::ErrorReporter* reporter;
 template <typename inputT>
 class MicroBenchmarkRunner {
  public:
-  // The lifetimes of model, op_resolver and tensor_arena must exceed that of
-  // the created MicroBenchmarkRunner object.
+  // The lifetimes of model, op_resolver, tensor_arena and workers must exceed
+  // that of the created MicroBenchmarkRunner object.
   MicroBenchmarkRunner(const uint8_t* model,
                        const tflite::MicroOpResolver* op_resolver,
-                       uint8_t* tensor_arena, int tensor_arena_size)
+                       uint8_t* tensor_arena, int tensor_arena_size,
+                       tflite::MicroWorkers* workers = nullptr,
+                       bool fuse_operators = false)
       : model_(tflite::GetModel(model)),
         reporter_(&micro_reporter_),
         interpreter_(model_, *op_resolver, tensor_arena, tensor_arena_size,
                      reporter_) {
+    interpreter_.SetWorkers(workers);
+    interpreter_.SetOperatorFusion(fuse_operators);
     interpreter_.AllocateTensors();
   }
 
@@ -83,6 +88,12 @@ class MicroBenchmarkRunner {
     }
   }
 
+  void EnableWeightPrefetch(size_t staging_bytes) {
+    if (interpreter_.EnableWeightPrefetch(staging_bytes) != kTfLiteOk) {
+      TF_LITE_REPORT_ERROR(reporter_, "EnableWeightPrefetch failed.");
+    }
+  }
+
   void SetRandomInput(const int random_seed) {
     // The pseudo-random number generator is initialized to a constant seed
     std::srand(random_seed);
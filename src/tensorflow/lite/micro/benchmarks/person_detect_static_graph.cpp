@@ -0,0 +1,499 @@
+// Generated by tensorflow/lite/micro/tools/generate_static_graph from the model in
+// person_detect_model_data.h.
+// Regenerate it whenever the model changes.
+
+#include "tensorflow/lite/micro/benchmarks/person_detect_static_graph.h"
+
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/static_graph.h"
+
+namespace {
+
+const TfLiteRegistration kRegistrationDepthwiseConv2d =
+    tflite::Register_DEPTHWISE_CONV_2D();
+const TfLiteRegistration kRegistrationConv2d =
+    tflite::Register_CONV_2D();
+const TfLiteRegistration kRegistrationAveragePool2d =
+    tflite::ops::micro::Register_AVERAGE_POOL_2D();
+const TfLiteRegistration kRegistrationReshape =
+    tflite::ops::micro::Register_RESHAPE();
+const TfLiteRegistration kRegistrationSoftmax =
+    tflite::Register_SOFTMAX();
+
+const tflite::StaticIntArray<8> kIntArray0 = {8, {0, 0, 0, 0, 0, 0, 0, 0}};
+const tflite::StaticFloatArray<8> kFloatArray0 = {8, {0.0163588561f, 0.0266105533f, 0.00303821545f, 0.00326251099f, 0.0115362778f, 0.0373822041f, 0.0181401875f, 0.00108622201f}};
+const tflite::StaticAffineQuantization kQuantization0 = {&kFloatArray0, &kIntArray0, 3};
+const tflite::StaticIntArray<4> kIntArray1 = {4, {1, 3, 3, 8}};
+const tflite::StaticIntArray<128> kIntArray2 = {128, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+const tflite::StaticFloatArray<128> kFloatArray1 = {128, {0.00562188542f, 0.00594976684f, 0.00710895844f, 0.00618774397f, 0.00635490008f, 0.00742039736f, 0.0055369758f, 0.00660772808f, 0.00635286001f, 0.00489683356f, 0.00670631044f, 0.00827100221f, 0.0071809995f, 0.0081321327f, 0.010144027f, 0.00435453979f, 0.0083869407f, 0.00772824045f, 0.00528608263f, 0.00502182543f, 0.0078791054f, 0.00614262372f, 0.0036391092f, 0.00678852014f, 0.0097038066f, 0.00443427032f, 0.00564715592f, 0.00541439606f, 0.00694633322f, 0.00994404778f, 0.00699039456f, 0.00369124394f, 0.00805723667f, 0.00787302945f, 0.00600304641f, 0.0113963f, 0.00521527138f, 0.00735404994f, 0.00856001582f, 0.00511844829f, 0.0068883528f, 0.00451773452f, 0.00884217583f, 0.0105433902f, 0.00789785199f, 0.00422981801f, 0.0065715597f, 0.00599266635f, 0.00863584969f, 0.00419175299f, 0.00685696723f, 0.00755757792f, 0.00800477527f, 0.00687465584f, 0.00431754068f, 0.00714431936f, 0.00478713401f, 0.00367291807f, 0.00726105366f, 0.00384721975f, 0.00422020955f, 0.00672272872f, 0.0119574396f, 0.00620557927f, 0.00487995986f, 0.00747141987f, 0.00487108063f, 0.00714496151f, 0.00875172298f, 0.00636599213f, 0.00655584782f, 0.00901541766f, 0.00523727806f, 0.00371249649f, 0.00479819532f, 0.00615267921f, 0.00427237339f, 0.00533080986f, 0.00409008935f, 0.00532067055f, 0.00647337222f, 0.00510958303f, 0.00912351254f, 0.00581023609f, 0.00365510629f, 0.00656885188f, 0.0091388179f, 0.00956548657f, 0.00717027904f, 0.0112547595f, 0.0064480952f, 0.00682624755f, 0.00779589778f, 0.00445712171f, 0.0130033921f, 0.00781139219f, 0.0106824981f, 0.00579054141f, 0.00483653089f, 0.00667749438f, 0.00585912587f, 0.00473360298f, 0.00345039042f, 0.00743216788f, 0.00423318287f, 0.00653258525f, 0.00785984844f, 0.00883948896f, 0.0114218965f, 0.00939799659f, 0.00703410991f, 0.0063048685f, 0.00467957556f, 0.00688628154f, 0.00560156954f, 0.00411949214f, 0.0068127024f, 0.00733671384f, 0.00650693476f, 0.00492263725f, 0.00380607997f, 0.00598005159f, 0.00785058457f, 0.00746584637f, 0.00897965766f, 0.00401326781f, 0.00750049157f, 0.00755707733f}};
+const tflite::StaticAffineQuantization kQuantization1 = {&kFloatArray1, &kIntArray2, 3};
+const tflite::StaticIntArray<4> kIntArray3 = {4, {1, 3, 3, 128}};
+const tflite::StaticFloatArray<128> kFloatArray2 = {128, {0.00263160095f, 0.00241317134f, 0.00240356708f, 0.00223276927f, 0.00218127994f, 0.00201541535f, 0.00194224133f, 0.00172351615f, 0.00236219703f, 0.0027036618f, 0.00352293742f, 0.00280787656f, 0.00233744481f, 0.0023799357f, 0.00217392365f, 0.00295087695f, 0.00289300038f, 0.00224399078f, 0.00264550396f, 0.00275420421f, 0.00264969678f, 0.00328243338f, 0.00239254278f, 0.00258487975f, 0.00254044845f, 0.00248612324f, 0.00344896503f, 0.00234586094f, 0.00293870363f, 0.00254691555f, 0.00216468656f, 0.00191756757f, 0.00243152911f, 0.00194985722f, 0.00272018369f, 0.00257213367f, 0.00336388196f, 0.00255323108f, 0.00243698643f, 0.0023244333f, 0.0026711484f, 0.00229642866f, 0.00238403259f, 0.00188487722f, 0.00236657308f, 0.00199948368f, 0.00228432915f, 0.00303546549f, 0.0022648212f, 0.0031960702f, 0.00239515561f, 0.00336917513f, 0.00259703514f, 0.00206164806f, 0.00275338581f, 0.00292821811f, 0.00247054314f, 0.00288740033f, 0.00237958087f, 0.00205543404f, 0.00190818054f, 0.00188493484f, 0.00261438871f, 0.00245289737f, 0.00300956261f, 0.00240699016f, 0.0024498431f, 0.00330000417f, 0.0035435569f, 0.00424094452f, 0.00193741568f, 0.00191447639f, 0.00240561692f, 0.00179108675f, 0.00268697389f, 0.00240459037f, 0.00207513291f, 0.00181350776f, 0.00193977857f, 0.00232902262f, 0.00247442629f, 0.00222294242f, 0.00261012581f, 0.00206066179f, 0.00307052955f, 0.00304024573f, 0.00237281364f, 0.00184668938f, 0.0023755182f, 0.00232034223f, 0.00240185973f, 0.00320854504f, 0.00284931646f, 0.00300545432f, 0.00337211578f, 0.00267053419f, 0.0028111476f, 0.00247249426f, 0.00208477606f, 0.00198139995f, 0.0017380357f, 0.0027792661f, 0.00194853661f, 0.00206654239f, 0.00230990187f, 0.00251705758f, 0.00308601954f, 0.00233730464f, 0.00237270282f, 0.00210819952f, 0.00214630249f, 0.00229858491f, 0.00268692966f, 0.00319043454f, 0.00287029543f, 0.00260903593f, 0.00216206932f, 0.00244537694f, 0.00222856877f, 0.00225215405f, 0.00250640837f, 0.00228906819f, 0.00214261189f, 0.00226865546f, 0.00212659477f, 0.00310357334f, 0.00231851242f, 0.00235905522f}};
+const tflite::StaticAffineQuantization kQuantization2 = {&kFloatArray2, &kIntArray2, 0};
+const tflite::StaticIntArray<4> kIntArray4 = {4, {128, 1, 1, 128}};
+const tflite::StaticFloatArray<128> kFloatArray3 = {128, {0.00609450042f, 0.00676023308f, 0.00835830253f, 0.00575819798f, 0.00489813322f, 0.00505514489f, 0.00659580762f, 0.00847077649f, 0.00690401625f, 0.00926760584f, 0.00906010065f, 0.00592165068f, 0.00805152208f, 0.0102444394f, 0.0066885883f, 0.00448907679f, 0.00776219741f, 0.00492311874f, 0.00517435558f, 0.00281245005f, 0.00560568646f, 0.00692619383f, 0.00336800073f, 0.00608358858f, 0.00674275169f, 0.0066089672f, 0.0101398528f, 0.0104114171f, 0.00914721563f, 0.00870718621f, 0.003462906f, 0.00730771106f, 0.00754521135f, 0.00768983644f, 0.00517845107f, 0.00728410669f, 0.00446938584f, 0.00615991931f, 0.0125665516f, 0.00532309152f, 0.0074675777f, 0.00879056379f, 0.0101425136f, 0.00526678003f, 0.00438138377f, 0.00459285965f, 0.00665746257f, 0.00652970467f, 0.00739171309f, 0.00531641347f, 0.00488147f, 0.00719956635f, 0.00609887345f, 0.00750298891f, 0.00629047444f, 0.0108262235f, 0.00551046431f, 0.00910275802f, 0.00738841435f, 0.00614750804f, 0.00537395012f, 0.00603563944f, 0.00992380176f, 0.00758721493f, 0.00912327413f, 0.0052182721f, 0.00489336392f, 0.00477263145f, 0.00504508754f, 0.00692429533f, 0.00661316467f, 0.00585590582f, 0.00713894423f, 0.00492094224f, 0.0060815718f, 0.00603194395f, 0.00803641789f, 0.00734233717f, 0.00830301736f, 0.0076868888f, 0.00510425633f, 0.00487336284f, 0.00636880659f, 0.00367755932f, 0.0059684976f, 0.00668308046f, 0.00765974494f, 0.0111350147f, 0.00720297638f, 0.00447809929f, 0.00915004592f, 0.00636777235f, 0.0075740763f, 0.0104266936f, 0.00971728284f, 0.0105405189f, 0.00942904595f, 0.00682143355f, 0.0046602292f, 0.00636463985f, 0.00696773874f, 0.00446708687f, 0.0030597779f, 0.00707326643f, 0.00719250785f, 0.00979518425f, 0.0076092435f, 0.0103597827f, 0.00619377103f, 0.00905590039f, 0.00422309386f, 0.0048789042f, 0.00778524345f, 0.00575244939f, 0.00612802664f, 0.00683270488f, 0.00614369055f, 0.00589286909f, 0.00982032716f, 0.0075373156f, 0.00737040862f, 0.00626551034f, 0.00549767213f, 0.00709977373f, 0.0089427894f, 0.00980800111f, 0.0110860309f, 0.00866270345f}};
+const tflite::StaticAffineQuantization kQuantization3 = {&kFloatArray3, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray4 = {128, {0.00322787999f, 0.00283594243f, 0.00313718012f, 0.00224050414f, 0.00252192002f, 0.00177461782f, 0.00256346562f, 0.00206570444f, 0.00217690459f, 0.00204927707f, 0.00208428456f, 0.00258283736f, 0.00283023994f, 0.00198155409f, 0.00247061974f, 0.00198679045f, 0.00331184827f, 0.00276812445f, 0.00192571897f, 0.00237150653f, 0.00244398532f, 0.00197569677f, 0.00218478334f, 0.00255366554f, 0.00314992061f, 0.00216176314f, 0.00248051807f, 0.0026492076f, 0.00178604666f, 0.00249079196f, 0.00252439943f, 0.00226556975f, 0.00224740268f, 0.00293224957f, 0.00285651442f, 0.00189453852f, 0.00232418953f, 0.0018779136f, 0.00250948663f, 0.00219532102f, 0.00215385971f, 0.00279992702f, 0.00220636465f, 0.00270034163f, 0.00344622391f, 0.00309154321f, 0.00217954093f, 0.00255627627f, 0.00293905358f, 0.00245548622f, 0.00205963454f, 0.00216058549f, 0.00200386508f, 0.00239965902f, 0.0019817967f, 0.0022614263f, 0.00344834803f, 0.00217824685f, 0.00245851697f, 0.00201004487f, 0.00231481181f, 0.00264848536f, 0.00278838328f, 0.00244246051f, 0.00320436852f, 0.00238600699f, 0.00244692573f, 0.00236178539f, 0.00263890764f, 0.00224954775f, 0.00191098941f, 0.0022066622f, 0.00217936723f, 0.00291172438f, 0.00212567323f, 0.00238350872f, 0.00178072264f, 0.00182889542f, 0.00269295834f, 0.00247415644f, 0.00394735392f, 0.00376923173f, 0.00248364569f, 0.00271630217f, 0.00205715839f, 0.00221667858f, 0.00184593827f, 0.0019966776f, 0.00296975439f, 0.00301064085f, 0.00214761589f, 0.00302473037f, 0.00290948316f, 0.00205704616f, 0.00175973354f, 0.00221187272f, 0.00186106667f, 0.002212669f, 0.00194882776f, 0.00364244217f, 0.00252705836f, 0.00251926063f, 0.00275664194f, 0.00250533922f, 0.00177412911f, 0.00285426481f, 0.00215171627f, 0.00280247978f, 0.00242512627f, 0.00208455324f, 0.00269720564f, 0.00226895814f, 0.00259007188f, 0.00216735108f, 0.00238840119f, 0.0023978597f, 0.00274600019f, 0.00201977813f, 0.0027656965f, 0.0022930894f, 0.00247812131f, 0.00197470491f, 0.00216457923f, 0.00301751145f, 0.00204014103f, 0.00250150636f, 0.00312774628f, 0.00240580528f}};
+const tflite::StaticAffineQuantization kQuantization4 = {&kFloatArray4, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray5 = {128, {0.00538790226f, 0.00456332555f, 0.00820198655f, 0.00660810154f, 0.0092233941f, 0.00437929388f, 0.00527400756f, 0.00669992063f, 0.00460303482f, 0.00850041769f, 0.00585760595f, 0.00483705988f, 0.0066182036f, 0.00542570744f, 0.00512194075f, 0.00628454378f, 0.00931655522f, 0.00701003009f, 0.00566236163f, 0.00524906535f, 0.00547134876f, 0.00471438281f, 0.00671587419f, 0.00564282248f, 0.00418566912f, 0.00684413081f, 0.00576311583f, 0.00448533706f, 0.00726253446f, 0.00641385699f, 0.00640824018f, 0.00772072142f, 0.00667134719f, 0.00740646152f, 0.00541354204f, 0.00726944394f, 0.00702098664f, 0.00386630092f, 0.00443297252f, 0.00902182329f, 0.00400971249f, 0.00991430599f, 0.00804675836f, 0.0059251776f, 0.00516985077f, 0.0059184921f, 0.00480981683f, 0.00858626142f, 0.00507406984f, 0.00511256745f, 0.0049335123f, 0.00446226588f, 0.00708163995f, 0.00778554101f, 0.00687258365f, 0.0075050653f, 0.00450165663f, 0.00682036253f, 0.00391736347f, 0.00541116297f, 0.00721418019f, 0.00735997176f, 0.00599940121f, 0.00417663576f, 0.0053591216f, 0.00702163251f, 0.00456305454f, 0.00614103023f, 0.00608167658f, 0.00832254346f, 0.00581020722f, 0.00432594307f, 0.00533957081f, 0.00448198244f, 0.00555398129f, 0.00528717181f, 0.00371387368f, 0.00531991385f, 0.0064330129f, 0.00489747571f, 0.00648208521f, 0.00769736478f, 0.00529664801f, 0.00621911045f, 0.00744292466f, 0.00667747809f, 0.00690170657f, 0.00558388466f, 0.00914432295f, 0.00704152277f, 0.0036331038f, 0.00712100323f, 0.008945073f, 0.00563421194f, 0.00577057153f, 0.00852319412f, 0.00496984459f, 0.00601200713f, 0.00622052653f, 0.00493514491f, 0.0083781695f, 0.00928890519f, 0.00992639549f, 0.00506577501f, 0.00649788231f, 0.00506532006f, 0.00833455753f, 0.00603894051f, 0.00556951901f, 0.0107871881f, 0.00749985268f, 0.00495768478f, 0.00620668847f, 0.0057613817f, 0.00599736162f, 0.00608618045f, 0.00900672376f, 0.00632462464f, 0.00417562854f, 0.00473320857f, 0.00673052156f, 0.00393303391f, 0.00549994363f, 0.00991555117f, 0.00311164372f, 0.00516124815f, 0.00855991431f, 0.00817137398f}};
+const tflite::StaticAffineQuantization kQuantization5 = {&kFloatArray5, &kIntArray2, 3};
+const tflite::StaticIntArray<256> kIntArray5 = {256, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+const tflite::StaticFloatArray<256> kFloatArray6 = {256, {0.00219546538f, 0.00145948201f, 0.00178536819f, 0.0017009913f, 0.00315302983f, 0.00171163678f, 0.00259198924f, 0.0026321488f, 0.00178876426f, 0.00204294967f, 0.00200950168f, 0.00193272426f, 0.00153757888f, 0.00214149617f, 0.00334268692f, 0.00231863046f, 0.00253476342f, 0.00150396512f, 0.0020512403f, 0.00203461433f, 0.00265439763f, 0.00198631361f, 0.00189177808f, 0.00168952998f, 0.00217775279f, 0.00256400788f, 0.00218917616f, 0.00252360268f, 0.001773283f, 0.00201083091f, 0.00137111545f, 0.00235978863f, 0.00214138604f, 0.00206598849f, 0.00145479164f, 0.00191446254f, 0.00341082225f, 0.00191068009f, 0.00150848017f, 0.00256922515f, 0.00258814381f, 0.00205949019f, 0.00200940017f, 0.00168662425f, 0.00184788718f, 0.00191701844f, 0.00174898421f, 0.0017451914f, 0.00278088707f, 0.00223043561f, 0.00209776708f, 0.00151129102f, 0.00248409971f, 0.00188940146f, 0.00215903926f, 0.00213993387f, 0.00248353486f, 0.00191913103f, 0.00159135833f, 0.00205409643f, 0.00158849766f, 0.00245903083f, 0.0014766166f, 0.00215514866f, 0.00266946084f, 0.00218829419f, 0.00209982996f, 0.00219057803f, 0.00152927334f, 0.00204709871f, 0.00196075626f, 0.00194613636f, 0.00303965458f, 0.00204661209f, 0.00199931813f, 0.00164397701f, 0.00225665746f, 0.00198739232f, 0.0025151486f, 0.00485526724f, 0.00303316768f, 0.00153218803f, 0.00240989402f, 0.00116997352f, 0.00169202103f, 0.00112051633f, 0.00241326634f, 0.00307654939f, 0.00156362774f, 0.00252188509f, 0.00249786698f, 0.00291745132f, 0.00207172008f, 0.00280804327f, 0.00239385734f, 0.00233272626f, 0.00195209472f, 0.00195101451f, 0.00226111268f, 0.00213530916f, 0.00208300538f, 0.0021263971f, 0.00152762467f, 0.001778726f, 0.00219008932f, 0.00207241718f, 0.0016700587f, 0.00175476749f, 0.00296288007f, 0.00171150034f, 0.00218063849f, 0.00176152552f, 0.00230288482f, 0.00314243673f, 0.0013481346f, 0.00183544715f, 0.00305644772f, 0.00263373274f, 0.00244805985f, 0.00258064852f, 0.00210776622f, 0.00243618363f, 0.00166097551f, 0.00182207359f, 0.00194459117f, 0.00188246556f, 0.00164365361f, 0.00186026481f, 0.00166285329f, 0.00214410014f, 0.00192631991f, 0.00232283515f, 0.0017920197f, 0.00202566711f, 0.0032796124f, 0.00177623658f, 0.00203278824f, 0.00139814219f, 0.00129491219f, 0.00197916734f, 0.00172634411f, 0.00249278615f, 0.00175867486f, 0.0021006905f, 0.00249224156f, 0.00289445114f, 0.00268093729f, 0.00265199505f, 0.00167042459f, 0.00200167578f, 0.00204905705f, 0.00190856901f, 0.00235236995f, 0.00145209464f, 0.00223038974f, 0.00316971331f, 0.00223230873f, 0.00239053252f, 0.00236097863f, 0.00221630535f, 0.00218507601f, 0.00209229044f, 0.0018056921f, 0.00138151948f, 0.00174237054f, 0.0024747022f, 0.00247318344f, 0.00263627642f, 0.00163514528f, 0.0025684936f, 0.00308737229f, 0.00303064613f, 0.00191328861f, 0.00193638622f, 0.00257297745f, 0.0017265504f, 0.00217264448f, 0.00187623617f, 0.0020858387f, 0.00253215083f, 0.00205668411f, 0.00209858012f, 0.00321713113f, 0.0018892762f, 0.00183309277f, 0.00189529592f, 0.00197326345f, 0.00186869898f, 0.00213028048f, 0.00283354707f, 0.00194942125f, 0.00191537535f, 0.00221297424f, 0.00147315848f, 0.00205886667f, 0.00207660766f, 0.0019248483f, 0.00267594168f, 0.00251003355f, 0.00263567199f, 0.00237523834f, 0.00229105935f, 0.00258423062f, 0.00278358953f, 0.00146580092f, 0.00272735674f, 0.00188349222f, 0.00240027579f, 0.00240939786f, 0.00180991832f, 0.00244614598f, 0.00161243335f, 0.00204937276f, 0.00257767504f, 0.00167687039f, 0.00209366623f, 0.00257462985f, 0.00196130853f, 0.00219041388f, 0.00224998919f, 0.00266959402f, 0.00311091985f, 0.00210226048f, 0.00212001964f, 0.00243116822f, 0.00142675196f, 0.00177467905f, 0.0021349655f, 0.00185036904f, 0.00165378256f, 0.00227110367f, 0.00275235111f, 0.00196075276f, 0.00207472988f, 0.00254322146f, 0.00166368508f, 0.00166977476f, 0.00203295914f, 0.00246628816f, 0.00216204929f, 0.00173163251f, 0.00149349892f, 0.00221173628f, 0.00305093871f, 0.00184044836f, 0.00244799023f, 0.0020653957f, 0.00221895613f, 0.00246976758f, 0.00280818599f, 0.00215356587f, 0.00194290944f, 0.00176200585f, 0.00204837811f, 0.00309629017f, 0.00298452075f}};
+const tflite::StaticAffineQuantization kQuantization6 = {&kFloatArray6, &kIntArray5, 0};
+const tflite::StaticIntArray<4> kIntArray6 = {4, {256, 1, 1, 128}};
+const tflite::StaticFloatArray<256> kFloatArray7 = {256, {0.0117457043f, 0.00707565621f, 0.0131058432f, 0.00761155225f, 0.0058303359f, 0.00849059597f, 0.00541870762f, 0.0100118779f, 0.00581320468f, 0.0100511312f, 0.00670591788f, 0.00595089188f, 0.00728565734f, 0.00725690695f, 0.0105285002f, 0.00919897202f, 0.00649771234f, 0.00585714215f, 0.00930202287f, 0.008612548f, 0.0100927427f, 0.00830629189f, 0.00810918119f, 0.00848670769f, 0.00919286534f, 0.00668751961f, 0.00728509575f, 0.00885835942f, 0.00976885203f, 0.00543970568f, 0.00630025333f, 0.00555818807f, 0.0061343438f, 0.00719116395f, 0.0080487309f, 0.00829275139f, 0.010793766f, 0.0078070513f, 0.0128277512f, 0.0109576676f, 0.00866125617f, 0.00787657686f, 0.00654837303f, 0.00701863924f, 0.00740242796f, 0.00780130131f, 0.00833010301f, 0.0105922706f, 0.00778001314f, 0.00698922994f, 0.00678696716f, 0.00661549671f, 0.00518426485f, 0.00900452398f, 0.0106866434f, 0.00672806147f, 0.00683569536f, 0.00698648999f, 0.00998955779f, 0.00557473861f, 0.00769527908f, 0.0114205806f, 0.00795105193f, 0.0126825199f, 0.0102909496f, 0.00959275663f, 0.00662614405f, 0.00931617059f, 0.00850757491f, 0.00862517115f, 0.00622051535f, 0.00956844818f, 0.00675328355f, 0.00745142857f, 0.0083497623f, 0.00760004809f, 0.00602259766f, 0.00807435904f, 0.0107294498f, 0.00748997927f, 0.0100836577f, 0.00670687202f, 0.010144243f, 0.00717444438f, 0.00566635327f, 0.00846924912f, 0.0106453886f, 0.0073029208f, 0.00881492626f, 0.00710707065f, 0.00620447006f, 0.00673985016f, 0.00829874072f, 0.0122987973f, 0.00854082499f, 0.00797940139f, 0.00878413208f, 0.00917846151f, 0.00625073304f, 0.00709556602f, 0.00910541415f, 0.00971700065f, 0.00760767749f, 0.00787427649f, 0.00700562773f, 0.00837250613f, 0.00674854266f, 0.00517952628f, 0.00947050657f, 0.0108755892f, 0.00624746876f, 0.00754634943f, 0.00641748263f, 0.00801742543f, 0.00474903919f, 0.00614993973f, 0.00797503069f, 0.00933296047f, 0.0128186354f, 0.00693583628f, 0.00874149799f, 0.0107524805f, 0.00580302021f, 0.00736323884f, 0.00816489849f, 0.00828156807f, 0.0116814515f, 0.00959131401f, 0.0139964391f, 0.00632402627f, 0.00653667143f, 0.0082147317f, 0.00853167195f, 0.00825182348f, 0.00614152616f, 0.00541662239f, 0.00631508464f, 0.0044156583f, 0.00641949149f, 0.00957494043f, 0.00834270101f, 0.0104935169f, 0.0143323848f, 0.00672379276f, 0.00936766062f, 0.0100281425f, 0.00854395889f, 0.00883582234f, 0.00893698446f, 0.00967069995f, 0.0079758754f, 0.00504841097f, 0.0113191735f, 0.00915498193f, 0.0067264922f, 0.00855371077f, 0.00807744917f, 0.0076279412f, 0.00732375076f, 0.00956806727f, 0.0076376209f, 0.00738490233f, 0.0047773649f, 0.00615451811f, 0.00905541331f, 0.00703262025f, 0.00949888863f, 0.00759271206f, 0.00762338284f, 0.0100661395f, 0.0157020632f, 0.00554141449f, 0.00923746731f, 0.0081662843f, 0.00698846439f, 0.0108747259f, 0.00992418732f, 0.00616337871f, 0.0120192738f, 0.00978944264f, 0.00924562383f, 0.010178146f, 0.00740556372f, 0.00601273123f, 0.00625966256f, 0.015779309f, 0.0103873424f, 0.0121449232f, 0.00700759795f, 0.00845466927f, 0.00916223973f, 0.00659928517f, 0.00541942287f, 0.00759982644f, 0.00521916244f, 0.00667997403f, 0.0061621042f, 0.00906499289f, 0.0113225803f, 0.0102405371f, 0.0108125154f, 0.00860687811f, 0.00571900699f, 0.00545451185f, 0.0103130201f, 0.00492864149f, 0.00788285397f, 0.00806497969f, 0.0121896192f, 0.0104537485f, 0.00689117843f, 0.00706404075f, 0.00764785102f, 0.00782812294f, 0.00923513062f, 0.0103553729f, 0.00893033948f, 0.00685067615f, 0.00798271783f, 0.00544158136f, 0.0101408474f, 0.00940131769f, 0.00815389492f, 0.0103519056f, 0.00758051779f, 0.00845352933f, 0.00724597974f, 0.00612956565f, 0.00805469137f, 0.00879119616f, 0.0129035255f, 0.0088364305f, 0.00700318348f, 0.00966313761f, 0.011889644f, 0.0061459667f, 0.0103408452f, 0.00667138863f, 0.00790081266f, 0.00691918703f, 0.010089607f, 0.0066904393f, 0.00547730038f, 0.00749178464f, 0.00907888915f, 0.0103458157f, 0.00854468718f, 0.00989091489f, 0.00926651154f, 0.00934524275f, 0.00965524092f, 0.00724062556f, 0.00520958425f, 0.00871098787f, 0.00604577968f, 0.00779590243f}};
+const tflite::StaticAffineQuantization kQuantization7 = {&kFloatArray7, &kIntArray5, 3};
+const tflite::StaticIntArray<4> kIntArray7 = {4, {1, 3, 3, 256}};
+const tflite::StaticFloatArray<256> kFloatArray8 = {256, {0.000842112408f, 0.00130414648f, 0.0011380309f, 0.000524384319f, 0.00117366319f, 0.00066889124f, 0.000740556221f, 0.00113972707f, 0.000849306234f, 0.00103367562f, 0.000843255722f, 0.000676923781f, 0.00107632659f, 0.000705455721f, 0.000688590982f, 0.00081828289f, 0.000882872322f, 0.000662960869f, 0.000597178296f, 0.000962805876f, 0.000559685403f, 0.000758543552f, 0.000981582562f, 0.000763695221f, 0.00115870184f, 0.00074113725f, 0.00136556255f, 0.000999392825f, 0.000582887558f, 0.000703678408f, 0.000831608195f, 0.000943110732f, 0.00110320328f, 0.000794017978f, 0.000763144111f, 0.000727773877f, 0.000803841802f, 0.000632337003f, 0.000875820057f, 0.000753161847f, 0.00100781268f, 0.000826590578f, 0.00100853376f, 0.000943803752f, 0.000552313519f, 0.000605472655f, 0.000747014768f, 0.000695569557f, 0.00105981133f, 0.00102432643f, 0.000827180687f, 0.000602250861f, 0.000690675341f, 0.00158295257f, 0.000720938551f, 0.000964717707f, 0.00101847225f, 0.000763303076f, 0.000686358486f, 0.000841331144f, 0.000843035232f, 0.000785059645f, 0.000984456507f, 0.000727805134f, 0.00058916898f, 0.000813489663f, 0.000623601954f, 0.000744064862f, 0.000741277065f, 0.00086698099f, 0.000884649227f, 0.000725133868f, 0.000496092951f, 0.000809113844f, 0.000644105312f, 0.000631028786f, 0.00126507843f, 0.000828872027f, 0.00068715727f, 0.000526135438f, 0.00155048072f, 0.000656237127f, 0.000526860938f, 0.0007458037f, 0.00110144599f, 0.000582724286f, 0.000688876607f, 0.0012005968f, 0.000745441881f, 0.000775208755f, 0.000979259261f, 0.000641932886f, 0.000777186768f, 0.000830215809f, 0.000554777915f, 0.00118355942f, 0.00100440765f, 0.000877912564f, 0.00115706515f, 0.000657708617f, 0.000652720046f, 0.00063990301f, 0.000639125297f, 0.000845408649f, 0.00105175306f, 0.000667248794f, 0.000645628839f, 0.000643645471f, 0.000930855516f, 0.000819009554f, 0.00102165435f, 0.000641001505f, 0.000499660382f, 0.00117573468f, 0.000682712242f, 0.00100317982f, 0.00108923728f, 0.000706921797f, 0.0012415112f, 0.00063701917f, 0.000842836162f, 0.000604667293f, 0.000629481452f, 0.000814539962f, 0.000845742528f, 0.000634456519f, 0.00061509473f, 0.000936223776f, 0.000897213118f, 0.00118519808f, 0.0012346576f, 0.000966677209f, 0.000825234631f, 0.000626746623f, 0.000885340327f, 0.000511605002f, 0.000959331344f, 0.000921559928f, 0.000629777147f, 0.000741837779f, 0.000910654955f, 0.000743448734f, 0.000769475184f, 0.000850813754f, 0.000814015861f, 0.00079556508f, 0.000873411365f, 0.000859947992f, 0.000935021089f, 0.000686534622f, 0.000865078589f, 0.000749069499f, 0.000631059695f, 0.000584293215f, 0.000928086694f, 0.000829492405f, 0.000737855327f, 0.00121250865f, 0.000755757384f, 0.000767102116f, 0.000625294866f, 0.000758580281f, 0.00140149693f, 0.000789263926f, 0.000740619842f, 0.000712209498f, 0.000604489062f, 0.000768014346f, 0.00056174706f, 0.00123741245f, 0.000792663777f, 0.000603617635f, 0.00105909305f, 0.000686841202f, 0.00076281128f, 0.000766857003f, 0.00207187049f, 0.00154796999f, 0.000866015151f, 0.000795413274f, 0.000622901774f, 0.000717238523f, 0.000752753578f, 0.000819042092f, 0.000954524963f, 0.00088377035f, 0.00116387231f, 0.000727140869f, 0.000699135126f, 0.000771000749f, 0.00080151303f, 0.000959212601f, 0.000628605718f, 0.000823796436f, 0.000933345873f, 0.00060837419f, 0.000689985289f, 0.000994718517f, 0.000617539685f, 0.000426906598f, 0.000694624963f, 0.000457055081f, 0.000896465383f, 0.000920733262f, 0.000804541982f, 0.000982807833f, 0.00109127536f, 0.000670410867f, 0.000565497379f, 0.000880902167f, 0.000910143484f, 0.000973340299f, 0.000796958455f, 0.000730808533f, 0.00143255387f, 0.000574611186f, 0.000580037595f, 0.000798729423f, 0.000923758955f, 0.000784496253f, 0.000838100968f, 0.000668857771f, 0.00100726553f, 0.00110097416f, 0.000767734717f, 0.000733056339f, 0.000609340961f, 0.000581459957f, 0.000673470553f, 0.000655372161f, 0.00105277367f, 0.000697130221f, 0.000770448707f, 0.000502173963f, 0.000974696595f, 0.00128315284f, 0.00100051169f, 0.000620235573f, 0.00064879522f, 0.000963065366f, 0.00144961604f, 0.00105426577f, 0.000645224063f, 0.00142911321f, 0.000599715393f, 0.00128937128f, 0.00113837095f, 0.000890996133f, 0.000682113634f, 0.00149357482f, 0.000704649254f, 0.000827738375f, 0.00126612f, 0.00103259354f, 0.000812122656f, 0.00103192579f}};
+const tflite::StaticAffineQuantization kQuantization8 = {&kFloatArray8, &kIntArray5, 0};
+const tflite::StaticIntArray<4> kIntArray8 = {4, {256, 1, 1, 256}};
+const tflite::StaticFloatArray<8> kFloatArray9 = {8, {0.00428244751f, 0.00618264545f, 0.146004513f, 0.002903688f, 0.0146602215f, 0.00264885672f, 0.00737399654f, 0.31964308f}};
+const tflite::StaticAffineQuantization kQuantization9 = {&kFloatArray9, &kIntArray0, 3};
+const tflite::StaticIntArray<16> kIntArray9 = {16, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+const tflite::StaticFloatArray<16> kFloatArray10 = {16, {0.013826617f, 0.00883920211f, 0.0165275447f, 0.00727126049f, 0.0121538732f, 0.0123067508f, 0.00783070736f, 0.00857046433f, 0.0142840622f, 0.00828269869f, 0.0128649948f, 0.00801924523f, 0.0121260947f, 0.00695286877f, 0.0081141768f, 0.010907732f}};
+const tflite::StaticAffineQuantization kQuantization10 = {&kFloatArray10, &kIntArray9, 0};
+const tflite::StaticIntArray<4> kIntArray10 = {4, {16, 1, 1, 8}};
+const tflite::StaticFloatArray<16> kFloatArray11 = {16, {0.00350469048f, 0.00303384429f, 0.00492874114f, 0.00400205003f, 0.00584234949f, 0.00480040861f, 0.00505840778f, 0.00267804926f, 0.00502581615f, 0.00890069641f, 0.00299418764f, 0.00495609129f, 0.00360774598f, 0.00350607373f, 0.00665708678f, 0.00723654265f}};
+const tflite::StaticAffineQuantization kQuantization11 = {&kFloatArray11, &kIntArray9, 3};
+const tflite::StaticIntArray<4> kIntArray11 = {4, {1, 3, 3, 16}};
+const tflite::StaticIntArray<32> kIntArray12 = {32, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+const tflite::StaticFloatArray<32> kFloatArray12 = {32, {0.0115221404f, 0.00401453953f, 0.00626025535f, 0.00639132038f, 0.00497542135f, 0.00159503159f, 0.00534194382f, 0.00688150246f, 0.00376011059f, 0.00339662912f, 0.00175300054f, 0.00515033118f, 0.00635465281f, 0.00509852543f, 0.00982401893f, 0.0114643304f, 0.00665064668f, 0.00765557075f, 0.00221314421f, 0.00314465794f, 0.0053928066f, 0.00193618669f, 0.00590380095f, 0.00672372989f, 0.00539267529f, 0.0011152114f, 0.00551001728f, 0.00730878068f, 0.00949182548f, 0.00470927823f, 0.00831933692f, 0.00368461013f}};
+const tflite::StaticAffineQuantization kQuantization12 = {&kFloatArray12, &kIntArray12, 0};
+const tflite::StaticIntArray<4> kIntArray13 = {4, {32, 1, 1, 16}};
+const tflite::StaticFloatArray<32> kFloatArray13 = {32, {0.0080894297f, 0.00963222329f, 0.00700800493f, 0.00989692751f, 0.0127436146f, 0.0241414011f, 0.00437976746f, 0.00717284391f, 0.00729259755f, 0.0169739425f, 0.0217083767f, 0.00672206795f, 0.00274909358f, 0.0131310932f, 0.0084508853f, 0.00205790158f, 0.00700033689f, 0.00426152116f, 0.0218844432f, 0.02441792f, 0.00550912227f, 0.0234514605f, 0.00317301555f, 0.00647593103f, 0.00608131709f, 0.0293608494f, 0.00758317392f, 0.00320949196f, 0.0050950069f, 0.00685285591f, 0.00645819493f, 0.0112365009f}};
+const tflite::StaticAffineQuantization kQuantization13 = {&kFloatArray13, &kIntArray12, 3};
+const tflite::StaticIntArray<4> kIntArray14 = {4, {1, 3, 3, 32}};
+const tflite::StaticFloatArray<32> kFloatArray14 = {32, {0.00432790769f, 0.00606587995f, 0.00496704783f, 0.00400248915f, 0.00210121623f, 0.00286284927f, 0.00372127001f, 0.00340356398f, 0.00493903831f, 0.00374570466f, 0.00576508697f, 0.00341838459f, 0.00522745494f, 0.00536258006f, 0.00324643939f, 0.00383256329f, 0.00402186671f, 0.0047303075f, 0.00579910539f, 0.00481632678f, 0.00673653511f, 0.00404177699f, 0.0036440955f, 0.00513223512f, 0.00640904345f, 0.00810303912f, 0.00657809293f, 0.00538314413f, 0.00284973881f, 0.00385641074f, 0.00465537142f, 0.00388823333f}};
+const tflite::StaticAffineQuantization kQuantization14 = {&kFloatArray14, &kIntArray12, 0};
+const tflite::StaticIntArray<4> kIntArray15 = {4, {32, 1, 1, 32}};
+const tflite::StaticFloatArray<32> kFloatArray15 = {32, {0.0028519663f, 0.00343102356f, 0.002634709f, 0.00355993258f, 0.00804970879f, 0.00412666379f, 0.00303329597f, 0.00305738789f, 0.00304651889f, 0.00235218415f, 0.0034891949f, 0.00303017139f, 0.00431682589f, 0.00681237411f, 0.004512785f, 0.00332404161f, 0.00313068787f, 0.00290882727f, 0.00491015147f, 0.00319304969f, 0.00485756528f, 0.00438933773f, 0.00206702971f, 0.00350918481f, 0.00691990601f, 0.00379815628f, 0.00328971376f, 0.0029371425f, 0.00475649536f, 0.00339225354f, 0.00441813888f, 0.00657115877f}};
+const tflite::StaticAffineQuantization kQuantization15 = {&kFloatArray15, &kIntArray12, 3};
+const tflite::StaticIntArray<64> kIntArray16 = {64, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+const tflite::StaticFloatArray<64> kFloatArray16 = {64, {0.004230096f, 0.00268528634f, 0.005036477f, 0.00423311861f, 0.00326360553f, 0.00369479298f, 0.00488079013f, 0.00402482273f, 0.00276235235f, 0.00428916002f, 0.00227759569f, 0.00488121947f, 0.00274586235f, 0.00421172846f, 0.00530884229f, 0.00800757203f, 0.004134221f, 0.00398917077f, 0.0042948341f, 0.00287199626f, 0.00704311859f, 0.00323615246f, 0.00336411595f, 0.00595675968f, 0.00569168851f, 0.00172768394f, 0.00265666004f, 0.00656811241f, 0.00548477005f, 0.00400214689f, 0.00421561301f, 0.00594988838f, 0.00519922981f, 0.00247312756f, 0.00363912666f, 0.0068087792f, 0.00241484214f, 0.00250341138f, 0.00365716452f, 0.00276816683f, 0.00341199432f, 0.0043283687f, 0.00323376013f, 0.00435960712f, 0.00630733231f, 0.00636684243f, 0.0020496794f, 0.00368224271f, 0.00528925192f, 0.00857570861f, 0.00809007324f, 0.00438674167f, 0.00432626111f, 0.00836863928f, 0.00526655791f, 0.00465588598f, 0.00324091245f, 0.00650185114f, 0.004458935f, 0.00507377647f, 0.00296111638f, 0.00773350708f, 0.00572560076f, 0.00306290621f}};
+const tflite::StaticAffineQuantization kQuantization16 = {&kFloatArray16, &kIntArray16, 0};
+const tflite::StaticIntArray<4> kIntArray17 = {4, {64, 1, 1, 32}};
+const tflite::StaticFloatArray<64> kFloatArray17 = {64, {0.00510951085f, 0.0094593605f, 0.00733629568f, 0.00751833804f, 0.00933452044f, 0.00438511884f, 0.00541970879f, 0.00306590111f, 0.0127157615f, 0.0144653311f, 0.017258184f, 0.00926490407f, 0.00906856451f, 0.00385801331f, 0.0065307417f, 0.00782022718f, 0.00580508029f, 0.0047275601f, 0.00658924598f, 0.0048025623f, 0.00454771239f, 0.00588625204f, 0.017020585f, 0.006201379f, 0.00541314948f, 0.0139554674f, 0.0112622334f, 0.00456367526f, 0.00588177703f, 0.0071301437f, 0.00540889241f, 0.0070964233f, 0.00425648969f, 0.00556018157f, 0.00656685792f, 0.00355191203f, 0.0109335994f, 0.011856107f, 0.00557570811f, 0.00538529828f, 0.00725296559f, 0.00691131456f, 0.0100044059f, 0.00665013399f, 0.00382491504f, 0.00340516143f, 0.0116159236f, 0.00405168114f, 0.0104503855f, 0.00891518686f, 0.00744348392f, 0.00864183623f, 0.0130860116f, 0.00547426613f, 0.00445722509f, 0.00518461457f, 0.00859209895f, 0.00611028727f, 0.00473698601f, 0.00491966447f, 0.0123349112f, 0.00422148546f, 0.00561250327f, 0.0115597192f}};
+const tflite::StaticAffineQuantization kQuantization17 = {&kFloatArray17, &kIntArray16, 3};
+const tflite::StaticIntArray<4> kIntArray18 = {4, {1, 3, 3, 64}};
+const tflite::StaticFloatArray<64> kFloatArray18 = {64, {0.00262121204f, 0.00382103352f, 0.00431398069f, 0.00502086896f, 0.00344852288f, 0.00282705366f, 0.00358264241f, 0.00331981317f, 0.00432958826f, 0.00394289708f, 0.00388374878f, 0.00343809929f, 0.00393417152f, 0.00242973934f, 0.00514880475f, 0.0021868581f, 0.00394439325f, 0.00220465031f, 0.00256891851f, 0.00463575777f, 0.00366113801f, 0.00326292263f, 0.00357571454f, 0.00367392693f, 0.00262514967f, 0.0023919805f, 0.004751598f, 0.00344232004f, 0.00440115854f, 0.00335182645f, 0.00395181123f, 0.0033759214f, 0.00295306463f, 0.00331756286f, 0.0031233381f, 0.00287581887f, 0.00330303865f, 0.00229719072f, 0.00263486686f, 0.00425872346f, 0.00398864131f, 0.00357442116f, 0.00282106129f, 0.00364431692f, 0.0037364997f, 0.00342325983f, 0.00286358339f, 0.00239364733f, 0.00301819481f, 0.00191559631f, 0.00353814452f, 0.00433013029f, 0.00154682889f, 0.00216834876f, 0.00358037464f, 0.00332100946f, 0.003173206f, 0.00358377304f, 0.00351182302f, 0.00338823535f, 0.00388540886f, 0.00401312392f, 0.00226271222f, 0.00224083383f}};
+const tflite::StaticAffineQuantization kQuantization18 = {&kFloatArray18, &kIntArray16, 0};
+const tflite::StaticIntArray<4> kIntArray19 = {4, {64, 1, 1, 64}};
+const tflite::StaticFloatArray<64> kFloatArray19 = {64, {0.00441551255f, 0.00416444568f, 0.00349371741f, 0.00379395182f, 0.00288013695f, 0.00295946561f, 0.00494032586f, 0.00382985384f, 0.0037778283f, 0.00542642456f, 0.00376853789f, 0.00412811758f, 0.00418157596f, 0.00390548538f, 0.00384268793f, 0.00742075685f, 0.00360864052f, 0.00957908574f, 0.00371286413f, 0.00436880812f, 0.00348095549f, 0.00398525083f, 0.00558597036f, 0.00335148838f, 0.00480915373f, 0.00365597429f, 0.00454111397f, 0.00389363663f, 0.00388220325f, 0.00457082503f, 0.00345753436f, 0.00393587817f, 0.0034876659f, 0.00367319421f, 0.00754470518f, 0.00526271947f, 0.00455691339f, 0.00466811704f, 0.00309458235f, 0.00317875878f, 0.00368687091f, 0.00513577601f, 0.00500061549f, 0.00450680545f, 0.00346791046f, 0.00449498277f, 0.00324125448f, 0.00462720962f, 0.00377392373f, 0.00424224464f, 0.00274399179f, 0.00467563933f, 0.0062591508f, 0.00590108056f, 0.00355424662f, 0.00400870899f, 0.0066364035f, 0.00400205981f, 0.00301917433f, 0.00304967072f, 0.00288769975f, 0.00434042513f, 0.00415077293f, 0.00665126787f}};
+const tflite::StaticAffineQuantization kQuantization19 = {&kFloatArray19, &kIntArray16, 3};
+const tflite::StaticFloatArray<128> kFloatArray20 = {128, {0.00377028319f, 0.00311884307f, 0.00574313104f, 0.00386966486f, 0.00310293888f, 0.00481216796f, 0.00240775198f, 0.00321880658f, 0.00443743868f, 0.00339896511f, 0.00310603087f, 0.00431755092f, 0.00272359792f, 0.00187340996f, 0.00257159607f, 0.00282337726f, 0.00277171819f, 0.00302362768f, 0.00380047946f, 0.00258068717f, 0.00352727249f, 0.0027197001f, 0.0040091332f, 0.00413537025f, 0.00437702052f, 0.00289706187f, 0.00330846501f, 0.00366292149f, 0.0031591102f, 0.00409763958f, 0.00350561901f, 0.00299463491f, 0.00363555667f, 0.00283073564f, 0.00272652134f, 0.0026573881f, 0.00316581503f, 0.00184122042f, 0.00337919779f, 0.00385198044f, 0.0040047029f, 0.00338329561f, 0.00302133407f, 0.00346289342f, 0.0040526716f, 0.00204075314f, 0.00332718855f, 0.00341386558f, 0.00230745459f, 0.00245542615f, 0.00393469073f, 0.00358447619f, 0.00336643355f, 0.00345029566f, 0.00303126802f, 0.00307539804f, 0.00370168919f, 0.00334670814f, 0.00267362501f, 0.00202991581f, 0.00300329807f, 0.00280870846f, 0.00266092829f, 0.0030579404f, 0.00344443368f, 0.0033723095f, 0.00251570344f, 0.00475908024f, 0.00300176139f, 0.00295668188f, 0.00308408542f, 0.00224328786f, 0.00332988589f, 0.00320752617f, 0.00309676235f, 0.00205930113f, 0.00253102905f, 0.00277093332f, 0.00274043274f, 0.00269332808f, 0.0034252801f, 0.00319547812f, 0.00385851506f, 0.00309580006f, 0.00297968322f, 0.00317576504f, 0.00230618822f, 0.00307914824f, 0.00293597695f, 0.00247868523f, 0.00371469581f, 0.00259317528f, 0.00338206906f, 0.00247165165f, 0.00416579423f, 0.00251395814f, 0.00239985716f, 0.00383030367f, 0.00307738641f, 0.00335694663f, 0.00398662779f, 0.00413510669f, 0.00340229087f, 0.00370226265f, 0.00353061338f, 0.00245492207f, 0.00276221265f, 0.00305839861f, 0.00309993536f, 0.00334841455f, 0.0036655271f, 0.00208164728f, 0.00295684324f, 0.00301029626f, 0.00276494073f, 0.00319132558f, 0.00334160123f, 0.0024207565f, 0.00284991926f, 0.00192013977f, 0.00298775244f, 0.00240546186f, 0.00315587199f, 0.00446831202f, 0.00420809863f, 0.00257162191f, 0.00325179193f, 0.00303313695f}};
+const tflite::StaticAffineQuantization kQuantization20 = {&kFloatArray20, &kIntArray2, 0};
+const tflite::StaticIntArray<4> kIntArray20 = {4, {128, 1, 1, 64}};
+const tflite::StaticFloatArray<128> kFloatArray21 = {128, {0.00464181742f, 0.00682961196f, 0.00672035385f, 0.00918852724f, 0.00747094583f, 0.00373231969f, 0.0054968358f, 0.0092051411f, 0.00582090998f, 0.00567479571f, 0.00846511405f, 0.00837459974f, 0.0108534778f, 0.0169589985f, 0.00593652669f, 0.00727096945f, 0.00918963552f, 0.00922283996f, 0.00753124291f, 0.0125981309f, 0.0104031209f, 0.00853538513f, 0.00990873389f, 0.00555999344f, 0.00398570113f, 0.00654057506f, 0.00597882178f, 0.00819930341f, 0.00648938818f, 0.00974025484f, 0.0047386596f, 0.0060506817f, 0.00536366133f, 0.00732505415f, 0.00701329159f, 0.00903998408f, 0.00549310306f, 0.00743754394f, 0.00666832365f, 0.00572677469f, 0.0061598937f, 0.00794640277f, 0.00591986673f, 0.00594598847f, 0.00633375673f, 0.00436541811f, 0.00668892218f, 0.00969873369f, 0.010087736f, 0.00719914772f, 0.0062853545f, 0.00786086731f, 0.00635179644f, 0.00598309422f, 0.00571922772f, 0.00544972066f, 0.00764542399f, 0.0102245966f, 0.00657046773f, 0.00717392983f, 0.00855763815f, 0.00532755814f, 0.0107059982f, 0.0124929715f, 0.00530548394f, 0.00449374737f, 0.0102083627f, 0.00542607391f, 0.00670369156f, 0.00793320406f, 0.00460931845f, 0.00964788813f, 0.00741475821f, 0.00640655216f, 0.0116442619f, 0.0151838409f, 0.00627535628f, 0.00404352928f, 0.00588937663f, 0.00615292555f, 0.00870244578f, 0.0100104194f, 0.00803736411f, 0.00556434551f, 0.00500637479f, 0.00748096453f, 0.00921408739f, 0.00793813542f, 0.00562591059f, 0.0158039816f, 0.00801888108f, 0.00573800458f, 0.00604299735f, 0.00592178712f, 0.00640370883f, 0.00735008996f, 0.00788206607f, 0.00922168512f, 0.00519049214f, 0.00949647836f, 0.0067774062f, 0.00656265207f, 0.0100460956f, 0.00494781975f, 0.00522840023f, 0.00602207053f, 0.00738396449f, 0.00437396113f, 0.00618713489f, 0.00899201259f, 0.0120424405f, 0.0133149261f, 0.00585767208f, 0.0116353175f, 0.00646083709f, 0.0115147084f, 0.0062861573f, 0.00961781666f, 0.00670075836f, 0.00974602625f, 0.0075120246f, 0.00418508099f, 0.00475017307f, 0.00455595693f, 0.00940211397f, 0.0078331586f, 0.00831991062f, 0.00442681462f}};
+const tflite::StaticAffineQuantization kQuantization21 = {&kFloatArray21, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray22 = {128, {0.00228037895f, 0.00363418343f, 0.00287598697f, 0.00273099588f, 0.00227555959f, 0.00223098486f, 0.00229635928f, 0.00366202393f, 0.00227003614f, 0.0022683274f, 0.00424818508f, 0.00320360693f, 0.00219551474f, 0.0028085201f, 0.00285772467f, 0.00272116601f, 0.0022486283f, 0.00313308043f, 0.00305775064f, 0.0026734462f, 0.00290814368f, 0.00261331699f, 0.00235062488f, 0.00289474032f, 0.00304844696f, 0.00308927917f, 0.00201922026f, 0.00256227632f, 0.00206484762f, 0.00266769389f, 0.00264753122f, 0.00316003524f, 0.00233922084f, 0.00270107738f, 0.00241496344f, 0.00374361267f, 0.00270635681f, 0.00195965241f, 0.00276476308f, 0.00246111932f, 0.00353765534f, 0.00320959068f, 0.00250915578f, 0.00251322472f, 0.00265894015f, 0.00239013997f, 0.00251907133f, 0.00282830209f, 0.00281185377f, 0.00271152891f, 0.00211741729f, 0.00285256072f, 0.00217191153f, 0.00221300311f, 0.00230364315f, 0.00237721903f, 0.00222331006f, 0.00219613872f, 0.00216097129f, 0.0031224268f, 0.0030175047f, 0.00189453759f, 0.00233365502f, 0.0023697773f, 0.0029737174f, 0.00269088335f, 0.0031674772f, 0.00227366271f, 0.00270299916f, 0.00254839333f, 0.00327769504f, 0.00284272642f, 0.00277589215f, 0.00261865347f, 0.00303128292f, 0.00309621776f, 0.00315336534f, 0.00259644655f, 0.00262477272f, 0.00256953738f, 0.00360899325f, 0.00268766074f, 0.00254075415f, 0.00274470076f, 0.00298681506f, 0.00310726371f, 0.00194437278f, 0.00198473642f, 0.00231860764f, 0.00258411793f, 0.0024002064f, 0.0029276784f, 0.0021870709f, 0.00253436086f, 0.0035711918f, 0.00271627819f, 0.00201791385f, 0.0023663165f, 0.00418266095f, 0.00222597108f, 0.00311879301f, 0.0022588477f, 0.00323306792f, 0.00280133914f, 0.00265358901f, 0.00255220593f, 0.00243007974f, 0.00303220865f, 0.00222141831f, 0.00240384927f, 0.00221836148f, 0.00305239391f, 0.00414053351f, 0.00203558709f, 0.0018881365f, 0.00217907433f, 0.00389928627f, 0.00205100025f, 0.00242698472f, 0.00319156726f, 0.00242285058f, 0.0028916751f, 0.0024590767f, 0.0026550293f, 0.00222541182f, 0.00279145944f, 0.00316614099f, 0.00280319038f}};
+const tflite::StaticAffineQuantization kQuantization22 = {&kFloatArray22, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray23 = {128, {0.00566967903f, 0.00824124459f, 0.00519455364f, 0.00415722141f, 0.00568966148f, 0.00903036352f, 0.00896777306f, 0.00671670167f, 0.00453453092f, 0.00525089493f, 0.00497244578f, 0.00976573303f, 0.00514130155f, 0.00462558633f, 0.00422097137f, 0.00448631169f, 0.0101894382f, 0.00655242009f, 0.0113704093f, 0.00500452193f, 0.0107947849f, 0.00489364937f, 0.00644869497f, 0.00554064661f, 0.0044830977f, 0.00607895013f, 0.0075244545f, 0.00522195036f, 0.00565834437f, 0.00602424936f, 0.0105232215f, 0.00873208977f, 0.00716743898f, 0.00644092355f, 0.00387508189f, 0.00626689242f, 0.00497958204f, 0.00659472216f, 0.00494650891f, 0.00535243424f, 0.00528149912f, 0.00862593483f, 0.00669724774f, 0.0055743698f, 0.00395332323f, 0.00486390479f, 0.00740307244f, 0.00950201042f, 0.00467335153f, 0.0065187104f, 0.00598023506f, 0.00510401605f, 0.00631316938f, 0.00469105411f, 0.00519125024f, 0.00677208696f, 0.00716787577f, 0.0109229246f, 0.00685735093f, 0.00443521654f, 0.0101530477f, 0.00626162486f, 0.00493869698f, 0.00756202452f, 0.00625905767f, 0.00837430824f, 0.00486292271f, 0.00419046916f, 0.00843452848f, 0.00561067322f, 0.0066062659f, 0.0071705915f, 0.00674129836f, 0.00435543619f, 0.00728453975f, 0.0059309816f, 0.00616739457f, 0.00536089158f, 0.00689535448f, 0.0124038784f, 0.00557869859f, 0.00470307982f, 0.00971133169f, 0.00529915234f, 0.00676767481f, 0.00478884624f, 0.00652774703f, 0.0092182681f, 0.00740346592f, 0.0073591331f, 0.0121134035f, 0.00514404569f, 0.00794343371f, 0.00419188663f, 0.00474959146f, 0.00452963775f, 0.00884699635f, 0.00677603995f, 0.00650361646f, 0.00668001967f, 0.00441373792f, 0.00502479868f, 0.00477745198f, 0.00723432191f, 0.00429382781f, 0.00494127441f, 0.00689072814f, 0.00716771837f, 0.00558096496f, 0.0091771055f, 0.00543984305f, 0.00764137087f, 0.00679512275f, 0.00922578853f, 0.0069812797f, 0.00510360952f, 0.00444297818f, 0.00482200459f, 0.0105968807f, 0.00438479427f, 0.00484608207f, 0.00977377314f, 0.00462185638f, 0.0110738855f, 0.0073683681f, 0.00510015804f, 0.00528532732f, 0.00612920802f}};
+const tflite::StaticAffineQuantization kQuantization23 = {&kFloatArray23, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray24 = {128, {0.00214339164f, 0.00257003237f, 0.00249007344f, 0.00244345213f, 0.00359314866f, 0.0035446682f, 0.00246481854f, 0.00233652536f, 0.0023807704f, 0.00311780162f, 0.00273637031f, 0.00265248073f, 0.00265029352f, 0.00273824995f, 0.00211259862f, 0.0022013355f, 0.00285087386f, 0.00295126904f, 0.00258470653f, 0.00215808605f, 0.00284862146f, 0.00257583475f, 0.00277392846f, 0.00273981853f, 0.00296750758f, 0.00258073187f, 0.00247066282f, 0.00302316528f, 0.00265987823f, 0.00266860845f, 0.00272826408f, 0.00301300874f, 0.00291807903f, 0.00232158159f, 0.00234344485f, 0.00270760339f, 0.00359460548f, 0.00289583486f, 0.00267159264f, 0.00243299361f, 0.0028156226f, 0.00266077695f, 0.00223500445f, 0.00253845565f, 0.00212655007f, 0.00248491531f, 0.00304865767f, 0.00302825589f, 0.00180319557f, 0.00174903241f, 0.00282845018f, 0.00181046966f, 0.00261367019f, 0.00233264733f, 0.00195929222f, 0.00276589021f, 0.00269925292f, 0.00211717072f, 0.00272383029f, 0.00260429969f, 0.00197981368f, 0.00243588234f, 0.00268205092f, 0.00306589971f, 0.00227388483f, 0.00267322082f, 0.00206496683f, 0.00262817391f, 0.00246614916f, 0.00259138155f, 0.00322759221f, 0.00298264879f, 0.00291042612f, 0.00349916308f, 0.00357316388f, 0.00268800394f, 0.00373010663f, 0.00226205331f, 0.002663441f, 0.00237535941f, 0.00275144121f, 0.0034922224f, 0.00303849648f, 0.00281912554f, 0.00356499525f, 0.0026335516f, 0.00193191494f, 0.00224504084f, 0.00199440471f, 0.00274775736f, 0.00253530499f, 0.00292876782f, 0.00252892333f, 0.00298795081f, 0.00239468925f, 0.00262172963f, 0.00339621305f, 0.00287468429f, 0.00229846966f, 0.0023938152f, 0.003343191f, 0.00215285481f, 0.00299700187f, 0.00191665883f, 0.00299515878f, 0.0022449242f, 0.00300923525f, 0.00375437108f, 0.00216230471f, 0.00233960967f, 0.0021588814f, 0.00268659368f, 0.0027919875f, 0.00269979029f, 0.00291416864f, 0.00266378256f, 0.00242192415f, 0.00191102817f, 0.00256982772f, 0.00205749297f, 0.00246668677f, 0.00236853119f, 0.00257576257f, 0.00261444435f, 0.00305653177f, 0.00223935256f, 0.00254419376f, 0.00263284286f}};
+const tflite::StaticAffineQuantization kQuantization24 = {&kFloatArray24, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray25 = {128, {0.00663880724f, 0.00420539035f, 0.0044797603f, 0.00561542343f, 0.0101356544f, 0.00544900354f, 0.00518342946f, 0.00637614401f, 0.00463852938f, 0.00443950482f, 0.00627352996f, 0.00776416669f, 0.0045598899f, 0.00430895807f, 0.00863438006f, 0.00714391936f, 0.00756427879f, 0.00519294245f, 0.00457941508f, 0.00353831588f, 0.00738258194f, 0.00442915782f, 0.00857529044f, 0.00933005288f, 0.00847419072f, 0.00692982413f, 0.00432656938f, 0.00865236949f, 0.00756713329f, 0.0120939761f, 0.00814744364f, 0.0065127518f, 0.00537918741f, 0.00690304209f, 0.00627504569f, 0.00761515414f, 0.00655512419f, 0.00529273134f, 0.00535529433f, 0.00952630676f, 0.0041026352f, 0.00551961455f, 0.00457297219f, 0.00791025069f, 0.00739187934f, 0.00553264283f, 0.00493384944f, 0.00555400783f, 0.00958299171f, 0.0103588598f, 0.00536224991f, 0.00819779467f, 0.00644712849f, 0.00471226173f, 0.0053880238f, 0.00541676255f, 0.0060519916f, 0.00660849689f, 0.0136667723f, 0.010153533f, 0.00625886815f, 0.0113645848f, 0.00618744921f, 0.00532082282f, 0.00663001742f, 0.00895037316f, 0.00439213449f, 0.00617613969f, 0.00969696138f, 0.00348603702f, 0.00811306946f, 0.00661491277f, 0.00470909849f, 0.00466489606f, 0.00556494948f, 0.0140165482f, 0.0055475696f, 0.00714313006f, 0.00488840276f, 0.00435635354f, 0.00482966378f, 0.00580770709f, 0.0079761697f, 0.0048651984f, 0.00732008135f, 0.00447841315f, 0.00489748036f, 0.00609115604f, 0.00764824869f, 0.00741764857f, 0.0046821977f, 0.0051159421f, 0.00540982932f, 0.00371103245f, 0.0122500658f, 0.00425169989f, 0.00739712128f, 0.00819738116f, 0.00473131472f, 0.00458073197f, 0.00784988049f, 0.00470924797f, 0.00560757983f, 0.00438199984f, 0.00431827735f, 0.00501227146f, 0.00754984235f, 0.00665927026f, 0.00520049036f, 0.0077668787f, 0.00476846565f, 0.00779721374f, 0.00459750323f, 0.00418532733f, 0.00571574364f, 0.00525376806f, 0.0062275622f, 0.00625912473f, 0.00826424826f, 0.00734692672f, 0.00800276268f, 0.00362781226f, 0.00463225786f, 0.00430467864f, 0.00529491063f, 0.00423718104f, 0.00499213813f, 0.00580860768f}};
+const tflite::StaticAffineQuantization kQuantization25 = {&kFloatArray25, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray26 = {128, {0.00217605755f, 0.00281172548f, 0.00223296485f, 0.00257449714f, 0.00209678314f, 0.00361206778f, 0.00266614673f, 0.00304110767f, 0.00220567035f, 0.00307999016f, 0.00287125958f, 0.0028089371f, 0.00208466407f, 0.00257436535f, 0.0026133426f, 0.00177733321f, 0.0023565779f, 0.00215925789f, 0.00178737275f, 0.00307382271f, 0.00259958277f, 0.00261540688f, 0.00236997684f, 0.00212201895f, 0.0018799731f, 0.00400513923f, 0.00197499874f, 0.00352435303f, 0.00390631333f, 0.00271473033f, 0.00256290613f, 0.00323982467f, 0.00309373974f, 0.00224975194f, 0.00296372315f, 0.00208150083f, 0.00287630456f, 0.00264868606f, 0.00216594525f, 0.00318642869f, 0.00312097534f, 0.00322471233f, 0.0022166355f, 0.00254778494f, 0.00213939021f, 0.00216746237f, 0.00285364548f, 0.00253873575f, 0.00272865524f, 0.00275512901f, 0.00236242265f, 0.00259796646f, 0.00302704773f, 0.0026988429f, 0.00300926133f, 0.00307223899f, 0.00260602986f, 0.00207363092f, 0.00255375495f, 0.00263906084f, 0.00242212298f, 0.00252022478f, 0.00211832183f, 0.00273095584f, 0.00309581938f, 0.00259570847f, 0.00283503672f, 0.00272600097f, 0.00213797949f, 0.00269145076f, 0.00352606736f, 0.00216920185f, 0.00258767116f, 0.00262727775f, 0.00381102506f, 0.00337793608f, 0.00259044557f, 0.00295299687f, 0.00276258541f, 0.00270362385f, 0.00277610309f, 0.0025328903f, 0.00306461169f, 0.0030650429f, 0.00254282798f, 0.00224281242f, 0.00230148993f, 0.00255669607f, 0.00327102514f, 0.0033066168f, 0.00360785541f, 0.00302861258f, 0.00241979747f, 0.00268353382f, 0.00251746364f, 0.00251513952f, 0.00228817784f, 0.00305530592f, 0.00210780045f, 0.00277862418f, 0.00259009493f, 0.00226458698f, 0.00243614055f, 0.00232115388f, 0.00294542429f, 0.00240409165f, 0.00278922752f, 0.00217711134f, 0.00226030685f, 0.00205957028f, 0.00394180557f, 0.00228987657f, 0.00376588129f, 0.00299163326f, 0.00187765446f, 0.00243850402f, 0.00228828075f, 0.00243641227f, 0.00342361745f, 0.00421693036f, 0.00388296484f, 0.00268029864f, 0.00286844838f, 0.00188581552f, 0.00228387467f, 0.00246948656f, 0.00248408644f, 0.00307568535f}};
+const tflite::StaticAffineQuantization kQuantization26 = {&kFloatArray26, &kIntArray2, 0};
+const tflite::StaticIntArray<1> kIntArray21 = {1, {-128}};
+const tflite::StaticFloatArray<1> kFloatArray27 = {1, {0.0186093301f}};
+const tflite::StaticAffineQuantization kQuantization27 = {&kFloatArray27, &kIntArray21, 0};
+const tflite::StaticIntArray<4> kIntArray22 = {4, {1, 1, 1, 256}};
+const tflite::StaticIntArray<1> kIntArray23 = {1, {-1}};
+const tflite::StaticFloatArray<1> kFloatArray28 = {1, {0.0125187514f}};
+const tflite::StaticAffineQuantization kQuantization28 = {&kFloatArray28, &kIntArray23, 0};
+const tflite::StaticIntArray<4> kIntArray24 = {4, {1, 1, 1, 2}};
+const tflite::StaticIntArray<2> kIntArray25 = {2, {0, 0}};
+const tflite::StaticFloatArray<2> kFloatArray29 = {2, {2.72369634e-05f, 2.59588269e-05f}};
+const tflite::StaticAffineQuantization kQuantization29 = {&kFloatArray29, &kIntArray25, 0};
+const tflite::StaticIntArray<1> kIntArray26 = {1, {2}};
+const tflite::StaticFloatArray<2> kFloatArray30 = {2, {0.00146361871f, 0.00139493612f}};
+const tflite::StaticAffineQuantization kQuantization30 = {&kFloatArray30, &kIntArray25, 0};
+const tflite::StaticIntArray<4> kIntArray27 = {4, {2, 1, 1, 256}};
+const tflite::StaticIntArray<2> kIntArray28 = {2, {1, 2}};
+const tflite::StaticFloatArray<8> kFloatArray31 = {8, {0.00012830476f, 0.000208710233f, 2.38291414e-05f, 2.55883224e-05f, 9.04806147e-05f, 0.000293193763f, 0.000142275981f, 8.51938876e-06f}};
+const tflite::StaticAffineQuantization kQuantization31 = {&kFloatArray31, &kIntArray0, 3};
+const tflite::StaticIntArray<1> kIntArray29 = {1, {8}};
+const tflite::StaticFloatArray<1> kFloatArray32 = {1, {0.0235294122f}};
+const tflite::StaticAffineQuantization kQuantization32 = {&kFloatArray32, &kIntArray21, 0};
+const tflite::StaticIntArray<4> kIntArray30 = {4, {1, 48, 48, 8}};
+const tflite::StaticIntArray<4> kIntArray31 = {4, {1, 6, 6, 128}};
+const tflite::StaticFloatArray<128> kFloatArray33 = {128, {0.00013227966f, 0.000139994518f, 0.000167269609f, 0.000145593978f, 0.00014952707f, 0.00017459759f, 0.000130281784f, 0.000155475951f, 0.000149479063f, 0.000115219613f, 0.000157795541f, 0.000194611814f, 0.000168964703f, 0.000191344297f, 0.000238682987f, 0.000102459759f, 0.000197339788f, 0.000181840951f, 0.000124378421f, 0.000118160599f, 0.000185390716f, 0.000144532329f, 8.56261031e-05f, 0.000159729883f, 0.000228324861f, 0.000104335777f, 0.000132874266f, 0.00012739755f, 0.000163443139f, 0.000233977597f, 0.000164479876f, 8.68528005e-05f, 0.000189582046f, 0.000185247758f, 0.000141248151f, 0.000268148229f, 0.00012271227f, 0.000173036475f, 0.000201412142f, 0.000120434081f, 0.000162078897f, 0.000106299638f, 0.000208051206f, 0.00024807977f, 0.000185831814f, 9.95251321e-05f, 0.00015462494f, 0.000141003911f, 0.000203196469f, 9.86294835e-05f, 0.000161340402f, 0.000177825365f, 0.000188347651f, 0.000161756616f, 0.000101589198f, 0.000168101629f, 0.000112638452f, 8.64216054e-05f, 0.000170848318f, 9.05228226e-05f, 9.92990535e-05f, 0.000158181851f, 0.000281351531f, 0.000146013626f, 0.000114822586f, 0.000175798123f, 0.000114613664f, 0.000168116749f, 0.000205922901f, 0.000149788058f, 0.000154255249f, 0.000212127474f, 0.000123230071f, 8.73528625e-05f, 0.000112898713f, 0.000144768928f, 0.000100526435f, 0.000125430815f, 9.62373961e-05f, 0.000125192251f, 0.000152314649f, 0.000120225486f, 0.000214670887f, 0.000136711446f, 8.60025029e-05f, 0.000154561218f, 0.000215031017f, 0.000225070282f, 0.000168712446f, 0.000264817878f, 0.000151719883f, 0.000160617594f, 0.000183432887f, 0.000104873456f, 0.000305962167f, 0.000183797471f, 0.000251352903f, 0.00013624804f, 0.000113800728f, 0.000157117523f, 0.000137861789f, 0.000111378897f, 8.11856589e-05f, 0.000174874542f, 9.96043018e-05f, 0.000153707893f, 0.000184937613f, 0.000207987978f, 0.000268750504f, 0.000221129332f, 0.000165508478f, 0.000148349849f, 0.000110107663f, 0.000162030163f, 0.000131801644f, 9.69292305e-05f, 0.000160298878f, 0.00017262857f, 0.000153104353f, 0.000115826762f, 8.95548219e-05f, 0.000140707096f, 0.00018471964f, 0.000175666981f, 0.000211286067f, 9.44298299e-05f, 0.000176482165f, 0.000177813592f}};
+const tflite::StaticAffineQuantization kQuantization33 = {&kFloatArray33, &kIntArray2, 3};
+const tflite::StaticIntArray<1> kIntArray32 = {1, {128}};
+const tflite::StaticFloatArray<128> kFloatArray34 = {128, {6.19200218e-05f, 5.67805037e-05f, 5.65545197e-05f, 5.253575e-05f, 5.13242339e-05f, 4.74215376e-05f, 4.56997986e-05f, 4.0553321e-05f, 5.55811093e-05f, 6.36155746e-05f, 8.28926495e-05f, 6.60676815e-05f, 5.49987017e-05f, 5.59984874e-05f, 5.11511462e-05f, 6.94323971e-05f, 6.80705998e-05f, 5.27997836e-05f, 6.22471562e-05f, 6.48048081e-05f, 6.23458109e-05f, 7.72337298e-05f, 5.62951245e-05f, 6.0820701e-05f, 5.97752587e-05f, 5.84970185e-05f, 8.11521168e-05f, 5.51967278e-05f, 6.91459718e-05f, 5.99274244e-05f, 5.09338024e-05f, 4.51192391e-05f, 5.72124518e-05f, 4.58789946e-05f, 6.40043218e-05f, 6.05207933e-05f, 7.91501661e-05f, 6.0076025e-05f, 5.73408579e-05f, 5.46925476e-05f, 6.28505513e-05f, 5.4033615e-05f, 5.60948865e-05f, 4.43500539e-05f, 5.56840751e-05f, 4.70466766e-05f, 5.37489213e-05f, 7.14227208e-05f, 5.32899103e-05f, 7.52016567e-05f, 5.63566027e-05f, 7.92747087e-05f, 6.1106708e-05f, 4.8509366e-05f, 6.47855486e-05f, 6.88992513e-05f, 5.81304266e-05f, 6.79388322e-05f, 5.59901382e-05f, 4.83631557e-05f, 4.48983665e-05f, 4.43514073e-05f, 6.15150275e-05f, 5.7715235e-05f, 7.08132429e-05f, 5.66350645e-05f, 5.76433667e-05f, 7.7647157e-05f, 8.33778104e-05f, 9.97869283e-05f, 4.55862537e-05f, 4.5046505e-05f, 5.6602752e-05f, 4.21432196e-05f, 6.3222913e-05f, 5.65785995e-05f, 4.8826656e-05f, 4.26707702e-05f, 4.56418493e-05f, 5.48005337e-05f, 5.82217945e-05f, 5.23045273e-05f, 6.14147284e-05f, 4.84861594e-05f, 7.22477562e-05f, 7.15351925e-05f, 5.58309112e-05f, 4.34515168e-05f, 5.58945467e-05f, 5.45962903e-05f, 5.65143491e-05f, 7.54951761e-05f, 6.70427398e-05f, 7.07165746e-05f, 7.93439031e-05f, 6.28361013e-05f, 6.61446538e-05f, 5.81763379e-05f, 4.90535567e-05f, 4.6621175e-05f, 4.089496e-05f, 6.53944953e-05f, 4.58479226e-05f, 4.86245262e-05f, 5.43506321e-05f, 5.92248871e-05f, 7.26122234e-05f, 5.49954057e-05f, 5.58283027e-05f, 4.9604696e-05f, 5.05012358e-05f, 5.40843503e-05f, 6.32218726e-05f, 7.50690524e-05f, 6.75363626e-05f, 6.13890807e-05f, 5.08722187e-05f, 5.75382837e-05f, 5.24369134e-05f, 5.29918616e-05f, 5.89743177e-05f, 5.3860429e-05f, 5.04143973e-05f, 5.33801285e-05f, 5.00375245e-05f, 7.30252577e-05f, 5.45532348e-05f, 5.5507182e-05f}};
+const tflite::StaticAffineQuantization kQuantization34 = {&kFloatArray34, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray35 = {128, {0.000143400015f, 0.000159064308f, 0.000196665947f, 0.000135487018f, 0.000115250194f, 0.00011894459f, 0.000155195477f, 0.000199312388f, 0.000162447439f, 0.000218061323f, 0.00021317885f, 0.000139332958f, 0.000189447586f, 0.000241045636f, 0.000157378556f, 0.000105625339f, 0.000182639938f, 0.000115838091f, 0.000121749545f, 6.61753002e-05f, 0.000131898501f, 0.000162969271f, 7.92470746e-05f, 0.000143143261f, 0.000158652983f, 0.000155505113f, 0.000238584777f, 0.000244974537f, 0.000215228603f, 0.000204874974f, 8.1480146e-05f, 0.000171946143f, 0.000177534384f, 0.000180937335f, 0.000121845907f, 0.000171390755f, 0.00010516202f, 0.000144939288f, 0.000295683567f, 0.000125249207f, 0.000175707712f, 0.000206836805f, 0.000238647379f, 0.000123924241f, 0.000103091385f, 0.000108067288f, 0.000156646187f, 0.000153640111f, 0.000173922657f, 0.00012509209f, 0.000114858121f, 0.000169401566f, 0.000143502912f, 0.000176540925f, 0.000148011168f, 0.000254734681f, 0.000129657987f, 0.000214182539f, 0.000173845052f, 0.000144647245f, 0.000126445884f, 0.000142015051f, 0.000233501225f, 0.000178522707f, 0.000214665284f, 0.000122782876f, 0.000115137977f, 0.00011229721f, 0.000118707947f, 0.000162924596f, 0.000155603877f, 0.000137786017f, 0.000167975159f, 0.000115786876f, 0.000143095807f, 0.000141928089f, 0.000189092185f, 0.000172760876f, 0.000195365123f, 0.000180867981f, 0.000120100151f, 0.00011466736f, 0.00014985427f, 8.65308102e-05f, 0.000140435237f, 0.000157248956f, 0.000180229297f, 0.000262000365f, 0.000169481806f, 0.000105367042f, 0.000215295207f, 0.000149829939f, 0.000178213566f, 0.000245333969f, 0.000228641948f, 0.00024801222f, 0.000221859911f, 0.000160504322f, 0.000109652457f, 0.000149756233f, 0.000163946796f, 0.000105107931f, 7.19947784e-05f, 0.000166429803f, 0.000169235485f, 0.000230474921f, 0.000179041032f, 0.000243759598f, 0.000145735787f, 0.000213080013f, 9.93669164e-05f, 0.000114797745f, 0.000183182201f, 0.000135351758f, 0.00014418886f, 0.00016076953f, 0.000144557431f, 0.000138655741f, 0.00023106653f, 0.0001773486f, 0.000173421387f, 0.00014742378f, 0.000129356995f, 0.000167053498f, 0.000210418584f, 0.000230776495f, 0.000260847795f, 0.000203828327f}};
+const tflite::StaticAffineQuantization kQuantization35 = {&kFloatArray35, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray36 = {128, {7.59501199e-05f, 6.67280619e-05f, 7.38160015e-05f, 5.27177472e-05f, 5.93392942e-05f, 4.1755713e-05f, 6.0316841e-05f, 4.8604812e-05f, 5.12212864e-05f, 4.82182841e-05f, 4.90419916e-05f, 6.07726433e-05f, 6.65938787e-05f, 4.66248021e-05f, 5.81322311e-05f, 4.67480131e-05f, 7.79258407e-05f, 6.51323426e-05f, 4.5311037e-05f, 5.58001557e-05f, 5.75055383e-05f, 4.64869845e-05f, 5.14066669e-05f, 6.00862477e-05f, 7.41157783e-05f, 5.08650155e-05f, 5.83651308e-05f, 6.23343003e-05f, 4.20246288e-05f, 5.86068709e-05f, 5.93976365e-05f, 5.33075254e-05f, 5.28800629e-05f, 6.8994108e-05f, 6.72121023e-05f, 4.45773767e-05f, 5.46868141e-05f, 4.4186203e-05f, 5.90467462e-05f, 5.16546133e-05f, 5.06790529e-05f, 6.58806384e-05f, 5.19144633e-05f, 6.35374527e-05f, 8.10876227e-05f, 7.27421939e-05f, 5.12833176e-05f, 6.01476786e-05f, 6.91542009e-05f, 5.77761457e-05f, 4.84619886e-05f, 5.0837305e-05f, 4.7149766e-05f, 5.64625661e-05f, 4.663051e-05f, 5.32100312e-05f, 8.11376012e-05f, 5.12528677e-05f, 5.7847461e-05f, 4.7295176e-05f, 5.44661598e-05f, 6.23173037e-05f, 6.56090197e-05f, 5.74696605e-05f, 7.53969071e-05f, 5.61413435e-05f, 5.75747254e-05f, 5.55714214e-05f, 6.20919454e-05f, 5.29305362e-05f, 4.49644576e-05f, 5.19214664e-05f, 5.12792285e-05f, 6.85111663e-05f, 5.00158421e-05f, 5.60825574e-05f, 4.18993586e-05f, 4.30328328e-05f, 6.33637246e-05f, 5.82154462e-05f, 9.28789159e-05f, 8.86878042e-05f, 5.84387235e-05f, 6.39129939e-05f, 4.84037264e-05f, 5.21571455e-05f, 4.34338435e-05f, 4.69806509e-05f, 6.98765725e-05f, 7.08386069e-05f, 5.05321404e-05f, 7.11701286e-05f, 6.84584302e-05f, 4.84010889e-05f, 4.14054957e-05f, 5.20440663e-05f, 4.37898052e-05f, 5.20628018e-05f, 4.58547729e-05f, 8.57045234e-05f, 5.94601988e-05f, 5.9276721e-05f, 6.48621644e-05f, 5.89491574e-05f, 4.17442134e-05f, 6.71591697e-05f, 5.06286196e-05f, 6.59407015e-05f, 5.70617958e-05f, 4.90483108e-05f, 6.34636599e-05f, 5.33872517e-05f, 6.0942868e-05f, 5.09964957e-05f, 5.61976776e-05f, 5.6420231e-05f, 6.46117696e-05f, 4.75241904e-05f, 6.50752118e-05f, 5.39550456e-05f, 5.83087385e-05f, 4.64636469e-05f, 5.09312777e-05f, 7.10002714e-05f, 4.80033195e-05f, 5.88589755e-05f, 7.35940339e-05f, 5.66071831e-05f}};
+const tflite::StaticAffineQuantization kQuantization36 = {&kFloatArray36, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray37 = {128, {0.000126774175f, 0.000107372369f, 0.000192987922f, 0.00015548474f, 0.000217021035f, 0.000103042214f, 0.000124094295f, 0.00015764519f, 0.000108306704f, 0.000200009832f, 0.00013782602f, 0.000113813177f, 0.000155722446f, 0.000127663705f, 0.000120516255f, 0.000147871615f, 0.000219213063f, 0.000164941885f, 0.000133232039f, 0.000123507416f, 0.000128737622f, 0.00011092666f, 0.000158020572f, 0.0001327723f, 9.84863364e-05f, 0.000161038377f, 0.000135602735f, 0.000105537343f, 0.00017088317f, 0.000150914289f, 0.000150782129f, 0.000181664043f, 0.000156972877f, 0.000174269691f, 0.000127377469f, 0.000171045744f, 0.000165199686f, 9.09717855e-05f, 0.00010430524f, 0.000212278203f, 9.43461782e-05f, 0.000233277795f, 0.000189335493f, 0.000139415948f, 0.000121643548f, 0.000139258642f, 0.000113172166f, 0.000202029682f, 0.000119389879f, 0.000120295706f, 0.000116082643f, 0.000104994491f, 0.000166626822f, 0.0001831892f, 0.000161707852f, 0.000176589776f, 0.000105921332f, 0.000160479118f, 9.21732571e-05f, 0.000127321488f, 0.000169745414f, 0.000173175809f, 0.000141162382f, 9.82737838e-05f, 0.000126096988f, 0.000165214893f, 0.000107365988f, 0.000144494828f, 0.000143098281f, 0.000195824556f, 0.000136710762f, 0.0001017869f, 0.000125636958f, 0.000105458414f, 0.000130681918f, 0.000124404047f, 8.73852623e-05f, 0.00012517444f, 0.000151365006f, 0.000115234725f, 0.000152519657f, 0.000181114476f, 0.000124627011f, 0.000146332008f, 0.000175127643f, 0.000157117131f, 0.000162393102f, 0.000131385517f, 0.000215160544f, 0.000165682897f, 8.54847967e-05f, 0.000167553022f, 0.00021047231f, 0.000132569694f, 0.000135778158f, 0.00020054575f, 0.000116937525f, 0.000141458993f, 0.000146365332f, 0.00011612106f, 0.000197133399f, 0.000218562476f, 0.000233562256f, 0.000119194709f, 0.000152891356f, 0.000119184006f, 0.000196107241f, 0.000142092715f, 0.000131047505f, 0.000253816193f, 0.000176467132f, 0.000116651412f, 0.000146039732f, 0.000135561932f, 0.000141114389f, 0.000143204248f, 0.000211922918f, 0.000148814695f, 9.8250086e-05f, 0.000111369613f, 0.000158365219f, 9.25419736e-05f, 0.000129410444f, 0.000233307088f, 7.32151457e-05f, 0.000121441139f, 0.000201409755f, 0.000192267631f}};
+const tflite::StaticAffineQuantization kQuantization37 = {&kFloatArray37, &kIntArray2, 3};
+const tflite::StaticFloatArray<256> kFloatArray38 = {256, {5.16580112e-05f, 3.43407555e-05f, 4.20086653e-05f, 4.00233257e-05f, 7.4188938e-05f, 4.02738078e-05f, 6.09879826e-05f, 6.19329148e-05f, 4.20885699e-05f, 4.80694034e-05f, 4.72823922e-05f, 4.54758665e-05f, 3.61783277e-05f, 5.03881456e-05f, 7.86514574e-05f, 5.45560106e-05f, 5.96414939e-05f, 3.53874166e-05f, 4.82644791e-05f, 4.787328e-05f, 6.24564127e-05f, 4.673679e-05f, 4.45124278e-05f, 3.9753646e-05f, 5.12412444e-05f, 6.03295994e-05f, 5.15100292e-05f, 5.93788864e-05f, 4.17243064e-05f, 4.73136679e-05f, 3.22615415e-05f, 5.55244405e-05f, 5.03855554e-05f, 4.8611495e-05f, 3.42303938e-05f, 4.50461775e-05f, 8.02546419e-05f, 4.4957178e-05f, 3.54936528e-05f, 6.04523593e-05f, 6.08975024e-05f, 4.84585944e-05f, 4.72800057e-05f, 3.96852774e-05f, 4.34797003e-05f, 4.5106317e-05f, 4.11525689e-05f, 4.10633293e-05f, 6.54326359e-05f, 5.24808383e-05f, 4.9359227e-05f, 3.55597876e-05f, 5.84494046e-05f, 4.44565048e-05f, 5.08009252e-05f, 5.03513875e-05f, 5.84361151e-05f, 4.51560263e-05f, 3.74437259e-05f, 4.83316835e-05f, 3.7376416e-05f, 5.785955e-05f, 3.474392e-05f, 5.07093828e-05f, 6.28108464e-05f, 5.14892745e-05f, 4.94077649e-05f, 5.15430147e-05f, 3.59829028e-05f, 4.81670286e-05f, 4.6135443e-05f, 4.5791443e-05f, 7.15212882e-05f, 4.81555799e-05f, 4.70427804e-05f, 3.86818137e-05f, 5.3097825e-05f, 4.67621721e-05f, 5.9179969e-05f, 0.000114241586f, 7.13686532e-05f, 3.60514823e-05f, 5.67033894e-05f, 2.75287894e-05f, 3.98122611e-05f, 2.63650909e-05f, 5.67827374e-05f, 7.23893972e-05f, 3.67912398e-05f, 5.93384757e-05f, 5.87733412e-05f, 6.86459171e-05f, 4.87463549e-05f, 6.60716105e-05f, 5.63260546e-05f, 5.48876778e-05f, 4.59316398e-05f, 4.59062248e-05f, 5.32026534e-05f, 5.02425682e-05f, 4.9011891e-05f, 5.00328752e-05f, 3.5944111e-05f, 4.18523778e-05f, 5.15315151e-05f, 4.87627585e-05f, 3.92955008e-05f, 4.12886475e-05f, 6.9714828e-05f, 4.02705955e-05f, 5.13091436e-05f, 4.14476599e-05f, 5.41855261e-05f, 7.39396928e-05f, 3.17208141e-05f, 4.31869921e-05f, 7.19164163e-05f, 6.19701823e-05f, 5.76014099e-05f, 6.07211441e-05f, 4.95944987e-05f, 5.73219695e-05f, 3.90817768e-05f, 4.28723215e-05f, 4.57550886e-05f, 4.42933087e-05f, 3.86742031e-05f, 4.37709386e-05f, 3.912596e-05f, 5.04494164e-05f, 4.53251741e-05f, 5.46549454e-05f, 4.21651712e-05f, 4.76627574e-05f, 7.71673513e-05f, 4.17938027e-05f, 4.78303118e-05f, 3.28974638e-05f, 3.04685218e-05f, 4.65686426e-05f, 4.06198633e-05f, 5.86537935e-05f, 4.13805865e-05f, 4.94280139e-05f, 5.86409806e-05f, 6.81047313e-05f, 6.3080879e-05f, 6.23998858e-05f, 3.93041082e-05f, 4.70982559e-05f, 4.82131072e-05f, 4.49075087e-05f, 5.5349883e-05f, 3.41669329e-05f, 5.24797579e-05f, 7.45814905e-05f, 5.25249125e-05f, 5.62478235e-05f, 5.55524384e-05f, 5.21483635e-05f, 5.14135536e-05f, 4.92303625e-05f, 4.2486874e-05f, 3.25063411e-05f, 4.09969543e-05f, 5.82282883e-05f, 5.81925524e-05f, 6.20300343e-05f, 3.84740088e-05f, 6.04351444e-05f, 7.26440558e-05f, 7.1309325e-05f, 4.5018558e-05f, 4.55620284e-05f, 6.05406458e-05f, 4.06247163e-05f, 5.11210492e-05f, 4.41467346e-05f, 4.90785569e-05f, 5.95800193e-05f, 4.83925687e-05f, 4.93783555e-05f, 7.56972076e-05f, 4.44535581e-05f, 4.31315966e-05f, 4.45951991e-05f, 4.642973e-05f, 4.39693904e-05f, 5.01242466e-05f, 6.66716951e-05f, 4.58687355e-05f, 4.50676562e-05f, 5.20699832e-05f, 3.46625529e-05f, 4.84439224e-05f, 4.88613587e-05f, 4.52905479e-05f, 6.29633359e-05f, 5.90596137e-05f, 6.20158098e-05f, 5.58879619e-05f, 5.39072789e-05f, 6.08054288e-05f, 6.54962278e-05f, 3.44894324e-05f, 6.41731021e-05f, 4.43174649e-05f, 5.6477078e-05f, 5.66917151e-05f, 4.25863145e-05f, 5.75563754e-05f, 3.79396079e-05f, 4.8220536e-05f, 6.06511785e-05f, 3.94557755e-05f, 4.92627369e-05f, 6.05795285e-05f, 4.61484378e-05f, 5.15391512e-05f, 5.29409226e-05f, 6.28139751e-05f, 7.31981127e-05f, 4.94649539e-05f, 4.98828158e-05f, 5.72039608e-05f, 3.35706354e-05f, 4.17571537e-05f, 5.02344847e-05f, 4.35380971e-05f, 3.89125307e-05f, 5.34377359e-05f, 6.47612032e-05f, 4.61353593e-05f, 4.88171754e-05f, 5.98405059e-05f, 3.91455324e-05f, 3.92888178e-05f, 4.78343318e-05f, 5.80303094e-05f, 5.08717494e-05f, 4.07442967e-05f, 3.51411509e-05f, 5.20408539e-05f, 7.17867952e-05f, 4.33046698e-05f, 5.75997728e-05f, 4.8597547e-05f, 5.2210733e-05f, 5.81121785e-05f, 6.60749647e-05f, 5.06721408e-05f, 4.57155184e-05f, 4.14589631e-05f, 4.81971329e-05f, 7.28538871e-05f, 7.02240213e-05f}};
+const tflite::StaticAffineQuantization kQuantization38 = {&kFloatArray38, &kIntArray5, 0};
+const tflite::StaticIntArray<1> kIntArray33 = {1, {256}};
+const tflite::StaticFloatArray<256> kFloatArray39 = {256, {0.000276369508f, 0.000166486032f, 0.000308372779f, 0.000179095354f, 0.000137184383f, 0.000199778733f, 0.000127499006f, 0.000235573607f, 0.000136781295f, 0.000236497217f, 0.0001577863f, 0.000140020988f, 0.000171427237f, 0.000170750762f, 0.000247729418f, 0.000216446409f, 0.000152887354f, 0.000137815106f, 0.000218871137f, 0.000202648196f, 0.000237476299f, 0.00019544216f, 0.000190804261f, 0.000199687245f, 0.000216302724f, 0.00015735341f, 0.000171414023f, 0.000208431986f, 0.000229855345f, 0.000127993073f, 0.000148241263f, 0.0001307809f, 0.000144337508f, 0.000169203864f, 0.000189381914f, 0.000195123561f, 0.000253970968f, 0.000183695331f, 0.000301829452f, 0.000257827487f, 0.000203794261f, 0.000185331228f, 0.000154079375f, 0.000165144462f, 0.000174174784f, 0.000183560041f, 0.000196002424f, 0.000249229895f, 0.000183059135f, 0.000164452475f, 0.000159693343f, 0.000155658752f, 0.000121982703f, 0.000211871156f, 0.00025145043f, 0.000158307332f, 0.000160839889f, 0.00016438801f, 0.000235048428f, 0.000131170324f, 0.000181065392f, 0.000268719537f, 0.000187083584f, 0.000298412226f, 0.000242139999f, 0.000225711919f, 0.000155909278f, 0.000219204012f, 0.000200178241f, 0.000202945201f, 0.00014636507f, 0.000225139956f, 0.000158900788f, 0.000175327732f, 0.000196465f, 0.000178824659f, 0.00014170818f, 0.000189984916f, 0.000252457656f, 0.000176234811f, 0.000237262531f, 0.000157808754f, 0.000238688081f, 0.000168810453f, 0.000133325957f, 0.000199276459f, 0.00025047973f, 0.000171833439f, 0.000207410034f, 0.000167225196f, 0.000145987535f, 0.000158584706f, 0.000195264496f, 0.000289383461f, 0.000200960596f, 0.000187750629f, 0.000206685465f, 0.00021596381f, 0.000147076076f, 0.000166954502f, 0.000214245039f, 0.000228635312f, 0.000179004186f, 0.000185277095f, 0.000164838304f, 0.000197000147f, 0.000158789248f, 0.000121871206f, 0.000222835457f, 0.000255896215f, 0.000146999271f, 0.00017756116f, 0.000150999593f, 0.00018864531f, 0.000111742098f, 0.000144704463f, 0.000187647791f, 0.000219599067f, 0.000301614957f, 0.00016319615f, 0.000205682314f, 0.00025299954f, 0.000136541654f, 0.000173252687f, 0.000192115258f, 0.000194860433f, 0.000274857681f, 0.000225677984f, 0.000329327973f, 0.000148800624f, 0.000153804038f, 0.000193287808f, 0.000200745228f, 0.000194160559f, 0.000144506499f, 0.000127449937f, 0.000148590232f, 0.000103897844f, 0.000151046857f, 0.000225292722f, 0.000196298846f, 0.000246906275f, 0.000337232603f, 0.000158206894f, 0.000220415546f, 0.000235956293f, 0.000201034331f, 0.000207901699f, 0.000210281985f, 0.000227545883f, 0.000187667654f, 0.000118786142f, 0.000266333489f, 0.000215411346f, 0.000158270414f, 0.000201263785f, 0.000190057632f, 0.00017948098f, 0.000172323547f, 0.000225130992f, 0.000179708732f, 0.000173762412f, 0.00011240859f, 0.000144812191f, 0.000213068546f, 0.000165473422f, 0.000223503273f, 0.000178652059f, 0.000179373717f, 0.000236850348f, 0.000369460322f, 0.000130386223f, 0.000217352179f, 0.000192147869f, 0.000164434459f, 0.000255875901f, 0.000233510291f, 0.000145020676f, 0.000282806461f, 0.000230339836f, 0.00021754409f, 0.000239485787f, 0.000174248562f, 0.000141476034f, 0.000147286177f, 0.000371277856f, 0.00024440806f, 0.000285762915f, 0.000164884666f, 0.000198933398f, 0.000215582113f, 0.000155277303f, 0.000127515828f, 0.00017881945f, 0.000122803831f, 0.000157175862f, 0.000144990685f, 0.000213293955f, 0.00026641367f, 0.000240953814f, 0.000254412123f, 0.000202514784f, 0.000134564878f, 0.00012834146f, 0.000242659298f, 0.00011596804f, 0.000185478915f, 0.000189764236f, 0.000286814582f, 0.000245970557f, 0.000162145385f, 0.000166212732f, 0.000179949435f, 0.000184191129f, 0.000217297202f, 0.000243655842f, 0.00021012564f, 0.00016119238f, 0.000187828657f, 0.000128037209f, 0.000238608176f, 0.000221207476f, 0.00019185635f, 0.00024357425f, 0.000178365124f, 0.000198906579f, 0.000170493644f, 0.00014422508f, 0.00018952215f, 0.000206851677f, 0.000303612382f, 0.000207916019f, 0.000164780795f, 0.000227367942f, 0.000279756321f, 0.000144610982f, 0.000243314003f, 0.000156973852f, 0.000185901474f, 0.000162804397f, 0.000237402521f, 0.00015742211f, 0.000128877655f, 0.000176277288f, 0.000213620922f, 0.000243430957f, 0.000201051473f, 0.000232727412f, 0.000218035566f, 0.000219888068f, 0.000227182143f, 0.000170367668f, 0.000122578451f, 0.000204964424f, 0.000142253644f, 0.000183433003f}};
+const tflite::StaticAffineQuantization kQuantization39 = {&kFloatArray39, &kIntArray5, 3};
+const tflite::StaticFloatArray<256> kFloatArray40 = {256, {1.98144098e-05f, 3.06858019e-05f, 2.67771975e-05f, 1.23384552e-05f, 2.76156043e-05f, 1.57386185e-05f, 1.74248526e-05f, 2.68171079e-05f, 1.99836759e-05f, 2.43217801e-05f, 1.98413109e-05f, 1.59276187e-05f, 2.53253329e-05f, 1.65989586e-05f, 1.62021406e-05f, 1.92537154e-05f, 2.07734665e-05f, 1.55990801e-05f, 1.40512539e-05f, 2.26542561e-05f, 1.31690686e-05f, 1.78480841e-05f, 2.30960613e-05f, 1.79692997e-05f, 2.72635734e-05f, 1.74385241e-05f, 3.21308835e-05f, 2.35151256e-05f, 1.37150018e-05f, 1.655714e-05f, 1.95672528e-05f, 2.21908413e-05f, 2.59577246e-05f, 1.86827765e-05f, 1.79563322e-05f, 1.71240918e-05f, 1.89139246e-05f, 1.48785184e-05f, 2.0607531e-05f, 1.77214552e-05f, 2.37132408e-05f, 1.94491913e-05f, 2.37302065e-05f, 2.22071467e-05f, 1.29956125e-05f, 1.4246416e-05f, 1.75768182e-05f, 1.63663426e-05f, 2.49367386e-05f, 2.41017988e-05f, 1.94630757e-05f, 1.41706087e-05f, 1.62511842e-05f, 3.72459435e-05f, 1.69632604e-05f, 2.26992397e-05f, 2.3964054e-05f, 1.7960072e-05f, 1.61496118e-05f, 1.97960271e-05f, 1.98361231e-05f, 1.8471992e-05f, 2.31636823e-05f, 1.71248266e-05f, 1.38628002e-05f, 1.91409345e-05f, 1.46729872e-05f, 1.75074092e-05f, 1.74418128e-05f, 2.03995533e-05f, 2.0815276e-05f, 1.70619733e-05f, 1.16727751e-05f, 1.90379724e-05f, 1.51554195e-05f, 1.48477366e-05f, 2.9766552e-05f, 1.95028715e-05f, 1.61684075e-05f, 1.23796572e-05f, 3.64818989e-05f, 1.54408735e-05f, 1.23967284e-05f, 1.75483219e-05f, 2.59163771e-05f, 1.37111601e-05f, 1.62088618e-05f, 2.82493365e-05f, 1.75398091e-05f, 1.82402055e-05f, 2.30413953e-05f, 1.51043032e-05f, 1.82867479e-05f, 1.95344892e-05f, 1.30535982e-05f, 2.78484567e-05f, 2.36331216e-05f, 2.06567674e-05f, 2.72250636e-05f, 1.5475498e-05f, 1.53581186e-05f, 1.5056542e-05f, 1.5038243e-05f, 1.98919679e-05f, 2.47471307e-05f, 1.56999722e-05f, 1.51912673e-05f, 1.51445993e-05f, 2.19024823e-05f, 1.92708139e-05f, 2.40389254e-05f, 1.50823889e-05f, 1.17567151e-05f, 2.76643459e-05f, 1.60638174e-05f, 2.36042306e-05f, 2.56291132e-05f, 1.66334539e-05f, 2.92120294e-05f, 1.49886864e-05f, 1.98314392e-05f, 1.42274657e-05f, 1.48113286e-05f, 1.91656472e-05f, 1.98998241e-05f, 1.49283887e-05f, 1.44728174e-05f, 2.20287948e-05f, 2.11108982e-05f, 2.78870139e-05f, 2.90507669e-05f, 2.27453475e-05f, 1.94172862e-05f, 1.474698e-05f, 2.08315378e-05f, 1.20377654e-05f, 2.25725034e-05f, 2.16837634e-05f, 1.48182862e-05f, 1.74550078e-05f, 2.14271749e-05f, 1.74929119e-05f, 1.81052983e-05f, 2.0019148e-05f, 1.91533145e-05f, 1.87191781e-05f, 2.05508568e-05f, 2.02340707e-05f, 2.20004968e-05f, 1.61537555e-05f, 2.03547916e-05f, 1.76251651e-05f, 1.48484633e-05f, 1.37480756e-05f, 2.18373352e-05f, 1.95174689e-05f, 1.73613025e-05f, 2.85296155e-05f, 1.77825277e-05f, 1.80494626e-05f, 1.47128203e-05f, 1.78489481e-05f, 3.29764007e-05f, 1.85709159e-05f, 1.74263496e-05f, 1.6757871e-05f, 1.4223272e-05f, 1.80709267e-05f, 1.32175783e-05f, 2.91155884e-05f, 1.86509133e-05f, 1.42027684e-05f, 2.49198365e-05f, 1.61609696e-05f, 1.79485014e-05f, 1.80436946e-05f, 4.87498946e-05f, 3.64228254e-05f, 2.03768268e-05f, 1.87156074e-05f, 1.46565126e-05f, 1.68762017e-05f, 1.77118491e-05f, 1.92715797e-05f, 2.24594114e-05f, 2.07945977e-05f, 2.73852311e-05f, 1.71091979e-05f, 1.6450238e-05f, 1.81411942e-05f, 1.88591312e-05f, 2.25697095e-05f, 1.47907231e-05f, 1.93834458e-05f, 2.19610793e-05f, 1.43146872e-05f, 1.62349479e-05f, 2.34051422e-05f, 1.45303457e-05f, 1.00448615e-05f, 1.63441164e-05f, 1.07542373e-05f, 2.10933031e-05f, 2.1664313e-05f, 1.89303992e-05f, 2.31248905e-05f, 2.56770672e-05f, 1.57743743e-05f, 1.33058211e-05f, 2.07271096e-05f, 2.14151405e-05f, 2.29021243e-05f, 1.87519636e-05f, 1.71954944e-05f, 3.37071506e-05f, 1.35202636e-05f, 1.36479439e-05f, 1.8793633e-05f, 2.17355046e-05f, 1.84587352e-05f, 1.97200225e-05f, 1.57378308e-05f, 2.3700366e-05f, 2.5905274e-05f, 1.80643474e-05f, 1.72483851e-05f, 1.43374345e-05f, 1.36814115e-05f, 1.58463663e-05f, 1.54205209e-05f, 2.4771145e-05f, 1.64030644e-05f, 1.81282048e-05f, 1.18158578e-05f, 2.29340385e-05f, 3.01918317e-05f, 2.35414518e-05f, 1.45937784e-05f, 1.52657703e-05f, 2.26603624e-05f, 3.41086125e-05f, 2.48062534e-05f, 1.5181743e-05f, 3.36261946e-05f, 1.41109504e-05f, 3.03381494e-05f, 2.67851992e-05f, 2.0964615e-05f, 1.60497329e-05f, 3.51429371e-05f, 1.65799829e-05f, 1.94761978e-05f, 2.97910592e-05f, 2.42963197e-05f, 1.91087693e-05f, 2.42806072e-05f}};
+const tflite::StaticAffineQuantization kQuantization40 = {&kFloatArray40, &kIntArray5, 0};
+const tflite::StaticFloatArray<8> kFloatArray41 = {8, {0.000100763471f, 0.000145474012f, 0.00343540031f, 6.83220715e-05f, 0.000344946398f, 6.23260421e-05f, 0.000173505803f, 0.00752101373f}};
+const tflite::StaticAffineQuantization kQuantization41 = {&kFloatArray41, &kIntArray0, 3};
+const tflite::StaticFloatArray<16> kFloatArray42 = {16, {0.000325332163f, 0.000207981226f, 0.000388883404f, 0.000171088483f, 0.000285973481f, 0.000289570598f, 0.000184251941f, 0.000201657982f, 0.000336095574f, 0.000194887034f, 0.000302705768f, 0.000188688122f, 0.000285319868f, 0.000163596909f, 0.000190921812f, 0.000256652507f}};
+const tflite::StaticAffineQuantization kQuantization42 = {&kFloatArray42, &kIntArray9, 0};
+const tflite::StaticIntArray<1> kIntArray34 = {1, {16}};
+const tflite::StaticIntArray<4> kIntArray35 = {4, {1, 48, 48, 16}};
+const tflite::StaticIntArray<4> kIntArray36 = {4, {1, 24, 24, 16}};
+const tflite::StaticFloatArray<16> kFloatArray43 = {16, {8.24633098e-05f, 7.13845729e-05f, 0.000115970382f, 9.41658873e-05f, 0.000137467054f, 0.000112950795f, 0.000119021359f, 6.30129216e-05f, 0.000118254502f, 0.000209428152f, 7.0451475e-05f, 0.000116613912f, 8.48881391e-05f, 8.24958552e-05f, 0.000156637339f, 0.000170271596f}};
+const tflite::StaticAffineQuantization kQuantization43 = {&kFloatArray43, &kIntArray9, 3};
+const tflite::StaticFloatArray<32> kFloatArray44 = {32, {0.000271109195f, 9.44597559e-05f, 0.000147300132f, 0.000150384018f, 0.000117068739f, 3.7530157e-05f, 0.000125692794f, 0.000161917706f, 8.84731926e-05f, 7.992069e-05f, 4.12470727e-05f, 0.000121184268f, 0.000149521249f, 0.000119965305f, 0.00023115339f, 0.000269748969f, 0.00015648581f, 0.000180131086f, 5.20739814e-05f, 7.3991956e-05f, 0.000126889572f, 4.55573354e-05f, 0.000138912961f, 0.00015820541f, 0.000126886473f, 2.62402682e-05f, 0.000129647466f, 0.000171971318f, 0.000223337076f, 0.000110806548f, 0.000195749104f, 8.66967093e-05f}};
+const tflite::StaticAffineQuantization kQuantization44 = {&kFloatArray44, &kIntArray12, 0};
+const tflite::StaticIntArray<1> kIntArray37 = {1, {32}};
+const tflite::StaticIntArray<4> kIntArray38 = {4, {1, 24, 24, 32}};
+const tflite::StaticFloatArray<32> kFloatArray45 = {32, {0.000190339531f, 0.00022664055f, 0.000164894242f, 0.000232868886f, 0.000299849751f, 0.000568032963f, 0.000103053353f, 0.000168772807f, 0.000171590538f, 0.000399386889f, 0.000510785321f, 0.000158166309f, 6.46845583e-05f, 0.000308966904f, 0.000198844369f, 4.84212142e-05f, 0.000164713812f, 0.000100271085f, 0.000514928077f, 0.000574539299f, 0.000129626409f, 0.000551799079f, 7.46591904e-05f, 0.000152374851f, 0.000143089812f, 0.000690843503f, 0.000178427625f, 7.55174624e-05f, 0.000119882519f, 0.000161243675f, 0.000151957531f, 0.000264388276f}};
+const tflite::StaticAffineQuantization kQuantization45 = {&kFloatArray45, &kIntArray12, 3};
+const tflite::StaticFloatArray<32> kFloatArray46 = {32, {0.000101833124f, 0.000142726596f, 0.000116871714f, 9.41762191e-05f, 4.9440383e-05f, 6.73611576e-05f, 8.75592959e-05f, 8.00838607e-05f, 0.000116212672f, 8.81342276e-05f, 0.000135649112f, 8.04325828e-05f, 0.000122998943f, 0.000126178362f, 7.63868084e-05f, 9.0177964e-05f, 9.46321597e-05f, 0.000111301357f, 0.00013644954f, 0.000113325339f, 0.000158506708f, 9.51006368e-05f, 8.57434279e-05f, 0.000120758479f, 0.000150801032f, 0.000190659746f, 0.000154778667f, 0.000126662213f, 6.70526788e-05f, 9.07390786e-05f, 0.000109538152f, 9.14878474e-05f}};
+const tflite::StaticAffineQuantization kQuantization46 = {&kFloatArray46, &kIntArray12, 0};
+const tflite::StaticIntArray<4> kIntArray39 = {4, {1, 12, 12, 32}};
+const tflite::StaticFloatArray<32> kFloatArray47 = {32, {6.71050875e-05f, 8.07299657e-05f, 6.19931525e-05f, 8.37631233e-05f, 0.00018940492f, 9.70979745e-05f, 7.13716727e-05f, 7.19385425e-05f, 7.16827999e-05f, 5.53455102e-05f, 8.20987043e-05f, 7.12981491e-05f, 0.000101572376f, 0.000160291165f, 0.000106183179f, 7.82127463e-05f, 7.36632428e-05f, 6.84429979e-05f, 0.000115532981f, 7.51305852e-05f, 0.000114295653f, 0.000103278537f, 4.86359932e-05f, 8.25690586e-05f, 0.000162821321f, 8.93683828e-05f, 7.74050277e-05f, 6.91092355e-05f, 0.000111917543f, 7.98177352e-05f, 0.000103956212f, 0.000154615496f}};
+const tflite::StaticAffineQuantization kQuantization47 = {&kFloatArray47, &kIntArray12, 3};
+const tflite::StaticFloatArray<64> kFloatArray48 = {64, {9.95316732e-05f, 6.31832081e-05f, 0.000118505341f, 9.96027957e-05f, 7.67907186e-05f, 8.69363066e-05f, 0.000114842122f, 9.47017106e-05f, 6.49965295e-05f, 0.000100921417f, 5.35904874e-05f, 0.000114852228f, 6.46085246e-05f, 9.90994959e-05f, 0.000124913931f, 0.000188413469f, 9.72757916e-05f, 9.38628436e-05f, 0.000101054924f, 6.75763804e-05f, 0.000165720441f, 7.61447664e-05f, 7.9155674e-05f, 0.000140159056f, 0.000133922091f, 4.06513864e-05f, 6.25096509e-05f, 0.000154543828f, 0.000129053413f, 9.41681647e-05f, 9.91908964e-05f, 0.00013999737f, 0.000122334823f, 5.81912391e-05f, 8.56265106e-05f, 0.000160206575f, 5.68198157e-05f, 5.89037991e-05f, 8.60509317e-05f, 6.51333394e-05f, 8.02822178e-05f, 0.000101843973f, 7.60884723e-05f, 0.00010257899f, 0.000148407824f, 0.000149808053f, 4.82277501e-05f, 8.66410046e-05f, 0.000124452985f, 0.000201781382f, 0.000190354665f, 0.000103217455f, 0.00010179438f, 0.000196909168f, 0.000123919017f, 0.000109550259f, 7.62567652e-05f, 0.000152984736f, 0.000104916122f, 0.000119382981f, 6.96733259e-05f, 0.000181964875f, 0.000134720016f, 7.2068382e-05f}};
+const tflite::StaticAffineQuantization kQuantization48 = {&kFloatArray48, &kIntArray16, 0};
+const tflite::StaticIntArray<1> kIntArray40 = {1, {64}};
+const tflite::StaticIntArray<4> kIntArray41 = {4, {1, 12, 12, 64}};
+const tflite::StaticFloatArray<64> kFloatArray49 = {64, {0.000120223784f, 0.000222573188f, 0.000172618718f, 0.000176902075f, 0.000219635782f, 0.000103179271f, 0.000127522566f, 7.21388496e-05f, 0.000299194391f, 0.000340360741f, 0.00040607492f, 0.000217997745f, 0.000213377993f, 9.07767826e-05f, 0.000153664514f, 0.000184005345f, 0.000136590126f, 0.00011123671f, 0.000155041082f, 0.000113001472f, 0.000107004998f, 0.000138500051f, 0.000400484365f, 0.000145914804f, 0.000127368228f, 0.000328363938f, 0.000264993723f, 0.000107380598f, 0.000138394753f, 0.000167768085f, 0.000127268053f, 0.000166974671f, 0.000100152698f, 0.000130827801f, 0.000154514302f, 8.35743995e-05f, 0.000257261156f, 0.000278967229f, 0.000131193141f, 0.000126712897f, 0.000170658022f, 0.000162619166f, 0.000235397791f, 0.000156473747f, 8.99980005e-05f, 8.01214483e-05f, 0.000273315847f, 9.53336785e-05f, 0.000245891424f, 0.000209769103f, 0.000175140798f, 0.000203337331f, 0.000307906157f, 0.000128806263f, 0.000104875886f, 0.000121990932f, 0.000202167037f, 0.000143771467f, 0.000111458496f, 0.000115756811f, 0.000290233205f, 9.93290741e-05f, 0.000132058907f, 0.000271993398f}};
+const tflite::StaticAffineQuantization kQuantization49 = {&kFloatArray49, &kIntArray16, 3};
+const tflite::StaticFloatArray<64> kFloatArray50 = {64, {6.16755788e-05f, 8.99066727e-05f, 0.000101505429f, 0.000118138094f, 8.11417194e-05f, 6.65189073e-05f, 8.42974696e-05f, 7.81132549e-05f, 0.000101872669f, 9.27740475e-05f, 9.13823242e-05f, 8.08964542e-05f, 9.25687418e-05f, 5.71703386e-05f, 0.000121148347f, 5.14554849e-05f, 9.28092559e-05f, 5.18741253e-05f, 6.04451416e-05f, 0.000109076653f, 8.61444278e-05f, 7.67746533e-05f, 8.4134459e-05f, 8.64453395e-05f, 6.17682308e-05f, 5.62818968e-05f, 0.000111802306f, 8.09957637e-05f, 0.000103556675f, 7.88665056e-05f, 9.29837988e-05f, 7.94334483e-05f, 6.94838745e-05f, 7.80603077e-05f, 7.34903078e-05f, 6.76663258e-05f, 7.7718556e-05f, 5.40515466e-05f, 6.19968705e-05f, 0.00010020526f, 9.38503872e-05f, 8.4104031e-05f, 6.63779138e-05f, 8.57486375e-05f, 8.79176441e-05f, 8.05472882e-05f, 6.73784307e-05f, 5.63211142e-05f, 7.10163513e-05f, 4.50728548e-05f, 8.32504593e-05f, 0.000101885424f, 3.63959734e-05f, 5.10199716e-05f, 8.42441077e-05f, 7.81413983e-05f, 7.46636724e-05f, 8.43240705e-05f, 8.26311298e-05f, 7.97231842e-05f, 9.14213888e-05f, 9.44264466e-05f, 5.32402883e-05f, 5.27255033e-05f}};
+const tflite::StaticAffineQuantization kQuantization50 = {&kFloatArray50, &kIntArray16, 0};
+const tflite::StaticIntArray<4> kIntArray42 = {4, {1, 6, 6, 64}};
+const tflite::StaticFloatArray<64> kFloatArray51 = {64, {0.000103894417f, 9.79869583e-05f, 8.22051152e-05f, 8.92694588e-05f, 6.77679272e-05f, 6.96344869e-05f, 0.000116242962f, 9.01142121e-05f, 8.88900759e-05f, 0.000127680585f, 8.86714843e-05f, 9.71321788e-05f, 9.83900245e-05f, 9.18937731e-05f, 9.04161861e-05f, 0.000174606044f, 8.49091884e-05f, 0.000225390264f, 8.73615136e-05f, 0.000102795486f, 8.19048364e-05f, 9.37706063e-05f, 0.000131434601f, 7.8858553e-05f, 0.000113156559f, 8.60229266e-05f, 0.000106849744f, 9.16149802e-05f, 9.13459589e-05f, 0.000107548825f, 8.13537481e-05f, 9.26088978e-05f, 8.2062732e-05f, 8.64281028e-05f, 0.000177522481f, 0.000123828693f, 0.000107221495f, 0.000109838053f, 7.2813702e-05f, 7.47943268e-05f, 8.67499039e-05f, 0.000120841789f, 0.000117661541f, 0.000106042484f, 8.15978929e-05f, 0.000105764302f, 7.62648124e-05f, 0.000108875523f, 8.87982096e-05f, 9.98175237e-05f, 6.45645123e-05f, 0.000110015048f, 0.000147274142f, 0.000138848962f, 8.36293329e-05f, 9.43225677e-05f, 0.00015615068f, 9.41661128e-05f, 7.10393942e-05f, 7.17569565e-05f, 6.79458753e-05f, 0.000102127655f, 9.76652445e-05f, 0.00015650042f}};
+const tflite::StaticAffineQuantization kQuantization51 = {&kFloatArray51, &kIntArray16, 3};
+const tflite::StaticFloatArray<128> kFloatArray52 = {128, {8.87125498e-05f, 7.33845445e-05f, 0.000135132505f, 9.10509407e-05f, 7.30103275e-05f, 0.000113227485f, 5.66529889e-05f, 7.57366288e-05f, 0.000104410326f, 7.99756526e-05f, 7.30830798e-05f, 0.000101589438f, 6.40846556e-05f, 4.4080236e-05f, 6.05081441e-05f, 6.64324107e-05f, 6.52168965e-05f, 7.11441826e-05f, 8.9423047e-05f, 6.07220536e-05f, 8.29946512e-05f, 6.39929422e-05f, 9.43325504e-05f, 9.73028291e-05f, 0.000102988721f, 6.81661622e-05f, 7.78462345e-05f, 8.61863882e-05f, 7.43320052e-05f, 9.64150531e-05f, 8.24851522e-05f, 7.04619961e-05f, 8.55425096e-05f, 6.66055494e-05f, 6.41534425e-05f, 6.25267785e-05f, 7.44897698e-05f, 4.33228342e-05f, 7.9510537e-05f, 9.06348359e-05f, 9.42283077e-05f, 7.9606958e-05f, 7.10902168e-05f, 8.14798477e-05f, 9.53569834e-05f, 4.80177223e-05f, 7.82867937e-05f, 8.03262519e-05f, 5.42930502e-05f, 5.77747342e-05f, 9.25809582e-05f, 8.4340616e-05f, 7.92102001e-05f, 8.11834252e-05f, 7.13239569e-05f, 7.23623089e-05f, 8.70985677e-05f, 7.8746074e-05f, 6.29088245e-05f, 4.77627254e-05f, 7.06658393e-05f, 6.60872611e-05f, 6.26100809e-05f, 7.19515374e-05f, 8.10455022e-05f, 7.93484578e-05f, 5.9193022e-05f, 0.000111978363f, 7.06296778e-05f, 6.95689887e-05f, 7.25667196e-05f, 5.27832453e-05f, 7.83502546e-05f, 7.54712019e-05f, 7.28649975e-05f, 4.84541451e-05f, 5.95536258e-05f, 6.51984301e-05f, 6.44807733e-05f, 6.33724267e-05f, 8.05948293e-05f, 7.51877233e-05f, 9.07885915e-05f, 7.28423547e-05f, 7.01101962e-05f, 7.47238882e-05f, 5.42632552e-05f, 7.24505517e-05f, 6.90818124e-05f, 5.83220062e-05f, 8.74046091e-05f, 6.10158895e-05f, 7.95780943e-05f, 5.81565109e-05f, 9.80186887e-05f, 5.91519565e-05f, 5.646723e-05f, 9.01247913e-05f, 7.24090933e-05f, 7.8986981e-05f, 9.38030062e-05f, 9.729663e-05f, 8.00539055e-05f, 8.71120646e-05f, 8.30732606e-05f, 5.77628743e-05f, 6.49932408e-05f, 7.19623204e-05f, 7.29396561e-05f, 7.87862227e-05f, 8.62476954e-05f, 4.89799386e-05f, 6.95727867e-05f, 7.08305015e-05f, 6.50574293e-05f, 7.50900144e-05f, 7.86259116e-05f, 5.69589793e-05f, 6.70569279e-05f, 4.51797605e-05f, 7.03000551e-05f, 5.65991031e-05f, 7.42558113e-05f, 0.000105136758f, 9.90140907e-05f, 6.05087516e-05f, 7.65127552e-05f, 7.13679328e-05f}};
+const tflite::StaticAffineQuantization kQuantization52 = {&kFloatArray52, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray53 = {128, {0.000109219232f, 0.000160696756f, 0.000158125971f, 0.000216200642f, 0.000175786961f, 8.78192877e-05f, 0.000129337321f, 0.000216591565f, 0.000136962597f, 0.000133524605f, 0.000199179165f, 0.000197049405f, 0.000255375955f, 0.000399035256f, 0.00013968299f, 0.000171081643f, 0.000216226719f, 0.000217007997f, 0.000177205715f, 0.000296426617f, 0.000244779309f, 0.000200832597f, 0.000233146682f, 0.000130823377f, 9.37812074e-05f, 0.00015389589f, 0.000140678167f, 0.000192924796f, 0.000152691486f, 0.000229182479f, 0.000111497873f, 0.000142368983f, 0.000126203799f, 0.000172354223f, 0.000165018631f, 0.000212705505f, 0.000129249485f, 0.000175001041f, 0.000156901733f, 0.000134747635f, 0.000144938676f, 0.000186974183f, 0.000139290991f, 0.00013990562f, 0.000149029569f, 0.00010271572f, 0.000157386414f, 0.000228205507f, 0.000237358501f, 0.000169391715f, 0.000147890692f, 0.00018496158f, 0.000149454034f, 0.000140778691f, 0.000134570073f, 0.000128228727f, 0.000179892333f, 0.000240578753f, 0.000154599242f, 0.000168798346f, 0.00020135619f, 0.000125354316f, 0.000251905847f, 0.000293952267f, 0.000124834914f, 0.000105735235f, 0.000240196779f, 0.000127672334f, 0.000157733928f, 0.00018666363f, 0.000108454551f, 0.000227009135f, 0.000174464905f, 0.000150742402f, 0.000273982645f, 0.000357266865f, 0.000147655446f, 9.51418697e-05f, 0.000138573567f, 0.00014477472f, 0.000204763433f, 0.000235539279f, 0.000189114449f, 0.000130925779f, 0.000117797055f, 0.000176022702f, 0.000216802058f, 0.000186779667f, 0.000132374364f, 0.00037185839f, 0.000188679565f, 0.000135011869f, 0.000142188175f, 0.000139336174f, 0.000150675507f, 0.000172943299f, 0.000185460376f, 0.000216980829f, 0.000122129233f, 0.00022344655f, 0.000159468385f, 0.000154415349f, 0.000236378721f, 0.000116419287f, 0.000123021178f, 0.000141695782f, 0.000173740351f, 0.000102916732f, 0.000145579645f, 0.000211576771f, 0.000283351546f, 0.000313292374f, 0.000137827577f, 0.000273772195f, 0.000152019697f, 0.00027093431f, 0.000147909581f, 0.000226301578f, 0.000157664908f, 0.000229318262f, 0.000176753529f, 9.84724975e-05f, 0.000111768779f, 0.00010719899f, 0.000221226219f, 0.000184309611f, 0.000195762608f, 0.000104160346f}};
+const tflite::StaticAffineQuantization kQuantization53 = {&kFloatArray53, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray54 = {128, {5.36559746e-05f, 8.55101971e-05f, 6.76702839e-05f, 6.42587256e-05f, 5.35425788e-05f, 5.24937641e-05f, 5.40319852e-05f, 8.61652734e-05f, 5.34126157e-05f, 5.33724087e-05f, 9.99572949e-05f, 7.53789864e-05f, 5.16591717e-05f, 6.608283e-05f, 6.72405804e-05f, 6.40274375e-05f, 5.29089011e-05f, 7.37195442e-05f, 7.19470772e-05f, 6.2904619e-05f, 6.84269107e-05f, 6.14898163e-05f, 5.53088212e-05f, 6.81115416e-05f, 7.17281655e-05f, 7.26889266e-05f, 4.75110646e-05f, 6.0288854e-05f, 4.85846504e-05f, 6.27692716e-05f, 6.22948501e-05f, 7.43537748e-05f, 5.50404911e-05f, 6.35547622e-05f, 5.68226715e-05f, 8.80850057e-05f, 6.36789846e-05f, 4.61094678e-05f, 6.50532529e-05f, 5.79086918e-05f, 8.32389487e-05f, 7.55197834e-05f, 5.90389609e-05f, 5.91347016e-05f, 6.25632965e-05f, 5.62385903e-05f, 5.92722681e-05f, 6.65482876e-05f, 6.61612648e-05f, 6.38006823e-05f, 4.9821585e-05f, 6.71190792e-05f, 5.11038015e-05f, 5.20706635e-05f, 5.42033704e-05f, 5.59345681e-05f, 5.23131785e-05f, 5.16738546e-05f, 5.08463854e-05f, 7.34688656e-05f, 7.10001113e-05f, 4.45773549e-05f, 5.49095312e-05f, 5.57594685e-05f, 6.99698212e-05f, 6.33149029e-05f, 7.4528878e-05f, 5.34979481e-05f, 6.35999822e-05f, 5.99621962e-05f, 7.71222403e-05f, 6.68876819e-05f, 6.53151073e-05f, 6.16153775e-05f, 7.13243062e-05f, 7.28521845e-05f, 7.41968324e-05f, 6.10928619e-05f, 6.17593614e-05f, 6.04597044e-05f, 8.49174903e-05f, 6.32390802e-05f, 5.9782451e-05f, 6.45811961e-05f, 7.02780017e-05f, 7.3112089e-05f, 4.57499482e-05f, 4.66996826e-05f, 5.45554758e-05f, 6.08027767e-05f, 5.64754446e-05f, 6.88865548e-05f, 5.14604944e-05f, 5.96320206e-05f, 8.40280409e-05f, 6.39124264e-05f, 4.74803273e-05f, 5.5678036e-05f, 9.84155558e-05f, 5.23757917e-05f, 7.33833658e-05f, 5.3149357e-05f, 7.60721887e-05f, 6.59138605e-05f, 6.24373861e-05f, 6.00519052e-05f, 5.71783494e-05f, 7.13460904e-05f, 5.22686678e-05f, 5.6561159e-05f, 5.21967413e-05f, 7.18210358e-05f, 9.7424323e-05f, 4.78961665e-05f, 4.44267425e-05f, 5.12723382e-05f, 9.17479119e-05f, 4.82588293e-05f, 5.71055243e-05f, 7.50957042e-05f, 5.70082484e-05f, 6.80394151e-05f, 5.78606305e-05f, 6.24712775e-05f, 5.23626331e-05f, 6.56814009e-05f, 7.44974386e-05f, 6.59574216e-05f}};
+const tflite::StaticAffineQuantization kQuantization54 = {&kFloatArray54, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray55 = {128, {0.000133404217f, 0.000193911648f, 0.000122224796f, 9.78169774e-05f, 0.00013387439f, 0.00021247915f, 0.000211006423f, 0.000158040042f, 0.000106694846f, 0.000123550475f, 0.00011699873f, 0.000229781959f, 0.000120971803f, 0.000108837325f, 9.93169742e-05f, 0.000105560277f, 0.000239751491f, 0.000154174588f, 0.000267539057f, 0.000117753458f, 0.000253994949f, 0.000115144692f, 0.000151733999f, 0.000130368164f, 0.000105484651f, 0.000143034122f, 0.000177045993f, 0.000122869416f, 0.000133137524f, 0.000141747048f, 0.000247605203f, 0.000205460936f, 0.000168645623f, 0.000151551139f, 9.11784009e-05f, 0.000147456289f, 0.000117166637f, 0.000155169939f, 0.000116388444f, 0.000125939638f, 0.000124270577f, 0.000202963172f, 0.000157582297f, 0.000131161651f, 9.3019371e-05f, 0.000114444818f, 0.000174189947f, 0.000223576717f, 0.000109961213f, 0.000153381421f, 0.000140711418f, 0.000120094497f, 0.000148545165f, 0.000110377747f, 0.000122147074f, 0.000159343224f, 0.000168655897f, 0.00025700999f, 0.000161349439f, 0.000104358041f, 0.000238895242f, 0.00014733235f, 0.000116204639f, 0.000177929993f, 0.000147271945f, 0.000197042551f, 0.000114421709f, 9.85992738e-05f, 0.0001984595f, 0.000132015848f, 0.00015544155f, 0.000168719809f, 0.000158618786f, 0.000102480852f, 0.000171400941f, 0.000139552518f, 0.000145115177f, 0.000126138621f, 0.000162243639f, 0.000291855977f, 0.000131263499f, 0.000110660701f, 0.000228501929f, 0.000124685947f, 0.000159239411f, 0.000112678739f, 0.000153594054f, 0.000216900429f, 0.000174199202f, 0.000173156077f, 0.000285021262f, 0.00012103637f, 0.000186904319f, 9.86326268e-05f, 0.000111755093f, 0.000106579711f, 0.000208164623f, 0.00015943624f, 0.000153026267f, 0.000157176939f, 0.000103852661f, 0.000118230557f, 0.000112410635f, 0.00017021934f, 0.000101031248f, 0.000116265284f, 0.000162134776f, 0.000168652201f, 0.000131316832f, 0.000215931897f, 0.000127996303f, 0.00017979696f, 0.00015988524f, 0.000217077381f, 0.00016426541f, 0.000120084929f, 0.000104540668f, 0.000113458933f, 0.000249338365f, 0.000103171631f, 0.000114025461f, 0.000229971134f, 0.000108749562f, 0.000260562025f, 0.000173373366f, 0.000120003722f, 0.000124360638f, 0.000144216669f}};
+const tflite::StaticAffineQuantization kQuantization55 = {&kFloatArray55, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray56 = {128, {5.04327472e-05f, 6.04713496e-05f, 5.85899652e-05f, 5.74929909e-05f, 8.45446775e-05f, 8.34039602e-05f, 5.79957305e-05f, 5.49770666e-05f, 5.60181288e-05f, 7.33600391e-05f, 6.43851818e-05f, 6.2411309e-05f, 6.23598462e-05f, 6.44294123e-05f, 4.97082037e-05f, 5.17961307e-05f, 6.70793888e-05f, 6.94416231e-05f, 6.08166265e-05f, 5.07784971e-05f, 6.70263908e-05f, 6.06078793e-05f, 6.5268905e-05f, 6.44663232e-05f, 6.98237127e-05f, 6.0723105e-05f, 5.81332424e-05f, 7.1133305e-05f, 6.25853718e-05f, 6.27907866e-05f, 6.41944498e-05f, 7.08943262e-05f, 6.86606872e-05f, 5.46254487e-05f, 5.51398807e-05f, 6.3708314e-05f, 8.45789546e-05f, 6.81372912e-05f, 6.28610069e-05f, 5.72469107e-05f, 6.62499442e-05f, 6.26065157e-05f, 5.25883406e-05f, 5.97283688e-05f, 5.00364731e-05f, 5.84685949e-05f, 7.17331204e-05f, 7.12530818e-05f, 4.24281316e-05f, 4.11537039e-05f, 6.65517728e-05f, 4.25992876e-05f, 6.14981254e-05f, 5.48858188e-05f, 4.6100995e-05f, 6.50797738e-05f, 6.3511834e-05f, 4.98157824e-05f, 6.40901271e-05f, 6.12776421e-05f, 4.6583853e-05f, 5.73148791e-05f, 6.31070798e-05f, 7.21388205e-05f, 5.35031722e-05f, 6.28993148e-05f, 4.85874552e-05f, 6.18393897e-05f, 5.80270389e-05f, 6.09736853e-05f, 7.5943346e-05f, 7.01799727e-05f, 6.84806146e-05f, 8.23332521e-05f, 8.40744469e-05f, 6.32471492e-05f, 8.77672137e-05f, 5.32247832e-05f, 6.26691981e-05f, 5.58908105e-05f, 6.47397974e-05f, 8.21699432e-05f, 7.14940397e-05f, 6.63323663e-05f, 8.38822452e-05f, 6.19659186e-05f, 4.54568217e-05f, 5.28244927e-05f, 4.6927169e-05f, 6.46531189e-05f, 5.96542377e-05f, 6.8912188e-05f, 5.95040801e-05f, 7.03047263e-05f, 5.63456306e-05f, 6.16877587e-05f, 7.99108966e-05f, 6.76396303e-05f, 5.408164e-05f, 5.63250651e-05f, 7.86633173e-05f, 5.06554097e-05f, 7.05176935e-05f, 4.5097855e-05f, 7.04743288e-05f, 5.28217461e-05f, 7.08055377e-05f, 8.83381435e-05f, 5.08777593e-05f, 5.50496407e-05f, 5.07972109e-05f, 6.32139709e-05f, 6.56938282e-05f, 6.35244796e-05f, 6.85686755e-05f, 6.2677238e-05f, 5.69864533e-05f, 4.49653708e-05f, 6.04665365e-05f, 4.8411599e-05f, 5.80396882e-05f, 5.57301464e-05f, 6.06061803e-05f, 6.15163372e-05f, 7.19183954e-05f, 5.26906479e-05f, 5.98633851e-05f, 6.19492421e-05f}};
+const tflite::StaticAffineQuantization kQuantization56 = {&kFloatArray56, &kIntArray2, 0};
+const tflite::StaticFloatArray<128> kFloatArray57 = {128, {0.000156207228f, 9.89503606e-05f, 0.000105406129f, 0.000132127607f, 0.000238485984f, 0.000128211846f, 0.00012196305f, 0.000150026914f, 0.000109141867f, 0.000104458937f, 0.000147612474f, 0.000182686272f, 0.000107291526f, 0.000101387253f, 0.000203161893f, 0.000168092229f, 0.000177983035f, 0.000122186888f, 0.000107750944f, 8.32544902e-05f, 0.000173707813f, 0.000104215484f, 0.000201771545f, 0.000219530659f, 0.000199392729f, 0.00016305469f, 0.000101801634f, 0.000203585165f, 0.000178050192f, 0.000284564157f, 0.000191704559f, 0.000153241228f, 0.000126569124f, 0.00016242452f, 0.000147648141f, 0.000179180104f, 0.000154238223f, 0.000124534854f, 0.000126006926f, 0.000224148404f, 9.65325962e-05f, 0.000129873282f, 0.00010759935f, 0.000186123551f, 0.000173926572f, 0.000130179833f, 0.000116090574f, 0.000130682543f, 0.000225482159f, 0.000243737886f, 0.000126170591f, 0.000192889289f, 0.000151697139f, 0.000110876746f, 0.000126777028f, 0.000127453241f, 0.000142399804f, 0.000155494054f, 0.000321571133f, 0.000238906665f, 0.000147267492f, 0.000267402007f, 0.000145587037f, 0.000125195831f, 0.000156000417f, 0.00021059702f, 0.00010334434f, 0.000145320941f, 0.000228163801f, 8.20244022e-05f, 0.000190895749f, 0.000155645015f, 0.000110802321f, 0.000109762259f, 0.000130939996f, 0.000329801143f, 0.000130531058f, 0.000168073646f, 0.000115021241f, 0.000102502439f, 0.000113639151f, 0.000136651928f, 0.000187674581f, 0.00011447526f, 0.000172237211f, 0.000105374427f, 0.000115234834f, 0.000143321318f, 0.000179958792f, 0.000174532906f, 0.000110169363f, 0.000120375109f, 0.000127290099f, 8.73184108e-05f, 0.000288236857f, 0.000100040001f, 0.000174049914f, 0.000192879554f, 0.000111325055f, 0.000107781932f, 0.00018470308f, 0.000110805835f, 0.000131943059f, 0.000103105878f, 0.000101606529f, 0.000117935801f, 0.000177643349f, 0.000156688722f, 0.000122364479f, 0.000182750096f, 0.000112199195f, 0.000183463853f, 0.000108176551f, 9.84782891e-05f, 0.000134488087f, 0.000123618069f, 0.000146530874f, 0.000147273531f, 0.000194452907f, 0.000172868866f, 0.000188300299f, 8.53602905e-05f, 0.000108994303f, 0.000101286561f, 0.000124586135f, 9.96983799e-05f, 0.000117462077f, 0.00013667313f}};
+const tflite::StaticAffineQuantization kQuantization57 = {&kFloatArray57, &kIntArray2, 3};
+const tflite::StaticFloatArray<128> kFloatArray58 = {128, {5.12013539e-05f, 6.61582453e-05f, 5.2540352e-05f, 6.05764035e-05f, 4.93360749e-05f, 8.49898352e-05f, 6.27328627e-05f, 7.15554779e-05f, 5.18981251e-05f, 7.24703568e-05f, 6.75590491e-05f, 6.6092638e-05f, 4.90509192e-05f, 6.05733039e-05f, 6.14904129e-05f, 4.18196068e-05f, 5.54488943e-05f, 5.08060693e-05f, 4.20558317e-05f, 7.23252451e-05f, 6.11666546e-05f, 6.15389872e-05f, 5.57641615e-05f, 4.99298585e-05f, 4.42346609e-05f, 9.42385741e-05f, 4.6470559e-05f, 8.29259588e-05f, 9.19132581e-05f, 6.38760102e-05f, 6.03036751e-05f, 7.62311684e-05f, 7.2793875e-05f, 5.2935342e-05f, 6.97346622e-05f, 4.89764898e-05f, 6.76777563e-05f, 6.23220258e-05f, 5.09634192e-05f, 7.49747924e-05f, 7.34347122e-05f, 7.5875585e-05f, 5.21561306e-05f, 5.99478808e-05f, 5.03385927e-05f, 5.0999115e-05f, 6.71446032e-05f, 5.97349608e-05f, 6.42036539e-05f, 6.48265632e-05f, 5.55864171e-05f, 6.11286232e-05f, 7.12246547e-05f, 6.35021861e-05f, 7.08061489e-05f, 7.22879777e-05f, 6.13183511e-05f, 4.87913167e-05f, 6.00883541e-05f, 6.2095547e-05f, 5.69911317e-05f, 5.92994074e-05f, 4.98428672e-05f, 6.4257787e-05f, 7.28428131e-05f, 6.10754942e-05f, 6.67067507e-05f, 6.41411971e-05f, 5.03053998e-05f, 6.33282543e-05f, 8.29662895e-05f, 5.10400459e-05f, 6.08863811e-05f, 6.18183039e-05f, 8.9671179e-05f, 7.94808511e-05f, 6.0951661e-05f, 6.94822811e-05f, 6.50020083e-05f, 6.36146797e-05f, 6.53200768e-05f, 5.95974197e-05f, 7.21085089e-05f, 7.21186589e-05f, 5.98312472e-05f, 5.27720586e-05f, 5.41527043e-05f, 6.01575557e-05f, 7.69652979e-05f, 7.78027461e-05f, 8.48907148e-05f, 7.1261471e-05f, 5.69364129e-05f, 6.31419753e-05f, 5.92344404e-05f, 5.91797543e-05f, 5.38394779e-05f, 7.18895535e-05f, 4.95953063e-05f, 6.53793904e-05f, 6.09434101e-05f, 5.32843987e-05f, 5.73209545e-05f, 5.4615386e-05f, 6.93041002e-05f, 5.65668633e-05f, 6.5628883e-05f, 5.12261504e-05f, 5.31836922e-05f, 4.84604789e-05f, 9.27483707e-05f, 5.38794484e-05f, 8.86089765e-05f, 7.03913756e-05f, 4.41801058e-05f, 5.73765647e-05f, 5.38419008e-05f, 5.73273501e-05f, 8.05557065e-05f, 9.9221892e-05f, 9.13638796e-05f, 6.30658542e-05f, 6.74929033e-05f, 4.43721292e-05f, 5.37382293e-05f, 5.81055683e-05f, 5.84490954e-05f, 7.23690682e-05f}};
+const tflite::StaticAffineQuantization kQuantization58 = {&kFloatArray58, &kIntArray2, 0};
+const tflite::StaticFloatArray<1> kFloatArray59 = {1, {0.00390625f}};
+const tflite::StaticAffineQuantization kQuantization59 = {&kFloatArray59, &kIntArray21, 0};
+const tflite::StaticFloatArray<1> kFloatArray60 = {1, {0.00784313772f}};
+const tflite::StaticAffineQuantization kQuantization60 = {&kFloatArray60, &kIntArray23, 0};
+const tflite::StaticIntArray<4> kIntArray43 = {4, {1, 96, 96, 1}};
+const TfLiteDepthwiseConvParams kParams0 = {kTfLitePaddingSame, /*stride_width=*/2, /*stride_height=*/2,
+     /*depth_multiplier=*/8, kTfLiteActRelu6, /*dilation_width_factor=*/1,
+     /*dilation_height_factor=*/1};
+const tflite::StaticIntArray<3> kIntArray44 = {3, {88, 0, 33}};
+const tflite::StaticIntArray<1> kIntArray45 = {1, {34}};
+const TfLiteDepthwiseConvParams kParams1 = {kTfLitePaddingSame, /*stride_width=*/1, /*stride_height=*/1,
+     /*depth_multiplier=*/1, kTfLiteActRelu6, /*dilation_width_factor=*/1,
+     /*dilation_height_factor=*/1};
+const tflite::StaticIntArray<3> kIntArray46 = {3, {34, 9, 52}};
+const tflite::StaticIntArray<1> kIntArray47 = {1, {51}};
+const TfLiteConvParams kParams2 = {kTfLitePaddingSame, /*stride_width=*/1, /*stride_height=*/1, kTfLiteActRelu6,
+     /*dilation_width_factor=*/1, /*dilation_height_factor=*/1};
+const tflite::StaticIntArray<3> kIntArray48 = {3, {51, 10, 53}};
+const tflite::StaticIntArray<1> kIntArray49 = {1, {54}};
+const TfLiteDepthwiseConvParams kParams3 = {kTfLitePaddingSame, /*stride_width=*/2, /*stride_height=*/2,
+     /*depth_multiplier=*/1, kTfLiteActRelu6, /*dilation_width_factor=*/1,
+     /*dilation_height_factor=*/1};
+const tflite::StaticIntArray<3> kIntArray50 = {3, {54, 11, 56}};
+const tflite::StaticIntArray<1> kIntArray51 = {1, {55}};
+const tflite::StaticIntArray<3> kIntArray52 = {3, {55, 12, 57}};
+const tflite::StaticIntArray<1> kIntArray53 = {1, {58}};
+const tflite::StaticIntArray<3> kIntArray54 = {3, {58, 13, 60}};
+const tflite::StaticIntArray<1> kIntArray55 = {1, {59}};
+const tflite::StaticIntArray<3> kIntArray56 = {3, {59, 14, 61}};
+const tflite::StaticIntArray<1> kIntArray57 = {1, {62}};
+const tflite::StaticIntArray<3> kIntArray58 = {3, {62, 15, 64}};
+const tflite::StaticIntArray<1> kIntArray59 = {1, {63}};
+const tflite::StaticIntArray<3> kIntArray60 = {3, {63, 16, 65}};
+const tflite::StaticIntArray<1> kIntArray61 = {1, {66}};
+const tflite::StaticIntArray<3> kIntArray62 = {3, {66, 17, 68}};
+const tflite::StaticIntArray<1> kIntArray63 = {1, {67}};
+const tflite::StaticIntArray<3> kIntArray64 = {3, {67, 18, 69}};
+const tflite::StaticIntArray<1> kIntArray65 = {1, {70}};
+const tflite::StaticIntArray<3> kIntArray66 = {3, {70, 19, 72}};
+const tflite::StaticIntArray<1> kIntArray67 = {1, {71}};
+const tflite::StaticIntArray<3> kIntArray68 = {3, {71, 20, 73}};
+const tflite::StaticIntArray<1> kIntArray69 = {1, {74}};
+const tflite::StaticIntArray<3> kIntArray70 = {3, {74, 21, 76}};
+const tflite::StaticIntArray<1> kIntArray71 = {1, {75}};
+const tflite::StaticIntArray<3> kIntArray72 = {3, {75, 22, 77}};
+const tflite::StaticIntArray<1> kIntArray73 = {1, {78}};
+const tflite::StaticIntArray<3> kIntArray74 = {3, {78, 23, 80}};
+const tflite::StaticIntArray<1> kIntArray75 = {1, {79}};
+const tflite::StaticIntArray<3> kIntArray76 = {3, {79, 24, 81}};
+const tflite::StaticIntArray<1> kIntArray77 = {1, {82}};
+const tflite::StaticIntArray<3> kIntArray78 = {3, {82, 25, 84}};
+const tflite::StaticIntArray<1> kIntArray79 = {1, {83}};
+const tflite::StaticIntArray<3> kIntArray80 = {3, {83, 26, 85}};
+const tflite::StaticIntArray<1> kIntArray81 = {1, {86}};
+const tflite::StaticIntArray<3> kIntArray82 = {3, {86, 1, 36}};
+const tflite::StaticIntArray<1> kIntArray83 = {1, {35}};
+const tflite::StaticIntArray<3> kIntArray84 = {3, {35, 2, 37}};
+const tflite::StaticIntArray<1> kIntArray85 = {1, {38}};
+const tflite::StaticIntArray<3> kIntArray86 = {3, {38, 3, 40}};
+const tflite::StaticIntArray<1> kIntArray87 = {1, {39}};
+const tflite::StaticIntArray<3> kIntArray88 = {3, {39, 4, 41}};
+const tflite::StaticIntArray<1> kIntArray89 = {1, {42}};
+const tflite::StaticIntArray<3> kIntArray90 = {3, {42, 5, 44}};
+const tflite::StaticIntArray<1> kIntArray91 = {1, {43}};
+const tflite::StaticIntArray<3> kIntArray92 = {3, {43, 6, 45}};
+const tflite::StaticIntArray<1> kIntArray93 = {1, {46}};
+const tflite::StaticIntArray<3> kIntArray94 = {3, {46, 7, 48}};
+const tflite::StaticIntArray<1> kIntArray95 = {1, {47}};
+const tflite::StaticIntArray<3> kIntArray96 = {3, {47, 8, 49}};
+const tflite::StaticIntArray<1> kIntArray97 = {1, {50}};
+const TfLitePoolParams kParams4 = {kTfLitePaddingValid, /*stride_width=*/2, /*stride_height=*/2,
+     /*filter_width=*/3, /*filter_height=*/3, kTfLiteActNone, {}};
+const tflite::StaticIntArray<1> kIntArray98 = {1, {27}};
+const TfLiteConvParams kParams5 = {kTfLitePaddingSame, /*stride_width=*/1, /*stride_height=*/1, kTfLiteActNone,
+     /*dilation_width_factor=*/1, /*dilation_height_factor=*/1};
+const tflite::StaticIntArray<3> kIntArray99 = {3, {27, 30, 29}};
+const tflite::StaticIntArray<1> kIntArray100 = {1, {28}};
+const TfLiteReshapeParams kParams6 = {{1, 2}, /*num_dimensions=*/2};
+const tflite::StaticIntArray<2> kIntArray101 = {2, {28, 32}};
+const tflite::StaticIntArray<1> kIntArray102 = {1, {31}};
+const TfLiteSoftmaxParams kParams7 = {/*beta=*/1.0f};
+const tflite::StaticIntArray<1> kIntArray103 = {1, {87}};
+const tflite::StaticIntArray<1> kIntArray104 = {1, {88}};
+
+const tflite::StaticTensor kTensors[] = {
+    {&kIntArray1, &kQuantization0, 39480, 72, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray3, &kQuantization1, 3848, 1152, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization2, 112464, 16384, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray3, &kQuantization3, 128860, 1152, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization4, 130024, 16384, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray3, &kQuantization5, 146944, 1152, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray6, &kQuantization6, 6700, 32768, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray7, &kQuantization7, 149668, 2304, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray8, &kQuantization8, 153020, 65536, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray1, &kQuantization9, 40384, 72, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray10, &kQuantization10, 39580, 128, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray11, &kQuantization11, 40608, 144, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray13, &kQuantization12, 39860, 512, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray14, &kQuantization13, 41556, 288, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray15, &kQuantization14, 41996, 1024, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray14, &kQuantization15, 43032, 288, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray17, &kQuantization16, 43472, 2048, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray18, &kQuantization17, 2980, 576, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray19, &kQuantization18, 45800, 4096, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray18, &kQuantization19, 49908, 576, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray20, &kQuantization20, 50764, 8192, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray3, &kQuantization21, 59492, 1152, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization22, 61180, 16384, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray3, &kQuantization23, 5012, 1152, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization24, 77576, 16384, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray3, &kQuantization25, 1288, 1152, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray4, &kQuantization26, 95544, 16384, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray22, &kQuantization27, 2304, 256, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray24, &kQuantization28, 0, 2, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray26, &kQuantization29, 220128, 8, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray27, &kQuantization30, 219604, 512, kTfLiteInt8,
+     tflite::kStaticTensorConstant},
+    {&kIntArray28, &kQuantization28, 16, 2, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray26, nullptr, 220148, 8, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray29, &kQuantization31, 1240, 32, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray30, &kQuantization32, 0, 18432, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray31, &kQuantization32, 4608, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray32, &kQuantization33, 60656, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray32, &kQuantization34, 6176, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray31, &kQuantization32, 0, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray31, &kQuantization32, 4608, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray32, &kQuantization35, 93972, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray32, &kQuantization36, 146420, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray31, &kQuantization32, 0, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray3, &kQuantization32, 4608, 1152, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray32, &kQuantization37, 148108, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray33, &kQuantization38, 148632, 1024, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray7, &kQuantization32, 0, 2304, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray7, &kQuantization32, 2304, 2304, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray33, &kQuantization39, 151984, 1024, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray33, &kQuantization40, 218568, 1024, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray7, &kQuantization27, 0, 2304, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray30, &kQuantization32, 36864, 18432, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray29, &kQuantization41, 40768, 32, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray34, &kQuantization42, 41480, 64, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray35, &kQuantization32, 0, 36864, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray36, &kQuantization32, 36864, 9216, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray34, &kQuantization43, 41360, 64, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray37, &kQuantization44, 39720, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray38, &kQuantization32, 0, 18432, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray38, &kQuantization32, 18432, 18432, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray37, &kQuantization45, 41856, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray37, &kQuantization46, 40468, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray38, &kQuantization32, 0, 18432, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray39, &kQuantization32, 18432, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray37, &kQuantization47, 43332, 128, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray40, &kQuantization48, 3568, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray41, &kQuantization32, 0, 9216, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray41, &kQuantization32, 9216, 9216, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray40, &kQuantization49, 45532, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray40, &kQuantization50, 448, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray41, &kQuantization32, 0, 9216, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray42, &kQuantization32, 9216, 2304, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray40, &kQuantization51, 50496, 256, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray32, &kQuantization52, 58968, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray31, &kQuantization32, 0, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray31, &kQuantization32, 4608, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray32, &kQuantization53, 2456, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray32, &kQuantization54, 716, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray31, &kQuantization32, 0, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray31, &kQuantization32, 4608, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray32, &kQuantization55, 40812, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray32, &kQuantization56, 94496, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray31, &kQuantization32, 0, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray31, &kQuantization32, 4608, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray32, &kQuantization57, 95020, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray32, &kQuantization58, 111940, 512, kTfLiteInt32,
+     tflite::kStaticTensorConstant},
+    {&kIntArray31, &kQuantization32, 0, 4608, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray28, &kQuantization59, 0, 2, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+    {&kIntArray43, &kQuantization60, 18432, 9216, kTfLiteInt8,
+     tflite::kStaticTensorArena},
+};
+
+const tflite::StaticOperator kOperators[] = {
+    {&kRegistrationDepthwiseConv2d, &kIntArray44, &kIntArray45, &kParams0, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray46, &kIntArray47, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray48, &kIntArray49, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray50, &kIntArray51, &kParams3, -1, 0},
+    {&kRegistrationConv2d, &kIntArray52, &kIntArray53, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray54, &kIntArray55, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray56, &kIntArray57, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray58, &kIntArray59, &kParams3, -1, 0},
+    {&kRegistrationConv2d, &kIntArray60, &kIntArray61, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray62, &kIntArray63, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray64, &kIntArray65, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray66, &kIntArray67, &kParams3, -1, 0},
+    {&kRegistrationConv2d, &kIntArray68, &kIntArray69, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray70, &kIntArray71, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray72, &kIntArray73, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray74, &kIntArray75, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray76, &kIntArray77, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray78, &kIntArray79, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray80, &kIntArray81, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray82, &kIntArray83, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray84, &kIntArray85, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray86, &kIntArray87, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray88, &kIntArray89, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray90, &kIntArray91, &kParams3, -1, 0},
+    {&kRegistrationConv2d, &kIntArray92, &kIntArray93, &kParams2, -1, 0},
+    {&kRegistrationDepthwiseConv2d, &kIntArray94, &kIntArray95, &kParams1, -1, 0},
+    {&kRegistrationConv2d, &kIntArray96, &kIntArray97, &kParams2, -1, 0},
+    {&kRegistrationAveragePool2d, &kIntArray97, &kIntArray98, &kParams4, -1, 0},
+    {&kRegistrationConv2d, &kIntArray99, &kIntArray100, &kParams5, -1, 0},
+    {&kRegistrationReshape, &kIntArray101, &kIntArray102, &kParams6, -1, 0},
+    {&kRegistrationSoftmax, &kIntArray102, &kIntArray103, &kParams7, -1, 0},
+};
+
+const tflite::StaticGraphPlan kPlan = {
+    kTensors, 89, kOperators, 31, &kIntArray104, &kIntArray103,
+    nullptr, nullptr, 0,
+    /*planned_bytes=*/55296, /*max_temp_tensors=*/7,
+    /*model_size=*/300568};
+
+}  // namespace
+
+PersonDetectStaticGraph::PersonDetectStaticGraph(uint8_t* arena, size_t arena_size,
+                                                 tflite::ErrorReporter* error_reporter)
+    : tflite::StaticGraph(kPlan, g_person_detect_model_data,
+                          g_person_detect_model_data_len, eval_tensors_,
+                          user_data_, arena, arena_size, error_reporter) {}
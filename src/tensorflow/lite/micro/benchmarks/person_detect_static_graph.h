@@ -0,0 +1,31 @@
+// Generated by tensorflow/lite/micro/tools/generate_static_graph from the model in
+// person_detect_model_data.h.
+// Regenerate it whenever the model changes.
+
+#ifndef TENSORFLOW_LITE_MICRO_BENCHMARKS_PERSON_DETECT_STATIC_GRAPH_H_
+#define TENSORFLOW_LITE_MICRO_BENCHMARKS_PERSON_DETECT_STATIC_GRAPH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/static_graph.h"
+
+class PersonDetectStaticGraph : public tflite::StaticGraph {
+ public:
+  // Planned tensors and scratch buffers, the TfLiteTensor structs handed to
+  // kernels and the kernels' persistent buffers. The last term was measured
+  // on a 64-bit host, so it is an upper bound on the device.
+  static constexpr size_t kArenaSize =
+      kArenaAlignment + 55296 + 7 * sizeof(TfLiteTensor) + 24512;
+
+  PersonDetectStaticGraph(uint8_t* arena, size_t arena_size,
+                          tflite::ErrorReporter* error_reporter);
+
+ private:
+  TfLiteEvalTensor eval_tensors_[89];
+  void* user_data_[31];
+};
+
+#endif  // TENSORFLOW_LITE_MICRO_BENCHMARKS_PERSON_DETECT_STATIC_GRAPH_H_
@@ -0,0 +1,145 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/benchmarks/micro_benchmark.h"
+#include "tensorflow/lite/micro/benchmarks/person_detect_static_graph.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+#include "tensorflow/lite/micro/rp2/multicore_workers.h"
+
+/*
+ * Person Detection benchmark. Evaluates runtime performance of the visual
+ * wakewords person detection model, with its weights read in place from flash
+ * and with them prefetched into SRAM one layer ahead by WeightPrefetcher. Run
+ * it once with the bundled model and once with a model rewritten by
+ * tools/reorder_model_buffers to compare the flash layouts. The last runs
+ * split every convolution between both cores. The final runs execute the
+ * same model as a static graph generated by tools/generate_static_graph,
+ * which skips op resolution, parameter parsing and memory planning at start-up.
+ */
+
+namespace {
+
+// The model uses about 85 KB of arena according to
+// MicroInterpreter::arena_used_bytes(); prefetching adds two staging slots.
+constexpr int kTensorArenaSize = 96 * 1024;
+constexpr int kPrefetchStagingSize = 8 * 1024;
+constexpr int kPrefetchArenaSize = kTensorArenaSize + 2 * kPrefetchStagingSize;
+constexpr int kRandomSeed = 42;
+constexpr int kNumIterations = 10;
+
+alignas(16) uint8_t tensor_arena[kPrefetchArenaSize];
+
+// Create an area of memory to use for input, output, and intermediate arrays.
+uint8_t benchmark_runner_buffer[sizeof(MicroBenchmarkRunner<int8_t>)];
+MicroBenchmarkRunner<int8_t>* benchmark_runner = nullptr;
+
+tflite::MulticoreWorkers multicore_workers;
+
+static_assert(PersonDetectStaticGraph::kArenaSize <= kPrefetchArenaSize,
+              "The static graph shares the benchmark's arena");
+uint8_t static_graph_buffer[sizeof(PersonDetectStaticGraph)];
+PersonDetectStaticGraph* static_graph = nullptr;
+
+// Initializes the benchmark runner, optionally with weight prefetching, with
+// convolutions split across both cores and with depthwise + pointwise pairs
+// fused. Initialization is timed as part of the benchmark.
+void InitializeBenchmarkRunner(bool prefetch, bool both_cores,
+                               bool fuse = false) {
+  // NOLINTNEXTLINE
+  static tflite::AllOpsResolver all_ops_resolver;
+  benchmark_runner = new (benchmark_runner_buffer) MicroBenchmarkRunner<int8_t>(
+      g_person_detect_model_data, &all_ops_resolver, tensor_arena,
+      prefetch ? kPrefetchArenaSize : kTensorArenaSize,
+      both_cores ? &multicore_workers : nullptr, fuse);
+  if (prefetch) {
+    benchmark_runner->EnableWeightPrefetch(kPrefetchStagingSize);
+  }
+  benchmark_runner->SetRandomInput(kRandomSeed);
+}
+
+void RunIterations(int iterations) {
+  for (int i = 0; i < iterations; ++i) {
+    benchmark_runner->RunSingleIteration();
+  }
+}
+
+// Initializes the static graph in the same arena, timed like the runner.
+void InitializeStaticGraph() {
+  static_graph = new (static_graph_buffer) PersonDetectStaticGraph(
+      tensor_arena, PersonDetectStaticGraph::kArenaSize,
+      micro_benchmark::reporter);
+  if (static_graph->AllocateTensors() != kTfLiteOk) {
+    TF_LITE_REPORT_ERROR(micro_benchmark::reporter,
+                         "AllocateTensors failed.");
+  }
+  std::srand(kRandomSeed);
+  TfLiteEvalTensor* input = static_graph->input(0);
+  const int input_length = tflite::ElementCount(*input->dims);
+  for (int i = 0; i < input_length; ++i) {
+    input->data.int8[i] = static_cast<int8_t>(std::rand() % 256);
+  }
+}
+
+void RunStaticGraphIterations(int iterations) {
+  for (int i = 0; i < iterations; ++i) {
+    if (static_graph->Invoke() != kTfLiteOk) {
+      TF_LITE_REPORT_ERROR(micro_benchmark::reporter, "Invoke failed.");
+    }
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_BENCHMARKS_BEGIN
+
+multicore_workers.Start();
+
+TF_LITE_MICRO_BENCHMARK(
+    InitializeBenchmarkRunner(/*prefetch=*/false, /*both_cores=*/false));
+TF_LITE_MICRO_BENCHMARK(RunIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARK(
+    InitializeBenchmarkRunner(/*prefetch=*/true, /*both_cores=*/false));
+TF_LITE_MICRO_BENCHMARK(RunIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARK(
+    InitializeBenchmarkRunner(/*prefetch=*/false, /*both_cores=*/true));
+TF_LITE_MICRO_BENCHMARK(RunIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARK(
+    InitializeBenchmarkRunner(/*prefetch=*/true, /*both_cores=*/true));
+TF_LITE_MICRO_BENCHMARK(RunIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARK(InitializeBenchmarkRunner(
+    /*prefetch=*/false, /*both_cores=*/false, /*fuse=*/true));
+TF_LITE_MICRO_BENCHMARK(RunIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARK(InitializeBenchmarkRunner(
+    /*prefetch=*/false, /*both_cores=*/true, /*fuse=*/true));
+TF_LITE_MICRO_BENCHMARK(RunIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARK(InitializeStaticGraph());
+TF_LITE_MICRO_BENCHMARK(RunStaticGraphIterations(1));
+TF_LITE_MICRO_BENCHMARK(RunStaticGraphIterations(kNumIterations));
+
+TF_LITE_MICRO_BENCHMARKS_END
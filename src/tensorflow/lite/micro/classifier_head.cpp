@@ -0,0 +1,110 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/classifier_head.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/m0plus/softmax.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace {
+
+// Matches the int8 scaling of the softmax kernel.
+constexpr int kScaledDiffIntegerBits = 5;
+
+}  // namespace
+
+TfLiteStatus TwoClassClassifierHead::Init(int8_t score_threshold) {
+  TFLITE_DCHECK(interpreter_ != nullptr);
+  if (interpreter_->operators_size() == 0) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Classifier head needs a model\n");
+    return kTfLiteError;
+  }
+  softmax_index_ = interpreter_->operators_size() - 1;
+  const NodeAndRegistration softmax =
+      interpreter_->node_and_registration(softmax_index_);
+  if (softmax.registration == nullptr ||
+      softmax.registration->builtin_code != BuiltinOperator_SOFTMAX) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Classifier head expects the model to end in "
+                         "SOFTMAX\n");
+    return kTfLiteError;
+  }
+
+  // MicroInterpreter::tensor() allocates a TfLiteTensor from the persistent
+  // section of the arena on every call, so the softmax tensors are only
+  // looked up by the first successful Init().
+  if (logits_ == nullptr) {
+    TF_LITE_ENSURE_STATUS(LookUpLogits(softmax.node));
+  }
+
+  const auto* params =
+      static_cast<const TfLiteSoftmaxParams*>(softmax.node.builtin_data);
+  int32_t mult;
+  int shift;
+  PreprocessSoftmaxScaling(static_cast<double>(params->beta),
+                           static_cast<double>(logits_scale_),
+                           kScaledDiffIntegerBits, &mult, &shift);
+  const int32_t diff_min =
+      -1.0 * CalculateInputRadius(kScaledDiffIntegerBits, shift);
+
+  min_confident_gap_ = 256;
+  for (int gap = 0; gap < 256; ++gap) {
+    if (m0plus::TwoClassTopScore(gap, mult, shift, diff_min) >=
+        score_threshold) {
+      min_confident_gap_ = gap;
+      break;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus TwoClassClassifierHead::LookUpLogits(const TfLiteNode& softmax) {
+  const TfLiteTensor* logits = interpreter_->tensor(softmax.inputs->data[0]);
+  const TfLiteTensor* scores = interpreter_->tensor(softmax.outputs->data[0]);
+  if (logits == nullptr || scores == nullptr) {
+    return kTfLiteError;
+  }
+  if (logits->type != kTfLiteInt8 || scores->type != kTfLiteInt8 ||
+      NumElements(logits) != 2) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Classifier head supports one row of two int8 "
+                         "logits, got %d elements of type %s\n",
+                         NumElements(logits), TfLiteTypeGetName(logits->type));
+    return kTfLiteError;
+  }
+  if (logits->data.int8 == nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Classifier head initialized before "
+                         "AllocateTensors()\n");
+    return kTfLiteError;
+  }
+  logits_ = GetTensorData<int8_t>(logits);
+  logits_scale_ = logits->params.scale;
+  return kTfLiteOk;
+}
+
+TfLiteStatus TwoClassClassifierHead::Invoke(TwoClassDecision* decision) {
+  TFLITE_DCHECK(logits_ != nullptr);
+  TF_LITE_ENSURE_STATUS(interpreter_->InvokeUntil(softmax_index_));
+  *decision = Decide(logits_[0], logits_[1]);
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
@@ -0,0 +1,86 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_CLASSIFIER_HEAD_H_
+#define TENSORFLOW_LITE_MICRO_CLASSIFIER_HEAD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+namespace tflite {
+
+// Top-1 decision of a two-class classifier.
+struct TwoClassDecision {
+  // Index of the larger logit. Ties pick class 0, like an argmax.
+  int label;
+  // Whether the softmax score of `label` reaches the threshold.
+  bool confident;
+};
+
+// Decides a model that ends in a two-class int8 SOFTMAX, such as the person
+// detection model, without running the softmax. The score of the top class
+// only depends on the gap between the two logits and grows with it, so Init()
+// turns the score threshold into a minimum gap once, and a decision is an
+// argmax plus one compare. Decisions are identical to thresholding the int8
+// output of the softmax kernel.
+class TwoClassClassifierHead {
+ public:
+  // `interpreter` must outlive the head.
+  TwoClassClassifierHead(MicroInterpreter* interpreter,
+                         ErrorReporter* error_reporter)
+      : interpreter_(interpreter), error_reporter_(error_reporter) {}
+
+  // Checks the model's last operator and maps `score_threshold` to a gap.
+  // The threshold is in the int8 domain of the softmax output (scale 1/256,
+  // zero point -128), so a probability p is round(p * 256) - 128. Must be
+  // called after the interpreter allocated its tensors.
+  TfLiteStatus Init(int8_t score_threshold);
+
+  // Runs every operator before the softmax and decides from its input. The
+  // model output is not valid afterwards.
+  TfLiteStatus Invoke(TwoClassDecision* decision);
+
+  // Decides from a pair of softmax inputs.
+  TwoClassDecision Decide(int8_t logit0, int8_t logit1) const {
+    TwoClassDecision decision;
+    decision.label = logit1 > logit0 ? 1 : 0;
+    const int gap = decision.label == 1 ? logit1 - logit0 : logit0 - logit1;
+    decision.confident = gap >= min_confident_gap_;
+    return decision;
+  }
+
+  // Smallest logit gap at which the top class reaches the threshold, or 256
+  // if it never does.
+  int min_confident_gap() const { return min_confident_gap_; }
+
+ private:
+  // Checks the tensors of the softmax node and keeps what Init() and Invoke()
+  // need from the logits.
+  TfLiteStatus LookUpLogits(const TfLiteNode& softmax);
+
+  MicroInterpreter* interpreter_;
+  ErrorReporter* error_reporter_;
+  const int8_t* logits_ = nullptr;
+  float logits_scale_ = 0.0f;
+  size_t softmax_index_ = 0;
+  int min_confident_gap_ = 256;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_CLASSIFIER_HEAD_H_
@@ -0,0 +1,179 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/classifier_head.h"
+
+#include <cstdint>
+
+#include "CMSIS/NN/Include/arm_nnfunctions.h"
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 96 * 1024;
+alignas(16) uint8_t g_arena[kArenaSize];
+
+constexpr int8_t kThresholds[] = {-128, -1, 0, 77, 126, 127};
+
+struct SoftmaxScaling {
+  int32_t mult;
+  int32_t shift;
+  int32_t diff_min;
+};
+
+// Computes the int8 parameters the same way as the softmax kernel's Prepare.
+SoftmaxScaling GetScaling(float input_scale, float beta) {
+  constexpr int kScaledDiffIntegerBits = 5;
+  SoftmaxScaling scaling;
+  int shift;
+  tflite::PreprocessSoftmaxScaling(static_cast<double>(beta),
+                                   static_cast<double>(input_scale),
+                                   kScaledDiffIntegerBits, &scaling.mult,
+                                   &shift);
+  scaling.shift = shift;
+  scaling.diff_min =
+      -1.0 * tflite::CalculateInputRadius(kScaledDiffIntegerBits, shift);
+  return scaling;
+}
+
+void FillInput(TfLiteTensor* input, int seed) {
+  for (size_t i = 0; i < input->bytes; ++i) {
+    input->data.int8[i] = static_cast<int8_t>((i * 7 + seed) & 0xff);
+  }
+}
+
+// Expects `decision` to be the argmax of `logits` and to agree with
+// thresholding the softmax output `scores`.
+void ExpectDecision(const int8_t* logits, const int8_t* scores,
+                    int8_t threshold, tflite::TwoClassDecision decision) {
+  const int label = logits[1] > logits[0] ? 1 : 0;
+  TF_LITE_MICRO_EXPECT_EQ(label, decision.label);
+  TF_LITE_MICRO_EXPECT_EQ(scores[label] >= threshold, decision.confident);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestDecisionsMatchSoftmaxForAllLogits) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  const tflite::NodeAndRegistration softmax =
+      interpreter.node_and_registration(interpreter.operators_size() - 1);
+  const SoftmaxScaling scaling = GetScaling(
+      interpreter.tensor(softmax.node.inputs->data[0])->params.scale,
+      static_cast<const TfLiteSoftmaxParams*>(softmax.node.builtin_data)
+          ->beta);
+
+  // Every pair of logits, one row per value of the second logit.
+  int8_t logits[256 * 2];
+  int8_t scores[256 * 2];
+  for (int8_t threshold : kThresholds) {
+    tflite::TwoClassClassifierHead head(&interpreter, &reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, head.Init(threshold));
+    for (int first = -128; first <= 127; ++first) {
+      for (int second = -128; second <= 127; ++second) {
+        logits[(second + 128) * 2] = static_cast<int8_t>(first);
+        logits[(second + 128) * 2 + 1] = static_cast<int8_t>(second);
+      }
+      arm_softmax_s8(logits, 256, 2, scaling.mult, scaling.shift,
+                     scaling.diff_min, scores);
+      for (int row = 0; row < 256; ++row) {
+        ExpectDecision(&logits[row * 2], &scores[row * 2], threshold,
+                       head.Decide(logits[row * 2], logits[row * 2 + 1]));
+      }
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(TestInvokeSkipsSoftmax) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  const size_t softmax_index = interpreter.operators_size() - 1;
+  const int8_t* logits =
+      interpreter
+          .tensor(interpreter.node_and_registration(softmax_index)
+                      .node.inputs->data[0])
+          ->data.int8;
+  const int8_t* scores = interpreter.output(0)->data.int8;
+
+  tflite::TwoClassClassifierHead head(&interpreter, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, head.Init(0));
+  for (int seed = 0; seed < 4; ++seed) {
+    FillInput(interpreter.input(0), seed * 37);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    const int8_t expected_scores[2] = {scores[0], scores[1]};
+
+    // The input buffer was reused by later operators.
+    FillInput(interpreter.input(0), seed * 37);
+    tflite::TwoClassDecision decision;
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, head.Invoke(&decision));
+    TF_LITE_MICRO_EXPECT_EQ(softmax_index, interpreter.next_operator());
+    ExpectDecision(logits, expected_scores, 0, decision);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestInitRejectsModelNotEndingInSoftmax) {
+  // The keyword model quantizes its softmax output as a last step.
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_keyword_scrambled_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  tflite::TwoClassClassifierHead head(&interpreter, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, head.Init(0));
+}
+
+TF_LITE_MICRO_TEST(TestThresholdsMapToGaps) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  tflite::TwoClassClassifierHead head(&interpreter, &reporter);
+
+  // The top class of two always scores at least one half.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, head.Init(-128));
+  TF_LITE_MICRO_EXPECT_EQ(0, head.min_confident_gap());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, head.Init(0));
+  TF_LITE_MICRO_EXPECT_EQ(0, head.min_confident_gap());
+  const size_t arena_used = interpreter.arena_used_bytes();
+  int previous_gap = 0;
+  for (int8_t threshold : kThresholds) {
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, head.Init(threshold));
+    TF_LITE_MICRO_EXPECT_GE(head.min_confident_gap(), previous_gap);
+    TF_LITE_MICRO_EXPECT_LE(head.min_confident_gap(), 256);
+    previous_gap = head.min_confident_gap();
+  }
+  // Changing the threshold takes nothing from the arena.
+  TF_LITE_MICRO_EXPECT_EQ(arena_used, interpreter.arena_used_bytes());
+}
+
+TF_LITE_MICRO_TESTS_END
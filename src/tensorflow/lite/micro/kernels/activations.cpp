@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 #include "tensorflow/lite/micro/micro_utils.h"
 
 namespace tflite {
@@ -149,6 +150,8 @@ TfLiteStatus ReluPrepare(TfLiteContext* context, TfLiteNode* node) {
     CalculateReluOpData<uint8_t>(input, output, data);
   }
 
+  TF_LITE_ENSURE_STATUS(
+      RequestInPlaceOutput(context, node, kInputTensor, kOutputTensor));
   return kTfLiteOk;
 }
 
@@ -214,6 +217,8 @@ TfLiteStatus Relu6Prepare(TfLiteContext* context, TfLiteNode* node) {
     data->zero_uint8 = input->params.zero_point;
   }
 
+  TF_LITE_ENSURE_STATUS(
+      RequestInPlaceOutput(context, node, kInputTensor, kOutputTensor));
   return kTfLiteOk;
 }
 
@@ -0,0 +1,285 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/block_sparse_fully_connected.h"
+
+#define FLATBUFFERS_LOCALE_INDEPENDENT 0
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kValuesTensor = 1;
+constexpr int kBlockIndicesTensor = 2;
+constexpr int kRowOffsetsTensor = 3;
+constexpr int kBiasTensor = 4;
+constexpr int kOutputTensor = 0;
+
+struct OpData {
+  int block_size;
+  TfLiteFusedActivation activation;
+  int32_t* output_multiplier;
+  int32_t* output_shift;
+  int32_t output_offset;
+  int32_t activation_min;
+  int32_t activation_max;
+};
+
+// acc[i] += the dot product of input row i with the stored blocks [begin,
+// end) of one filter row, for two input rows. The block size is a template
+// parameter for the common sizes so that the compiler unrolls the blocks;
+// kBlockSize == 0 takes it from `block_size`.
+template <int kBlockSize>
+void DotBlocks(const int8_t* values, const uint8_t* block_indices,
+               int block_size, int begin, int end, const int8_t* in0,
+               const int8_t* in1, int32_t* acc) {
+  const int size = kBlockSize > 0 ? kBlockSize : block_size;
+  int32_t acc0 = 0;
+  int32_t acc1 = 0;
+  for (int b = begin; b < end; ++b) {
+    const int8_t* w = values + b * size;
+    const int offset = block_indices[b] * size;
+    const int8_t* x0 = in0 + offset;
+    const int8_t* x1 = in1 + offset;
+    for (int i = 0; i < size; ++i) {
+      const int32_t f = w[i];
+      acc0 += x0[i] * f;
+      acc1 += x1[i] * f;
+    }
+  }
+  acc[0] += acc0;
+  acc[1] += acc1;
+}
+
+template <int kBlockSize>
+void BlockSparseRows(const BlockSparseFilter& filter,
+                     const int32_t* folded_bias,
+                     const int32_t* output_multiplier,
+                     const int32_t* output_shift, int32_t output_offset,
+                     int32_t activation_min, int32_t activation_max,
+                     int rows, const int8_t* input_data,
+                     int8_t* output_data) {
+  const int depth = filter.depth;
+  const int channels = filter.channels;
+  for (int r = 0; r < rows; r += 2) {
+    const int8_t* in0 = input_data + r * depth;
+    // A single trailing row is computed as a pair with itself.
+    const int8_t* in1 = r + 1 < rows ? in0 + depth : in0;
+    int8_t* out = output_data + r * channels;
+    for (int c = 0; c < channels; ++c) {
+      int32_t acc[2] = {folded_bias[c], folded_bias[c]};
+      DotBlocks<kBlockSize>(filter.values, filter.block_indices,
+                            filter.block_size, filter.row_offsets[c],
+                            filter.row_offsets[c + 1], in0, in1, acc);
+      for (int i = 0; i < 2 && r + i < rows; ++i) {
+        int32_t value = MultiplyByQuantizedMultiplier(
+            acc[i], output_multiplier[c], output_shift[c]);
+        value += output_offset;
+        value = value < activation_min ? activation_min : value;
+        value = value > activation_max ? activation_max : value;
+        out[i * channels + c] = static_cast<int8_t>(value);
+      }
+    }
+  }
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  OpData* data = static_cast<OpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+  const flexbuffers::Map& m =
+      flexbuffers::GetRoot(reinterpret_cast<const uint8_t*>(buffer), length)
+          .AsMap();
+  data->block_size = m["block_size"].AsInt32();
+  data->activation = static_cast<TfLiteFusedActivation>(
+      m["fused_activation_function"].AsInt32());
+  return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 5);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  const TfLiteTensor* values = GetInput(context, node, kValuesTensor);
+  const TfLiteTensor* block_indices =
+      GetInput(context, node, kBlockIndicesTensor);
+  const TfLiteTensor* row_offsets = GetInput(context, node, kRowOffsetsTensor);
+  const TfLiteTensor* bias = GetInput(context, node, kBiasTensor);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, values->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, block_indices->type, kTfLiteUInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, row_offsets->type, kTfLiteInt32);
+  TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt32);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE(context, IsConstantTensor(values) &&
+                              IsConstantTensor(block_indices) &&
+                              IsConstantTensor(row_offsets) &&
+                              IsConstantTensor(bias));
+
+  const int depth = input->dims->data[input->dims->size - 1];
+  const int channels = output->dims->data[output->dims->size - 1];
+  const int block_size = data->block_size;
+  TF_LITE_ENSURE_MSG(context, IsBlockSparseEncodable(depth, block_size),
+                     "Unsupported block size for the filter depth.");
+  TF_LITE_ENSURE_EQ(context, NumElements(input) / depth,
+                    NumElements(output) / channels);
+  TF_LITE_ENSURE_EQ(context, NumElements(row_offsets), channels + 1);
+  TF_LITE_ENSURE_EQ(context, NumElements(bias), channels);
+
+  // Malformed offsets or indices would read outside the filter or the input,
+  // so they are checked once here.
+  const int32_t* offsets = GetTensorData<int32_t>(row_offsets);
+  const int blocks = NumElements(block_indices);
+  TF_LITE_ENSURE_EQ(context, offsets[0], 0);
+  TF_LITE_ENSURE_EQ(context, offsets[channels], blocks);
+  TF_LITE_ENSURE_EQ(context, NumElements(values), blocks * block_size);
+  for (int c = 0; c < channels; ++c) {
+    TF_LITE_ENSURE(context, offsets[c] <= offsets[c + 1]);
+  }
+  const uint8_t* indices = GetTensorData<uint8_t>(block_indices);
+  for (int b = 0; b < blocks; ++b) {
+    TF_LITE_ENSURE(context, indices[b] < depth / block_size);
+  }
+
+  TF_LITE_ENSURE_EQ(context, values->quantization.type,
+                    kTfLiteAffineQuantization);
+  const auto* filter_quantization =
+      static_cast<const TfLiteAffineQuantization*>(
+          values->quantization.params);
+  TF_LITE_ENSURE(context, filter_quantization != nullptr &&
+                              filter_quantization->scale != nullptr);
+  const int scale_count = filter_quantization->scale->size;
+  TF_LITE_ENSURE(context, scale_count == 1 || scale_count == channels);
+
+  data->output_multiplier = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  data->output_shift = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->output_multiplier != nullptr &&
+                              data->output_shift != nullptr);
+  // The same multipliers as the dense kernels derive from the filter scales.
+  for (int c = 0; c < channels; ++c) {
+    const float filter_scale =
+        filter_quantization->scale->data[scale_count == 1 ? 0 : c];
+    const double effective_scale = static_cast<double>(input->params.scale) *
+                                   static_cast<double>(filter_scale) /
+                                   static_cast<double>(output->params.scale);
+    int shift;
+    QuantizeMultiplier(effective_scale, &data->output_multiplier[c], &shift);
+    data->output_shift[c] = shift;
+  }
+  data->output_offset = output->params.zero_point;
+  return CalculateActivationRangeQuantized(context, data->activation, output,
+                                           &data->activation_min,
+                                           &data->activation_max);
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *static_cast<const OpData*>(node->user_data);
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kInputTensor);
+  const TfLiteEvalTensor* values =
+      tflite::micro::GetEvalInput(context, node, kValuesTensor);
+  const TfLiteEvalTensor* block_indices =
+      tflite::micro::GetEvalInput(context, node, kBlockIndicesTensor);
+  const TfLiteEvalTensor* row_offsets =
+      tflite::micro::GetEvalInput(context, node, kRowOffsetsTensor);
+  const TfLiteEvalTensor* bias =
+      tflite::micro::GetEvalInput(context, node, kBiasTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  BlockSparseFilter filter;
+  filter.depth = input_shape.Dims(input_shape.DimensionsCount() - 1);
+  filter.channels = output_shape.Dims(output_shape.DimensionsCount() - 1);
+  filter.block_size = data.block_size;
+  filter.values = tflite::micro::GetTensorData<int8_t>(values);
+  filter.block_indices = tflite::micro::GetTensorData<uint8_t>(block_indices);
+  filter.row_offsets = tflite::micro::GetTensorData<int32_t>(row_offsets);
+
+  BlockSparseFullyConnected(
+      filter, tflite::micro::GetTensorData<int32_t>(bias),
+      data.output_multiplier, data.output_shift, data.output_offset,
+      data.activation_min, data.activation_max,
+      input_shape.FlatSize() / filter.depth,
+      tflite::micro::GetTensorData<int8_t>(input),
+      tflite::micro::GetTensorData<int8_t>(output));
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+void BlockSparseFullyConnected(const BlockSparseFilter& filter,
+                               const int32_t* folded_bias,
+                               const int32_t* output_multiplier,
+                               const int32_t* output_shift,
+                               int32_t output_offset, int32_t activation_min,
+                               int32_t activation_max, int rows,
+                               const int8_t* input_data, int8_t* output_data) {
+  switch (filter.block_size) {
+    case 4:
+      BlockSparseRows<4>(filter, folded_bias, output_multiplier, output_shift,
+                         output_offset, activation_min, activation_max, rows,
+                         input_data, output_data);
+      break;
+    case 8:
+      BlockSparseRows<8>(filter, folded_bias, output_multiplier, output_shift,
+                         output_offset, activation_min, activation_max, rows,
+                         input_data, output_data);
+      break;
+    case 16:
+      BlockSparseRows<16>(filter, folded_bias, output_multiplier,
+                          output_shift, output_offset, activation_min,
+                          activation_max, rows, input_data, output_data);
+      break;
+    default:
+      BlockSparseRows<0>(filter, folded_bias, output_multiplier, output_shift,
+                         output_offset, activation_min, activation_max, rows,
+                         input_data, output_data);
+      break;
+  }
+}
+
+TfLiteRegistration* Register_BLOCK_SPARSE_FULLY_CONNECTED() {
+  static TfLiteRegistration r = {/*init=*/Init,
+                                 /*free=*/nullptr,
+                                 /*prepare=*/Prepare,
+                                 /*invoke=*/Eval,
+                                 /*profiling_string=*/nullptr,
+                                 /*builtin_code=*/0,
+                                 /*custom_name=*/nullptr,
+                                 /*version=*/0};
+  return &r;
+}
+
+}  // namespace tflite
@@ -0,0 +1,136 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_BLOCK_SPARSE_FULLY_CONNECTED_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_BLOCK_SPARSE_FULLY_CONNECTED_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+namespace tflite {
+
+// A fully connected layer with a pruned int8 filter, which
+// tools/sparsify_model_weights.cpp writes in place of FULLY_CONNECTED and
+// pointwise CONV_2D operators. Each row of the [channels, depth] filter is
+// split into blocks of block_size consecutive weights and only the blocks
+// holding a nonzero weight are stored, so the zero blocks cost neither flash
+// reads nor MACs.
+//
+// The custom operator has the inputs
+//   0: input, int8 [..., depth]
+//   1: values, int8 [stored blocks * block_size], the stored blocks row by row
+//   2: block indices, uint8 [stored blocks], each block's position in its row
+//   3: row offsets, int32 [channels + 1], the first stored block of each row
+//   4: bias, int32 [channels], with input_offset * sum(row) folded in
+// and an int8 [..., channels] output. The values tensor keeps the filter's
+// per-tensor or per-channel scales. Its custom options are a flexbuffer map
+// with "block_size" and "fused_activation_function".
+constexpr char kBlockSparseFullyConnectedName[] =
+    "BLOCK_SPARSE_FULLY_CONNECTED";
+
+// Block indices are stored in a byte.
+constexpr int kMaxBlocksPerRow = 256;
+
+struct BlockSparseFilter {
+  int channels;
+  int depth;
+  int block_size;
+  const int8_t* values;
+  const uint8_t* block_indices;
+  const int32_t* row_offsets;
+};
+
+inline bool IsBlockSparseEncodable(int depth, int block_size) {
+  return block_size > 0 && depth % block_size == 0 &&
+         depth / block_size <= kMaxBlocksPerRow;
+}
+
+// Returns the number of blocks of a dense [channels, depth] filter that hold
+// a nonzero weight.
+inline int CountNonZeroBlocks(const int8_t* weights, int channels, int depth,
+                              int block_size) {
+  int count = 0;
+  for (int i = 0; i < channels * depth; i += block_size) {
+    for (int j = 0; j < block_size; ++j) {
+      if (weights[i + j] != 0) {
+        ++count;
+        break;
+      }
+    }
+  }
+  return count;
+}
+
+// Encodes a dense [channels, depth] filter. `values` needs room for
+// CountNonZeroBlocks() * block_size weights, `block_indices` for
+// CountNonZeroBlocks() indices and `row_offsets` for channels + 1 offsets.
+inline void EncodeBlockSparse(const int8_t* weights, int channels, int depth,
+                              int block_size, int8_t* values,
+                              uint8_t* block_indices, int32_t* row_offsets) {
+  int count = 0;
+  for (int c = 0; c < channels; ++c) {
+    row_offsets[c] = count;
+    for (int b = 0; b < depth / block_size; ++b) {
+      const int8_t* block = weights + c * depth + b * block_size;
+      bool nonzero = false;
+      for (int j = 0; j < block_size; ++j) {
+        nonzero = nonzero || block[j] != 0;
+      }
+      if (!nonzero) {
+        continue;
+      }
+      for (int j = 0; j < block_size; ++j) {
+        values[count * block_size + j] = block[j];
+      }
+      block_indices[count] = static_cast<uint8_t>(b);
+      ++count;
+    }
+  }
+  row_offsets[channels] = count;
+}
+
+// Stores bias[c] + input_offset * sum(row c) for each channel, the bias the
+// custom operator expects. `bias` may be null.
+inline void FoldBlockSparseInputOffset(const BlockSparseFilter& filter,
+                                       const int32_t* bias,
+                                       int32_t input_offset,
+                                       int32_t* folded_bias) {
+  for (int c = 0; c < filter.channels; ++c) {
+    int32_t sum = 0;
+    for (int i = filter.row_offsets[c] * filter.block_size;
+         i < filter.row_offsets[c + 1] * filter.block_size; ++i) {
+      sum += filter.values[i];
+    }
+    folded_bias[c] = (bias ? bias[c] : 0) + input_offset * sum;
+  }
+}
+
+// Computes `rows` rows of int8 outputs from the int8 input rows, requantizing
+// channel c with output_multiplier[c] and output_shift[c]. Bit-exact with the
+// reference int8 fully connected and per-channel convolution kernels on the
+// dense filter.
+void BlockSparseFullyConnected(const BlockSparseFilter& filter,
+                               const int32_t* folded_bias,
+                               const int32_t* output_multiplier,
+                               const int32_t* output_shift,
+                               int32_t output_offset, int32_t activation_min,
+                               int32_t activation_max, int rows,
+                               const int8_t* input_data, int8_t* output_data);
+
+TfLiteRegistration* Register_BLOCK_SPARSE_FULLY_CONNECTED();
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_BLOCK_SPARSE_FULLY_CONNECTED_H_
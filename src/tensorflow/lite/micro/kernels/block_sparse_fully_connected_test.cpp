@@ -0,0 +1,320 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/kernels/block_sparse_fully_connected.h"
+
+#include <cstdint>
+
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kMaxRows = 25;
+constexpr int kMaxDepth = 128;
+constexpr int kMaxChannels = 16;
+
+int8_t g_input[kMaxRows * kMaxDepth];
+int8_t g_filter[kMaxChannels * kMaxDepth];
+int32_t g_bias[kMaxChannels];
+int8_t g_values[kMaxChannels * kMaxDepth];
+uint8_t g_block_indices[kMaxChannels * kMaxDepth];
+int32_t g_row_offsets[kMaxChannels + 1];
+int32_t g_folded_bias[kMaxChannels];
+int8_t g_expected[kMaxRows * kMaxChannels];
+int8_t g_output[kMaxRows * kMaxChannels];
+float g_filter_scales[kMaxChannels + 1];
+int g_filter_zero_points[kMaxChannels + 1];
+int32_t g_multiplier[kMaxChannels];
+int32_t g_shift[kMaxChannels];
+
+tflite::testing::Random g_random;
+
+// Fills a dense filter in which each block is zero with probability
+// `percent_zero` / 100.
+void FillPrunedFilter(int channels, int depth, int block_size,
+                      int percent_zero) {
+  for (int i = 0; i < channels * depth; i += block_size) {
+    const bool zero = g_random.Int(0, 99) < percent_zero;
+    for (int j = 0; j < block_size; ++j) {
+      g_filter[i + j] = zero ? 0 : static_cast<int8_t>(g_random.Int(-127, 127));
+    }
+  }
+}
+
+struct Layer {
+  int rows;
+  int depth;
+  int channels;
+  int block_size;
+  int input_zero_point;
+  int output_zero_point;
+  float input_scale;
+  float output_scale;
+  bool per_channel;
+};
+
+// Encodes g_filter and folds the input offset into g_bias the way the
+// model transformer does. Returns the number of non-zero blocks.
+int EncodeLayer(const Layer& layer) {
+  const int blocks = tflite::CountNonZeroBlocks(
+      g_filter, layer.channels, layer.depth, layer.block_size);
+  tflite::EncodeBlockSparse(g_filter, layer.channels, layer.depth,
+                            layer.block_size, g_values, g_block_indices,
+                            g_row_offsets);
+  const tflite::BlockSparseFilter filter = {layer.channels,  layer.depth,
+                                            layer.block_size, g_values,
+                                            g_block_indices, g_row_offsets};
+  tflite::FoldBlockSparseInputOffset(filter, g_bias, -layer.input_zero_point,
+                                     g_folded_bias);
+  return blocks;
+}
+
+// Runs the custom operator on g_input and the encoded filter with `dims` as
+// the input and output shapes and stores the result in g_output.
+TfLiteStatus RunEncoded(const Layer& layer, int blocks, const int* input_dims,
+                        const int* output_dims,
+                        TfLiteFusedActivation activation) {
+
+  const int values_dims[] = {1, blocks * layer.block_size};
+  const int block_indices_dims[] = {1, blocks};
+  const int row_offsets_dims[] = {1, layer.channels + 1};
+  const int bias_dims[] = {1, layer.channels};
+  const int scale_count = layer.per_channel ? layer.channels : 1;
+  g_filter_scales[0] = scale_count;
+  g_filter_zero_points[0] = scale_count;
+  TfLiteAffineQuantization filter_quant;
+  filter_quant.scale = tflite::testing::FloatArrayFromFloats(g_filter_scales);
+  filter_quant.zero_point =
+      tflite::testing::IntArrayFromInts(g_filter_zero_points);
+  filter_quant.quantized_dimension = 0;
+
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(input_dims),
+          layer.input_scale, layer.input_zero_point),
+      tflite::testing::CreateTensor(
+          g_values, tflite::testing::IntArrayFromInts(values_dims)),
+      tflite::testing::CreateTensor(
+          g_block_indices,
+          tflite::testing::IntArrayFromInts(block_indices_dims)),
+      tflite::testing::CreateTensor(
+          g_row_offsets, tflite::testing::IntArrayFromInts(row_offsets_dims)),
+      tflite::testing::CreateTensor(
+          g_folded_bias, tflite::testing::IntArrayFromInts(bias_dims)),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(output_dims),
+          layer.output_scale, layer.output_zero_point),
+  };
+  tensors[1].quantization = {kTfLiteAffineQuantization, &filter_quant};
+  for (int i = 1; i <= 4; ++i) {
+    tensors[i].allocation_type = kTfLiteMmapRo;
+  }
+
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.Int("block_size", layer.block_size);
+    fbb.Int("fused_activation_function", activation);
+  });
+  fbb.Finish();
+  const std::vector<uint8_t>& options = fbb.GetBuffer();
+
+  const int inputs[] = {5, 0, 1, 2, 3, 4};
+  const int outputs[] = {1, 5};
+  tflite::micro::KernelRunner runner(
+      *tflite::Register_BLOCK_SPARSE_FULLY_CONNECTED(), tensors, 6,
+      tflite::testing::IntArrayFromInts(inputs),
+      tflite::testing::IntArrayFromInts(outputs), nullptr,
+      micro_test::reporter);
+  TfLiteStatus status = runner.InitAndPrepare(
+      reinterpret_cast<const char*>(options.data()), options.size());
+  if (status == kTfLiteOk) {
+    status = runner.Invoke();
+  }
+  return status;
+}
+
+TfLiteStatus RunBlockSparse(const Layer& layer, const int* input_dims,
+                            const int* output_dims,
+                            TfLiteFusedActivation activation) {
+  return RunEncoded(layer, EncodeLayer(layer), input_dims, output_dims,
+                    activation);
+}
+
+void FillLayer(const Layer& layer, int percent_zero) {
+  for (int i = 0; i < layer.rows * layer.depth; ++i) {
+    g_input[i] = static_cast<int8_t>(g_random.Int(-128, 127));
+  }
+  FillPrunedFilter(layer.channels, layer.depth, layer.block_size,
+                   percent_zero);
+  for (int c = 0; c < layer.channels; ++c) {
+    g_bias[c] = g_random.Int(-20000, 20000);
+    g_filter_scales[c + 1] =
+        layer.per_channel ? g_random.Int(1, 64) / 4096.0f : 1 / 256.0f;
+    g_filter_zero_points[c + 1] = 0;
+    int shift;
+    tflite::QuantizeMultiplier(static_cast<double>(layer.input_scale) *
+                                   g_filter_scales[c + 1] /
+                                   layer.output_scale,
+                               &g_multiplier[c], &shift);
+    g_shift[c] = shift;
+  }
+}
+
+// Expects the custom operator to match the dense fully connected kernel.
+void TestMatchesFullyConnected(int rows, int depth, int channels,
+                               int block_size, int percent_zero) {
+  const Layer layer = {rows, depth, channels, block_size,
+                       g_random.Int(-128, 127), g_random.Int(-128, 127),
+                       0.05f, 0.5f, false};
+  FillLayer(layer, percent_zero);
+  const int input_dims[] = {2, rows, depth};
+  const int output_dims[] = {2, rows, channels};
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, RunBlockSparse(layer, input_dims, output_dims,
+                                kTfLiteActRelu));
+
+  tflite::FullyConnectedParams params;
+  params.input_offset = -layer.input_zero_point;
+  params.weights_offset = 0;
+  params.output_offset = layer.output_zero_point;
+  params.output_multiplier = g_multiplier[0];
+  params.output_shift = g_shift[0];
+  params.quantized_activation_min =
+      layer.output_zero_point > -128 ? layer.output_zero_point : -128;
+  params.quantized_activation_max = 127;
+  tflite::reference_integer_ops::FullyConnected(
+      params, tflite::RuntimeShape({rows, depth}), g_input,
+      tflite::RuntimeShape({channels, depth}), g_filter,
+      tflite::RuntimeShape({channels}), g_bias,
+      tflite::RuntimeShape({rows, channels}), g_expected);
+  for (int i = 0; i < rows * channels; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+// Expects the custom operator to match a dense per-channel 1x1 convolution.
+void TestMatchesPointwiseConv(int size, int depth, int channels,
+                              int block_size, int percent_zero) {
+  const Layer layer = {size * size, depth, channels, block_size,
+                       g_random.Int(-128, 127), g_random.Int(-128, 127),
+                       0.05f, 1.0f, true};
+  FillLayer(layer, percent_zero);
+  const int input_dims[] = {4, 1, size, size, depth};
+  const int output_dims[] = {4, 1, size, size, channels};
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, RunBlockSparse(layer, input_dims, output_dims,
+                                kTfLiteActNone));
+
+  tflite::ConvParams params;
+  params.input_offset = -layer.input_zero_point;
+  params.output_offset = layer.output_zero_point;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.padding_values.height = 0;
+  params.padding_values.width = 0;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  tflite::reference_integer_ops::ConvPerChannel(
+      params, g_multiplier, g_shift,
+      tflite::RuntimeShape({1, size, size, depth}), g_input,
+      tflite::RuntimeShape({channels, 1, 1, depth}), g_filter,
+      tflite::RuntimeShape({channels}), g_bias,
+      tflite::RuntimeShape({1, size, size, channels}), g_expected);
+  for (int i = 0; i < size * size * channels; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(BlockSparseMatchesFullyConnected) {
+  for (int percent_zero : {0, 50, 90, 100}) {
+    TestMatchesFullyConnected(1, 128, 16, 8, percent_zero);
+    TestMatchesFullyConnected(3, 64, 5, 4, percent_zero);
+    TestMatchesFullyConnected(2, 128, 7, 16, percent_zero);
+    TestMatchesFullyConnected(3, 30, 3, 2, percent_zero);
+  }
+}
+
+TF_LITE_MICRO_TEST(BlockSparseMatchesPointwiseConv) {
+  for (int percent_zero : {0, 60, 95}) {
+    TestMatchesPointwiseConv(5, 64, 16, 8, percent_zero);
+    TestMatchesPointwiseConv(4, 32, 9, 4, percent_zero);
+    TestMatchesPointwiseConv(3, 96, 6, 16, percent_zero);
+  }
+}
+
+TF_LITE_MICRO_TEST(BlockSparseEncodingRoundTrips) {
+  FillPrunedFilter(8, 64, 4, 70);
+  const int blocks = tflite::CountNonZeroBlocks(g_filter, 8, 64, 4);
+  tflite::EncodeBlockSparse(g_filter, 8, 64, 4, g_values, g_block_indices,
+                            g_row_offsets);
+  TF_LITE_MICRO_EXPECT_EQ(blocks, g_row_offsets[8]);
+  int8_t decoded[8 * 64] = {};
+  for (int c = 0; c < 8; ++c) {
+    for (int b = g_row_offsets[c]; b < g_row_offsets[c + 1]; ++b) {
+      for (int j = 0; j < 4; ++j) {
+        decoded[c * 64 + g_block_indices[b] * 4 + j] = g_values[b * 4 + j];
+      }
+    }
+  }
+  for (int i = 0; i < 8 * 64; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_filter[i], decoded[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(BlockSparseRejectsMalformedFilters) {
+  const Layer layer = {2, 64, 4, 8, 0, 0, 0.05f, 0.5f, false};
+  const int input_dims[] = {2, 2, 64};
+  const int output_dims[] = {2, 2, 4};
+  FillLayer(layer, 0);
+  const int blocks = EncodeLayer(layer);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, RunEncoded(layer, blocks, input_dims,
+                                                output_dims, kTfLiteActNone));
+
+  // A block index past the end of the row.
+  g_block_indices[blocks - 1] = 64 / 8;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          RunEncoded(layer, blocks, input_dims, output_dims,
+                                     kTfLiteActNone));
+  EncodeLayer(layer);
+
+  // Row offsets that do not cover the values.
+  g_row_offsets[4] = blocks - 1;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          RunEncoded(layer, blocks, input_dims, output_dims,
+                                     kTfLiteActNone));
+
+  // A depth that is not a multiple of the block size.
+  const Layer uneven = {2, 60, 4, 8, 0, 0, 0.05f, 0.5f, false};
+  const int uneven_input_dims[] = {2, 2, 60};
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          RunEncoded(uneven, blocks, uneven_input_dims,
+                                     output_dims, kTfLiteActNone));
+}
+
+TF_LITE_MICRO_TESTS_END
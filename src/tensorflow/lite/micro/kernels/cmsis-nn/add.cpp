@@ -24,6 +24,9 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/m0plus/add.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
 
 namespace tflite {
@@ -38,6 +41,10 @@ constexpr int kOutputTensor = 0;
 struct OpData {
   bool requires_broadcast;
 
+  // Whether int16 tensors use the power-of-two scale path. Otherwise they
+  // take the general 8-bit path with a smaller left shift.
+  bool pot_scale_int16;
+
   // These fields are used in both the general 8-bit -> 8bit quantized path,
   // and the special 16-bit -> 16bit quantized path
   int input1_shift;
@@ -62,12 +69,26 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteAddParams* params,
                              OpData* data) {
   data->requires_broadcast = !HaveSameShapes(input1, input2);
 
-  if (output->type == kTfLiteUInt8 || output->type == kTfLiteInt8) {
-    // 8bit -> 8bit general quantized path, with general rescalings
+  // As in TFLite, int16 tensors with zero zero points and power-of-two scales
+  // take the special 16-bit path and all others the general one.
+  int input1_scale_log2 = 0;
+  int input2_scale_log2 = 0;
+  int output_scale_log2 = 0;
+  data->pot_scale_int16 =
+      output->type == kTfLiteInt16 && input1->params.zero_point == 0 &&
+      input2->params.zero_point == 0 && output->params.zero_point == 0 &&
+      CheckedLog2(input1->params.scale, &input1_scale_log2) &&
+      CheckedLog2(input2->params.scale, &input2_scale_log2) &&
+      CheckedLog2(output->params.scale, &output_scale_log2);
+
+  if (output->type == kTfLiteUInt8 || output->type == kTfLiteInt8 ||
+      (output->type == kTfLiteInt16 && !data->pot_scale_int16)) {
+    // 8bit -> 8bit general quantized path, with general rescalings, also
+    // used by int16 -> int16 with general rescalings.
     data->input1_offset = -input1->params.zero_point;
     data->input2_offset = -input2->params.zero_point;
     data->output_offset = output->params.zero_point;
-    data->left_shift = 20;
+    data->left_shift = output->type == kTfLiteInt16 ? 15 : 20;
     const double twice_max_input_scale =
         2 * static_cast<double>(
                 std::max(input1->params.scale, input2->params.scale));
@@ -88,6 +109,20 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteAddParams* params,
     QuantizeMultiplierSmallerThanOneExp(
         real_output_multiplier, &data->output_multiplier, &data->output_shift);
 
+    TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
+        context, params->activation, output, &data->output_activation_min,
+        &data->output_activation_max));
+  } else if (output->type == kTfLiteInt16) {
+    // 16bit -> 16bit special path for symmetric power-of-two scales, where
+    // only one input may need shifting to match the output.
+    TF_LITE_ENSURE_MSG(context, !data->requires_broadcast,
+                       "Broadcast is not supported for power-of-two int16.");
+    data->input1_shift = input1_scale_log2 - output_scale_log2;
+    data->input2_shift = input2_scale_log2 - output_scale_log2;
+    TF_LITE_ENSURE(context, data->input1_shift == 0 || data->input2_shift == 0);
+    TF_LITE_ENSURE(context, data->input1_shift <= 0);
+    TF_LITE_ENSURE(context, data->input2_shift <= 0);
+
     TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
         context, params->activation, output, &data->output_activation_min,
         &data->output_activation_max));
@@ -124,7 +159,20 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
                               const TfLiteEvalTensor* input1,
                               const TfLiteEvalTensor* input2,
                               TfLiteEvalTensor* output) {
-  if (output->type == kTfLiteUInt8 || output->type == kTfLiteInt8) {
+  if (output->type == kTfLiteInt16 && data->pot_scale_int16) {
+    tflite::ArithmeticParams op_params;
+    op_params.input1_shift = data->input1_shift;
+    op_params.input2_shift = data->input2_shift;
+    SetActivationParams(data->output_activation_min,
+                        data->output_activation_max, &op_params);
+    reference_ops::Add(op_params, tflite::micro::GetTensorShape(input1),
+                       tflite::micro::GetTensorData<int16_t>(input1),
+                       tflite::micro::GetTensorShape(input2),
+                       tflite::micro::GetTensorData<int16_t>(input2),
+                       tflite::micro::GetTensorShape(output),
+                       tflite::micro::GetTensorData<int16_t>(output));
+  } else if (output->type == kTfLiteUInt8 || output->type == kTfLiteInt8 ||
+             output->type == kTfLiteInt16) {
     tflite::ArithmeticParams op_params;
     op_params.left_shift = data->left_shift;
     op_params.input1_offset = data->input1_offset;
@@ -166,6 +214,27 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
                                  tflite::micro::GetTensorShape(input2),
                                  tflite::micro::GetTensorShape(output)));
       }
+    } else if (output->type == kTfLiteInt16) {
+      if (need_broadcast) {
+        TF_LITE_ADD(reference_ops, BroadcastAdd4DSlow, int16_t);
+      } else if (kUseM0PlusKernels &&
+                 m0plus::AddElementwiseInt16Supported(op_params)) {
+        m0plus::AddElementwiseInt16(
+            MatchingElementsSize(tflite::micro::GetTensorShape(input1),
+                                 tflite::micro::GetTensorShape(input2),
+                                 tflite::micro::GetTensorShape(output)),
+            op_params, tflite::micro::GetTensorData<int16_t>(input1),
+            tflite::micro::GetTensorData<int16_t>(input2),
+            tflite::micro::GetTensorData<int16_t>(output));
+      } else {
+        reference_ops::Add(op_params, tflite::micro::GetTensorShape(input1),
+                           tflite::micro::GetTensorData<int16_t>(input1),
+                           tflite::micro::GetTensorShape(input2),
+                           tflite::micro::GetTensorData<int16_t>(input2),
+                           tflite::micro::GetTensorShape(output),
+                           tflite::micro::GetTensorData<int16_t>(output),
+                           /*pot_scale=*/false);
+      }
     } else {
       if (need_broadcast) {
         TF_LITE_ADD(reference_ops, BroadcastAdd4DSlow, uint8_t);
@@ -198,6 +267,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_STATUS(
       CalculateOpData(context, params, input1, input2, output, data));
 
+  // Each output element only reads the input elements at the same position,
+  // so the output can overwrite an input that was not broadcast.
+  if (HaveSameShapes(input1, output)) {
+    TF_LITE_ENSURE_STATUS(
+        RequestInPlaceOutput(context, node, kInputTensor1, kOutputTensor));
+  }
+  if (HaveSameShapes(input2, output)) {
+    TF_LITE_ENSURE_STATUS(
+        RequestInPlaceOutput(context, node, kInputTensor2, kOutputTensor));
+  }
   return kTfLiteOk;
 }
 
@@ -216,7 +295,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   if (output->type == kTfLiteFloat32) {
     EvalAdd(context, node, params, data, input1, input2, output);
-  } else if (output->type == kTfLiteUInt8 || output->type == kTfLiteInt8) {
+  } else if (output->type == kTfLiteUInt8 || output->type == kTfLiteInt8 ||
+             output->type == kTfLiteInt16) {
     TF_LITE_ENSURE_OK(context, EvalAddQuantized(context, node, params, data,
                                                 input1, input2, output));
   } else {
@@ -26,6 +26,10 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/conv.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
+#include "tensorflow/lite/micro/micro_workers.h"
 
 namespace tflite {
 namespace {
@@ -63,6 +67,15 @@ struct OpData {
 
   // Index to buffer for optimizations if applicable.
   int buffer_idx;
+
+  // Whether output rows are split between the interpreter's workers. The
+  // buffer then holds one scratch area of `buffer_size` bytes per worker.
+  bool use_workers;
+  int32_t buffer_size;
+
+  // Per-channel bias + input_offset * kernel sum for the m0plus kernel,
+  // computed in Prepare if it fit in the weight packing budget, or nullptr.
+  int32_t* folded_bias;
 };
 
 inline PaddingType RuntimePaddingType(TfLitePadding padding) {
@@ -77,6 +90,22 @@ inline PaddingType RuntimePaddingType(TfLitePadding padding) {
   }
 }
 
+ConvParams ConvParamsQuantized(const TfLiteConvParams& params,
+                               const OpData& data) {
+  ConvParams op_params;
+  op_params.input_offset = -data.input_zero_point;
+  op_params.output_offset = data.output_zero_point;
+  op_params.stride_height = params.stride_height;
+  op_params.stride_width = params.stride_width;
+  op_params.dilation_height_factor = params.dilation_height_factor;
+  op_params.dilation_width_factor = params.dilation_width_factor;
+  op_params.padding_values.height = data.padding.height;
+  op_params.padding_values.width = data.padding.width;
+  op_params.quantized_activation_min = data.output_activation_min;
+  op_params.quantized_activation_max = data.output_activation_max;
+  return op_params;
+}
+
 TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteNode* node,
                              const TfLiteConvParams* params, int width,
                              int height, int filter_width, int filter_height,
@@ -176,7 +205,37 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   data->filter_zero_point = filter->params.zero_point;
   data->output_zero_point = output->params.zero_point;
 
-  if (input->type == kTfLiteInt8) {
+  if (input->type == kTfLiteInt16) {
+    // 16x8 convolutions have symmetric activations and 64-bit biases.
+    TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+    TF_LITE_ENSURE_EQ(context, input->params.zero_point, 0);
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
+    const TfLiteTensor* bias =
+        GetOptionalInputTensor(context, node, kBiasTensor);
+    if (bias != nullptr) {
+      TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt64);
+    }
+  }
+
+  const bool use_m0plus =
+      kUseM0PlusKernels &&
+      m0plus::ConvPerChannelSupported(ConvParamsQuantized(*params, *data));
+  data->folded_bias = nullptr;
+  if (input->type == kTfLiteInt8 && use_m0plus) {
+    // The filter is constant, so its kernel sums can be folded into the bias
+    // once here if the model's packing budget allows.
+    data->folded_bias = static_cast<int32_t*>(
+        AllocatePackedBuffer(context, num_channels * sizeof(int32_t)));
+    if (data->folded_bias != nullptr) {
+      const TfLiteTensor* bias =
+          GetOptionalInputTensor(context, node, kBiasTensor);
+      m0plus::FoldInputOffset(
+          GetTensorData<int8_t>(filter), num_channels,
+          filter_dims.h * filter_dims.w * filter_dims.c,
+          GetTensorData<int32_t>(bias), -data->input_zero_point,
+          data->folded_bias);
+    }
+  } else if (input->type == kTfLiteInt8) {
     // Initialize cmsis-nn convolution parameters
     cmsis_nn_conv_params conv_params;
     conv_params.input_offset = -input->params.zero_point;
@@ -194,6 +253,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
         &conv_params, &input_dims, &filter_dims, &output_dims);
   }
 
+  // Only single-batch int8 convolutions are split, since a band of rows
+  // spanning several batches is not contiguous in the input.
+  MicroWorkers* workers = GetMicroWorkers(context);
+  data->use_workers =
+      workers != nullptr && input->type == kTfLiteInt8 && input_dims.n == 1;
+  data->buffer_size = buf_size;
+  if (data->use_workers) {
+    buf_size *= workers->num_workers();
+  }
+
   if (buf_size > 0) {
     TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
         context, buf_size, &data->buffer_idx));
@@ -243,14 +312,28 @@ TfLiteStatus EvalQuantized(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
-TfLiteStatus EvalQuantizedPerChannel(
-    TfLiteContext* context, TfLiteNode* node, TfLiteConvParams* params,
-    const OpData& data, const TfLiteEvalTensor* input,
-    const TfLiteEvalTensor* filter, const TfLiteEvalTensor* bias,
-    TfLiteEvalTensor* output, TfLiteEvalTensor* im2col) {
+// Computes an int8 per-channel convolution from explicit shapes and buffers,
+// so that each worker can run it on its own band of output rows. `buffer` is
+// the CMSIS-NN scratch buffer of the calling worker, if any.
+void EvalQuantizedPerChannelRows(
+    const TfLiteConvParams& params, const OpData& data,
+    const ConvParams& op_params, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data, void* buffer) {
+  if (kUseM0PlusKernels && m0plus::ConvPerChannelSupported(op_params)) {
+    m0plus::ConvPerChannel(op_params, data.per_channel_output_multiplier,
+                           data.per_channel_output_shift, input_shape,
+                           input_data, filter_shape, filter_data, bias_shape,
+                           bias_data, output_shape, output_data,
+                           data.folded_bias);
+    return;
+  }
+
   cmsis_nn_conv_params conv_params;
-  conv_params.dilation.h = params->dilation_height_factor;
-  conv_params.dilation.w = params->dilation_width_factor;
+  conv_params.dilation.h = params.dilation_height_factor;
+  conv_params.dilation.w = params.dilation_width_factor;
   // TODO(#43557) Remove checks for dilation and call to reference
   // implementation when dilation is supported in the optimized implementation
   // by CMSIS-NN.
@@ -258,10 +341,10 @@ TfLiteStatus EvalQuantizedPerChannel(
     // Initialize cmsis-nn convolution parameters
     conv_params.input_offset = -data.input_zero_point;
     conv_params.output_offset = data.output_zero_point;
-    conv_params.stride.h = params->stride_height;
-    conv_params.stride.w = params->stride_width;
-    conv_params.padding.h = data.padding.height;
-    conv_params.padding.w = data.padding.width;
+    conv_params.stride.h = params.stride_height;
+    conv_params.stride.w = params.stride_width;
+    conv_params.padding.h = op_params.padding_values.height;
+    conv_params.padding.w = op_params.padding_values.width;
     conv_params.activation.min = data.output_activation_min;
     conv_params.activation.max = data.output_activation_max;
 
@@ -271,11 +354,6 @@ TfLiteStatus EvalQuantizedPerChannel(
         const_cast<int32_t*>(data.per_channel_output_multiplier);
     quant_params.shift = const_cast<int32_t*>(data.per_channel_output_shift);
 
-    RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
-    RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
-    RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
-    RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
-
     // Consistency check.
     TFLITE_DCHECK_LE(conv_params.activation.min, conv_params.activation.max);
     TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
@@ -284,7 +362,7 @@ TfLiteStatus EvalQuantizedPerChannel(
     const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
     const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
     const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-    if (tflite::micro::GetTensorData<int8_t>(bias)) {
+    if (bias_data) {
       TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
     }
 
@@ -318,51 +396,138 @@ TfLiteStatus EvalQuantizedPerChannel(
     output_dims.c = output_depth;
 
     // Initialize cmsis-nn context
+    // Note: ctx.size is currently not used in cmsis-nn.
+    // The buffer should be allocated in the Prepare function through
+    // arm_convolve_wrapper_s8_get_buffer_size
     cmsis_nn_context ctx;
-    ctx.buf = nullptr;
+    ctx.buf = buffer;
     ctx.size = 0;
 
-    if (data.buffer_idx > -1) {
-      ctx.buf = context->GetScratchBuffer(context, data.buffer_idx);
-      // Note: ctx.size is currently not used in cmsis-nn.
-      // The buffer should be allocated in the Prepare function through
-      // arm_convolve_wrapper_s8_get_buffer_size
-    }
-
     // arm_convolve_wrapper_s8 dispatches the optimized kernel accordingly with
     // the parameters passed
     TFLITE_DCHECK_EQ(
-        arm_convolve_wrapper_s8(
-            &ctx, &conv_params, &quant_params, &input_dims,
-            tflite::micro::GetTensorData<int8_t>(input), &filter_dims,
-            tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
-            tflite::micro::GetTensorData<int32_t>(bias), &output_dims,
-            tflite::micro::GetTensorData<int8_t>(output)),
+        arm_convolve_wrapper_s8(&ctx, &conv_params, &quant_params, &input_dims,
+                                input_data, &filter_dims, filter_data,
+                                &bias_dims, bias_data, &output_dims,
+                                output_data),
         ARM_MATH_SUCCESS);
   } else {
-    // TODO(b/154032858): Investigate removing extra copies.
-    ConvParams op_params;
-    op_params.input_offset = -data.input_zero_point;
-    op_params.output_offset = data.output_zero_point;
-    op_params.stride_height = params->stride_height;
-    op_params.stride_width = params->stride_width;
-    op_params.dilation_height_factor = params->dilation_height_factor;
-    op_params.dilation_width_factor = params->dilation_width_factor;
-    op_params.padding_values.height = data.padding.height;
-    op_params.padding_values.width = data.padding.width;
-    op_params.quantized_activation_min = data.output_activation_min;
-    op_params.quantized_activation_max = data.output_activation_max;
+    reference_integer_ops::ConvPerChannel(
+        op_params, data.per_channel_output_multiplier,
+        data.per_channel_output_shift, input_shape, input_data, filter_shape,
+        filter_data, bias_shape, bias_data, output_shape, output_data);
+  }
+}
+
+// A convolution shared between workers, each computing a band of output rows.
+struct ConvTask {
+  const TfLiteConvParams* params;
+  const OpData* data;
+  const TfLiteEvalTensor* input;
+  const TfLiteEvalTensor* filter;
+  const TfLiteEvalTensor* bias;
+  TfLiteEvalTensor* output;
+  uint8_t* buffer;
+};
 
+void RunConvTask(void* task_data, int worker, int num_workers) {
+  const ConvTask& task = *static_cast<const ConvTask*>(task_data);
+  RuntimeShape input_shape = tflite::micro::GetTensorShape(task.input);
+  RuntimeShape output_shape = tflite::micro::GetTensorShape(task.output);
+  const RuntimeShape filter_shape = tflite::micro::GetTensorShape(task.filter);
+
+  int row_begin;
+  int row_end;
+  GetWorkerRange(output_shape.Dims(1), worker, num_workers, &row_begin,
+                 &row_end);
+  if (row_begin == row_end) {
+    return;
+  }
+
+  ConvParams op_params = ConvParamsQuantized(*task.params, *task.data);
+  const micro::RowSlice slice = micro::SliceWindowRows(
+      row_begin, row_end, op_params.stride_height,
+      op_params.dilation_height_factor, filter_shape.Dims(1),
+      op_params.padding_values.height, input_shape.Dims(1));
+  op_params.padding_values.height = slice.pad_height;
+  const int input_row_size = input_shape.Dims(2) * input_shape.Dims(3);
+  const int output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+  input_shape.SetDim(1, slice.input_rows);
+  output_shape.SetDim(1, row_end - row_begin);
+
+  EvalQuantizedPerChannelRows(
+      *task.params, *task.data, op_params, input_shape,
+      tflite::micro::GetTensorData<int8_t>(task.input) +
+          slice.input_row * input_row_size,
+      filter_shape, tflite::micro::GetTensorData<int8_t>(task.filter),
+      tflite::micro::GetTensorShape(task.bias),
+      tflite::micro::GetTensorData<int32_t>(task.bias), output_shape,
+      tflite::micro::GetTensorData<int8_t>(task.output) +
+          row_begin * output_row_size,
+      task.buffer != nullptr ? task.buffer + worker * task.data->buffer_size
+                             : nullptr);
+}
+
+TfLiteStatus EvalQuantizedPerChannel(
+    TfLiteContext* context, TfLiteNode* node, TfLiteConvParams* params,
+    const OpData& data, const TfLiteEvalTensor* input,
+    const TfLiteEvalTensor* filter, const TfLiteEvalTensor* bias,
+    TfLiteEvalTensor* output, TfLiteEvalTensor* im2col) {
+  uint8_t* buffer = nullptr;
+  if (data.buffer_idx > -1) {
+    buffer = static_cast<uint8_t*>(
+        context->GetScratchBuffer(context, data.buffer_idx));
+  }
+
+  if (data.use_workers) {
+    ConvTask task = {params, &data, input, filter, bias, output, buffer};
+    GetMicroWorkers(context)->Run(RunConvTask, &task);
+    return kTfLiteOk;
+  }
+
+  EvalQuantizedPerChannelRows(
+      *params, data, ConvParamsQuantized(*params, data),
+      tflite::micro::GetTensorShape(input),
+      tflite::micro::GetTensorData<int8_t>(input),
+      tflite::micro::GetTensorShape(filter),
+      tflite::micro::GetTensorData<int8_t>(filter),
+      tflite::micro::GetTensorShape(bias),
+      tflite::micro::GetTensorData<int32_t>(bias),
+      tflite::micro::GetTensorShape(output),
+      tflite::micro::GetTensorData<int8_t>(output), buffer);
+  return kTfLiteOk;
+}
+
+TfLiteStatus EvalQuantizedPerChannel16x8(
+    TfLiteContext* context, TfLiteNode* node, TfLiteConvParams* params,
+    const OpData& data, const TfLiteEvalTensor* input,
+    const TfLiteEvalTensor* filter, const TfLiteEvalTensor* bias,
+    TfLiteEvalTensor* output) {
+  const ConvParams op_params = ConvParamsQuantized(*params, data);
+  // CMSIS-NN has no 16-bit convolutions, so targets with the DSP extension
+  // use the reference kernel.
+  if (kUseM0PlusKernels && m0plus::ConvPerChannelSupported(op_params)) {
+    m0plus::ConvPerChannel(op_params, data.per_channel_output_multiplier,
+                           data.per_channel_output_shift,
+                           tflite::micro::GetTensorShape(input),
+                           tflite::micro::GetTensorData<int16_t>(input),
+                           tflite::micro::GetTensorShape(filter),
+                           tflite::micro::GetTensorData<int8_t>(filter),
+                           tflite::micro::GetTensorShape(bias),
+                           tflite::micro::GetTensorData<int64_t>(bias),
+                           tflite::micro::GetTensorShape(output),
+                           tflite::micro::GetTensorData<int16_t>(output));
+  } else {
     reference_integer_ops::ConvPerChannel(
         op_params, data.per_channel_output_multiplier,
         data.per_channel_output_shift, tflite::micro::GetTensorShape(input),
-        tflite::micro::GetTensorData<int8_t>(input),
+        tflite::micro::GetTensorData<int16_t>(input),
         tflite::micro::GetTensorShape(filter),
         tflite::micro::GetTensorData<int8_t>(filter),
         tflite::micro::GetTensorShape(bias),
-        tflite::micro::GetTensorData<int32_t>(bias),
+        tflite::micro::GetTensorData<int64_t>(bias),
         tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int8_t>(output));
+        tflite::micro::GetTensorData<int16_t>(output));
   }
   return kTfLiteOk;
 }
@@ -420,8 +585,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const OpData& data = *(static_cast<const OpData*>(node->user_data));
 
   TF_LITE_ENSURE_EQ(context, input->type, output->type);
-  TF_LITE_ENSURE_MSG(context, input->type == filter->type,
-                     "Hybrid models are not supported on TFLite Micro.");
+  TF_LITE_ENSURE_MSG(
+      context,
+      input->type == filter->type ||
+          (input->type == kTfLiteInt16 && filter->type == kTfLiteInt8),
+      "Hybrid models are not supported on TFLite Micro.");
 
   switch (input->type) {  // Already know in/out types are same.
     case kTfLiteFloat32:
@@ -432,6 +600,9 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       return EvalQuantizedPerChannel(context, node, params, data, input, filter,
                                      bias, output, nullptr);
       break;
+    case kTfLiteInt16:
+      return EvalQuantizedPerChannel16x8(context, node, params, data, input,
+                                         filter, bias, output);
     case kTfLiteUInt8:
       return EvalQuantized(context, node, params, data, input, filter, bias,
                            nullptr, nullptr, output);
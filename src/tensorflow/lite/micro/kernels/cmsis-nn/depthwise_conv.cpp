@@ -26,6 +26,9 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/depthwise_conv.h"
+#include "tensorflow/lite/micro/micro_workers.h"
 
 namespace tflite {
 namespace {
@@ -62,8 +65,33 @@ struct OpData {
   int32_t output_activation_max;
   // Index to buffer for optimizations if applicable.
   int buffer_idx;
+
+  // Whether output rows are split between the interpreter's workers. The
+  // buffer then holds one scratch area of `buffer_size` bytes per worker.
+  bool use_workers;
+  int32_t buffer_size;
 };
 
+DepthwiseParams DepthwiseParamsQuantized(
+    const TfLiteDepthwiseConvParams& params, const OpData& data) {
+  DepthwiseParams op_params;
+  op_params.padding_type = PaddingType::kSame;
+  op_params.padding_values.width = data.padding.width;
+  op_params.padding_values.height = data.padding.height;
+  op_params.stride_width = params.stride_width;
+  op_params.stride_height = params.stride_height;
+  op_params.dilation_width_factor = params.dilation_width_factor;
+  op_params.dilation_height_factor = params.dilation_height_factor;
+  op_params.depth_multiplier = params.depth_multiplier;
+  op_params.input_offset = -data.input_zero_point;
+  op_params.weights_offset = 0;
+  op_params.output_offset = data.output_zero_point;
+  // TODO(b/130439627): Use calculated value for clamping.
+  op_params.quantized_activation_min = std::numeric_limits<int8_t>::min();
+  op_params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+  return op_params;
+}
+
 TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteNode* node,
                              TfLiteDepthwiseConvParams* params, int width,
                              int height, int filter_width, int filter_height,
@@ -161,7 +189,30 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   data->filter_zero_point = filter->params.zero_point;
   data->output_zero_point = output->params.zero_point;
 
-  if (input->type == kTfLiteInt8) {
+  if (input->type == kTfLiteInt16) {
+    // 16x8 convolutions have symmetric activations and 64-bit biases.
+    TF_LITE_ENSURE_TYPES_EQ(context, filter->type, kTfLiteInt8);
+    TF_LITE_ENSURE_EQ(context, input->params.zero_point, 0);
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
+    const TfLiteTensor* bias =
+        GetOptionalInputTensor(context, node, kBiasTensor);
+    if (bias != nullptr) {
+      TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt64);
+    }
+  }
+
+  // Only single-batch int8 convolutions are split, since a band of rows
+  // spanning several batches is not contiguous in the input.
+  MicroWorkers* workers = GetMicroWorkers(context);
+  data->use_workers = workers != nullptr && input->type == kTfLiteInt8 &&
+                      SizeOfDimension(input, 0) == 1;
+  data->buffer_size = 0;
+
+  const bool use_m0plus =
+      kUseM0PlusKernels &&
+      m0plus::DepthwiseConvPerChannelSupported(
+          DepthwiseParamsQuantized(*params, *data), GetTensorShape(filter));
+  if (input->type == kTfLiteInt8 && !use_m0plus) {
     RuntimeShape input_shape = GetTensorShape(input);
     RuntimeShape output_shape = GetTensorShape(output);
     RuntimeShape filter_shape = GetTensorShape(filter);
@@ -195,8 +246,12 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     dw_conv_params.padding.h = data->padding.height;
     dw_conv_params.padding.w = data->padding.width;
 
-    const int32_t buf_size = arm_depthwise_conv_wrapper_s8_get_buffer_size(
+    int32_t buf_size = arm_depthwise_conv_wrapper_s8_get_buffer_size(
         &dw_conv_params, &input_dims, &filter_dims, &output_dims);
+    data->buffer_size = buf_size;
+    if (data->use_workers) {
+      buf_size *= workers->num_workers();
+    }
 
     if (buf_size > 0) {
       TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
@@ -240,37 +295,45 @@ void EvalFloat(TfLiteContext* context, TfLiteNode* node,
       tflite::micro::GetTensorData<float>(output));
 }
 
-void EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
-                             TfLiteDepthwiseConvParams* params, OpData* data,
-                             const TfLiteEvalTensor* input,
-                             const TfLiteEvalTensor* filter,
-                             const TfLiteEvalTensor* bias,
-                             TfLiteEvalTensor* output) {
+// Computes an int8 per-channel depthwise convolution from explicit shapes and
+// buffers, so that each worker can run it on its own band of output rows.
+// `buffer` is the CMSIS-NN scratch buffer of the calling worker, if any.
+void EvalQuantizedPerChannelRows(
+    const TfLiteDepthwiseConvParams& params, const OpData& data,
+    const DepthwiseParams& op_params, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data, void* buffer) {
+  if (kUseM0PlusKernels &&
+      m0plus::DepthwiseConvPerChannelSupported(op_params, filter_shape)) {
+    m0plus::DepthwiseConvPerChannel(
+        op_params, data.per_channel_output_multiplier,
+        data.per_channel_output_shift, input_shape, input_data, filter_shape,
+        filter_data, bias_shape, bias_data, output_shape, output_data);
+    return;
+  }
+
   cmsis_nn_dw_conv_params dw_conv_params;
-  dw_conv_params.dilation.h = params->dilation_height_factor;
-  dw_conv_params.dilation.w = params->dilation_width_factor;
+  dw_conv_params.dilation.h = params.dilation_height_factor;
+  dw_conv_params.dilation.w = params.dilation_width_factor;
   // Call to reference implementation can be removed when dilation is supported
   // in the optimized implementations.
   if (1 == dw_conv_params.dilation.h && 1 == dw_conv_params.dilation.w) {
-    dw_conv_params.input_offset = -data->input_zero_point;
-    dw_conv_params.output_offset = data->output_zero_point;
-    dw_conv_params.stride.h = params->stride_height;
-    dw_conv_params.stride.w = params->stride_width;
-    dw_conv_params.padding.h = data->padding.height;
-    dw_conv_params.padding.w = data->padding.width;
+    dw_conv_params.input_offset = -data.input_zero_point;
+    dw_conv_params.output_offset = data.output_zero_point;
+    dw_conv_params.stride.h = params.stride_height;
+    dw_conv_params.stride.w = params.stride_width;
+    dw_conv_params.padding.h = op_params.padding_values.height;
+    dw_conv_params.padding.w = op_params.padding_values.width;
     // TODO(b/130439627): Use calculated value for clamping.
     dw_conv_params.activation.min = std::numeric_limits<int8_t>::min();
     dw_conv_params.activation.max = std::numeric_limits<int8_t>::max();
-    dw_conv_params.ch_mult = params->depth_multiplier;
+    dw_conv_params.ch_mult = params.depth_multiplier;
 
     cmsis_nn_per_channel_quant_params quant_params;
-    quant_params.multiplier = data->per_channel_output_multiplier;
-    quant_params.shift = data->per_channel_output_shift;
-
-    RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
-    RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
-    RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
-    RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
+    quant_params.multiplier = data.per_channel_output_multiplier;
+    quant_params.shift = data.per_channel_output_shift;
 
     TFLITE_DCHECK_LE(dw_conv_params.activation.min,
                      dw_conv_params.activation.max);
@@ -278,7 +341,7 @@ void EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
     const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
     const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
 
-    if (tflite::micro::GetTensorData<int8_t>(bias)) {
+    if (bias_data) {
       TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
     }
 
@@ -307,49 +370,141 @@ void EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
     output_dims.c = output_depth;
 
     cmsis_nn_context ctx;
-    ctx.buf = nullptr;
+    ctx.buf = buffer;
     /* 'size' is unused */
     ctx.size = 0;
 
-    if (data->buffer_idx > -1) {
-      ctx.buf = context->GetScratchBuffer(context, data->buffer_idx);
-    }
-
     TFLITE_DCHECK_EQ(
-        arm_depthwise_conv_wrapper_s8(
-            &ctx, &dw_conv_params, &quant_params, &input_dims,
-            tflite::micro::GetTensorData<int8_t>(input), &filter_dims,
-            tflite::micro::GetTensorData<int8_t>(filter), &bias_dims,
-            tflite::micro::GetTensorData<int32_t>(bias), &output_dims,
-            tflite::micro::GetTensorData<int8_t>(output)),
+        arm_depthwise_conv_wrapper_s8(&ctx, &dw_conv_params, &quant_params,
+                                      &input_dims, input_data, &filter_dims,
+                                      filter_data, &bias_dims, bias_data,
+                                      &output_dims, output_data),
         ARM_MATH_SUCCESS);
   } else {
-    DepthwiseParams op_params;
-    op_params.padding_type = PaddingType::kSame;
-    op_params.padding_values.width = data->padding.width;
-    op_params.padding_values.height = data->padding.height;
-    op_params.stride_width = params->stride_width;
-    op_params.stride_height = params->stride_height;
-    op_params.dilation_width_factor = params->dilation_width_factor;
-    op_params.dilation_height_factor = params->dilation_height_factor;
-    op_params.depth_multiplier = params->depth_multiplier;
-    op_params.input_offset = -data->input_zero_point;
-    op_params.weights_offset = 0;
-    op_params.output_offset = data->output_zero_point;
-    // TODO(b/130439627): Use calculated value for clamping.
-    op_params.quantized_activation_min = std::numeric_limits<int8_t>::min();
-    op_params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+    reference_integer_ops::DepthwiseConvPerChannel(
+        op_params, data.per_channel_output_multiplier,
+        data.per_channel_output_shift, input_shape, input_data, filter_shape,
+        filter_data, bias_shape, bias_data, output_shape, output_data);
+  }
+}
 
+// A depthwise convolution shared between workers, each computing a band of
+// output rows.
+struct DepthwiseConvTask {
+  const TfLiteDepthwiseConvParams* params;
+  const OpData* data;
+  const TfLiteEvalTensor* input;
+  const TfLiteEvalTensor* filter;
+  const TfLiteEvalTensor* bias;
+  TfLiteEvalTensor* output;
+  uint8_t* buffer;
+};
+
+void RunDepthwiseConvTask(void* task_data, int worker, int num_workers) {
+  const DepthwiseConvTask& task =
+      *static_cast<const DepthwiseConvTask*>(task_data);
+  RuntimeShape input_shape = tflite::micro::GetTensorShape(task.input);
+  RuntimeShape output_shape = tflite::micro::GetTensorShape(task.output);
+  const RuntimeShape filter_shape = tflite::micro::GetTensorShape(task.filter);
+
+  int row_begin;
+  int row_end;
+  GetWorkerRange(output_shape.Dims(1), worker, num_workers, &row_begin,
+                 &row_end);
+  if (row_begin == row_end) {
+    return;
+  }
+
+  DepthwiseParams op_params =
+      DepthwiseParamsQuantized(*task.params, *task.data);
+  const micro::RowSlice slice = micro::SliceWindowRows(
+      row_begin, row_end, op_params.stride_height,
+      op_params.dilation_height_factor, filter_shape.Dims(1),
+      op_params.padding_values.height, input_shape.Dims(1));
+  op_params.padding_values.height = slice.pad_height;
+  const int input_row_size = input_shape.Dims(2) * input_shape.Dims(3);
+  const int output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+  input_shape.SetDim(1, slice.input_rows);
+  output_shape.SetDim(1, row_end - row_begin);
+
+  EvalQuantizedPerChannelRows(
+      *task.params, *task.data, op_params, input_shape,
+      tflite::micro::GetTensorData<int8_t>(task.input) +
+          slice.input_row * input_row_size,
+      filter_shape, tflite::micro::GetTensorData<int8_t>(task.filter),
+      tflite::micro::GetTensorShape(task.bias),
+      tflite::micro::GetTensorData<int32_t>(task.bias), output_shape,
+      tflite::micro::GetTensorData<int8_t>(task.output) +
+          row_begin * output_row_size,
+      task.buffer != nullptr ? task.buffer + worker * task.data->buffer_size
+                             : nullptr);
+}
+
+void EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
+                             TfLiteDepthwiseConvParams* params, OpData* data,
+                             const TfLiteEvalTensor* input,
+                             const TfLiteEvalTensor* filter,
+                             const TfLiteEvalTensor* bias,
+                             TfLiteEvalTensor* output) {
+  uint8_t* buffer = nullptr;
+  if (data->buffer_idx > -1) {
+    buffer = static_cast<uint8_t*>(
+        context->GetScratchBuffer(context, data->buffer_idx));
+  }
+
+  if (data->use_workers) {
+    DepthwiseConvTask task = {params, data, input, filter, bias, output,
+                              buffer};
+    GetMicroWorkers(context)->Run(RunDepthwiseConvTask, &task);
+    return;
+  }
+
+  EvalQuantizedPerChannelRows(
+      *params, *data, DepthwiseParamsQuantized(*params, *data),
+      tflite::micro::GetTensorShape(input),
+      tflite::micro::GetTensorData<int8_t>(input),
+      tflite::micro::GetTensorShape(filter),
+      tflite::micro::GetTensorData<int8_t>(filter),
+      tflite::micro::GetTensorShape(bias),
+      tflite::micro::GetTensorData<int32_t>(bias),
+      tflite::micro::GetTensorShape(output),
+      tflite::micro::GetTensorData<int8_t>(output), buffer);
+}
+
+void EvalQuantizedPerChannel16x8(TfLiteContext* context, TfLiteNode* node,
+                                 TfLiteDepthwiseConvParams* params,
+                                 const OpData* data,
+                                 const TfLiteEvalTensor* input,
+                                 const TfLiteEvalTensor* filter,
+                                 const TfLiteEvalTensor* bias,
+                                 TfLiteEvalTensor* output) {
+  DepthwiseParams op_params = DepthwiseParamsQuantized(*params, *data);
+  op_params.quantized_activation_min = data->output_activation_min;
+  op_params.quantized_activation_max = data->output_activation_max;
+  const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  // CMSIS-NN has no 16-bit depthwise convolutions, so targets with the DSP
+  // extension and other filter sizes use the reference kernel.
+  if (kUseM0PlusKernels &&
+      m0plus::DepthwiseConvPerChannelSupported(op_params, filter_shape)) {
+    m0plus::DepthwiseConvPerChannel(
+        op_params, data->per_channel_output_multiplier,
+        data->per_channel_output_shift, tflite::micro::GetTensorShape(input),
+        tflite::micro::GetTensorData<int16_t>(input), filter_shape,
+        tflite::micro::GetTensorData<int8_t>(filter),
+        tflite::micro::GetTensorShape(bias),
+        tflite::micro::GetTensorData<int64_t>(bias),
+        tflite::micro::GetTensorShape(output),
+        tflite::micro::GetTensorData<int16_t>(output));
+  } else {
     reference_integer_ops::DepthwiseConvPerChannel(
         op_params, data->per_channel_output_multiplier,
         data->per_channel_output_shift, tflite::micro::GetTensorShape(input),
-        tflite::micro::GetTensorData<int8_t>(input),
-        tflite::micro::GetTensorShape(filter),
+        tflite::micro::GetTensorData<int16_t>(input), filter_shape,
         tflite::micro::GetTensorData<int8_t>(filter),
         tflite::micro::GetTensorShape(bias),
-        tflite::micro::GetTensorData<int32_t>(bias),
+        tflite::micro::GetTensorData<int64_t>(bias),
         tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int8_t>(output));
+        tflite::micro::GetTensorData<int16_t>(output));
   }
 }
 
@@ -448,6 +603,10 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       EvalQuantizedPerChannel(context, node, params, &data, input, filter, bias,
                               output);
       break;
+    case kTfLiteInt16:
+      EvalQuantizedPerChannel16x8(context, node, params, &data, input, filter,
+                                  bias, output);
+      break;
     case kTfLiteUInt8:
       EvalQuantized(context, node, params, &data, input, filter, bias, output);
       break;
@@ -25,6 +25,9 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/fully_connected.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/fully_connected.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 
 namespace tflite {
 namespace {
@@ -47,6 +50,10 @@ struct OpData {
   int32_t input_zero_point;
   int32_t filter_zero_point;
   int32_t output_zero_point;
+
+  // Per-channel bias + input_offset * weight row sum, computed in Prepare if
+  // it fit in the weight packing budget, or nullptr.
+  int32_t* folded_bias;
 };
 
 constexpr int kInputTensor = 0;
@@ -59,6 +66,19 @@ constexpr int kOutputTensor = 0;
 // Register_FULLY_CONNECTED).
 TfLiteRegistration fully_connected_registration;
 
+FullyConnectedParams FullyConnectedParamsQuantized(const OpData& data) {
+  FullyConnectedParams op_params;
+  op_params.input_offset = -data.input_zero_point;
+  op_params.weights_offset = -data.filter_zero_point;
+  op_params.output_offset = data.output_zero_point;
+  op_params.output_multiplier = data.output_multiplier;
+  // TODO(b/138810107): Figure out whether output shift should be inverted
+  op_params.output_shift = -data.output_shift;
+  op_params.quantized_activation_min = data.output_activation_min;
+  op_params.quantized_activation_max = data.output_activation_max;
+  return op_params;
+}
+
 TfLiteStatus CalculateOpData(TfLiteContext* context,
                              TfLiteFusedActivation activation,
                              TfLiteType data_type, const TfLiteTensor* input,
@@ -103,13 +123,43 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteTensor* bias = GetOptionalInputTensor(context, node, kBiasTensor);
   TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
   TF_LITE_ENSURE_TYPES_EQ(context, input->type, output->type);
-  TF_LITE_ENSURE_MSG(context, input->type == filter->type,
-                     "Hybrid models are not supported on TFLite Micro.");
+  TF_LITE_ENSURE_MSG(
+      context,
+      input->type == filter->type ||
+          (input->type == kTfLiteInt16 && filter->type == kTfLiteInt8),
+      "Hybrid models are not supported on TFLite Micro.");
   TF_LITE_ENSURE_STATUS(CalculateOpData(context, params->activation,
                                         input->type, input, filter, bias,
                                         output, data));
-
-  if (input->type == kTfLiteInt8 && nullptr != GetTensorData<int32_t>(bias)) {
+  if (input->type == kTfLiteInt16) {
+    // 16x8 layers have symmetric activations and 64-bit biases.
+    TF_LITE_ENSURE_EQ(context, input->params.zero_point, 0);
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
+    if (bias != nullptr) {
+      TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt64);
+    }
+  }
+  data->folded_bias = nullptr;
+
+  const bool use_m0plus =
+      kUseM0PlusKernels && input->type == kTfLiteInt8 &&
+      m0plus::FullyConnectedSupported(FullyConnectedParamsQuantized(*data));
+  if (use_m0plus) {
+    // The weights are constant, so their row sums can be folded into the bias
+    // once here if the model's packing budget allows.
+    const RuntimeShape filter_shape = GetTensorShape(filter);
+    const int filter_dim_count = filter_shape.DimensionsCount();
+    const int output_depth = filter_shape.Dims(filter_dim_count - 2);
+    const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+    data->folded_bias = static_cast<int32_t*>(
+        AllocatePackedBuffer(context, output_depth * sizeof(int32_t)));
+    if (data->folded_bias != nullptr) {
+      m0plus::FoldInputOffset(GetTensorData<int8_t>(filter), output_depth,
+                              accum_depth, GetTensorData<int32_t>(bias),
+                              -data->input_zero_point, data->folded_bias);
+    }
+  } else if (input->type == kTfLiteInt8 &&
+             nullptr != GetTensorData<int32_t>(bias)) {
     RuntimeShape filter_shape = GetTensorShape(filter);
     RuntimeShape output_shape = GetTensorShape(output);
 
@@ -140,6 +190,20 @@ TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
                                const TfLiteEvalTensor* filter,
                                const TfLiteEvalTensor* bias,
                                TfLiteEvalTensor* output) {
+  const FullyConnectedParams op_params = FullyConnectedParamsQuantized(data);
+  if (kUseM0PlusKernels && m0plus::FullyConnectedSupported(op_params)) {
+    m0plus::FullyConnected(op_params, tflite::micro::GetTensorShape(input),
+                           tflite::micro::GetTensorData<int8_t>(input),
+                           tflite::micro::GetTensorShape(filter),
+                           tflite::micro::GetTensorData<int8_t>(filter),
+                           tflite::micro::GetTensorShape(bias),
+                           tflite::micro::GetTensorData<int32_t>(bias),
+                           tflite::micro::GetTensorShape(output),
+                           tflite::micro::GetTensorData<int8_t>(output),
+                           data.folded_bias);
+    return kTfLiteOk;
+  }
+
   // The 'if' condition can be removed when null handling of bias is added to
   // arm_fully_connected_s8
   if (nullptr != tflite::micro::GetTensorData<int32_t>(bias)) {
@@ -206,16 +270,6 @@ TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
             tflite::micro::GetTensorData<int8_t>(output)),
         ARM_MATH_SUCCESS);
   } else {
-    tflite::FullyConnectedParams op_params;
-    op_params.input_offset = -data.input_zero_point;
-    op_params.weights_offset = -data.filter_zero_point;
-    op_params.output_offset = data.output_zero_point;
-    op_params.output_multiplier = data.output_multiplier;
-    // TODO(b/138810107): Figure out whether output shift should be inverted
-    op_params.output_shift = -data.output_shift;
-    op_params.quantized_activation_min = data.output_activation_min;
-    op_params.quantized_activation_max = data.output_activation_max;
-
     reference_integer_ops::FullyConnected(
         op_params, tflite::micro::GetTensorShape(input),
         tflite::micro::GetTensorData<int8_t>(input),
@@ -274,6 +328,38 @@ TfLiteStatus EvalQuantized(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
+TfLiteStatus EvalQuantized16x8(TfLiteContext* context, TfLiteNode* node,
+                               const OpData& data,
+                               const TfLiteEvalTensor* input,
+                               const TfLiteEvalTensor* filter,
+                               const TfLiteEvalTensor* bias,
+                               TfLiteEvalTensor* output) {
+  const FullyConnectedParams op_params = FullyConnectedParamsQuantized(data);
+  // CMSIS-NN has no 16-bit fully connected layers, so targets with the DSP
+  // extension use the reference kernel.
+  if (kUseM0PlusKernels && m0plus::FullyConnectedSupported(op_params)) {
+    m0plus::FullyConnected(op_params, tflite::micro::GetTensorShape(input),
+                           tflite::micro::GetTensorData<int16_t>(input),
+                           tflite::micro::GetTensorShape(filter),
+                           tflite::micro::GetTensorData<int8_t>(filter),
+                           tflite::micro::GetTensorShape(bias),
+                           tflite::micro::GetTensorData<int64_t>(bias),
+                           tflite::micro::GetTensorShape(output),
+                           tflite::micro::GetTensorData<int16_t>(output));
+  } else {
+    reference_integer_ops::FullyConnected(
+        op_params, tflite::micro::GetTensorShape(input),
+        tflite::micro::GetTensorData<int16_t>(input),
+        tflite::micro::GetTensorShape(filter),
+        tflite::micro::GetTensorData<int8_t>(filter),
+        tflite::micro::GetTensorShape(bias),
+        tflite::micro::GetTensorData<int64_t>(bias),
+        tflite::micro::GetTensorShape(output),
+        tflite::micro::GetTensorData<int16_t>(output));
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus EvalFloat(TfLiteContext* context, TfLiteNode* node,
                        TfLiteFusedActivation activation,
                        const TfLiteEvalTensor* input,
@@ -326,6 +412,10 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteUInt8:
       return EvalQuantized(context, node, data, input, filter, bias, output);
 
+    case kTfLiteInt16:
+      return EvalQuantized16x8(context, node, data, input, filter, bias,
+                               output);
+
     default:
       TF_LITE_KERNEL_LOG(context, "Type %s (%d) not supported.",
                          TfLiteTypeGetName(input->type), input->type);
@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
 
 namespace tflite {
@@ -96,6 +97,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   data->output_zero_point = output->params.zero_point;
   CalculateOpData(context, node, params, data);
 
+  // Each output element only reads the input elements at the same position,
+  // so the output can overwrite an input that was not broadcast.
+  if (HaveSameShapes(input1, output)) {
+    TF_LITE_ENSURE_STATUS(
+        RequestInPlaceOutput(context, node, kInput1Tensor, kOutputTensor));
+  }
+  if (HaveSameShapes(input2, output)) {
+    TF_LITE_ENSURE_STATUS(
+        RequestInPlaceOutput(context, node, kInput2Tensor, kOutputTensor));
+  }
   return kTfLiteOk;
 }
 
@@ -23,6 +23,8 @@ limitations under the License.
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/op_macros.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
+#include "tensorflow/lite/micro/kernels/m0plus/softmax.h"
 
 namespace tflite {
 namespace {
@@ -139,6 +141,13 @@ TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node) {
     op_data->scale = output->params.scale;
   }
 
+  // Each output element only depends on the input element at the same
+  // position and on statistics gathered over its row before any output of
+  // the row is written, so the output can overwrite an input of the same type.
+  if (input->type == output->type) {
+    TF_LITE_ENSURE_STATUS(RequestInPlaceOutput(context, node, 0, 0));
+  }
+
   auto* params = static_cast<TfLiteSoftmaxParams*>(node->builtin_data);
   return CalculateSoftmaxParams(context, input, output, params, op_data);
 }
@@ -176,10 +185,19 @@ void SoftmaxQuantized(const TfLiteEvalTensor* input, TfLiteEvalTensor* output,
       const int depth =
           MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
 
-      arm_softmax_s8(tflite::micro::GetTensorData<int8_t>(input), outer_size,
-                     depth, op_data.input_multiplier, op_data.input_left_shift,
-                     op_data.diff_min,
-                     tflite::micro::GetTensorData<int8_t>(output));
+      if (depth == 2) {
+        // Two-class heads, such as the person detection model's, need one
+        // exponential per row instead of four.
+        m0plus::SoftmaxTwoClass(tflite::micro::GetTensorData<int8_t>(input),
+                                outer_size, op_data.input_multiplier,
+                                op_data.input_left_shift, op_data.diff_min,
+                                tflite::micro::GetTensorData<int8_t>(output));
+      } else {
+        arm_softmax_s8(tflite::micro::GetTensorData<int8_t>(input),
+                       outer_size, depth, op_data.input_multiplier,
+                       op_data.input_left_shift, op_data.diff_min,
+                       tflite::micro::GetTensorData<int8_t>(output));
+      }
     }
   } else {
     tflite::reference_ops::SoftmaxInt16(
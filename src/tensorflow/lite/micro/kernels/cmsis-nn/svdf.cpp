@@ -13,11 +13,13 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 
 #include "CMSIS/NN/Include/arm_nn_types.h"
 #include "CMSIS/NN/Include/arm_nnfunctions.h"
+#include "CMSIS/NN/Include/arm_nnsupportfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
@@ -45,6 +47,11 @@ struct OpData {
   // Cached tensor zero point values for quantized operations.
   int input_zero_point;
   int output_zero_point;
+
+  // Position of the oldest entry in every memory_size row of the activation
+  // state. The rows are rings, so each invocation overwrites the oldest entry
+  // and advances the head instead of shifting the whole state.
+  int state_head;
 };
 
 // Input tensors.
@@ -67,10 +74,31 @@ constexpr int kOutputTensor = 0;
  * 2.) Output dimensions - the TFLite version determines output size and runtime
  * and resizes the output tensor. Micro runtime does not support tensor
  * resizing.
+ * 3.) Activation state - each memory_size row of the state is a ring whose
+ * oldest entry is at OpData::state_head, rather than being shifted left by one
+ * entry on every invocation. The outputs are the same.
  */
+
+// Returns the dot product of `weights` with a ring of `memory_size` state
+// entries whose oldest entry is at `head`. The products are summed oldest
+// first, in the same order as over a shifted state row.
+template <typename T, typename AccumT>
+inline AccumT DotStateRing(const T* weights, const T* state_row,
+                           int memory_size, int head) {
+  AccumT sum = 0;
+  const int wrap = memory_size - head;
+  for (int j = 0; j < wrap; ++j) {
+    sum += weights[j] * state_row[head + j];
+  }
+  for (int j = wrap; j < memory_size; ++j) {
+    sum += weights[j] * state_row[j - wrap];
+  }
+  return sum;
+}
+
 static inline void ApplyTimeWeightsBiasAndActivation(
     int batch_size, int memory_size, int num_filters, int num_units, int rank,
-    const float* const __restrict__ weights_time_ptr,
+    int state_head, const float* const __restrict__ weights_time_ptr,
     const float* const __restrict__ bias_ptr, TfLiteFusedActivation activation,
     float* const __restrict__ state_ptr, float* const __restrict__ scratch_ptr,
     float* const __restrict__ output_ptr) {
@@ -81,11 +109,10 @@ static inline void ApplyTimeWeightsBiasAndActivation(
     const float* vector1_ptr = weights_time_ptr;
     const float* vector2_ptr = state_ptr + b * memory_size * num_filters;
     for (int i = 0; i < num_filters; ++i) {
-      *scratch_ptr_batch = 0.f;
-      for (int j = 0; j < memory_size; ++j) {
-        *scratch_ptr_batch += *vector1_ptr++ * *vector2_ptr++;
-      }
-      scratch_ptr_batch++;
+      *scratch_ptr_batch++ = DotStateRing<float, float>(
+          vector1_ptr, vector2_ptr, memory_size, state_head);
+      vector1_ptr += memory_size;
+      vector2_ptr += memory_size;
     }
   }
 
@@ -134,8 +161,8 @@ inline void EvalFloatSVDF(
     TfLiteContext* context, TfLiteNode* node, const TfLiteEvalTensor* input,
     const TfLiteEvalTensor* weights_feature,
     const TfLiteEvalTensor* weights_time, const TfLiteEvalTensor* bias,
-    const TfLiteSVDFParams* params, int scratch_tensor_index,
-    TfLiteEvalTensor* activation_state, TfLiteEvalTensor* output) {
+    const TfLiteSVDFParams* params, TfLiteEvalTensor* activation_state,
+    TfLiteEvalTensor* output, OpData* data) {
   const int rank = params->rank;
   const int batch_size = input->dims->data[0];
   const int input_size = input->dims->data[1];
@@ -156,33 +183,23 @@ inline void EvalFloatSVDF(
   TFLITE_DCHECK(context->GetScratchBuffer != nullptr);
 
   float* scratch_ptr = static_cast<float*>(
-      context->GetScratchBuffer(context, scratch_tensor_index));
+      context->GetScratchBuffer(context, data->scratch_tensor_index));
 
   float* output_ptr = tflite::micro::GetTensorData<float>(output);
 
-  // Left shift the activation_state.
-  {
-    float* new_state_start = state_ptr;
-    const float* old_state_start = state_ptr + 1;
-    const float* old_state_end =
-        state_ptr + batch_size * num_filters * memory_size;
-    while (old_state_start != old_state_end) {
-      *new_state_start++ = *old_state_start++;
-    }
-  }
-
   // Note: no need to clear the latest activation, matmul is not accumulative.
 
   // Compute conv1d(inputs, weights_feature).
-  // The activation_state's rightmost column is used to save current cycle
-  // activation. This is achieved by starting at state_ptr[memory_size - 1] and
-  // having the stride equal to memory_size.
+  // The current cycle activation replaces the oldest one, the column at the
+  // head of the state rings. This is achieved by starting at
+  // state_ptr[state_head] and having the stride equal to memory_size.
+  const int state_head = data->state_head;
 
   // Perform batched matrix vector multiply operation:
   {
     const float* matrix = weights_feature_ptr;
     const float* vector = input_ptr;
-    float* result = &state_ptr[memory_size - 1];
+    float* result = &state_ptr[state_head];
     float* result_in_batch = result;
     for (int i = 0; i < batch_size; ++i) {
       const float* matrix_ptr = matrix;
@@ -198,11 +215,18 @@ inline void EvalFloatSVDF(
     }
   }
 
+  // The entry just written is now the newest.
+  data->state_head = (state_head + 1) % memory_size;
+
   ApplyTimeWeightsBiasAndActivation(
-      batch_size, memory_size, num_filters, num_units, rank, weights_time_ptr,
-      bias_ptr, params->activation, state_ptr, scratch_ptr, output_ptr);
+      batch_size, memory_size, num_filters, num_units, rank, data->state_head,
+      weights_time_ptr, bias_ptr, params->activation, state_ptr, scratch_ptr,
+      output_ptr);
 }
 
+// Int8 SVDF, bit-exact with arm_svdf_s8() but on the ring state: the new
+// activations replace the oldest column instead of the whole state being
+// moved by one entry first.
 void EvalIntegerSVDF(TfLiteContext* context, TfLiteNode* node,
                      const TfLiteEvalTensor* input_tensor,
                      const TfLiteEvalTensor* weights_feature_tensor,
@@ -210,72 +234,85 @@ void EvalIntegerSVDF(TfLiteContext* context, TfLiteNode* node,
                      const TfLiteEvalTensor* bias_tensor,
                      const TfLiteSVDFParams* params,
                      TfLiteEvalTensor* activation_state_tensor,
-                     TfLiteEvalTensor* output_tensor, const OpData& data) {
-  cmsis_nn_dims input_dims;
-  input_dims.n = input_tensor->dims->data[0];
-  input_dims.h = input_tensor->dims->data[1];
-
-  cmsis_nn_dims weights_feature_dims;
-  weights_feature_dims.n = weights_feature_tensor->dims->data[0];
-  weights_feature_dims.h = weights_feature_tensor->dims->data[1];
-
-  cmsis_nn_dims weights_time_dims;
-  weights_time_dims.n = weights_time_tensor->dims->data[0];
-  weights_time_dims.h = weights_time_tensor->dims->data[1];
-
-  cmsis_nn_dims bias_dims;
-  bias_dims.n = bias_tensor->dims->data[0];
-
-  cmsis_nn_dims state_dims;
-  state_dims.n = bias_tensor->dims->data[0];
-  state_dims.h = bias_tensor->dims->data[1];
-
-  cmsis_nn_dims output_dims;
-  output_dims.n = output_tensor->dims->data[0];
-  output_dims.h = output_tensor->dims->data[1];
-
-  cmsis_nn_svdf_params svdf_params;
-  svdf_params.rank = params->rank;
-  svdf_params.input_offset = data.input_zero_point;
-  svdf_params.output_offset = data.output_zero_point;
-
-  svdf_params.input_activation.min = INT16_MIN;
-  svdf_params.input_activation.max = INT16_MAX;
-
-  svdf_params.output_activation.min = INT8_MIN;
-  svdf_params.output_activation.max = INT8_MAX;
-
-  cmsis_nn_per_tensor_quant_params in_quant_params;
-  in_quant_params.multiplier = data.effective_scale_1_a;
-  in_quant_params.shift = data.effective_scale_1_b;
-
-  cmsis_nn_per_tensor_quant_params out_quant_params;
-  out_quant_params.multiplier = data.effective_scale_2_a;
-  out_quant_params.shift = data.effective_scale_2_b;
+                     TfLiteEvalTensor* output_tensor, OpData* data) {
+  const int rank = params->rank;
+  const int batch_size = input_tensor->dims->data[0];
+  const int input_size = input_tensor->dims->data[1];
+  const int num_filters = weights_feature_tensor->dims->data[0];
+  const int num_units = num_filters / rank;
+  const int memory_size = weights_time_tensor->dims->data[1];
+
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input_tensor);
+  const int8_t* weights_feature_data =
+      tflite::micro::GetTensorData<int8_t>(weights_feature_tensor);
+  const int16_t* weights_time_data =
+      tflite::micro::GetTensorData<int16_t>(weights_time_tensor);
+  const int32_t* bias_data =
+      tflite::micro::GetTensorData<int32_t>(bias_tensor);
+  int16_t* state_data =
+      tflite::micro::GetTensorData<int16_t>(activation_state_tensor);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output_tensor);
 
   TFLITE_DCHECK(context != nullptr);
   TFLITE_DCHECK(context->GetScratchBuffer != nullptr);
+  int32_t* scratch = static_cast<int32_t*>(
+      context->GetScratchBuffer(context, data->scratch_tensor_index));
+  int32_t* scratch_output = static_cast<int32_t*>(
+      context->GetScratchBuffer(context, data->scratch_output_tensor_index));
+
+  // Compute conv1d(inputs, weights_feature) into the oldest column.
+  const int state_head = data->state_head;
+  for (int b = 0; b < batch_size; ++b) {
+    const int8_t* input_batch = input_data + b * input_size;
+    const int8_t* weights = weights_feature_data;
+    int16_t* result = state_data + b * num_filters * memory_size + state_head;
+    for (int f = 0; f < num_filters; ++f) {
+      int32_t dot = 0;
+      for (int i = 0; i < input_size; ++i) {
+        dot += *weights++ * (input_batch[i] - data->input_zero_point);
+      }
+      dot = arm_nn_requantize(dot, data->effective_scale_1_a,
+                              data->effective_scale_1_b);
+      *result = static_cast<int16_t>(
+          std::min<int32_t>(std::max<int32_t>(dot, INT16_MIN), INT16_MAX));
+      result += memory_size;
+    }
+  }
+  data->state_head = (state_head + 1) % memory_size;
 
-  cmsis_nn_context scratch_ctx;
-  scratch_ctx.buf = static_cast<int32_t*>(
-      context->GetScratchBuffer(context, data.scratch_tensor_index));
+  // Compute matmul(activation_state, weights_time).
+  for (int b = 0; b < batch_size; ++b) {
+    const int16_t* weights = weights_time_data;
+    const int16_t* state_row = state_data + b * num_filters * memory_size;
+    int32_t* scratch_batch = scratch + b * num_filters;
+    for (int f = 0; f < num_filters; ++f) {
+      *scratch_batch++ = DotStateRing<int16_t, int32_t>(
+          weights, state_row, memory_size, data->state_head);
+      weights += memory_size;
+      state_row += memory_size;
+    }
+  }
 
-  cmsis_nn_context scratch_output_ctx;
-  scratch_output_ctx.buf = static_cast<int32_t*>(
-      context->GetScratchBuffer(context, data.scratch_output_tensor_index));
+  // Reduce the rank and add the bias.
+  for (int b = 0; b < batch_size; ++b) {
+    const int32_t* scratch_batch = scratch + b * num_filters;
+    int32_t* output_batch = scratch_output + b * num_units;
+    for (int u = 0; u < num_units; ++u) {
+      output_batch[u] = bias_data != nullptr ? bias_data[u] : 0;
+      for (int r = 0; r < rank; ++r) {
+        output_batch[u] += *scratch_batch++;
+      }
+    }
+  }
 
-  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output_tensor);
-  arm_svdf_s8(
-      &scratch_ctx, &scratch_output_ctx, &svdf_params, &in_quant_params,
-      &out_quant_params, &input_dims,
-      (int8_t*)tflite::micro::GetTensorData<int8_t>(input_tensor), &state_dims,
-      (int16_t*)tflite::micro::GetTensorData<int16_t>(activation_state_tensor),
-      &weights_feature_dims,
-      (int8_t*)tflite::micro::GetTensorData<int8_t>(weights_feature_tensor),
-      &weights_time_dims,
-      (int16_t*)tflite::micro::GetTensorData<int16_t>(weights_time_tensor),
-      &bias_dims, (int32_t*)tflite::micro::GetTensorData<int32_t>(bias_tensor),
-      &output_dims, output_data);
+  for (int i = 0; i < batch_size * num_units; ++i) {
+    const int32_t value =
+        arm_nn_requantize(scratch_output[i], data->effective_scale_2_a,
+                          data->effective_scale_2_b) +
+        data->output_zero_point;
+    output_data[i] = static_cast<int8_t>(
+        std::min<int32_t>(std::max<int32_t>(value, INT8_MIN), INT8_MAX));
+  }
 }
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
@@ -352,6 +389,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   TFLITE_DCHECK(node->user_data != nullptr);
   OpData* data = static_cast<OpData*>(node->user_data);
+  // The state starts out zeroed, in which any position can be the head.
+  data->state_head = 0;
 
   if (input->type == kTfLiteInt8) {
     TF_LITE_ENSURE_EQ(context, weights_feature->type, kTfLiteInt8);
@@ -419,7 +458,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   auto* params = reinterpret_cast<TfLiteSVDFParams*>(node->builtin_data);
   TFLITE_DCHECK(node->user_data != nullptr);
-  const OpData& data = *(static_cast<const OpData*>(node->user_data));
+  OpData* data = static_cast<OpData*>(node->user_data);
 
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kInputTensor);
@@ -439,8 +478,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   switch (weights_feature->type) {
     case kTfLiteFloat32: {
       EvalFloatSVDF(context, node, input, weights_feature, weights_time, bias,
-                    params, data.scratch_tensor_index, activation_state,
-                    output);
+                    params, activation_state, output, data);
       return kTfLiteOk;
       break;
     }
@@ -0,0 +1,379 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/kernels/depthwise_pointwise_conv.h"
+
+#include <limits>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/conv.h"
+#include "tensorflow/lite/micro/kernels/m0plus/depthwise_conv.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
+#include "tensorflow/lite/micro/micro_workers.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kDepthwiseFilterTensor = 1;
+constexpr int kDepthwiseBiasTensor = 2;
+constexpr int kPointwiseFilterTensor = 3;
+constexpr int kPointwiseBiasTensor = 4;
+constexpr int kOutputTensor = 0;
+
+// https://www.tensorflow.org/lite/performance/quantization_spec
+constexpr int kDepthwiseConvQuantizedDimension = 3;
+constexpr int kConvQuantizedDimension = 0;
+
+struct OpData {
+  TfLitePaddingValues depthwise_padding;
+
+  // Cached zero points of the input, depthwise output and pointwise output.
+  int32_t input_zero_point;
+  int32_t depthwise_output_zero_point;
+  int32_t output_zero_point;
+
+  // Per channel output multiplier and shift of both convolutions.
+  int32_t* depthwise_output_multiplier;
+  int32_t* depthwise_output_shift;
+  int32_t* pointwise_output_multiplier;
+  int32_t* pointwise_output_shift;
+
+  // The range of the pointwise convolution's fused activation.
+  int32_t output_activation_min;
+  int32_t output_activation_max;
+
+  // Per-channel bias + input_offset * kernel sum of the pointwise filter,
+  // computed in Prepare if it fit in the weight packing budget, or nullptr.
+  int32_t* pointwise_folded_bias;
+
+  // Index of the scratch buffer holding one row of the depthwise output per
+  // worker, each `row_bytes` long.
+  int buffer_idx;
+  int row_bytes;
+  bool use_workers;
+};
+
+// The depthwise half mirrors the standalone depthwise kernel, which clamps to
+// the full int8 range rather than the fused activation.
+DepthwiseParams DepthwiseParamsQuantized(
+    const TfLiteDepthwiseConvParams& params, const OpData& data) {
+  DepthwiseParams op_params;
+  op_params.padding_type = PaddingType::kSame;
+  op_params.padding_values.width = data.depthwise_padding.width;
+  op_params.padding_values.height = data.depthwise_padding.height;
+  op_params.stride_width = params.stride_width;
+  op_params.stride_height = params.stride_height;
+  op_params.dilation_width_factor = params.dilation_width_factor;
+  op_params.dilation_height_factor = params.dilation_height_factor;
+  op_params.depth_multiplier = params.depth_multiplier;
+  op_params.input_offset = -data.input_zero_point;
+  op_params.weights_offset = 0;
+  op_params.output_offset = data.depthwise_output_zero_point;
+  op_params.quantized_activation_min = std::numeric_limits<int8_t>::min();
+  op_params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+  return op_params;
+}
+
+ConvParams PointwiseParamsQuantized(const OpData& data) {
+  ConvParams op_params;
+  op_params.input_offset = -data.depthwise_output_zero_point;
+  op_params.output_offset = data.output_zero_point;
+  op_params.stride_height = 1;
+  op_params.stride_width = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.dilation_width_factor = 1;
+  op_params.padding_values.height = 0;
+  op_params.padding_values.width = 0;
+  op_params.quantized_activation_min = data.output_activation_min;
+  op_params.quantized_activation_max = data.output_activation_max;
+  return op_params;
+}
+
+TfLiteStatus EnsurePerChannelQuantized(TfLiteContext* context,
+                                       const TfLiteTensor* filter,
+                                       int num_channels) {
+  TF_LITE_ENSURE_EQ(context, filter->quantization.type,
+                    kTfLiteAffineQuantization);
+  const auto* affine_quantization =
+      reinterpret_cast<TfLiteAffineQuantization*>(filter->quantization.params);
+  TF_LITE_ENSURE(context, affine_quantization);
+  TF_LITE_ENSURE(context, affine_quantization->scale);
+  TF_LITE_ENSURE(context, affine_quantization->zero_point);
+  TF_LITE_ENSURE(context, affine_quantization->scale->size == 1 ||
+                              affine_quantization->scale->size == num_channels);
+  TF_LITE_ENSURE_EQ(context, affine_quantization->scale->size,
+                    affine_quantization->zero_point->size);
+  return kTfLiteOk;
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  const auto* params =
+      static_cast<const DepthwisePointwiseConvParams*>(node->builtin_data);
+  const TfLiteDepthwiseConvParams& depthwise = *params->depthwise;
+  const TfLiteConvParams& pointwise = *params->pointwise;
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 5);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  const TfLiteTensor* input = GetInput(context, node, kInputTensor);
+  const TfLiteTensor* depthwise_filter =
+      GetInput(context, node, kDepthwiseFilterTensor);
+  const TfLiteTensor* depthwise_bias =
+      GetInput(context, node, kDepthwiseBiasTensor);
+  const TfLiteTensor* pointwise_filter =
+      GetInput(context, node, kPointwiseFilterTensor);
+  const TfLiteTensor* pointwise_bias =
+      GetInput(context, node, kPointwiseBiasTensor);
+  TfLiteTensor* depthwise_output =
+      context->GetTensor(context, params->depthwise_output);
+  TfLiteTensor* output = GetOutput(context, node, kOutputTensor);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, depthwise_output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_EQ(context, SizeOfDimension(input, 0), 1);
+
+  const int depthwise_channels =
+      SizeOfDimension(depthwise_filter, kDepthwiseConvQuantizedDimension);
+  const int pointwise_channels =
+      SizeOfDimension(pointwise_filter, kConvQuantizedDimension);
+  TF_LITE_ENSURE_STATUS(EnsurePerChannelQuantized(context, depthwise_filter,
+                                                  depthwise_channels));
+  TF_LITE_ENSURE_STATUS(EnsurePerChannelQuantized(context, pointwise_filter,
+                                                  pointwise_channels));
+
+  data->depthwise_output_multiplier =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, depthwise_channels * sizeof(int32_t)));
+  data->depthwise_output_shift =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, depthwise_channels * sizeof(int32_t)));
+  data->pointwise_output_multiplier =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, pointwise_channels * sizeof(int32_t)));
+  data->pointwise_output_shift =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, pointwise_channels * sizeof(int32_t)));
+
+  int32_t output_multiplier;
+  int output_shift;
+  int32_t activation_min;
+  int32_t activation_max;
+  TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
+      context, input, depthwise_filter, depthwise_bias, depthwise_output,
+      depthwise.activation, &output_multiplier, &output_shift,
+      &activation_min, &activation_max, data->depthwise_output_multiplier,
+      reinterpret_cast<int*>(data->depthwise_output_shift),
+      depthwise_channels));
+  TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
+      context, depthwise_output, pointwise_filter, pointwise_bias, output,
+      pointwise.activation, &output_multiplier, &output_shift,
+      &data->output_activation_min, &data->output_activation_max,
+      data->pointwise_output_multiplier,
+      reinterpret_cast<int*>(data->pointwise_output_shift),
+      pointwise_channels));
+
+  int unused_output_height;
+  int unused_output_width;
+  data->depthwise_padding = ComputePaddingHeightWidth(
+      depthwise.stride_height, depthwise.stride_width, 1, 1,
+      SizeOfDimension(input, 1), SizeOfDimension(input, 2),
+      SizeOfDimension(depthwise_filter, 1),
+      SizeOfDimension(depthwise_filter, 2), depthwise.padding,
+      &unused_output_height, &unused_output_width);
+  data->input_zero_point = input->params.zero_point;
+  data->depthwise_output_zero_point = depthwise_output->params.zero_point;
+  data->output_zero_point = output->params.zero_point;
+
+  TF_LITE_ENSURE(context,
+                 m0plus::DepthwiseConvPerChannelSupported(
+                     DepthwiseParamsQuantized(depthwise, *data),
+                     GetTensorShape(depthwise_filter)));
+  TF_LITE_ENSURE(context, pointwise.stride_height == 1 &&
+                              pointwise.stride_width == 1 &&
+                              SizeOfDimension(pointwise_filter, 1) == 1 &&
+                              SizeOfDimension(pointwise_filter, 2) == 1);
+
+  const int pointwise_depth = SizeOfDimension(pointwise_filter, 3);
+  data->pointwise_folded_bias = static_cast<int32_t*>(
+      AllocatePackedBuffer(context, pointwise_channels * sizeof(int32_t)));
+  if (data->pointwise_folded_bias != nullptr) {
+    m0plus::FoldInputOffset(GetTensorData<int8_t>(pointwise_filter),
+                            pointwise_channels, pointwise_depth,
+                            GetTensorData<int32_t>(pointwise_bias),
+                            -data->depthwise_output_zero_point,
+                            data->pointwise_folded_bias);
+  }
+
+  MicroWorkers* workers = GetMicroWorkers(context);
+  data->use_workers = workers != nullptr;
+  data->row_bytes = SizeOfDimension(depthwise_output, 2) *
+                    SizeOfDimension(depthwise_output, 3);
+  const int buffer_size =
+      data->row_bytes * (data->use_workers ? workers->num_workers() : 1);
+  return context->RequestScratchBufferInArena(context, buffer_size,
+                                              &data->buffer_idx);
+}
+
+// A fused convolution shared between workers, each computing a band of
+// output rows.
+struct DepthwisePointwiseConvTask {
+  const DepthwisePointwiseConvParams* params;
+  const OpData* data;
+  const TfLiteEvalTensor* input;
+  const TfLiteEvalTensor* depthwise_filter;
+  const TfLiteEvalTensor* depthwise_bias;
+  const TfLiteEvalTensor* pointwise_filter;
+  const TfLiteEvalTensor* pointwise_bias;
+  TfLiteEvalTensor* output;
+  int8_t* buffer;
+};
+
+// Computes output rows [row_begin, row_end), running the depthwise
+// convolution for one row into `row_buffer` and the pointwise convolution
+// over that row straight away.
+void EvalRows(const DepthwisePointwiseConvTask& task, int row_begin,
+              int row_end, int8_t* row_buffer) {
+  const OpData& data = *task.data;
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(task.input);
+  const RuntimeShape depthwise_filter_shape =
+      tflite::micro::GetTensorShape(task.depthwise_filter);
+  const RuntimeShape depthwise_bias_shape =
+      tflite::micro::GetTensorShape(task.depthwise_bias);
+  const RuntimeShape pointwise_filter_shape =
+      tflite::micro::GetTensorShape(task.pointwise_filter);
+  const RuntimeShape pointwise_bias_shape =
+      tflite::micro::GetTensorShape(task.pointwise_bias);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(task.output);
+
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int input_row_size = input_shape.Dims(2) * input_shape.Dims(3);
+  const RuntimeShape row_shape(
+      {1, 1, output_width, depthwise_filter_shape.Dims(3)});
+  const RuntimeShape output_row_shape({1, 1, output_width, output_depth});
+
+  const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(task.input);
+  int8_t* output_data = tflite::micro::GetTensorData<int8_t>(task.output);
+
+  DepthwiseParams depthwise_params =
+      DepthwiseParamsQuantized(*task.params->depthwise, data);
+  const ConvParams pointwise_params = PointwiseParamsQuantized(data);
+  RuntimeShape slice_shape = input_shape;
+  for (int row = row_begin; row < row_end; ++row) {
+    const micro::RowSlice slice = micro::SliceWindowRows(
+        row, row + 1, depthwise_params.stride_height,
+        depthwise_params.dilation_height_factor,
+        depthwise_filter_shape.Dims(1),
+        data.depthwise_padding.height, input_shape.Dims(1));
+    depthwise_params.padding_values.height = slice.pad_height;
+    slice_shape.SetDim(1, slice.input_rows);
+
+    m0plus::DepthwiseConvPerChannel(
+        depthwise_params, data.depthwise_output_multiplier,
+        data.depthwise_output_shift, slice_shape,
+        input_data + slice.input_row * input_row_size, depthwise_filter_shape,
+        tflite::micro::GetTensorData<int8_t>(task.depthwise_filter),
+        depthwise_bias_shape,
+        tflite::micro::GetTensorData<int32_t>(task.depthwise_bias), row_shape,
+        row_buffer);
+    m0plus::ConvPerChannel(
+        pointwise_params, data.pointwise_output_multiplier,
+        data.pointwise_output_shift, row_shape, row_buffer,
+        pointwise_filter_shape,
+        tflite::micro::GetTensorData<int8_t>(task.pointwise_filter),
+        pointwise_bias_shape,
+        tflite::micro::GetTensorData<int32_t>(task.pointwise_bias),
+        output_row_shape, output_data + row * output_width * output_depth,
+        data.pointwise_folded_bias);
+  }
+}
+
+void RunDepthwisePointwiseConvTask(void* task_data, int worker,
+                                   int num_workers) {
+  const DepthwisePointwiseConvTask& task =
+      *static_cast<const DepthwisePointwiseConvTask*>(task_data);
+  int row_begin;
+  int row_end;
+  GetWorkerRange(tflite::micro::GetTensorShape(task.output).Dims(1), worker,
+                 num_workers, &row_begin, &row_end);
+  EvalRows(task, row_begin, row_end,
+           task.buffer + worker * task.data->row_bytes);
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+  const OpData& data = *static_cast<const OpData*>(node->user_data);
+
+  DepthwisePointwiseConvTask task;
+  task.params =
+      static_cast<const DepthwisePointwiseConvParams*>(node->builtin_data);
+  task.data = &data;
+  task.input = tflite::micro::GetEvalInput(context, node, kInputTensor);
+  task.depthwise_filter =
+      tflite::micro::GetEvalInput(context, node, kDepthwiseFilterTensor);
+  task.depthwise_bias =
+      tflite::micro::GetEvalInput(context, node, kDepthwiseBiasTensor);
+  task.pointwise_filter =
+      tflite::micro::GetEvalInput(context, node, kPointwiseFilterTensor);
+  task.pointwise_bias =
+      tflite::micro::GetEvalInput(context, node, kPointwiseBiasTensor);
+  task.output = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+  task.buffer = static_cast<int8_t*>(
+      context->GetScratchBuffer(context, data.buffer_idx));
+
+  if (data.use_workers) {
+    GetMicroWorkers(context)->Run(RunDepthwisePointwiseConvTask, &task);
+  } else {
+    EvalRows(task, 0, tflite::micro::GetTensorShape(task.output).Dims(1),
+             task.buffer);
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteRegistration* Register_DEPTHWISE_POINTWISE_CONV_2D() {
+  static TfLiteRegistration r = {/*init=*/Init,
+                                 /*free=*/nullptr,
+                                 /*prepare=*/Prepare,
+                                 /*invoke=*/Eval,
+                                 /*profiling_string=*/nullptr,
+                                 /*builtin_code=*/BuiltinOperator_CUSTOM,
+                                 /*custom_name=*/"DEPTHWISE_POINTWISE_CONV_2D",
+                                 /*version=*/0};
+  return &r;
+}
+
+}  // namespace tflite
@@ -0,0 +1,45 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_DEPTHWISE_POINTWISE_CONV_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_DEPTHWISE_POINTWISE_CONV_H_
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+
+namespace tflite {
+
+// Builtin data of a fused depthwise + pointwise convolution: the parameters
+// of the two operators it replaces and the index of the depthwise output
+// tensor, which only provides quantization parameters.
+struct DepthwisePointwiseConvParams {
+  const TfLiteDepthwiseConvParams* depthwise;
+  const TfLiteConvParams* pointwise;
+  int depthwise_output;
+};
+
+// A 3x3 int8 depthwise convolution followed by a 1x1 int8 convolution over
+// its output, as produced by FuseDepthwisePointwiseConvs(). The node has the
+// inputs {input, depthwise filter, depthwise bias, pointwise filter,
+// pointwise bias} and the pointwise output as its only output.
+//
+// The depthwise output is computed one row at a time into a scratch buffer
+// and immediately consumed by the pointwise convolution, so the intermediate
+// tensor is never materialized. The results are bit-exact with running the
+// two operators separately.
+TfLiteRegistration* Register_DEPTHWISE_POINTWISE_CONV_2D();
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_DEPTHWISE_POINTWISE_CONV_H_
@@ -12,6 +12,8 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
+#include <cstring>
 #include <numeric>
 
 #define FLATBUFFERS_LOCALE_INDEPENDENT 0
@@ -36,6 +38,9 @@ namespace {
  * 1.) Temporaries (temporary tensors) - Micro use instead scratch buffer API.
  * 2.) Output dimensions - the TFLite version does not support undefined out
  * dimensions. So model must have static out dimensions.
+ * 3.) Fixed-point path - when boxes, scores and anchors are all uint8, the
+ * boxes are decoded and suppressed in fixed point and the scores are never
+ * dequantized, so the FPU-less cores only touch floats when writing outputs.
  */
 
 // Input tensors
@@ -54,6 +59,15 @@ constexpr int kBatchSize = 1;
 
 constexpr int kNumDetectionsPerClass = 100;
 
+// Fixed-point box coordinates are in units of the anchor scale divided by
+// 2^kBoxFractionBits, the IoU threshold is in Q15.
+constexpr int kBoxFractionBits = 12;
+constexpr int kIouFractionBits = 15;
+constexpr int kNumScoreLevels = 256;
+// Largest half size factor kept in the tables, so that multiplying by an
+// anchor extent of up to 255 stays within int32.
+constexpr int32_t kMaxHalfSizeFactor = 1 << 22;
+
 // Object Detection model produces axis-aligned boxes in two formats:
 // BoxCorner represents the lower left corner (xmin, ymin) and
 // the upper right corner (xmax, ymax).
@@ -86,6 +100,17 @@ static_assert(sizeof(BoxCornerEncoding) == sizeof(float) * kNumCoordBox,
 static_assert(sizeof(CenterSizeEncoding) == sizeof(float) * kNumCoordBox,
               "Size of CenterSizeEncoding is 4 float values");
 
+// Fixed-point counterpart of BoxCornerEncoding. It shares the decoded boxes
+// scratch buffer, so it must have the same size.
+struct BoxCornerFixedPoint {
+  int32_t ymin;
+  int32_t xmin;
+  int32_t ymax;
+  int32_t xmax;
+};
+static_assert(sizeof(BoxCornerFixedPoint) == sizeof(BoxCornerEncoding),
+              "BoxCornerFixedPoint must fit the decoded boxes buffer");
+
 struct OpData {
   int max_detections;
   int max_classes_per_detection;  // Fast Non-Max-Suppression
@@ -108,11 +133,39 @@ struct OpData {
   int sorted_indices_idx;
   int buffer_idx;
   int selected_idx;
+  int score_histogram_idx;
 
   // Cached tensor scale and zero point values for quantized operations
   TfLiteQuantizationParams input_box_encodings;
   TfLiteQuantizationParams input_class_predictions;
   TfLiteQuantizationParams input_anchors;
+
+  // Fixed-point decode and NMS, used when all inputs are uint8.
+  bool use_fixed_point;
+  int32_t center_y_multiplier;
+  int center_y_shift;
+  int32_t center_x_multiplier;
+  int center_x_shift;
+  // 0.5 * exp(h / h_scale) and 0.5 * exp(w / w_scale) for every quantized
+  // h and w, with kBoxFractionBits fractional bits.
+  int32_t* half_h_table;
+  int32_t* half_w_table;
+  // Lowest quantized score that passes nms_score_threshold.
+  int score_threshold_quantized;
+  int32_t iou_threshold_fixed_point;
+};
+
+class Dequantizer {
+ public:
+  Dequantizer(int zero_point, float scale)
+      : zero_point_(zero_point), scale_(scale) {}
+  float operator()(uint8_t x) {
+    return (static_cast<float>(x) - zero_point_) * scale_;
+  }
+
+ private:
+  int zero_point_;
+  float scale_;
 };
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
@@ -150,6 +203,57 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
 
 void Free(TfLiteContext* context, void* buffer) {}
 
+// Fills `table` with 0.5 * exp(dequantized / scale) for every uint8 value,
+// in the fixed-point format of the decoded boxes.
+void FillHalfSizeTable(const OpData* op_data, float scale, int32_t* table) {
+  Dequantizer dequantize(op_data->input_box_encodings.zero_point,
+                         op_data->input_box_encodings.scale);
+  for (int q = 0; q < kNumScoreLevels; ++q) {
+    const double factor = 0.5 * std::exp(dequantize(q) / scale) *
+                          static_cast<double>(1 << kBoxFractionBits);
+    table[q] = factor >= kMaxHalfSizeFactor
+                   ? kMaxHalfSizeFactor
+                   : static_cast<int32_t>(factor + 0.5);
+  }
+}
+
+TfLiteStatus PrepareFixedPoint(TfLiteContext* context, OpData* op_data) {
+  // The centers are offset by (box - zero_point) * (anchor - zero_point),
+  // which is below 2^16, so the multipliers may shift left by at most 15.
+  const double box_scale = op_data->input_box_encodings.scale;
+  QuantizeMultiplier(
+      box_scale / op_data->scale_values.y * (1 << kBoxFractionBits),
+      &op_data->center_y_multiplier, &op_data->center_y_shift);
+  QuantizeMultiplier(
+      box_scale / op_data->scale_values.x * (1 << kBoxFractionBits),
+      &op_data->center_x_multiplier, &op_data->center_x_shift);
+  TF_LITE_ENSURE(context, op_data->center_y_shift <= 15);
+  TF_LITE_ENSURE(context, op_data->center_x_shift <= 15);
+
+  int32_t* tables = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+      context, 2 * kNumScoreLevels * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, tables != nullptr);
+  op_data->half_h_table = tables;
+  op_data->half_w_table = tables + kNumScoreLevels;
+  FillHalfSizeTable(op_data, op_data->scale_values.h, op_data->half_h_table);
+  FillHalfSizeTable(op_data, op_data->scale_values.w, op_data->half_w_table);
+
+  // Use the float dequantization so that exactly the same scores are kept.
+  Dequantizer dequantize(op_data->input_class_predictions.zero_point,
+                         op_data->input_class_predictions.scale);
+  int threshold = 0;
+  while (threshold < kNumScoreLevels &&
+         dequantize(threshold) <
+             op_data->non_max_suppression_score_threshold) {
+    ++threshold;
+  }
+  op_data->score_threshold_quantized = threshold;
+  op_data->iou_threshold_fixed_point = static_cast<int32_t>(
+      op_data->intersection_over_union_threshold * (1 << kIouFractionBits) +
+      0.5f);
+  return kTfLiteOk;
+}
+
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   auto* op_data = static_cast<OpData*>(node->user_data);
 
@@ -179,17 +283,33 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   op_data->input_anchors.scale = input_anchors->params.scale;
   op_data->input_anchors.zero_point = input_anchors->params.zero_point;
 
+  op_data->use_fixed_point =
+      input_box_encodings->type == kTfLiteUInt8 &&
+      input_class_predictions->type == kTfLiteUInt8 &&
+      input_anchors->type == kTfLiteUInt8;
+  if (op_data->use_fixed_point) {
+    TF_LITE_ENSURE_STATUS(PrepareFixedPoint(context, op_data));
+  }
+
   // Scratch tensors
   context->RequestScratchBufferInArena(context, num_boxes,
                                        &op_data->active_candidate_idx);
   context->RequestScratchBufferInArena(context,
                                        num_boxes * kNumCoordBox * sizeof(float),
                                        &op_data->decoded_boxes_idx);
-  context->RequestScratchBufferInArena(
-      context,
-      input_class_predictions->dims->data[1] *
-          input_class_predictions->dims->data[2] * sizeof(float),
-      &op_data->scores_idx);
+  // The fixed-point path bins the quantized scores instead of dequantizing
+  // them.
+  if (op_data->use_fixed_point) {
+    context->RequestScratchBufferInArena(context,
+                                         kNumScoreLevels * sizeof(int),
+                                         &op_data->score_histogram_idx);
+  } else {
+    context->RequestScratchBufferInArena(
+        context,
+        input_class_predictions->dims->data[1] *
+            input_class_predictions->dims->data[2] * sizeof(float),
+        &op_data->scores_idx);
+  }
 
   // Additional buffers
   context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
@@ -221,19 +341,6 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
-class Dequantizer {
- public:
-  Dequantizer(int zero_point, float scale)
-      : zero_point_(zero_point), scale_(scale) {}
-  float operator()(uint8_t x) {
-    return (static_cast<float>(x) - zero_point_) * scale_;
-  }
-
- private:
-  int zero_point_;
-  float scale_;
-};
-
 void DequantizeBoxEncodings(const TfLiteEvalTensor* input_box_encodings,
                             int idx, float quant_zero_point, float quant_scale,
                             int length_box_encoding,
@@ -331,8 +438,62 @@ TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
   return kTfLiteOk;
 }
 
-void DecreasingPartialArgSort(const float* values, int num_values,
-                              int num_to_sort, int* indices) {
+// Fixed-point version of DecodeCenterSizeBoxes for uint8 boxes and anchors.
+// The anchors are used in their quantized units, the box offsets are scaled
+// by the multipliers and tables set up in PrepareFixedPoint.
+TfLiteStatus DecodeCenterSizeBoxesFixedPoint(TfLiteContext* context,
+                                             TfLiteNode* node,
+                                             OpData* op_data) {
+  const TfLiteEvalTensor* input_box_encodings =
+      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  TF_LITE_ENSURE_EQ(context, input_box_encodings->dims->data[0], kBatchSize);
+  const int num_boxes = input_box_encodings->dims->data[1];
+  const int length_box_encoding = input_box_encodings->dims->data[2];
+  TF_LITE_ENSURE(context, length_box_encoding >= kNumCoordBox);
+  const TfLiteEvalTensor* input_anchors =
+      tflite::micro::GetEvalInput(context, node, kInputTensorAnchors);
+
+  const uint8_t* boxes =
+      tflite::micro::GetTensorData<uint8_t>(input_box_encodings);
+  const uint8_t* anchors = tflite::micro::GetTensorData<uint8_t>(input_anchors);
+  const int32_t box_zero_point = op_data->input_box_encodings.zero_point;
+  const int32_t anchor_zero_point = op_data->input_anchors.zero_point;
+  BoxCornerFixedPoint* decoded_boxes = reinterpret_cast<BoxCornerFixedPoint*>(
+      context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
+
+  for (int idx = 0; idx < num_boxes; ++idx) {
+    const uint8_t* box = boxes + idx * length_box_encoding;
+    const uint8_t* anchor = anchors + idx * kNumCoordBox;
+    const int32_t anchor_y = anchor[0] - anchor_zero_point;
+    const int32_t anchor_x = anchor[1] - anchor_zero_point;
+    const int32_t anchor_h = anchor[2] - anchor_zero_point;
+    const int32_t anchor_w = anchor[3] - anchor_zero_point;
+
+    const int32_t ycenter =
+        anchor_y * (1 << kBoxFractionBits) +
+        MultiplyByQuantizedMultiplier(
+            static_cast<int32_t>((box[0] - box_zero_point) * anchor_h),
+            op_data->center_y_multiplier, op_data->center_y_shift);
+    const int32_t xcenter =
+        anchor_x * (1 << kBoxFractionBits) +
+        MultiplyByQuantizedMultiplier(
+            static_cast<int32_t>((box[1] - box_zero_point) * anchor_w),
+            op_data->center_x_multiplier, op_data->center_x_shift);
+    const int32_t half_h = anchor_h * op_data->half_h_table[box[2]];
+    const int32_t half_w = anchor_w * op_data->half_w_table[box[3]];
+
+    BoxCornerFixedPoint& decoded = decoded_boxes[idx];
+    decoded.ymin = ycenter - half_h;
+    decoded.xmin = xcenter - half_w;
+    decoded.ymax = ycenter + half_h;
+    decoded.xmax = xcenter + half_w;
+  }
+  return kTfLiteOk;
+}
+
+template <typename T>
+void DecreasingPartialArgSort(const T* values, int num_values, int num_to_sort,
+                              int* indices) {
   std::iota(indices, indices + num_values, 0);
   std::partial_sort(
       indices, indices + num_to_sort, indices + num_values,
@@ -345,8 +506,9 @@ int SelectDetectionsAboveScoreThreshold(const float* values, int size,
   int counter = 0;
   for (int i = 0; i < size; i++) {
     if (values[i] >= threshold) {
-      keep_values[counter++] = values[i];
-      keep_indices[i] = i;
+      keep_values[counter] = values[i];
+      keep_indices[counter] = i;
+      counter++;
     }
   }
   return counter;
@@ -363,6 +525,17 @@ bool ValidateBoxes(const float* decoded_boxes, const int num_boxes) {
   return true;
 }
 
+bool ValidateBoxes(const BoxCornerFixedPoint* decoded_boxes,
+                   const int num_boxes) {
+  for (int i = 0; i < num_boxes; ++i) {
+    const BoxCornerFixedPoint& box = decoded_boxes[i];
+    if (box.ymin >= box.ymax || box.xmin >= box.xmax) {
+      return false;
+    }
+  }
+  return true;
+}
+
 float ComputeIntersectionOverUnion(const float* decoded_boxes, const int i,
                                    const int j) {
   auto& box_i = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
@@ -380,6 +553,29 @@ float ComputeIntersectionOverUnion(const float* decoded_boxes, const int i,
   return intersection_area / (area_i + area_j - intersection_area);
 }
 
+// Returns whether the IoU of boxes i and j is above `threshold` (Q15), by
+// comparing intersection * 2^15 against threshold * union instead of
+// dividing.
+bool IntersectionOverUnionExceeds(const BoxCornerFixedPoint* decoded_boxes,
+                                  const int i, const int j,
+                                  const int32_t threshold) {
+  const BoxCornerFixedPoint& box_i = decoded_boxes[i];
+  const BoxCornerFixedPoint& box_j = decoded_boxes[j];
+  const int32_t intersection_h = std::min(box_i.ymax, box_j.ymax) -
+                                 std::max(box_i.ymin, box_j.ymin);
+  const int32_t intersection_w = std::min(box_i.xmax, box_j.xmax) -
+                                 std::max(box_i.xmin, box_j.xmin);
+  if (intersection_h <= 0 || intersection_w <= 0) return false;
+  const int64_t area_i = static_cast<int64_t>(box_i.ymax - box_i.ymin) *
+                         (box_i.xmax - box_i.xmin);
+  const int64_t area_j = static_cast<int64_t>(box_j.ymax - box_j.ymin) *
+                         (box_j.xmax - box_j.xmin);
+  const int64_t intersection_area =
+      static_cast<int64_t>(intersection_h) * intersection_w;
+  return intersection_area * (1 << kIouFractionBits) >
+         threshold * (area_i + area_j - intersection_area);
+}
+
 // NonMaxSuppressionSingleClass() prunes out the box locations with high overlap
 // before selecting the highest scoring boxes (max_detections in number)
 // It assumes all boxes are good in beginning and sorts based on the scores.
@@ -460,6 +656,90 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
   return kTfLiteOk;
 }
 
+// Fixed-point version of NonMaxSuppressionSingleClassHelper for uint8 scores.
+// Boxes below the score threshold are dropped while binning the scores, and
+// the bins give the candidates in decreasing score order in O(N). A candidate
+// is selected if it does not overlap any box selected before it, so each one
+// is only compared against at most max_detections boxes.
+TfLiteStatus NonMaxSuppressionSingleClassHelper(
+    TfLiteContext* context, TfLiteNode* node, OpData* op_data,
+    const uint8_t* scores, int* selected, int* selected_size,
+    int max_detections) {
+  const TfLiteEvalTensor* input_box_encodings =
+      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  const int num_boxes = input_box_encodings->dims->data[1];
+  const float intersection_over_union_threshold =
+      op_data->intersection_over_union_threshold;
+  TF_LITE_ENSURE(context, (max_detections >= 0));
+  TF_LITE_ENSURE(context, (intersection_over_union_threshold > 0.0f) &&
+                              (intersection_over_union_threshold <= 1.0f));
+  const BoxCornerFixedPoint* decoded_boxes =
+      reinterpret_cast<const BoxCornerFixedPoint*>(
+          context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
+
+  const int threshold = op_data->score_threshold_quantized;
+  int* bin_offsets = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->score_histogram_idx));
+  std::memset(bin_offsets, 0, kNumScoreLevels * sizeof(int));
+  for (int i = 0; i < num_boxes; ++i) {
+    if (scores[i] >= threshold) ++bin_offsets[scores[i]];
+  }
+  int num_scores_kept = 0;
+  for (int level = kNumScoreLevels - 1; level >= threshold; --level) {
+    const int count = bin_offsets[level];
+    bin_offsets[level] = num_scores_kept;
+    num_scores_kept += count;
+  }
+  int* sorted_indices = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->sorted_indices_idx));
+  for (int i = 0; i < num_boxes; ++i) {
+    if (scores[i] >= threshold) sorted_indices[bin_offsets[scores[i]]++] = i;
+  }
+
+  *selected_size = 0;
+  for (int k = 0; k < num_scores_kept && *selected_size < max_detections;
+       ++k) {
+    const int candidate = sorted_indices[k];
+    bool suppressed = false;
+    for (int s = 0; s < *selected_size && !suppressed; ++s) {
+      suppressed = IntersectionOverUnionExceeds(
+          decoded_boxes, selected[s], candidate,
+          op_data->iou_threshold_fixed_point);
+    }
+    if (!suppressed) selected[(*selected_size)++] = candidate;
+  }
+
+  return kTfLiteOk;
+}
+
+// Writes the decoded box of `anchor_index` to a detection_boxes entry.
+void WriteDetectionBox(TfLiteContext* context, const OpData* op_data,
+                       int anchor_index, BoxCornerEncoding* output_box) {
+  const void* decoded_boxes =
+      context->GetScratchBuffer(context, op_data->decoded_boxes_idx);
+  if (!op_data->use_fixed_point) {
+    *output_box =
+        reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[anchor_index];
+    return;
+  }
+  const BoxCornerFixedPoint& box = reinterpret_cast<const BoxCornerFixedPoint*>(
+      decoded_boxes)[anchor_index];
+  const float unit =
+      op_data->input_anchors.scale / static_cast<float>(1 << kBoxFractionBits);
+  output_box->ymin = box.ymin * unit;
+  output_box->xmin = box.xmin * unit;
+  output_box->ymax = box.ymax * unit;
+  output_box->xmax = box.xmax * unit;
+}
+
+float DetectionScore(const OpData* op_data, float score) { return score; }
+
+float DetectionScore(const OpData* op_data, uint8_t score) {
+  Dequantizer dequantize(op_data->input_class_predictions.zero_point,
+                         op_data->input_class_predictions.scale);
+  return dequantize(score);
+}
+
 // This function implements a regular version of Non Maximal Suppression (NMS)
 // for multiple classes where
 // 1) we do NMS separately for each class across all anchors and
@@ -467,10 +747,11 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
 // 3) The worst runtime of the regular NMS is O(K*N^2)
 // where N is the number of anchors and K the number of
 // classes.
+template <typename T>
 TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
                                                       TfLiteNode* node,
                                                       OpData* op_data,
-                                                      const float* scores) {
+                                                      const T* scores) {
   const TfLiteEvalTensor* input_box_encodings =
       tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
   const TfLiteEvalTensor* input_class_predictions =
@@ -495,18 +776,18 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   TF_LITE_ENSURE(context, num_detections_per_class > 0);
 
   // For each class, perform non-max suppression.
-  float* class_scores = reinterpret_cast<float*>(
+  T* class_scores = reinterpret_cast<T*>(
       context->GetScratchBuffer(context, op_data->score_buffer_idx));
   int* box_indices_after_regular_non_max_suppression = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->buffer_idx));
-  float* scores_after_regular_non_max_suppression =
-      reinterpret_cast<float*>(context->GetScratchBuffer(
+  T* scores_after_regular_non_max_suppression =
+      reinterpret_cast<T*>(context->GetScratchBuffer(
           context, op_data->scores_after_regular_non_max_suppression_idx));
 
   int size_of_sorted_indices = 0;
   int* sorted_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->sorted_indices_idx));
-  float* sorted_values = reinterpret_cast<float*>(
+  T* sorted_values = reinterpret_cast<T*>(
       context->GetScratchBuffer(context, op_data->sorted_values_idx));
 
   for (int col = 0; col < num_classes; col++) {
@@ -563,13 +844,13 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
       const int class_index =
           box_indices_after_regular_non_max_suppression[output_box_index] -
           anchor_index * num_classes_with_background - label_offset;
-      const float selected_score =
-          scores_after_regular_non_max_suppression[output_box_index];
+      const float selected_score = DetectionScore(
+          op_data, scores_after_regular_non_max_suppression[output_box_index]);
       // detection_boxes
-      float* decoded_boxes = reinterpret_cast<float*>(
-          context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-      ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[output_box_index] =
-          reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[anchor_index];
+      WriteDetectionBox(
+          context, op_data, anchor_index,
+          &ReInterpretTensor<BoxCornerEncoding*>(
+              detection_boxes)[output_box_index]);
       // detection_classes
       tflite::micro::GetTensorData<float>(detection_classes)[output_box_index] =
           class_index;
@@ -600,10 +881,13 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
 // 3) Compared to standard NMS, the worst runtime of this version is O(N^2)
 // instead of O(KN^2) where N is the number of anchors and K the number of
 // classes.
+// Only the anchors that survive NMS need their classes sorted, so the sort
+// is done after selection.
+template <typename T>
 TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
                                                    TfLiteNode* node,
                                                    OpData* op_data,
-                                                   const float* scores) {
+                                                   const T* scores) {
   const TfLiteEvalTensor* input_box_encodings =
       tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
   const TfLiteEvalTensor* input_class_predictions =
@@ -629,18 +913,15 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   TF_LITE_ENSURE(context, (max_categories_per_anchor > 0));
   const int num_categories_per_anchor =
       std::min(max_categories_per_anchor, num_classes);
-  float* max_scores = reinterpret_cast<float*>(
+  T* max_scores = reinterpret_cast<T*>(
       context->GetScratchBuffer(context, op_data->score_buffer_idx));
-  int* sorted_class_indices = reinterpret_cast<int*>(
+  int* class_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->buffer_idx));
 
   for (int row = 0; row < num_boxes; row++) {
-    const float* box_scores =
+    const T* box_scores =
         scores + row * num_classes_with_background + label_offset;
-    int* class_indices = sorted_class_indices + row * num_classes;
-    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
-                             class_indices);
-    max_scores[row] = box_scores[class_indices[0]];
+    max_scores[row] = *std::max_element(box_scores, box_scores + num_classes);
   }
 
   // Perform non-maximal suppression on max scores
@@ -657,19 +938,18 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   for (int i = 0; i < selected_size; i++) {
     int selected_index = selected[i];
 
-    const float* box_scores =
+    const T* box_scores =
         scores + selected_index * num_classes_with_background + label_offset;
-    const int* class_indices =
-        sorted_class_indices + selected_index * num_classes;
+    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
+                             class_indices);
 
     for (int col = 0; col < num_categories_per_anchor; ++col) {
       int box_offset = num_categories_per_anchor * output_box_index + col;
 
       // detection_boxes
-      float* decoded_boxes = reinterpret_cast<float*>(
-          context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-      ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[box_offset] =
-          reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[selected_index];
+      WriteDetectionBox(
+          context, op_data, selected_index,
+          &ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[box_offset]);
 
       // detection_classes
       tflite::micro::GetTensorData<float>(detection_classes)[box_offset] =
@@ -677,7 +957,7 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
 
       // detection_scores
       tflite::micro::GetTensorData<float>(detection_scores)[box_offset] =
-          box_scores[class_indices[col]];
+          DetectionScore(op_data, box_scores[class_indices[col]]);
 
       output_box_index++;
     }
@@ -703,6 +983,18 @@ void DequantizeClassPredictions(const TfLiteEvalTensor* input_class_predictions,
   }
 }
 
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClassWithScores(TfLiteContext* context,
+                                                   TfLiteNode* node,
+                                                   OpData* op_data,
+                                                   const T* scores) {
+  if (op_data->use_regular_non_max_suppression) {
+    return NonMaxSuppressionMultiClassRegularHelper(context, node, op_data,
+                                                    scores);
+  }
+  return NonMaxSuppressionMultiClassFastHelper(context, node, op_data, scores);
+}
+
 TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
                                          TfLiteNode* node, OpData* op_data) {
   // Get the input tensors
@@ -722,6 +1014,19 @@ TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
   TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
   TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
 
+  if (op_data->use_fixed_point) {
+    // The boxes do not depend on the class, so validate them once here
+    // rather than for every class.
+    TF_LITE_ENSURE(context,
+                   ValidateBoxes(reinterpret_cast<const BoxCornerFixedPoint*>(
+                                     context->GetScratchBuffer(
+                                         context, op_data->decoded_boxes_idx)),
+                                 num_boxes));
+    return NonMaxSuppressionMultiClassWithScores(
+        context, node, op_data,
+        tflite::micro::GetTensorData<uint8_t>(input_class_predictions));
+  }
+
   const float* scores;
   switch (input_class_predictions->type) {
     case kTfLiteUInt8: {
@@ -740,15 +1045,7 @@ TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
       return kTfLiteError;
   }
 
-  if (op_data->use_regular_non_max_suppression) {
-    TF_LITE_ENSURE_STATUS(NonMaxSuppressionMultiClassRegularHelper(
-        context, node, op_data, scores));
-  } else {
-    TF_LITE_ENSURE_STATUS(
-        NonMaxSuppressionMultiClassFastHelper(context, node, op_data, scores));
-  }
-
-  return kTfLiteOk;
+  return NonMaxSuppressionMultiClassWithScores(context, node, op_data, scores);
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -764,7 +1061,12 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   // This fills in temporary decoded_boxes
   // by transforming input_box_encodings and input_anchors from
   // CenterSizeEncodings to BoxCornerEncoding
-  TF_LITE_ENSURE_STATUS(DecodeCenterSizeBoxes(context, node, op_data));
+  if (op_data->use_fixed_point) {
+    TF_LITE_ENSURE_STATUS(
+        DecodeCenterSizeBoxesFixedPoint(context, node, op_data));
+  } else {
+    TF_LITE_ENSURE_STATUS(DecodeCenterSizeBoxes(context, node, op_data));
+  }
 
   // This fills in the output tensors
   // by choosing effective set of decoded boxes
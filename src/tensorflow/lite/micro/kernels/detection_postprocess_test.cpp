@@ -0,0 +1,201 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cmath>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/flexbuffers_generated_data.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace tflite {
+TfLiteRegistration* Register_DETECTION_POSTPROCESS();
+}  // namespace tflite
+
+namespace {
+
+// The generated op data has num_classes = 2 and max_detections = 3; the
+// first class is the background.
+constexpr int kNumBoxes = 32;
+constexpr int kNumClassesWithBackground = 3;
+constexpr int kMaxDetections = 3;
+
+constexpr float kBoxScale = 0.1f;
+constexpr int kBoxZeroPoint = 128;
+constexpr float kScoreScale = 1.0f / 256;
+// Scores below the zero point dequantize below the 0.0 score threshold.
+constexpr int kScoreZeroPoint = 32;
+constexpr float kAnchorScale = 0.01f;
+constexpr int kAnchorZeroPoint = 0;
+constexpr float kBoxTolerance = 1e-3f;
+
+uint8_t g_boxes[kNumBoxes * 4];
+uint8_t g_scores[kNumBoxes * kNumClassesWithBackground];
+uint8_t g_anchors[kNumBoxes * 4];
+float g_boxes_float[kNumBoxes * 4];
+float g_scores_float[kNumBoxes * kNumClassesWithBackground];
+float g_anchors_float[kNumBoxes * 4];
+
+tflite::testing::Random g_random;
+
+// Fills overlapping anchors and small box offsets around them. The scores
+// are chosen so that the boxes entering each single class NMS have distinct
+// scores, since ties may be ordered differently by the two paths.
+void FillInputs(bool regular_nms) {
+  const int score_offset = g_random.Int(0, 255);
+  for (int i = 0; i < kNumBoxes; ++i) {
+    g_anchors[i * 4 + 0] = g_random.Int(20, 80);
+    g_anchors[i * 4 + 1] = g_random.Int(20, 80);
+    g_anchors[i * 4 + 2] = g_random.Int(20, 40);
+    g_anchors[i * 4 + 3] = g_random.Int(20, 40);
+    for (int j = 0; j < 4; ++j) {
+      g_boxes[i * 4 + j] =
+          g_random.Int(kBoxZeroPoint - 10, kBoxZeroPoint + 10);
+    }
+    uint8_t* scores = g_scores + i * kNumClassesWithBackground;
+    scores[0] = g_random.Int(0, 255);
+    const int first = (i * 37 + score_offset) % 256;
+    if (regular_nms) {
+      scores[1] = first;
+      scores[2] = (i * 91 + 64) % 256;
+    } else {
+      const int best = 1 + g_random.Int(0, 1);
+      scores[best] = first;
+      scores[3 - best] = first / 2;
+    }
+  }
+  for (int i = 0; i < kNumBoxes * 4; ++i) {
+    g_boxes_float[i] = (g_boxes[i] - kBoxZeroPoint) * kBoxScale;
+    g_anchors_float[i] = (g_anchors[i] - kAnchorZeroPoint) * kAnchorScale;
+  }
+  for (int i = 0; i < kNumBoxes * kNumClassesWithBackground; ++i) {
+    g_scores_float[i] = (g_scores[i] - kScoreZeroPoint) * kScoreScale;
+  }
+}
+
+struct Detections {
+  float boxes[kMaxDetections * 4];
+  float classes[kMaxDetections];
+  float scores[kMaxDetections];
+  float num_detections;
+};
+
+void RunDetectionPostprocess(bool quantized, const unsigned char* op_data,
+                             int op_data_size, Detections* detections) {
+  const int box_dims[] = {3, 1, kNumBoxes, 4};
+  const int score_dims[] = {3, 1, kNumBoxes, kNumClassesWithBackground};
+  const int anchor_dims[] = {2, kNumBoxes, 4};
+  const int output_boxes_dims[] = {3, 1, kMaxDetections, 4};
+  const int output_dims[] = {2, 1, kMaxDetections};
+  const int num_detections_dims[] = {1, 1};
+  TfLiteIntArray* box_shape = tflite::testing::IntArrayFromInts(box_dims);
+  TfLiteIntArray* score_shape = tflite::testing::IntArrayFromInts(score_dims);
+  TfLiteIntArray* anchor_shape =
+      tflite::testing::IntArrayFromInts(anchor_dims);
+
+  TfLiteTensor tensors[7];
+  if (quantized) {
+    tensors[0] = tflite::testing::CreateQuantizedTensor(
+        g_boxes, box_shape, kBoxScale, kBoxZeroPoint);
+    tensors[1] = tflite::testing::CreateQuantizedTensor(
+        g_scores, score_shape, kScoreScale, kScoreZeroPoint);
+    tensors[2] = tflite::testing::CreateQuantizedTensor(
+        g_anchors, anchor_shape, kAnchorScale, kAnchorZeroPoint);
+  } else {
+    tensors[0] = tflite::testing::CreateTensor(g_boxes_float, box_shape);
+    tensors[1] = tflite::testing::CreateTensor(g_scores_float, score_shape);
+    tensors[2] = tflite::testing::CreateTensor(g_anchors_float, anchor_shape);
+  }
+  tensors[3] = tflite::testing::CreateTensor(
+      detections->boxes, tflite::testing::IntArrayFromInts(output_boxes_dims));
+  tensors[4] = tflite::testing::CreateTensor(
+      detections->classes, tflite::testing::IntArrayFromInts(output_dims));
+  tensors[5] = tflite::testing::CreateTensor(
+      detections->scores, tflite::testing::IntArrayFromInts(output_dims));
+  tensors[6] = tflite::testing::CreateTensor(
+      &detections->num_detections,
+      tflite::testing::IntArrayFromInts(num_detections_dims));
+
+  const int inputs_array_data[] = {3, 0, 1, 2};
+  const int outputs_array_data[] = {4, 3, 4, 5, 6};
+  const TfLiteRegistration* registration =
+      tflite::Register_DETECTION_POSTPROCESS();
+  tflite::micro::KernelRunner runner(
+      *registration, tensors, 7,
+      tflite::testing::IntArrayFromInts(inputs_array_data),
+      tflite::testing::IntArrayFromInts(outputs_array_data), nullptr,
+      micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, runner.InitAndPrepare(reinterpret_cast<const char*>(op_data),
+                                       op_data_size));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+}
+
+// Runs the fixed-point path on uint8 inputs and the float path on the same
+// inputs dequantized, and expects the same detections. Scores are
+// dequantized identically, the boxes only within kBoxTolerance.
+void TestFixedPointMatchesFloat(const unsigned char* op_data,
+                                int op_data_size, bool regular_nms) {
+  for (int seed = 1; seed <= 8; ++seed) {
+    g_random = tflite::testing::Random(seed);
+    FillInputs(regular_nms);
+    Detections expected;
+    Detections actual;
+    RunDetectionPostprocess(false, op_data, op_data_size, &expected);
+    RunDetectionPostprocess(true, op_data, op_data_size, &actual);
+
+    TF_LITE_MICRO_EXPECT_LT(0, expected.num_detections);
+    TF_LITE_MICRO_EXPECT_EQ(expected.num_detections, actual.num_detections);
+    for (int i = 0; i < kMaxDetections; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(expected.classes[i], actual.classes[i]);
+      TF_LITE_MICRO_EXPECT_EQ(expected.scores[i], actual.scores[i]);
+      for (int j = 0; j < 4; ++j) {
+        TF_LITE_MICRO_EXPECT_NEAR(expected.boxes[i * 4 + j],
+                                  actual.boxes[i * 4 + j], kBoxTolerance);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestFastNmsFixedPointMatchesFloat) {
+  TestFixedPointMatchesFloat(g_gen_data_none_regular_nms,
+                             g_gen_data_size_none_regular_nms, false);
+}
+
+TF_LITE_MICRO_TEST(TestRegularNmsFixedPointMatchesFloat) {
+  TestFixedPointMatchesFloat(g_gen_data_regular_nms,
+                             g_gen_data_size_regular_nms, true);
+}
+
+TF_LITE_MICRO_TEST(TestScoresBelowThresholdArePruned) {
+  g_random = tflite::testing::Random();
+  FillInputs(true);
+  for (int i = 0; i < kNumBoxes * kNumClassesWithBackground; ++i) {
+    g_scores[i] = kScoreZeroPoint - 1;
+  }
+  Detections detections;
+  RunDetectionPostprocess(true, g_gen_data_regular_nms,
+                          g_gen_data_size_regular_nms, &detections);
+  TF_LITE_MICRO_EXPECT_EQ(0.0f, detections.num_detections);
+}
+
+TF_LITE_MICRO_TESTS_END
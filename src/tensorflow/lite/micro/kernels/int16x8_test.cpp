@@ -0,0 +1,421 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cmath>
+#include <cstdint>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/add.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+// Runs the registered kernels on 16x8 tensors (int16 activations, int8
+// weights, int64 biases) and compares them with the reference kernels fed the
+// parameters TFLite derives from the same tensors.
+
+namespace {
+
+constexpr int kMaxSize = 1024;
+// The fully connected filter, 8 channels of 300, is the largest.
+constexpr int kMaxFilterSize = 2400;
+constexpr int kMaxChannels = 16;
+constexpr float kSoftmaxTolerance = 3.0f / 32768;
+
+int16_t g_input[kMaxSize];
+int16_t g_input2[kMaxSize];
+int8_t g_filter[kMaxFilterSize];
+int64_t g_bias[kMaxChannels];
+int16_t g_expected[kMaxSize];
+int16_t g_output[kMaxSize];
+float g_filter_scales[kMaxChannels + 1];
+int g_filter_zero_points[kMaxChannels + 1];
+int32_t g_multiplier[kMaxChannels];
+int32_t g_shift[kMaxChannels];
+
+tflite::testing::Random g_random;
+
+float RandomScale() {
+  return g_random.Int(1, 1 << 12) / static_cast<float>(1 << 20);
+}
+
+// Whether FillInputs() arguments fit the buffers, for static_assert.
+constexpr bool Fits(int input_size, int filter_size, int channels) {
+  return input_size <= kMaxSize && filter_size <= kMaxFilterSize &&
+         channels <= kMaxChannels;
+}
+
+void FillInputs(int input_size, int filter_size, int channels) {
+  for (int i = 0; i < input_size; ++i) {
+    g_input[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+  }
+  for (int i = 0; i < filter_size; ++i) {
+    g_filter[i] = static_cast<int8_t>(g_random.Int(-127, 127));
+  }
+  for (int c = 0; c < channels; ++c) {
+    g_bias[c] = g_random.Int(-(1 << 20), 1 << 20);
+  }
+}
+
+// Quantizes the filter per channel along `quantized_dimension` with random
+// scales, and computes the per-channel multipliers the way the kernels do.
+TfLiteTensor CreatePerChannelFilter(TfLiteIntArray* dims, int channels,
+                                    int quantized_dimension, float input_scale,
+                                    float output_scale,
+                                    TfLiteAffineQuantization* quant) {
+  g_filter_scales[0] = channels;
+  g_filter_zero_points[0] = channels;
+  for (int c = 0; c < channels; ++c) {
+    g_filter_scales[c + 1] = RandomScale();
+    g_filter_zero_points[c + 1] = 0;
+    int shift;
+    tflite::QuantizeMultiplier(static_cast<double>(input_scale) *
+                                   g_filter_scales[c + 1] / output_scale,
+                               &g_multiplier[c], &shift);
+    g_shift[c] = shift;
+  }
+  quant->scale = tflite::testing::FloatArrayFromFloats(g_filter_scales);
+  quant->zero_point = tflite::testing::IntArrayFromInts(g_filter_zero_points);
+  quant->quantized_dimension = quantized_dimension;
+  TfLiteTensor filter = tflite::testing::CreateTensor(g_filter, dims);
+  filter.quantization = {kTfLiteAffineQuantization, quant};
+  return filter;
+}
+
+void Run(const TfLiteRegistration& registration, TfLiteTensor* tensors,
+         int tensors_size, const int* inputs, const int* outputs,
+         void* builtin_data) {
+  tflite::micro::KernelRunner runner(
+      registration, tensors, tensors_size,
+      tflite::testing::IntArrayFromInts(inputs),
+      tflite::testing::IntArrayFromInts(outputs), builtin_data,
+      micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+}
+
+void ExpectOutputsEqual(int size) {
+  for (int i = 0; i < size; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FullyConnected16x8MatchesReference) {
+  constexpr int kBatches = 3;
+  constexpr int kDepth = 300;
+  constexpr int kChannels = 8;
+  const int input_dims[] = {2, kBatches, kDepth};
+  const int filter_dims[] = {2, kChannels, kDepth};
+  const int bias_dims[] = {1, kChannels};
+  const int output_dims[] = {2, kBatches, kChannels};
+  const float input_scale = RandomScale();
+  const float filter_scale = RandomScale();
+  // Sums of 300 products mostly stay within the output range.
+  const float output_scale = input_scale * filter_scale * 1024;
+  static_assert(Fits(kBatches * kDepth, kChannels * kDepth, kChannels),
+                "buffers too small");
+  FillInputs(kBatches * kDepth, kChannels * kDepth, kChannels);
+
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(input_dims),
+          input_scale),
+      tflite::testing::CreateQuantizedTensor(
+          g_filter, tflite::testing::IntArrayFromInts(filter_dims),
+          filter_scale),
+      tflite::testing::CreateQuantizedTensor(
+          g_bias, tflite::testing::IntArrayFromInts(bias_dims),
+          input_scale * filter_scale),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(output_dims),
+          output_scale),
+  };
+  TfLiteFullyConnectedParams builtin_data = {
+      kTfLiteActRelu, kTfLiteFullyConnectedWeightsFormatDefault, false,
+      false};
+  const int inputs[] = {3, 0, 1, 2};
+  const int outputs[] = {1, 3};
+  Run(tflite::Register_FULLY_CONNECTED(), tensors, 4, inputs, outputs,
+      &builtin_data);
+
+  tflite::FullyConnectedParams params;
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  int shift;
+  tflite::QuantizeMultiplier(
+      static_cast<double>(input_scale) * filter_scale / output_scale,
+      &params.output_multiplier, &shift);
+  params.output_shift = shift;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 32767;
+  tflite::reference_integer_ops::FullyConnected(
+      params, tflite::RuntimeShape({kBatches, kDepth}), g_input,
+      tflite::RuntimeShape({kChannels, kDepth}), g_filter,
+      tflite::RuntimeShape({kChannels}), g_bias,
+      tflite::RuntimeShape({kBatches, kChannels}), g_expected);
+  ExpectOutputsEqual(kBatches * kChannels);
+}
+
+TF_LITE_MICRO_TEST(Conv16x8MatchesReference) {
+  constexpr int kSize = 6;
+  constexpr int kInDepth = 4;
+  constexpr int kOutDepth = 5;
+  const int input_dims[] = {4, 1, kSize, kSize, kInDepth};
+  const int filter_dims[] = {4, kOutDepth, 3, 3, kInDepth};
+  const int bias_dims[] = {1, kOutDepth};
+  const int output_dims[] = {4, 1, kSize, kSize, kOutDepth};
+  const float input_scale = RandomScale();
+  // Filter scales are at most 2^-8, which keeps most outputs in range.
+  const float output_scale = input_scale * 16;
+  static_assert(
+      Fits(kSize * kSize * kInDepth, kOutDepth * 9 * kInDepth, kOutDepth),
+      "buffers too small");
+  FillInputs(kSize * kSize * kInDepth, kOutDepth * 9 * kInDepth, kOutDepth);
+
+  TfLiteAffineQuantization filter_quant;
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(input_dims),
+          input_scale),
+      CreatePerChannelFilter(tflite::testing::IntArrayFromInts(filter_dims),
+                             kOutDepth, 0, input_scale, output_scale,
+                             &filter_quant),
+      tflite::testing::CreateQuantizedTensor(
+          g_bias, tflite::testing::IntArrayFromInts(bias_dims), 1.0f),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(output_dims),
+          output_scale),
+  };
+  TfLiteConvParams builtin_data = {kTfLitePaddingSame, 1, 1, kTfLiteActNone,
+                                   1, 1};
+  const int inputs[] = {3, 0, 1, 2};
+  const int outputs[] = {1, 3};
+  Run(tflite::Register_CONV_2D(), tensors, 4, inputs, outputs, &builtin_data);
+
+  tflite::ConvParams params;
+  params.input_offset = 0;
+  params.output_offset = 0;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.padding_values.height = 1;
+  params.padding_values.width = 1;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  tflite::reference_integer_ops::ConvPerChannel(
+      params, g_multiplier, g_shift,
+      tflite::RuntimeShape({1, kSize, kSize, kInDepth}), g_input,
+      tflite::RuntimeShape({kOutDepth, 3, 3, kInDepth}), g_filter,
+      tflite::RuntimeShape({kOutDepth}), g_bias,
+      tflite::RuntimeShape({1, kSize, kSize, kOutDepth}), g_expected);
+  ExpectOutputsEqual(kSize * kSize * kOutDepth);
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv16x8MatchesReference) {
+  constexpr int kSize = 7;
+  constexpr int kDepth = 6;
+  const int input_dims[] = {4, 1, kSize, kSize, kDepth};
+  const int filter_dims[] = {4, 1, 3, 3, kDepth};
+  const int bias_dims[] = {1, kDepth};
+  const int output_dims[] = {4, 1, kSize, kSize, kDepth};
+  const float input_scale = RandomScale();
+  // Filter scales are at most 2^-8, which keeps most outputs in range.
+  const float output_scale = input_scale * 16;
+  static_assert(Fits(kSize * kSize * kDepth, 9 * kDepth, kDepth),
+                "buffers too small");
+  FillInputs(kSize * kSize * kDepth, 9 * kDepth, kDepth);
+
+  TfLiteAffineQuantization filter_quant;
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(input_dims),
+          input_scale),
+      CreatePerChannelFilter(tflite::testing::IntArrayFromInts(filter_dims),
+                             kDepth, 3, input_scale, output_scale,
+                             &filter_quant),
+      tflite::testing::CreateQuantizedTensor(
+          g_bias, tflite::testing::IntArrayFromInts(bias_dims), 1.0f),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(output_dims),
+          output_scale),
+  };
+  TfLiteDepthwiseConvParams builtin_data = {
+      kTfLitePaddingSame, 1, 1, 1, kTfLiteActNone, 1, 1};
+  const int inputs[] = {3, 0, 1, 2};
+  const int outputs[] = {1, 3};
+  Run(tflite::Register_DEPTHWISE_CONV_2D(), tensors, 4, inputs, outputs,
+      &builtin_data);
+
+  // The full int16 range, which catches int8 activation limits.
+  tflite::DepthwiseParams params;
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.padding_values.height = 1;
+  params.padding_values.width = 1;
+  params.depth_multiplier = 1;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  tflite::reference_integer_ops::DepthwiseConvPerChannel(
+      params, g_multiplier, g_shift,
+      tflite::RuntimeShape({1, kSize, kSize, kDepth}), g_input,
+      tflite::RuntimeShape({1, 3, 3, kDepth}), g_filter,
+      tflite::RuntimeShape({kDepth}), g_bias,
+      tflite::RuntimeShape({1, kSize, kSize, kDepth}), g_expected);
+  ExpectOutputsEqual(kSize * kSize * kDepth);
+}
+
+TF_LITE_MICRO_TEST(AddInt16GeneralScalesMatchReference) {
+  constexpr int kSize = 256;
+  const int dims[] = {2, 16, 16};
+  const float input1_scale = RandomScale();
+  const float input2_scale = RandomScale();
+  const float output_scale =
+      2 * (input1_scale > input2_scale ? input1_scale : input2_scale);
+  for (int i = 0; i < kSize; ++i) {
+    g_input[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+    g_input2[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+  }
+
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(dims), input1_scale),
+      tflite::testing::CreateQuantizedTensor(
+          g_input2, tflite::testing::IntArrayFromInts(dims), input2_scale),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(dims), output_scale),
+  };
+  TfLiteAddParams builtin_data = {kTfLiteActNone, false};
+  const int inputs[] = {2, 0, 1};
+  const int outputs[] = {1, 2};
+  Run(tflite::ops::micro::Register_ADD(), tensors, 3, inputs, outputs,
+      &builtin_data);
+
+  tflite::ArithmeticParams params;
+  params.left_shift = 15;
+  params.input1_offset = 0;
+  params.input2_offset = 0;
+  params.output_offset = 0;
+  const double twice_max_input_scale =
+      2 * static_cast<double>(input1_scale > input2_scale ? input1_scale
+                                                          : input2_scale);
+  tflite::QuantizeMultiplierSmallerThanOneExp(
+      input1_scale / twice_max_input_scale, &params.input1_multiplier,
+      &params.input1_shift);
+  tflite::QuantizeMultiplierSmallerThanOneExp(
+      input2_scale / twice_max_input_scale, &params.input2_multiplier,
+      &params.input2_shift);
+  tflite::QuantizeMultiplierSmallerThanOneExp(
+      twice_max_input_scale / ((1 << 15) * static_cast<double>(output_scale)),
+      &params.output_multiplier, &params.output_shift);
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  tflite::reference_ops::AddElementwise(kSize, params, g_input, g_input2,
+                                        g_expected);
+  ExpectOutputsEqual(kSize);
+}
+
+TF_LITE_MICRO_TEST(AddInt16PowerOfTwoScalesSaturate) {
+  constexpr int kSize = 256;
+  const int dims[] = {1, kSize};
+  for (int i = 0; i < kSize; ++i) {
+    g_input[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+    g_input2[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+  }
+
+  // The second input is shifted right by two to match the output.
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(dims), 1.0f / 1024),
+      tflite::testing::CreateQuantizedTensor(
+          g_input2, tflite::testing::IntArrayFromInts(dims), 1.0f / 4096),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(dims), 1.0f / 1024),
+  };
+  TfLiteAddParams builtin_data = {kTfLiteActNone, true};
+  const int inputs[] = {2, 0, 1};
+  const int outputs[] = {1, 2};
+  Run(tflite::ops::micro::Register_ADD(), tensors, 3, inputs, outputs,
+      &builtin_data);
+
+  for (int i = 0; i < kSize; ++i) {
+    int32_t sum = g_input[i] + ((g_input2[i] + 2 - (g_input2[i] < 0)) >> 2);
+    sum = sum < -32768 ? -32768 : sum;
+    sum = sum > 32767 ? 32767 : sum;
+    g_expected[i] = static_cast<int16_t>(sum);
+  }
+  ExpectOutputsEqual(kSize);
+}
+
+TF_LITE_MICRO_TEST(SoftmaxInt16MatchesFloat) {
+  constexpr int kRows = 4;
+  constexpr int kClasses = 10;
+  const int dims[] = {2, kRows, kClasses};
+  constexpr float kInputScale = 1.0f / 2048;
+  for (int i = 0; i < kRows * kClasses; ++i) {
+    g_input[i] = static_cast<int16_t>(g_random.Int(-8192, 8192));
+  }
+
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          g_input, tflite::testing::IntArrayFromInts(dims), kInputScale),
+      tflite::testing::CreateQuantizedTensor(
+          g_output, tflite::testing::IntArrayFromInts(dims), 1.0f / 32768),
+  };
+  TfLiteSoftmaxParams builtin_data = {1.0f};
+  const int inputs[] = {1, 0};
+  const int outputs[] = {1, 1};
+  Run(tflite::Register_SOFTMAX(), tensors, 2, inputs, outputs, &builtin_data);
+
+  // The kernel approximates exp() and 1 / (1 + x) with lookup tables.
+  for (int row = 0; row < kRows; ++row) {
+    const int16_t* logits = &g_input[row * kClasses];
+    int16_t max_logit = logits[0];
+    for (int c = 1; c < kClasses; ++c) {
+      max_logit = logits[c] > max_logit ? logits[c] : max_logit;
+    }
+    float sum = 0.0f;
+    for (int c = 0; c < kClasses; ++c) {
+      sum += std::exp((logits[c] - max_logit) * kInputScale);
+    }
+    for (int c = 0; c < kClasses; ++c) {
+      const float expected =
+          std::exp((logits[c] - max_logit) * kInputScale) / sum;
+      TF_LITE_MICRO_EXPECT_NEAR(expected,
+                                g_output[row * kClasses + c] / 32768.0f,
+                                kSoftmaxTolerance);
+    }
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
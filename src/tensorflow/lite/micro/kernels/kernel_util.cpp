@@ -37,5 +37,21 @@ const RuntimeShape GetTensorShape(const TfLiteEvalTensor* tensor) {
   return RuntimeShape(dims_size, dims_data);
 }
 
+RowSlice SliceWindowRows(int output_row_begin, int output_row_end,
+                         int stride_height, int dilation_height_factor,
+                         int filter_height, int pad_height, int input_height) {
+  const int first = output_row_begin * stride_height - pad_height;
+  const int last = (output_row_end - 1) * stride_height - pad_height +
+                   (filter_height - 1) * dilation_height_factor;
+  RowSlice slice;
+  slice.input_row = first < 0 ? 0 : first;
+  slice.pad_height = first < 0 ? -first : 0;
+  // Rows past the window of the last output row are left out, so kernels that
+  // derive the output size from the input size see a consistent shape.
+  const int end = last + 1 < input_height ? last + 1 : input_height;
+  slice.input_rows = end - slice.input_row;
+  return slice;
+}
+
 }  // namespace micro
 }  // namespace tflite
@@ -69,6 +69,20 @@ const RuntimeShape GetTensorShape(const TfLiteEvalTensor* tensor);
 bool HaveSameShapes(const TfLiteEvalTensor* input1,
                     const TfLiteEvalTensor* input2);
 
+// The part of a single-batch NHWC input that output rows
+// [output_row_begin, output_row_end) of a windowed op (convolution, depthwise
+// convolution) read: `input_rows` rows starting at `input_row`, with
+// `pad_height` rows of top padding left once the input starts there.
+struct RowSlice {
+  int input_row;
+  int input_rows;
+  int pad_height;
+};
+
+RowSlice SliceWindowRows(int output_row_begin, int output_row_end,
+                         int stride_height, int dilation_height_factor,
+                         int filter_height, int pad_height, int input_height);
+
 }  // namespace micro
 }  // namespace tflite
 
@@ -0,0 +1,87 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/add.h"
+
+#include "tensorflow/lite/kernels/internal/common.h"
+
+namespace tflite {
+namespace m0plus {
+namespace {
+
+constexpr int kInt16LeftShift = 15;
+
+// An input multiplier in [0, 2^31) split into 16-bit halves, with the right
+// shift that follows the multiplication.
+struct InputScale {
+  int32_t high;
+  int32_t low;
+  int right_shift;
+
+  // Equals MultiplyByQuantizedMultiplierSmallerThanOneExp(x << 15, ...).
+  // SaturatingRoundingDoublingHighMul(x << 15, m) rounds x * m / 2^16 to the
+  // nearest integer, ties upwards, which is floor((x * m + 2^15) / 2^16) =
+  // x * high + ((x * low + 2^15) >> 16). With |x| <= 2^15 and low < 2^16
+  // neither product overflows.
+  int32_t Scale(int32_t x) const {
+    const int32_t scaled = x * high + ((x * low + (1 << 15)) >> 16);
+    return gemmlowp::RoundingDivideByPOT(scaled, right_shift);
+  }
+};
+
+InputScale GetInputScale(int32_t multiplier, int shift) {
+  InputScale scale;
+  scale.high = multiplier >> 16;
+  scale.low = multiplier & 0xffff;
+  scale.right_shift = -shift;
+  return scale;
+}
+
+}  // namespace
+
+bool AddElementwiseInt16Supported(const ArithmeticParams& params) {
+  return params.left_shift == kInt16LeftShift && params.input1_offset == 0 &&
+         params.input2_offset == 0 && params.input1_multiplier >= 0 &&
+         params.input2_multiplier >= 0;
+}
+
+void AddElementwiseInt16(int size, const ArithmeticParams& params,
+                         const int16_t* input1_data,
+                         const int16_t* input2_data, int16_t* output_data) {
+  TFLITE_DCHECK(AddElementwiseInt16Supported(params));
+  const InputScale scale1 =
+      GetInputScale(params.input1_multiplier, params.input1_shift);
+  const InputScale scale2 =
+      GetInputScale(params.input2_multiplier, params.input2_shift);
+  const int32_t output_multiplier = params.output_multiplier;
+  const int output_shift = params.output_shift;
+  const int32_t output_offset = params.output_offset;
+  const int32_t activation_min = params.quantized_activation_min;
+  const int32_t activation_max = params.quantized_activation_max;
+
+  for (int i = 0; i < size; ++i) {
+    const int32_t raw_sum =
+        scale1.Scale(input1_data[i]) + scale2.Scale(input2_data[i]);
+    int32_t output = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+                         raw_sum, output_multiplier, output_shift) +
+                     output_offset;
+    output = output < activation_min ? activation_min : output;
+    output = output > activation_max ? activation_max : output;
+    output_data[i] = static_cast<int16_t>(output);
+  }
+}
+
+}  // namespace m0plus
+}  // namespace tflite
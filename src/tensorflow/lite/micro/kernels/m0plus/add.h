@@ -0,0 +1,43 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_ADD_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_ADD_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace m0plus {
+
+// Returns true if AddElementwiseInt16() handles these parameters: the general
+// scale int16 path (left shift 15) with symmetric inputs, which is what 16x8
+// models use.
+bool AddElementwiseInt16Supported(const ArithmeticParams& params);
+
+// Elementwise int16 add for the Cortex-M0+, bit-exact with
+// reference_ops::AddElementwise() on int16 data. The reference rescales each
+// input with a 64-bit multiply, a library call on the M0+. With a left shift
+// of 15 the rescaled input is floor((x * multiplier + 2^15) / 2^16), which
+// splitting the multiplier into 16-bit halves computes in 32 bits, so only the
+// output rescale needs 64 bits.
+void AddElementwiseInt16(int size, const ArithmeticParams& params,
+                         const int16_t* input1_data,
+                         const int16_t* input2_data, int16_t* output_data);
+
+}  // namespace m0plus
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_ADD_H_
@@ -0,0 +1,125 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/kernels/m0plus/add.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/add.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kMaxSize = 1 << 16;
+
+int16_t g_input1[kMaxSize];
+int16_t g_input2[kMaxSize];
+int16_t g_expected[kMaxSize];
+int16_t g_output[kMaxSize];
+
+tflite::testing::Random g_random;
+
+// Computes the general-path parameters the same way as the add kernel's
+// Prepare for int16 tensors with the given scales.
+tflite::ArithmeticParams GetParams(double input1_scale, double input2_scale,
+                                   double output_scale) {
+  tflite::ArithmeticParams params;
+  params.left_shift = 15;
+  params.input1_offset = 0;
+  params.input2_offset = 0;
+  params.output_offset = 0;
+  const double twice_max_input_scale =
+      2 * (input1_scale > input2_scale ? input1_scale : input2_scale);
+  tflite::QuantizeMultiplierSmallerThanOneExp(
+      input1_scale / twice_max_input_scale, &params.input1_multiplier,
+      &params.input1_shift);
+  tflite::QuantizeMultiplierSmallerThanOneExp(
+      input2_scale / twice_max_input_scale, &params.input2_multiplier,
+      &params.input2_shift);
+  tflite::QuantizeMultiplierSmallerThanOneExp(
+      twice_max_input_scale / ((1 << params.left_shift) * output_scale),
+      &params.output_multiplier, &params.output_shift);
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  return params;
+}
+
+double RandomScale() {
+  return g_random.Int(1, 1 << 20) / static_cast<double>(1 << 24);
+}
+
+void ExpectMatchesReference(int size, const tflite::ArithmeticParams& params) {
+  tflite::reference_ops::AddElementwise(size, params, g_input1, g_input2,
+                                        g_expected);
+  TF_LITE_MICRO_EXPECT(tflite::m0plus::AddElementwiseInt16Supported(params));
+  tflite::m0plus::AddElementwiseInt16(size, params, g_input1, g_input2,
+                                      g_output);
+  for (int i = 0; i < size; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(AddInt16MatchesReference) {
+  for (int trial = 0; trial < 64; ++trial) {
+    const int size = g_random.Int(1, 1024);
+    for (int i = 0; i < size; ++i) {
+      g_input1[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+      g_input2[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+    }
+    tflite::ArithmeticParams params =
+        GetParams(RandomScale(), RandomScale(), RandomScale());
+    params.quantized_activation_min = g_random.Int(-32768, 0);
+    params.quantized_activation_max = g_random.Int(0, 32767);
+    ExpectMatchesReference(size, params);
+  }
+}
+
+TF_LITE_MICRO_TEST(AddInt16MatchesReferenceForAllInputs) {
+  // Every int16 value against a random partner.
+  for (int trial = 0; trial < 8; ++trial) {
+    for (int i = 0; i < kMaxSize; ++i) {
+      g_input1[i] = static_cast<int16_t>(i - 32768);
+      g_input2[i] = static_cast<int16_t>(g_random.Int(-32768, 32767));
+    }
+    ExpectMatchesReference(
+        kMaxSize, GetParams(RandomScale(), RandomScale(), RandomScale()));
+  }
+}
+
+TF_LITE_MICRO_TEST(AddInt16MatchesReferenceForEqualScales) {
+  // Equal scales give input multipliers of exactly one half.
+  for (int i = 0; i < kMaxSize; ++i) {
+    g_input1[i] = static_cast<int16_t>(i - 32768);
+    g_input2[i] = static_cast<int16_t>(32767 - i);
+  }
+  ExpectMatchesReference(kMaxSize, GetParams(0.001, 0.001, 0.002));
+  ExpectMatchesReference(kMaxSize, GetParams(0.001, 0.001, 0.0005));
+}
+
+TF_LITE_MICRO_TEST(AddWithOtherLeftShiftIsNotSupported) {
+  tflite::ArithmeticParams params = GetParams(0.5, 0.25, 1.0);
+  params.left_shift = 20;
+  TF_LITE_MICRO_EXPECT(!tflite::m0plus::AddElementwiseInt16Supported(params));
+  params = GetParams(0.5, 0.25, 1.0);
+  params.input1_offset = 1;
+  TF_LITE_MICRO_EXPECT(!tflite::m0plus::AddElementwiseInt16Supported(params));
+}
+
+TF_LITE_MICRO_TESTS_END
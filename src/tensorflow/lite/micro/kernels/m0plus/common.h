@@ -0,0 +1,224 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_COMMON_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_COMMON_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+
+// Building blocks shared by the Cortex-M0+ int8 and 16x8 kernels.
+//
+// The M0+ has no SIMD or saturating instructions, but it does have a
+// single-cycle 32x32->32 multiplier, so the cost of a MAC is dominated by the
+// two byte loads feeding it. The helpers below therefore keep several
+// accumulators live and reuse every loaded byte more than once. The input
+// offset is folded out of the inner loops: sum((x + offset) * w) is computed
+// as sum(x * w) + offset * sum(w), which is bit-exact in 32-bit arithmetic.
+//
+// Weights are read in the model's own layout rather than repacked. Conv and
+// fully connected filters are stored output channel first, so each channel's
+// weights are already contiguous in the order the dot products walk them,
+// and a packed copy would cost arena RAM for weights that can stay in flash.
+
+namespace tflite {
+
+// Without the DSP extension (e.g. on the RP2040's Cortex-M0+) CMSIS-NN only
+// has its generic C paths, so the CMSIS-NN kernels hand their int8 and 16x8
+// work to the m0plus kernels instead. This is the condition under which
+// arm_math_types.h defines ARM_MATH_DSP, tested directly so that the m0plus
+// kernels don't depend on CMSIS.
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+constexpr bool kUseM0PlusKernels = false;
+#else
+constexpr bool kUseM0PlusKernels = true;
+#endif
+
+namespace m0plus {
+
+// Returns the sum of `size` int8 values.
+inline int32_t Sum(const int8_t* data, int size) {
+  int32_t sum = 0;
+  for (int i = 0; i < size; ++i) {
+    sum += data[i];
+  }
+  return sum;
+}
+
+// Stores bias[i] + input_offset * sum(filter row i) for each of the `rows`
+// contiguous filter rows of `row_size` weights. This is the starting value of
+// every accumulator of output channel i, so kernels can take it precomputed
+// instead of summing the filter again on every invocation. `bias` may be
+// null.
+inline void FoldInputOffset(const int8_t* filter, int rows, int row_size,
+                            const int32_t* bias, int32_t input_offset,
+                            int32_t* folded_bias) {
+  for (int i = 0; i < rows; ++i) {
+    const int32_t bias_value = bias ? bias[i] : 0;
+    folded_bias[i] = bias_value + input_offset * Sum(filter + i * row_size,
+                                                     row_size);
+  }
+}
+
+// acc[0] += in . w
+inline void Dot1x1(const int8_t* in, const int8_t* w, int size, int32_t* acc) {
+  int32_t acc0 = 0;
+  int i = 0;
+  for (; i + 1 < size; i += 2) {
+    acc0 += in[i] * w[i];
+    acc0 += in[i + 1] * w[i + 1];
+  }
+  if (i < size) {
+    acc0 += in[i] * w[i];
+  }
+  acc[0] += acc0;
+}
+
+// acc[j] += in . w_j for two filters.
+inline void Dot1x2(const int8_t* in, const int8_t* w0, const int8_t* w1,
+                   int size, int32_t* acc) {
+  int32_t acc0 = 0;
+  int32_t acc1 = 0;
+  for (int i = 0; i < size; ++i) {
+    const int32_t x = in[i];
+    acc0 += x * w0[i];
+    acc1 += x * w1[i];
+  }
+  acc[0] += acc0;
+  acc[1] += acc1;
+}
+
+// acc[2 * i + j] += in_i . w_j for two inputs and two filters: four MACs for
+// every four loads.
+inline void Dot2x2(const int8_t* in0, const int8_t* in1, const int8_t* w0,
+                   const int8_t* w1, int size, int32_t* acc) {
+  int32_t acc00 = 0;
+  int32_t acc01 = 0;
+  int32_t acc10 = 0;
+  int32_t acc11 = 0;
+  for (int i = 0; i < size; ++i) {
+    const int32_t x0 = in0[i];
+    const int32_t x1 = in1[i];
+    const int32_t f0 = w0[i];
+    const int32_t f1 = w1[i];
+    acc00 += x0 * f0;
+    acc01 += x0 * f1;
+    acc10 += x1 * f0;
+    acc11 += x1 * f1;
+  }
+  acc[0] += acc00;
+  acc[1] += acc01;
+  acc[2] += acc10;
+  acc[3] += acc11;
+}
+
+// Per output channel requantization state, loaded once per channel instead of
+// once per output element.
+struct ChannelQuantization {
+  int32_t multiplier;
+  int32_t shift;
+  int32_t output_offset;
+  int32_t activation_min;
+  int32_t activation_max;
+
+  int8_t Requantize(int32_t acc) const {
+    acc = MultiplyByQuantizedMultiplier(acc, multiplier, shift);
+    acc += output_offset;
+    acc = acc < activation_min ? activation_min : acc;
+    acc = acc > activation_max ? activation_max : acc;
+    return static_cast<int8_t>(acc);
+  }
+};
+
+// 16x8 kernels (int16 activations, int8 weights) accumulate in 64 bits like
+// the reference kernels, but a 64-bit add costs two instructions and a 64-bit
+// multiply a library call. A single int16 * int8 product is at most 2^22 in
+// magnitude, so runs of up to kInt16x8Chunk products are summed in 32 bits and
+// only the partial sums are widened.
+constexpr int kInt16x8Chunk = 256;
+
+// acc[j] += in . w_j for two filters, with int16 inputs.
+inline void Dot1x2(const int16_t* in, const int8_t* w0, const int8_t* w1,
+                   int size, int64_t* acc) {
+  while (size > 0) {
+    const int chunk = size < kInt16x8Chunk ? size : kInt16x8Chunk;
+    int32_t acc0 = 0;
+    int32_t acc1 = 0;
+    for (int i = 0; i < chunk; ++i) {
+      const int32_t x = in[i];
+      acc0 += x * w0[i];
+      acc1 += x * w1[i];
+    }
+    acc[0] += acc0;
+    acc[1] += acc1;
+    in += chunk;
+    w0 += chunk;
+    w1 += chunk;
+    size -= chunk;
+  }
+}
+
+// acc[2 * i + j] += in_i . w_j for two inputs and two filters, with int16
+// inputs.
+inline void Dot2x2(const int16_t* in0, const int16_t* in1, const int8_t* w0,
+                   const int8_t* w1, int size, int64_t* acc) {
+  while (size > 0) {
+    const int chunk = size < kInt16x8Chunk ? size : kInt16x8Chunk;
+    int32_t acc00 = 0;
+    int32_t acc01 = 0;
+    int32_t acc10 = 0;
+    int32_t acc11 = 0;
+    for (int i = 0; i < chunk; ++i) {
+      const int32_t x0 = in0[i];
+      const int32_t x1 = in1[i];
+      const int32_t f0 = w0[i];
+      const int32_t f1 = w1[i];
+      acc00 += x0 * f0;
+      acc01 += x0 * f1;
+      acc10 += x1 * f0;
+      acc11 += x1 * f1;
+    }
+    acc[0] += acc00;
+    acc[1] += acc01;
+    acc[2] += acc10;
+    acc[3] += acc11;
+    in0 += chunk;
+    in1 += chunk;
+    w0 += chunk;
+    w1 += chunk;
+    size -= chunk;
+  }
+}
+
+// Requantization of 64-bit accumulators to int16. 16-bit activations are
+// symmetric, so unlike ChannelQuantization there is no output offset.
+struct ChannelQuantization16 {
+  int32_t multiplier;
+  int32_t shift;
+  int32_t activation_min;
+  int32_t activation_max;
+
+  int16_t Requantize(int64_t acc) const {
+    int32_t result = MultiplyByQuantizedMultiplier(acc, multiplier, shift);
+    result = result < activation_min ? activation_min : result;
+    result = result > activation_max ? activation_max : result;
+    return static_cast<int16_t>(result);
+  }
+};
+
+}  // namespace m0plus
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_COMMON_H_
@@ -0,0 +1,466 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/conv.h"
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+
+namespace tflite {
+namespace m0plus {
+namespace {
+
+struct ConvGeometry {
+  int batches;
+  int input_height;
+  int input_width;
+  int input_depth;
+  int filter_height;
+  int filter_width;
+  int output_height;
+  int output_width;
+  int output_depth;
+  int stride_height;
+  int stride_width;
+  int pad_height;
+  int pad_width;
+};
+
+// Output channels are processed in pairs: for each pair the filter rows, the
+// kernel sums and the requantization parameters are set up once and then
+// reused for every output pixel.
+struct ChannelPair {
+  const int8_t* filter[2];
+  // bias + input_offset * kernel sum, the start value of full windows.
+  int32_t base[2];
+  int32_t bias[2];
+  ChannelQuantization quantization[2];
+  int count;
+};
+
+void SetUpChannels(const ConvParams& params, const int32_t* output_multiplier,
+                   const int32_t* output_shift, const int8_t* filter_data,
+                   const int32_t* bias_data, const int32_t* folded_bias,
+                   int filter_size, int output_channel, int count,
+                   ChannelPair* pair) {
+  pair->count = count;
+  for (int i = 0; i < count; ++i) {
+    const int channel = output_channel + i;
+    pair->filter[i] = filter_data + channel * filter_size;
+    pair->bias[i] = bias_data ? bias_data[channel] : 0;
+    if (folded_bias) {
+      pair->base[i] = folded_bias[channel];
+    } else {
+      FoldInputOffset(pair->filter[i], 1, filter_size, &pair->bias[i],
+                      params.input_offset, &pair->base[i]);
+    }
+    pair->quantization[i].multiplier = output_multiplier[channel];
+    pair->quantization[i].shift = output_shift[channel];
+    pair->quantization[i].output_offset = params.output_offset;
+    pair->quantization[i].activation_min = params.quantized_activation_min;
+    pair->quantization[i].activation_max = params.quantized_activation_max;
+  }
+  // A single trailing channel is computed as a pair with itself.
+  if (count == 1) {
+    pair->filter[1] = pair->filter[0];
+    pair->base[1] = pair->base[0];
+    pair->bias[1] = pair->bias[0];
+  }
+}
+
+// 1x1 convolution without padding: every output pixel is the dot product of
+// one input pixel with each filter, so two pixels and two channels are
+// accumulated at a time.
+void Conv1x1(const ConvParams& params, const int32_t* output_multiplier,
+             const int32_t* output_shift, const ConvGeometry& g,
+             const int8_t* input_data, const int8_t* filter_data,
+             const int32_t* bias_data, const int32_t* folded_bias,
+             int8_t* output_data) {
+  const int depth = g.input_depth;
+
+  // With unit strides the input pixels of consecutive outputs are contiguous,
+  // so the whole tensor is a single row of pixels.
+  const bool contiguous = g.stride_height == 1 && g.stride_width == 1;
+  const int rows = contiguous ? 1 : g.batches * g.output_height;
+  const int columns =
+      contiguous ? g.batches * g.output_height * g.output_width
+                 : g.output_width;
+  const int column_stride = g.stride_width * depth;
+
+  for (int out_c = 0; out_c < g.output_depth; out_c += 2) {
+    ChannelPair pair;
+    SetUpChannels(params, output_multiplier, output_shift, filter_data,
+                  bias_data, folded_bias, depth, out_c,
+                  g.output_depth - out_c >= 2 ? 2 : 1, &pair);
+    const int32_t base0 = pair.base[0];
+    const int32_t base1 = pair.base[1];
+
+    for (int row = 0; row < rows; ++row) {
+      const int8_t* in;
+      int8_t* out;
+      if (contiguous) {
+        in = input_data;
+        out = output_data + out_c;
+      } else {
+        const int batch = row / g.output_height;
+        const int out_y = row % g.output_height;
+        in = input_data + ((batch * g.input_height + out_y * g.stride_height) *
+                           g.input_width) *
+                              depth;
+        out = output_data + row * g.output_width * g.output_depth + out_c;
+      }
+
+      int column = 0;
+      for (; column + 1 < columns; column += 2) {
+        int32_t acc[4] = {base0, base1, base0, base1};
+        Dot2x2(in, in + column_stride, pair.filter[0], pair.filter[1], depth,
+               acc);
+        out[0] = pair.quantization[0].Requantize(acc[0]);
+        out[g.output_depth] = pair.quantization[0].Requantize(acc[2]);
+        if (pair.count == 2) {
+          out[1] = pair.quantization[1].Requantize(acc[1]);
+          out[g.output_depth + 1] = pair.quantization[1].Requantize(acc[3]);
+        }
+        in += 2 * column_stride;
+        out += 2 * g.output_depth;
+      }
+      if (column < columns) {
+        int32_t acc[2] = {base0, base1};
+        Dot1x2(in, pair.filter[0], pair.filter[1], depth, acc);
+        out[0] = pair.quantization[0].Requantize(acc[0]);
+        if (pair.count == 2) {
+          out[1] = pair.quantization[1].Requantize(acc[1]);
+        }
+      }
+    }
+  }
+}
+
+// Accumulates the filter window of one output pixel whose window is clipped
+// by the image border. Padding contributes zero after the input offset is
+// applied, so the kernel sum is taken over the valid taps only.
+void AccumulateClippedWindow(const ConvGeometry& g, int32_t input_offset,
+                             const int8_t* input_data, const ChannelPair& pair,
+                             int batch, int in_y_origin, int in_x_origin,
+                             int32_t* acc) {
+  const int depth = g.input_depth;
+  const int filter_y_start = in_y_origin < 0 ? -in_y_origin : 0;
+  const int filter_y_end = g.input_height - in_y_origin < g.filter_height
+                               ? g.input_height - in_y_origin
+                               : g.filter_height;
+  const int filter_x_start = in_x_origin < 0 ? -in_x_origin : 0;
+  const int filter_x_end = g.input_width - in_x_origin < g.filter_width
+                               ? g.input_width - in_x_origin
+                               : g.filter_width;
+  if (filter_x_end <= filter_x_start) {
+    return;
+  }
+  const int segment = (filter_x_end - filter_x_start) * depth;
+  for (int filter_y = filter_y_start; filter_y < filter_y_end; ++filter_y) {
+    const int8_t* in =
+        input_data + ((batch * g.input_height + in_y_origin + filter_y) *
+                          g.input_width +
+                      in_x_origin + filter_x_start) *
+                         depth;
+    const int filter_offset =
+        (filter_y * g.filter_width + filter_x_start) * depth;
+    const int8_t* w0 = pair.filter[0] + filter_offset;
+    const int8_t* w1 = pair.filter[1] + filter_offset;
+    Dot1x2(in, w0, w1, segment, acc);
+    acc[0] += input_offset * Sum(w0, segment);
+    acc[1] += input_offset * Sum(w1, segment);
+  }
+}
+
+// Convolution with an arbitrary filter size. A filter row spans
+// filter_width * input_depth contiguous bytes in both the input and the
+// filter, so interior pixels are accumulated one filter row at a time.
+void ConvWindowed(const ConvParams& params, const int32_t* output_multiplier,
+                  const int32_t* output_shift, const ConvGeometry& g,
+                  const int8_t* input_data, const int8_t* filter_data,
+                  const int32_t* bias_data, const int32_t* folded_bias,
+                  int8_t* output_data) {
+  const int32_t input_offset = params.input_offset;
+  const int depth = g.input_depth;
+  const int filter_size = g.filter_height * g.filter_width * depth;
+  const int row_length = g.filter_width * depth;
+  const int input_row_stride = g.input_width * depth;
+  const int column_stride = g.stride_width * depth;
+
+  for (int out_c = 0; out_c < g.output_depth; out_c += 2) {
+    ChannelPair pair;
+    SetUpChannels(params, output_multiplier, output_shift, filter_data,
+                  bias_data, folded_bias, filter_size, out_c,
+                  g.output_depth - out_c >= 2 ? 2 : 1, &pair);
+    const int32_t base0 = pair.base[0];
+    const int32_t base1 = pair.base[1];
+
+    for (int batch = 0; batch < g.batches; ++batch) {
+      for (int out_y = 0; out_y < g.output_height; ++out_y) {
+        const int in_y_origin = out_y * g.stride_height - g.pad_height;
+        const bool rows_inside =
+            in_y_origin >= 0 &&
+            in_y_origin + g.filter_height <= g.input_height;
+        int8_t* out =
+            output_data +
+            ((batch * g.output_height + out_y) * g.output_width) *
+                g.output_depth +
+            out_c;
+
+        for (int out_x = 0; out_x < g.output_width;) {
+          const int in_x_origin = out_x * g.stride_width - g.pad_width;
+          const bool inside = rows_inside && in_x_origin >= 0 &&
+                              in_x_origin + g.filter_width <= g.input_width;
+          const bool next_inside =
+              inside && out_x + 1 < g.output_width &&
+              in_x_origin + g.stride_width + g.filter_width <= g.input_width;
+
+          if (next_inside) {
+            int32_t acc[4] = {base0, base1, base0, base1};
+            const int8_t* in =
+                input_data +
+                (batch * g.input_height + in_y_origin) * input_row_stride +
+                in_x_origin * depth;
+            for (int filter_y = 0; filter_y < g.filter_height; ++filter_y) {
+              const int filter_offset = filter_y * row_length;
+              Dot2x2(in, in + column_stride, pair.filter[0] + filter_offset,
+                     pair.filter[1] + filter_offset, row_length, acc);
+              in += input_row_stride;
+            }
+            out[0] = pair.quantization[0].Requantize(acc[0]);
+            out[g.output_depth] = pair.quantization[0].Requantize(acc[2]);
+            if (pair.count == 2) {
+              out[1] = pair.quantization[1].Requantize(acc[1]);
+              out[g.output_depth + 1] =
+                  pair.quantization[1].Requantize(acc[3]);
+            }
+            out += 2 * g.output_depth;
+            out_x += 2;
+            continue;
+          }
+
+          int32_t acc[2];
+          if (inside) {
+            acc[0] = base0;
+            acc[1] = base1;
+            const int8_t* in =
+                input_data +
+                (batch * g.input_height + in_y_origin) * input_row_stride +
+                in_x_origin * depth;
+            for (int filter_y = 0; filter_y < g.filter_height; ++filter_y) {
+              const int filter_offset = filter_y * row_length;
+              Dot1x2(in, pair.filter[0] + filter_offset,
+                     pair.filter[1] + filter_offset, row_length, acc);
+              in += input_row_stride;
+            }
+          } else {
+            acc[0] = pair.bias[0];
+            acc[1] = pair.bias[1];
+            AccumulateClippedWindow(g, input_offset, input_data, pair, batch,
+                                    in_y_origin, in_x_origin, acc);
+          }
+          out[0] = pair.quantization[0].Requantize(acc[0]);
+          if (pair.count == 2) {
+            out[1] = pair.quantization[1].Requantize(acc[1]);
+          }
+          out += g.output_depth;
+          ++out_x;
+        }
+      }
+    }
+  }
+}
+
+// 16x8 convolution with an arbitrary filter size. The valid part of every
+// filter row is contiguous in both the input and the filter, and with a zero
+// input offset the padding simply drops out of the sums.
+void ConvWindowed16x8(const ConvParams& params,
+                      const int32_t* output_multiplier,
+                      const int32_t* output_shift, const ConvGeometry& g,
+                      const int16_t* input_data, const int8_t* filter_data,
+                      const int64_t* bias_data, int16_t* output_data) {
+  const int depth = g.input_depth;
+  const int filter_size = g.filter_height * g.filter_width * depth;
+  const int row_length = g.filter_width * depth;
+  const int input_row_stride = g.input_width * depth;
+  const int column_stride = g.stride_width * depth;
+
+  for (int out_c = 0; out_c < g.output_depth; out_c += 2) {
+    const int count = g.output_depth - out_c >= 2 ? 2 : 1;
+    const int8_t* w0 = filter_data + out_c * filter_size;
+    // A single trailing channel is computed as a pair with itself.
+    const int8_t* w1 = count == 2 ? w0 + filter_size : w0;
+    int64_t bias[2] = {0, 0};
+    ChannelQuantization16 quantization[2];
+    for (int i = 0; i < count; ++i) {
+      bias[i] = bias_data ? bias_data[out_c + i] : 0;
+      quantization[i].multiplier = output_multiplier[out_c + i];
+      quantization[i].shift = output_shift[out_c + i];
+      quantization[i].activation_min = params.quantized_activation_min;
+      quantization[i].activation_max = params.quantized_activation_max;
+    }
+
+    for (int batch = 0; batch < g.batches; ++batch) {
+      for (int out_y = 0; out_y < g.output_height; ++out_y) {
+        const int in_y_origin = out_y * g.stride_height - g.pad_height;
+        const int filter_y_start = in_y_origin < 0 ? -in_y_origin : 0;
+        const int filter_y_end = g.input_height - in_y_origin < g.filter_height
+                                     ? g.input_height - in_y_origin
+                                     : g.filter_height;
+        const int16_t* input_rows =
+            input_data +
+            (batch * g.input_height + in_y_origin + filter_y_start) *
+                input_row_stride;
+        int16_t* out =
+            output_data +
+            ((batch * g.output_height + out_y) * g.output_width) *
+                g.output_depth +
+            out_c;
+
+        for (int out_x = 0; out_x < g.output_width;) {
+          const int in_x_origin = out_x * g.stride_width - g.pad_width;
+          const bool next_inside =
+              in_x_origin >= 0 && out_x + 1 < g.output_width &&
+              in_x_origin + g.stride_width + g.filter_width <= g.input_width;
+
+          if (next_inside) {
+            int64_t acc[4] = {bias[0], bias[1], bias[0], bias[1]};
+            const int16_t* in = input_rows + in_x_origin * depth;
+            for (int filter_y = filter_y_start; filter_y < filter_y_end;
+                 ++filter_y) {
+              const int filter_offset = filter_y * row_length;
+              Dot2x2(in, in + column_stride, w0 + filter_offset,
+                     w1 + filter_offset, row_length, acc);
+              in += input_row_stride;
+            }
+            out[0] = quantization[0].Requantize(acc[0]);
+            out[g.output_depth] = quantization[0].Requantize(acc[2]);
+            if (count == 2) {
+              out[1] = quantization[1].Requantize(acc[1]);
+              out[g.output_depth + 1] = quantization[1].Requantize(acc[3]);
+            }
+            out += 2 * g.output_depth;
+            out_x += 2;
+            continue;
+          }
+
+          int64_t acc[2] = {bias[0], bias[1]};
+          const int filter_x_start = in_x_origin < 0 ? -in_x_origin : 0;
+          const int filter_x_end = g.input_width - in_x_origin < g.filter_width
+                                       ? g.input_width - in_x_origin
+                                       : g.filter_width;
+          if (filter_x_end > filter_x_start) {
+            const int segment = (filter_x_end - filter_x_start) * depth;
+            const int16_t* in =
+                input_rows + (in_x_origin + filter_x_start) * depth;
+            for (int filter_y = filter_y_start; filter_y < filter_y_end;
+                 ++filter_y) {
+              const int filter_offset =
+                  filter_y * row_length + filter_x_start * depth;
+              Dot1x2(in, w0 + filter_offset, w1 + filter_offset, segment,
+                     acc);
+              in += input_row_stride;
+            }
+          }
+          out[0] = quantization[0].Requantize(acc[0]);
+          if (count == 2) {
+            out[1] = quantization[1].Requantize(acc[1]);
+          }
+          out += g.output_depth;
+          ++out_x;
+        }
+      }
+    }
+  }
+}
+
+ConvGeometry GetGeometry(const ConvParams& params,
+                         const RuntimeShape& input_shape,
+                         const RuntimeShape& filter_shape,
+                         const RuntimeShape& output_shape) {
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+
+  ConvGeometry g;
+  g.batches = MatchingDim(input_shape, 0, output_shape, 0);
+  g.input_height = input_shape.Dims(1);
+  g.input_width = input_shape.Dims(2);
+  g.input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  g.filter_height = filter_shape.Dims(1);
+  g.filter_width = filter_shape.Dims(2);
+  g.output_height = output_shape.Dims(1);
+  g.output_width = output_shape.Dims(2);
+  g.output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  g.stride_height = params.stride_height;
+  g.stride_width = params.stride_width;
+  g.pad_height = params.padding_values.height;
+  g.pad_width = params.padding_values.width;
+  return g;
+}
+
+}  // namespace
+
+bool ConvPerChannelSupported(const ConvParams& params) {
+  return params.dilation_height_factor == 1 &&
+         params.dilation_width_factor == 1;
+}
+
+void ConvPerChannel(const ConvParams& params, const int32_t* output_multiplier,
+                    const int32_t* output_shift,
+                    const RuntimeShape& input_shape, const int8_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int32_t* bias_data,
+                    const RuntimeShape& output_shape, int8_t* output_data,
+                    const int32_t* folded_bias) {
+  TFLITE_DCHECK(ConvPerChannelSupported(params));
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  const ConvGeometry g =
+      GetGeometry(params, input_shape, filter_shape, output_shape);
+  if (bias_data) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), g.output_depth);
+  }
+
+  if (g.filter_height == 1 && g.filter_width == 1 && g.pad_height == 0 &&
+      g.pad_width == 0) {
+    Conv1x1(params, output_multiplier, output_shift, g, input_data,
+            filter_data, bias_data, folded_bias, output_data);
+  } else {
+    ConvWindowed(params, output_multiplier, output_shift, g, input_data,
+                 filter_data, bias_data, folded_bias, output_data);
+  }
+}
+
+void ConvPerChannel(const ConvParams& params, const int32_t* output_multiplier,
+                    const int32_t* output_shift,
+                    const RuntimeShape& input_shape, const int16_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int64_t* bias_data,
+                    const RuntimeShape& output_shape, int16_t* output_data) {
+  TFLITE_DCHECK(ConvPerChannelSupported(params));
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  const ConvGeometry g =
+      GetGeometry(params, input_shape, filter_shape, output_shape);
+  if (bias_data) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), g.output_depth);
+  }
+  ConvWindowed16x8(params, output_multiplier, output_shift, g, input_data,
+                   filter_data, bias_data, output_data);
+}
+
+}  // namespace m0plus
+}  // namespace tflite
@@ -0,0 +1,61 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_CONV_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_CONV_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace m0plus {
+
+// Returns true if ConvPerChannel() handles convolutions with these
+// parameters. Dilated convolutions are left to the reference kernel.
+bool ConvPerChannelSupported(const ConvParams& params);
+
+// Int8 per-channel convolution for the Cortex-M0+, bit-exact with
+// reference_integer_ops::ConvPerChannel(). 1x1 convolutions without padding
+// run as a matrix multiplication over all output pixels; other filter sizes
+// (3x3 in particular) use a windowed kernel that only checks the image
+// borders once per output pixel.
+//
+// `folded_bias` optionally holds the per-channel result of FoldInputOffset()
+// over the filter, which saves summing every filter on each call.
+void ConvPerChannel(const ConvParams& params, const int32_t* output_multiplier,
+                    const int32_t* output_shift,
+                    const RuntimeShape& input_shape, const int8_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int32_t* bias_data,
+                    const RuntimeShape& output_shape, int8_t* output_data,
+                    const int32_t* folded_bias = nullptr);
+
+// 16x8 per-channel convolution (int16 activations, int8 weights) for the
+// Cortex-M0+, bit-exact with the int16 reference_integer_ops::ConvPerChannel().
+// The input is symmetric, so taps in the padding are skipped instead of being
+// offset, and each filter row is summed in 32 bits before being added to the
+// 64-bit accumulators. Two output channels and, away from the left and right
+// borders, two output pixels are computed at a time.
+void ConvPerChannel(const ConvParams& params, const int32_t* output_multiplier,
+                    const int32_t* output_shift,
+                    const RuntimeShape& input_shape, const int16_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int64_t* bias_data,
+                    const RuntimeShape& output_shape, int16_t* output_data);
+
+}  // namespace m0plus
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_CONV_H_
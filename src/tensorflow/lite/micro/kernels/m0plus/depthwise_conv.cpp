@@ -0,0 +1,261 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/depthwise_conv.h"
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+
+namespace tflite {
+namespace m0plus {
+namespace {
+
+constexpr int kFilterSize = 3;
+
+// The nine weights of one output channel.
+struct Filter3x3 {
+  int32_t w[kFilterSize * kFilterSize];
+};
+
+// Accumulates the full 3x3 window whose top-left input element is at `in`.
+// `column` and `row` are the distances between horizontally and vertically
+// adjacent input elements of the same channel.
+template <typename Input>
+inline int32_t Window(const Input* in, int column, int row,
+                      const Filter3x3& f) {
+  const Input* in1 = in + row;
+  const Input* in2 = in1 + row;
+  return in[0] * f.w[0] + in[column] * f.w[1] + in[2 * column] * f.w[2] +
+         in1[0] * f.w[3] + in1[column] * f.w[4] + in1[2 * column] * f.w[5] +
+         in2[0] * f.w[6] + in2[column] * f.w[7] + in2[2 * column] * f.w[8];
+}
+
+// Accumulates the full windows of two horizontally adjacent output pixels,
+// loading each of the overlapping input columns only once.
+template <int kStride, typename Input, typename Acc>
+inline void WindowPair(const Input* in, int column, int row,
+                       const Filter3x3& f, Acc* acc0, Acc* acc1) {
+  int32_t sum0 = 0;
+  int32_t sum1 = 0;
+  for (int y = 0; y < kFilterSize; ++y) {
+    int32_t x[kStride + kFilterSize];
+    for (int i = 0; i < kStride + kFilterSize; ++i) {
+      x[i] = in[i * column];
+    }
+    const int32_t* w = &f.w[y * kFilterSize];
+    sum0 += x[0] * w[0] + x[1] * w[1] + x[2] * w[2];
+    sum1 += x[kStride] * w[0] + x[kStride + 1] * w[1] + x[kStride + 2] * w[2];
+    in += row;
+  }
+  *acc0 += sum0;
+  *acc1 += sum1;
+}
+
+// The requantization of each output type.
+template <typename Output>
+struct Requantization;
+
+template <>
+struct Requantization<int8_t> {
+  using Type = ChannelQuantization;
+};
+
+template <>
+struct Requantization<int16_t> {
+  using Type = ChannelQuantization16;
+};
+
+void SetUpQuantization(const DepthwiseParams& params, int32_t multiplier,
+                       int32_t shift, ChannelQuantization* quantization) {
+  quantization->multiplier = multiplier;
+  quantization->shift = shift;
+  quantization->output_offset = params.output_offset;
+  quantization->activation_min = params.quantized_activation_min;
+  quantization->activation_max = params.quantized_activation_max;
+}
+
+void SetUpQuantization(const DepthwiseParams& params, int32_t multiplier,
+                       int32_t shift, ChannelQuantization16* quantization) {
+  quantization->multiplier = multiplier;
+  quantization->shift = shift;
+  quantization->activation_min = params.quantized_activation_min;
+  quantization->activation_max = params.quantized_activation_max;
+}
+
+// The 3x3 kernel for int8 and 16x8 inputs. Window sums fit in 32 bits either
+// way; they are added to accumulators of the bias type.
+template <typename Input, typename Bias, typename Output>
+void DepthwiseConv3x3(const DepthwiseParams& params, int32_t input_offset,
+                      const int32_t* output_multiplier,
+                      const int32_t* output_shift,
+                      const RuntimeShape& input_shape, const Input* input_data,
+                      const RuntimeShape& filter_shape,
+                      const int8_t* filter_data,
+                      const RuntimeShape& bias_shape, const Bias* bias_data,
+                      const RuntimeShape& output_shape, Output* output_data) {
+  TFLITE_DCHECK(DepthwiseConvPerChannelSupported(params, filter_shape));
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  TFLITE_DCHECK_EQ(output_depth, input_depth * depth_multiplier);
+  if (bias_data) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  }
+
+  const int column = input_depth;
+  const int row = input_width * input_depth;
+
+  for (int batch = 0; batch < batches; ++batch) {
+    const Input* batch_input =
+        input_data + batch * input_height * input_width * input_depth;
+    Output* batch_output =
+        output_data + batch * output_height * output_width * output_depth;
+
+    for (int in_c = 0; in_c < input_depth; ++in_c) {
+      for (int m = 0; m < depth_multiplier; ++m) {
+        const int out_c = in_c * depth_multiplier + m;
+
+        Filter3x3 filter;
+        int32_t kernel_sum = 0;
+        for (int i = 0; i < kFilterSize * kFilterSize; ++i) {
+          filter.w[i] = filter_data[i * output_depth + out_c];
+          kernel_sum += filter.w[i];
+        }
+        const Bias bias = bias_data ? bias_data[out_c] : 0;
+        const Bias base = bias + input_offset * kernel_sum;
+        typename Requantization<Output>::Type quantization;
+        SetUpQuantization(params, output_multiplier[out_c],
+                          output_shift[out_c], &quantization);
+
+        const Input* channel_input = batch_input + in_c;
+        for (int out_y = 0; out_y < output_height; ++out_y) {
+          const int in_y_origin = out_y * stride_height - pad_height;
+          const bool rows_inside = in_y_origin >= 0 &&
+                                   in_y_origin + kFilterSize <= input_height;
+          Output* out =
+              batch_output + out_y * output_width * output_depth + out_c;
+
+          for (int out_x = 0; out_x < output_width;) {
+            const int in_x_origin = out_x * stride_width - pad_width;
+            const bool inside = rows_inside && in_x_origin >= 0 &&
+                                in_x_origin + kFilterSize <= input_width;
+
+            if (inside && stride_width <= 2 && out_x + 1 < output_width &&
+                in_x_origin + stride_width + kFilterSize <= input_width) {
+              const Input* in =
+                  channel_input + in_y_origin * row + in_x_origin * column;
+              Bias acc0 = base;
+              Bias acc1 = base;
+              if (stride_width == 1) {
+                WindowPair<1>(in, column, row, filter, &acc0, &acc1);
+              } else {
+                WindowPair<2>(in, column, row, filter, &acc0, &acc1);
+              }
+              out[0] = quantization.Requantize(acc0);
+              out[output_depth] = quantization.Requantize(acc1);
+              out += 2 * output_depth;
+              out_x += 2;
+              continue;
+            }
+
+            Bias acc;
+            if (inside) {
+              acc = base + Window(channel_input + in_y_origin * row +
+                                      in_x_origin * column,
+                                  column, row, filter);
+            } else {
+              // Padding contributes zero once the input offset is applied,
+              // so border pixels add the offset per valid tap.
+              acc = bias;
+              for (int filter_y = 0; filter_y < kFilterSize; ++filter_y) {
+                const int in_y = in_y_origin + filter_y;
+                if (in_y < 0 || in_y >= input_height) {
+                  continue;
+                }
+                for (int filter_x = 0; filter_x < kFilterSize; ++filter_x) {
+                  const int in_x = in_x_origin + filter_x;
+                  if (in_x < 0 || in_x >= input_width) {
+                    continue;
+                  }
+                  acc += (channel_input[in_y * row + in_x * column] +
+                          input_offset) *
+                         filter.w[filter_y * kFilterSize + filter_x];
+                }
+              }
+            }
+            out[0] = quantization.Requantize(acc);
+            out += output_depth;
+            ++out_x;
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+bool DepthwiseConvPerChannelSupported(const DepthwiseParams& params,
+                                      const RuntimeShape& filter_shape) {
+  return params.dilation_height_factor == 1 &&
+         params.dilation_width_factor == 1 &&
+         filter_shape.Dims(1) == kFilterSize &&
+         filter_shape.Dims(2) == kFilterSize;
+}
+
+void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data) {
+  DepthwiseConv3x3(params, params.input_offset, output_multiplier,
+                   output_shift, input_shape, input_data, filter_shape,
+                   filter_data, bias_shape, bias_data, output_shape,
+                   output_data);
+}
+
+void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int16_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int64_t* bias_data, const RuntimeShape& output_shape,
+    int16_t* output_data) {
+  // 16-bit activations are symmetric.
+  DepthwiseConv3x3(params, 0, output_multiplier, output_shift, input_shape,
+                   input_data, filter_shape, filter_data, bias_shape,
+                   bias_data, output_shape, output_data);
+}
+
+}  // namespace m0plus
+}  // namespace tflite
@@ -0,0 +1,58 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_DEPTHWISE_CONV_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_DEPTHWISE_CONV_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace m0plus {
+
+// Returns true if DepthwiseConvPerChannel() handles depthwise convolutions
+// with these parameters: 3x3 filters without dilation, any stride, padding
+// and depth multiplier.
+bool DepthwiseConvPerChannelSupported(const DepthwiseParams& params,
+                                      const RuntimeShape& filter_shape);
+
+// Int8 per-channel 3x3 depthwise convolution for the Cortex-M0+, bit-exact
+// with reference_integer_ops::DepthwiseConvPerChannel(). Each output channel
+// keeps its nine weights in registers while sweeping the image, and
+// neighbouring output pixels share the input columns they overlap on.
+void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data);
+
+// 16x8 variant (int16 activations, int8 weights), bit-exact with the int16
+// reference_integer_ops::DepthwiseConvPerChannel(). It shares the int8 kernel:
+// nine products fit in 32 bits, so only the bias and the accumulators are 64
+// bits wide.
+void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int16_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int64_t* bias_data, const RuntimeShape& output_shape,
+    int16_t* output_data);
+
+}  // namespace m0plus
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_DEPTHWISE_CONV_H_
@@ -0,0 +1,200 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/depthwise_conv.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kMaxInputSize = 16 * 16 * 32 * 2;
+constexpr int kMaxChannels = 32;
+constexpr int kMaxOutputSize = 16 * 16 * 32 * 2;
+
+int8_t g_input[kMaxInputSize];
+int8_t g_filter[3 * 3 * kMaxChannels];
+int32_t g_bias[kMaxChannels];
+int32_t g_multiplier[kMaxChannels];
+int32_t g_shift[kMaxChannels];
+int8_t g_expected[kMaxOutputSize];
+int8_t g_output[kMaxOutputSize];
+int16_t g_input16[kMaxInputSize];
+int64_t g_bias64[kMaxChannels];
+int16_t g_expected16[kMaxOutputSize];
+int16_t g_output16[kMaxOutputSize];
+
+tflite::testing::Random g_random;
+
+void Fill(int8_t* data, int size) {
+  for (int i = 0; i < size; ++i) {
+    data[i] = static_cast<int8_t>(g_random.Int(-128, 127));
+  }
+}
+
+// Runs both kernels on random data and expects identical outputs.
+void TestMatchesReference(int batches, int height, int width, int in_depth,
+                          int depth_multiplier, int stride, int padding,
+                          bool with_bias) {
+  const int out_depth = in_depth * depth_multiplier;
+  const int out_height = (height + 2 * padding - 3) / stride + 1;
+  const int out_width = (width + 2 * padding - 3) / stride + 1;
+  const tflite::RuntimeShape input_shape({batches, height, width, in_depth});
+  const tflite::RuntimeShape filter_shape({1, 3, 3, out_depth});
+  const tflite::RuntimeShape bias_shape({out_depth});
+  const tflite::RuntimeShape output_shape(
+      {batches, out_height, out_width, out_depth});
+  TF_LITE_MICRO_EXPECT_LE(input_shape.FlatSize(), kMaxInputSize);
+  TF_LITE_MICRO_EXPECT_LE(out_depth, kMaxChannels);
+  TF_LITE_MICRO_EXPECT_LE(output_shape.FlatSize(), kMaxOutputSize);
+
+  Fill(g_input, input_shape.FlatSize());
+  Fill(g_filter, filter_shape.FlatSize());
+  for (int c = 0; c < out_depth; ++c) {
+    g_bias[c] = g_random.Int(-5000, 5000);
+    g_multiplier[c] = g_random.Int(1 << 30, 0x7fffffff);
+    g_shift[c] = g_random.Int(-10, -4);
+  }
+
+  tflite::DepthwiseParams params;
+  params.input_offset = g_random.Int(-127, 128);
+  params.weights_offset = 0;
+  params.output_offset = g_random.Int(-128, 127);
+  params.stride_height = stride;
+  params.stride_width = stride;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.padding_values.height = padding;
+  params.padding_values.width = padding;
+  params.depth_multiplier = depth_multiplier;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = g_random.Int(0, 127);
+  const int32_t* bias = with_bias ? g_bias : nullptr;
+
+  tflite::reference_integer_ops::DepthwiseConvPerChannel(
+      params, g_multiplier, g_shift, input_shape, g_input, filter_shape,
+      g_filter, bias_shape, bias, output_shape, g_expected);
+  TF_LITE_MICRO_EXPECT(
+      tflite::m0plus::DepthwiseConvPerChannelSupported(params, filter_shape));
+  tflite::m0plus::DepthwiseConvPerChannel(
+      params, g_multiplier, g_shift, input_shape, g_input, filter_shape,
+      g_filter, bias_shape, bias, output_shape, g_output);
+
+  for (int i = 0; i < output_shape.FlatSize(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+// Runs the 16x8 kernels on random data and expects identical outputs. With
+// `extreme` set, every input is -32768 and every weight -128.
+void TestMatchesReference16x8(int batches, int height, int width,
+                              int in_depth, int depth_multiplier, int stride,
+                              int padding, bool with_bias,
+                              bool extreme = false) {
+  const int out_depth = in_depth * depth_multiplier;
+  const int out_height = (height + 2 * padding - 3) / stride + 1;
+  const int out_width = (width + 2 * padding - 3) / stride + 1;
+  const tflite::RuntimeShape input_shape({batches, height, width, in_depth});
+  const tflite::RuntimeShape filter_shape({1, 3, 3, out_depth});
+  const tflite::RuntimeShape bias_shape({out_depth});
+  const tflite::RuntimeShape output_shape(
+      {batches, out_height, out_width, out_depth});
+  TF_LITE_MICRO_EXPECT_LE(input_shape.FlatSize(), kMaxInputSize);
+  TF_LITE_MICRO_EXPECT_LE(out_depth, kMaxChannels);
+  TF_LITE_MICRO_EXPECT_LE(output_shape.FlatSize(), kMaxOutputSize);
+
+  for (int i = 0; i < input_shape.FlatSize(); ++i) {
+    g_input16[i] =
+        extreme ? -32768 : static_cast<int16_t>(g_random.Int(-32768, 32767));
+  }
+  for (int i = 0; i < filter_shape.FlatSize(); ++i) {
+    g_filter[i] = extreme ? -128 : static_cast<int8_t>(g_random.Int(-127, 127));
+  }
+  for (int c = 0; c < out_depth; ++c) {
+    g_bias64[c] = static_cast<int64_t>(g_random.Int(-(1 << 30), 1 << 30)) * 64;
+    g_multiplier[c] = g_random.Int(1 << 30, 0x7fffffff);
+    g_shift[c] = g_random.Int(-16, -8);
+  }
+
+  tflite::DepthwiseParams params;
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  params.stride_height = stride;
+  params.stride_width = stride;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.padding_values.height = padding;
+  params.padding_values.width = padding;
+  params.depth_multiplier = depth_multiplier;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = g_random.Int(0, 32767);
+  const int64_t* bias = with_bias ? g_bias64 : nullptr;
+
+  tflite::reference_integer_ops::DepthwiseConvPerChannel(
+      params, g_multiplier, g_shift, input_shape, g_input16, filter_shape,
+      g_filter, bias_shape, bias, output_shape, g_expected16);
+  tflite::m0plus::DepthwiseConvPerChannel(
+      params, g_multiplier, g_shift, input_shape, g_input16, filter_shape,
+      g_filter, bias_shape, bias, output_shape, g_output16);
+
+  for (int i = 0; i < output_shape.FlatSize(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected16[i], g_output16[i]);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(DepthwiseConv3x3Stride1MatchesReference) {
+  TestMatchesReference(1, 16, 16, 32, 1, 1, 1, true);
+  TestMatchesReference(1, 7, 9, 5, 1, 1, 1, true);
+  TestMatchesReference(2, 6, 6, 3, 1, 1, 0, false);
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv3x3Stride2MatchesReference) {
+  TestMatchesReference(1, 16, 16, 16, 1, 2, 1, true);
+  TestMatchesReference(1, 9, 11, 4, 1, 2, 0, true);
+  TestMatchesReference(1, 8, 8, 4, 1, 3, 1, true);
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv3x3MultiplierMatchesReference) {
+  TestMatchesReference(1, 16, 16, 1, 8, 2, 1, true);
+  TestMatchesReference(1, 5, 6, 3, 2, 1, 1, false);
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv3x316x8MatchesReference) {
+  TestMatchesReference16x8(1, 16, 16, 32, 1, 1, 1, true);
+  TestMatchesReference16x8(2, 9, 11, 4, 1, 2, 0, false);
+  TestMatchesReference16x8(1, 5, 6, 3, 2, 1, 1, true);
+  TestMatchesReference16x8(1, 7, 7, 8, 1, 1, 1, true, true);
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConvOtherFiltersAreNotSupported) {
+  tflite::DepthwiseParams params;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  TF_LITE_MICRO_EXPECT(!tflite::m0plus::DepthwiseConvPerChannelSupported(
+      params, tflite::RuntimeShape({1, 5, 5, 8})));
+  params.dilation_width_factor = 2;
+  TF_LITE_MICRO_EXPECT(!tflite::m0plus::DepthwiseConvPerChannelSupported(
+      params, tflite::RuntimeShape({1, 3, 3, 8})));
+}
+
+TF_LITE_MICRO_TESTS_END
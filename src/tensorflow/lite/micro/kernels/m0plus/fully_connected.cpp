@@ -0,0 +1,153 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/fully_connected.h"
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+
+namespace tflite {
+namespace m0plus {
+
+bool FullyConnectedSupported(const FullyConnectedParams& params) {
+  return params.weights_offset == 0;
+}
+
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const int8_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int32_t* bias_data,
+                    const RuntimeShape& output_shape, int8_t* output_data,
+                    const int32_t* folded_bias) {
+  TFLITE_DCHECK(FullyConnectedSupported(params));
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_GE(filter_shape.DimensionsCount(), 2);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 2);
+
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = output_shape.Dims(0);
+  const int output_depth = output_shape.Dims(1);
+  TFLITE_DCHECK_LE(output_depth, filter_shape.Dims(filter_dim_count - 2));
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  ChannelQuantization quantization;
+  quantization.multiplier = params.output_multiplier;
+  quantization.shift = params.output_shift;
+  quantization.output_offset = params.output_offset;
+  quantization.activation_min = params.quantized_activation_min;
+  quantization.activation_max = params.quantized_activation_max;
+
+  for (int out_c = 0; out_c < output_depth; out_c += 2) {
+    const int count = output_depth - out_c >= 2 ? 2 : 1;
+    const int8_t* w0 = filter_data + out_c * accum_depth;
+    // A single trailing channel is computed as a pair with itself.
+    const int8_t* w1 = count == 2 ? w0 + accum_depth : w0;
+    int32_t base[2];
+    if (folded_bias) {
+      base[0] = folded_bias[out_c];
+      base[1] = folded_bias[out_c + count - 1];
+    } else {
+      FoldInputOffset(w0, 1, accum_depth,
+                      bias_data ? &bias_data[out_c] : nullptr,
+                      params.input_offset, &base[0]);
+      FoldInputOffset(w1, 1, accum_depth,
+                      bias_data ? &bias_data[out_c + count - 1] : nullptr,
+                      params.input_offset, &base[1]);
+    }
+
+    int b = 0;
+    for (; b + 1 < batches; b += 2) {
+      const int8_t* in = input_data + b * accum_depth;
+      int32_t acc[4] = {base[0], base[1], base[0], base[1]};
+      Dot2x2(in, in + accum_depth, w0, w1, accum_depth, acc);
+      int8_t* out = output_data + b * output_depth + out_c;
+      out[0] = quantization.Requantize(acc[0]);
+      out[output_depth] = quantization.Requantize(acc[2]);
+      if (count == 2) {
+        out[1] = quantization.Requantize(acc[1]);
+        out[output_depth + 1] = quantization.Requantize(acc[3]);
+      }
+    }
+    if (b < batches) {
+      int32_t acc[2] = {base[0], base[1]};
+      Dot1x2(input_data + b * accum_depth, w0, w1, accum_depth, acc);
+      int8_t* out = output_data + b * output_depth + out_c;
+      out[0] = quantization.Requantize(acc[0]);
+      if (count == 2) {
+        out[1] = quantization.Requantize(acc[1]);
+      }
+    }
+  }
+}
+
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const int16_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int64_t* bias_data,
+                    const RuntimeShape& output_shape, int16_t* output_data) {
+  TFLITE_DCHECK(FullyConnectedSupported(params));
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_GE(filter_shape.DimensionsCount(), 2);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 2);
+
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = output_shape.Dims(0);
+  const int output_depth = output_shape.Dims(1);
+  TFLITE_DCHECK_LE(output_depth, filter_shape.Dims(filter_dim_count - 2));
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  ChannelQuantization16 quantization;
+  quantization.multiplier = params.output_multiplier;
+  quantization.shift = params.output_shift;
+  quantization.activation_min = params.quantized_activation_min;
+  quantization.activation_max = params.quantized_activation_max;
+
+  for (int out_c = 0; out_c < output_depth; out_c += 2) {
+    const int count = output_depth - out_c >= 2 ? 2 : 1;
+    const int8_t* w0 = filter_data + out_c * accum_depth;
+    // A single trailing channel is computed as a pair with itself.
+    const int8_t* w1 = count == 2 ? w0 + accum_depth : w0;
+    const int64_t bias0 = bias_data ? bias_data[out_c] : 0;
+    const int64_t bias1 = bias_data ? bias_data[out_c + count - 1] : 0;
+
+    int b = 0;
+    for (; b + 1 < batches; b += 2) {
+      const int16_t* in = input_data + b * accum_depth;
+      int64_t acc[4] = {bias0, bias1, bias0, bias1};
+      Dot2x2(in, in + accum_depth, w0, w1, accum_depth, acc);
+      int16_t* out = output_data + b * output_depth + out_c;
+      out[0] = quantization.Requantize(acc[0]);
+      out[output_depth] = quantization.Requantize(acc[2]);
+      if (count == 2) {
+        out[1] = quantization.Requantize(acc[1]);
+        out[output_depth + 1] = quantization.Requantize(acc[3]);
+      }
+    }
+    if (b < batches) {
+      int64_t acc[2] = {bias0, bias1};
+      Dot1x2(input_data + b * accum_depth, w0, w1, accum_depth, acc);
+      int16_t* out = output_data + b * output_depth + out_c;
+      out[0] = quantization.Requantize(acc[0]);
+      if (count == 2) {
+        out[1] = quantization.Requantize(acc[1]);
+      }
+    }
+  }
+}
+
+}  // namespace m0plus
+}  // namespace tflite
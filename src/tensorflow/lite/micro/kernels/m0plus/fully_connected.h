@@ -0,0 +1,55 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_FULLY_CONNECTED_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_FULLY_CONNECTED_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace m0plus {
+
+// Returns true if FullyConnected() handles these parameters. Weights with a
+// non-zero zero point (never produced for int8) are left to the reference
+// kernel.
+bool FullyConnectedSupported(const FullyConnectedParams& params);
+
+// Int8 fully connected layer for the Cortex-M0+, bit-exact with
+// reference_integer_ops::FullyConnected(). Two output channels (and two
+// batches, if there are several) are accumulated at a time.
+//
+// `folded_bias` optionally holds the per-channel result of FoldInputOffset()
+// over the weights, which saves summing every weight row on each call.
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const int8_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int32_t* bias_data,
+                    const RuntimeShape& output_shape, int8_t* output_data,
+                    const int32_t* folded_bias = nullptr);
+
+// 16x8 fully connected layer (int16 activations, int8 weights) for the
+// Cortex-M0+, bit-exact with the int16 reference_integer_ops::FullyConnected().
+// Products are summed in 32 bits between 64-bit accumulations.
+void FullyConnected(const FullyConnectedParams& params,
+                    const RuntimeShape& input_shape, const int16_t* input_data,
+                    const RuntimeShape& filter_shape, const int8_t* filter_data,
+                    const RuntimeShape& bias_shape, const int64_t* bias_data,
+                    const RuntimeShape& output_shape, int16_t* output_data);
+
+}  // namespace m0plus
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_FULLY_CONNECTED_H_
@@ -0,0 +1,181 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/fully_connected.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/m0plus/common.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kMaxBatches = 3;
+constexpr int kMaxDepth = 256;
+constexpr int kMaxChannels = 33;
+
+int8_t g_input[kMaxBatches * kMaxDepth];
+int8_t g_filter[kMaxChannels * kMaxDepth];
+int32_t g_bias[kMaxChannels];
+int32_t g_folded_bias[kMaxChannels];
+int8_t g_expected[kMaxBatches * kMaxChannels];
+int8_t g_output[kMaxBatches * kMaxChannels];
+
+// 16x8 rows are longer than one accumulation chunk.
+constexpr int kMaxDepth16 = 600;
+
+int16_t g_input16[kMaxBatches * kMaxDepth16];
+int8_t g_filter16[kMaxChannels * kMaxDepth16];
+int64_t g_bias64[kMaxChannels];
+int16_t g_expected16[kMaxBatches * kMaxChannels];
+int16_t g_output16[kMaxBatches * kMaxChannels];
+
+tflite::testing::Random g_random;
+
+void Fill(int8_t* data, int size) {
+  for (int i = 0; i < size; ++i) {
+    data[i] = static_cast<int8_t>(g_random.Int(-128, 127));
+  }
+}
+
+// Runs both kernels on random data, with and without folded bias, and expects
+// identical outputs.
+void TestMatchesReference(int batches, int depth, int channels,
+                          bool with_bias) {
+  const tflite::RuntimeShape input_shape({batches, depth});
+  const tflite::RuntimeShape filter_shape({channels, depth});
+  const tflite::RuntimeShape bias_shape({channels});
+  const tflite::RuntimeShape output_shape({batches, channels});
+  TF_LITE_MICRO_EXPECT_LE(batches, kMaxBatches);
+  TF_LITE_MICRO_EXPECT_LE(depth, kMaxDepth);
+  TF_LITE_MICRO_EXPECT_LE(channels, kMaxChannels);
+
+  Fill(g_input, input_shape.FlatSize());
+  Fill(g_filter, filter_shape.FlatSize());
+  for (int c = 0; c < channels; ++c) {
+    g_bias[c] = g_random.Int(-20000, 20000);
+  }
+
+  tflite::FullyConnectedParams params;
+  params.input_offset = g_random.Int(-127, 128);
+  params.weights_offset = 0;
+  params.output_offset = g_random.Int(-128, 127);
+  params.output_multiplier = g_random.Int(1 << 30, 0x7fffffff);
+  params.output_shift = g_random.Int(-12, -6);
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = g_random.Int(0, 127);
+  const int32_t* bias = with_bias ? g_bias : nullptr;
+
+  tflite::reference_integer_ops::FullyConnected(
+      params, input_shape, g_input, filter_shape, g_filter, bias_shape, bias,
+      output_shape, g_expected);
+  TF_LITE_MICRO_EXPECT(tflite::m0plus::FullyConnectedSupported(params));
+
+  tflite::m0plus::FullyConnected(params, input_shape, g_input, filter_shape,
+                                 g_filter, bias_shape, bias, output_shape,
+                                 g_output);
+  for (int i = 0; i < output_shape.FlatSize(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+
+  tflite::m0plus::FoldInputOffset(g_filter, channels, depth, bias,
+                                  params.input_offset, g_folded_bias);
+  tflite::m0plus::FullyConnected(params, input_shape, g_input, filter_shape,
+                                 g_filter, bias_shape, bias, output_shape,
+                                 g_output, g_folded_bias);
+  for (int i = 0; i < output_shape.FlatSize(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+// Runs the 16x8 kernels on random data and expects identical outputs. With
+// `extreme` set, every input is -32768 and every weight -128.
+void TestMatchesReference16x8(int batches, int depth, int channels,
+                              bool with_bias, bool extreme = false) {
+  const tflite::RuntimeShape input_shape({batches, depth});
+  const tflite::RuntimeShape filter_shape({channels, depth});
+  const tflite::RuntimeShape bias_shape({channels});
+  const tflite::RuntimeShape output_shape({batches, channels});
+  TF_LITE_MICRO_EXPECT_LE(batches, kMaxBatches);
+  TF_LITE_MICRO_EXPECT_LE(depth, kMaxDepth16);
+  TF_LITE_MICRO_EXPECT_LE(channels, kMaxChannels);
+
+  for (int i = 0; i < input_shape.FlatSize(); ++i) {
+    g_input16[i] =
+        extreme ? -32768 : static_cast<int16_t>(g_random.Int(-32768, 32767));
+  }
+  for (int i = 0; i < filter_shape.FlatSize(); ++i) {
+    g_filter16[i] =
+        extreme ? -128 : static_cast<int8_t>(g_random.Int(-127, 127));
+  }
+  for (int c = 0; c < channels; ++c) {
+    g_bias64[c] = static_cast<int64_t>(g_random.Int(-(1 << 30), 1 << 30)) * 64;
+  }
+
+  tflite::FullyConnectedParams params;
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  params.output_multiplier = g_random.Int(1 << 30, 0x7fffffff);
+  params.output_shift = g_random.Int(-24, -16);
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = g_random.Int(0, 32767);
+  const int64_t* bias = with_bias ? g_bias64 : nullptr;
+
+  tflite::reference_integer_ops::FullyConnected(
+      params, input_shape, g_input16, filter_shape, g_filter16, bias_shape,
+      bias, output_shape, g_expected16);
+  TF_LITE_MICRO_EXPECT(tflite::m0plus::FullyConnectedSupported(params));
+  tflite::m0plus::FullyConnected(params, input_shape, g_input16, filter_shape,
+                                 g_filter16, bias_shape, bias, output_shape,
+                                 g_output16);
+  for (int i = 0; i < output_shape.FlatSize(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected16[i], g_output16[i]);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FullyConnectedMatchesReference) {
+  TestMatchesReference(1, 256, 32, true);
+  TestMatchesReference(1, 250, 33, true);
+  TestMatchesReference(2, 64, 4, false);
+  TestMatchesReference(3, 17, 1, true);
+}
+
+TF_LITE_MICRO_TEST(FullyConnected16x8MatchesReference) {
+  TestMatchesReference16x8(1, 256, 32, true);
+  TestMatchesReference16x8(2, 250, 33, true);
+  TestMatchesReference16x8(3, 17, 1, false);
+  TestMatchesReference16x8(3, 600, 5, true);
+}
+
+TF_LITE_MICRO_TEST(FullyConnected16x8LongRowsMatchReference) {
+  // Sums of the extreme products overflow 32 bits after 512 of them.
+  TestMatchesReference16x8(1, 600, 3, true, true);
+  TestMatchesReference16x8(3, 513, 2, false, true);
+}
+
+TF_LITE_MICRO_TEST(FullyConnectedWithWeightOffsetIsNotSupported) {
+  tflite::FullyConnectedParams params;
+  params.weights_offset = 3;
+  TF_LITE_MICRO_EXPECT(!tflite::m0plus::FullyConnectedSupported(params));
+}
+
+TF_LITE_MICRO_TESTS_END
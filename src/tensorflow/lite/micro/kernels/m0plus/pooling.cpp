@@ -0,0 +1,152 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/pooling.h"
+
+#include "tensorflow/lite/kernels/internal/common.h"
+
+namespace tflite {
+namespace m0plus {
+namespace {
+
+// Number of channels accumulated per pass over a window.
+constexpr int kChannelBlock = 32;
+
+// Divides `acc` by `count`, rounding half away from zero, and clamps. A
+// window that only covers padding has no pixels and averages to 0.
+inline int8_t RoundedAverage(int32_t acc, int count, int32_t activation_min,
+                             int32_t activation_max) {
+  int32_t value = 0;
+  if (count > 0) {
+    const int32_t half = count / 2;
+    value = acc > 0 ? (acc + half) / count : (acc - half) / count;
+  }
+  value = value < activation_min ? activation_min : value;
+  value = value > activation_max ? activation_max : value;
+  return static_cast<int8_t>(value);
+}
+
+// Average of every pixel, for a window that covers the whole unpadded input
+// and so produces a 1x1 output, as in classifier heads. The pixels of a batch
+// are contiguous, so each channel block is a single flat walk.
+void GlobalAveragePool(const PoolParams& params, int batches, int pixels,
+                       int depth, const int8_t* input_data,
+                       int8_t* output_data) {
+  for (int batch = 0; batch < batches; ++batch) {
+    const int8_t* batch_input = input_data + batch * pixels * depth;
+    int8_t* out = output_data + batch * depth;
+    for (int channel = 0; channel < depth; channel += kChannelBlock) {
+      const int block =
+          depth - channel < kChannelBlock ? depth - channel : kChannelBlock;
+      int32_t acc[kChannelBlock] = {};
+      const int8_t* in = batch_input + channel;
+      for (int pixel = 0; pixel < pixels; ++pixel) {
+        for (int i = 0; i < block; ++i) {
+          acc[i] += in[i];
+        }
+        in += depth;
+      }
+      for (int i = 0; i < block; ++i) {
+        out[channel + i] =
+            RoundedAverage(acc[i], pixels, params.quantized_activation_min,
+                           params.quantized_activation_max);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void AveragePool(const PoolParams& params, const RuntimeShape& input_shape,
+                 const int8_t* input_data, const RuntimeShape& output_shape,
+                 int8_t* output_data) {
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int32_t activation_min = params.quantized_activation_min;
+  const int32_t activation_max = params.quantized_activation_max;
+
+  if (output_height == 1 && output_width == 1 &&
+      params.padding_values.height == 0 && params.padding_values.width == 0 &&
+      params.filter_height >= input_height &&
+      params.filter_width >= input_width) {
+    GlobalAveragePool(params, batches, input_height * input_width, depth,
+                      input_data, output_data);
+    return;
+  }
+
+  int8_t* out = output_data;
+  for (int batch = 0; batch < batches; ++batch) {
+    const int8_t* batch_input =
+        input_data + batch * input_height * input_width * depth;
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          out_y * params.stride_height - params.padding_values.height;
+      const int filter_y_start = in_y_origin < 0 ? -in_y_origin : 0;
+      const int filter_y_end =
+          input_height - in_y_origin < params.filter_height
+              ? input_height - in_y_origin
+              : params.filter_height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin =
+            out_x * params.stride_width - params.padding_values.width;
+        const int filter_x_start = in_x_origin < 0 ? -in_x_origin : 0;
+        const int filter_x_end =
+            input_width - in_x_origin < params.filter_width
+                ? input_width - in_x_origin
+                : params.filter_width;
+        const int filter_count = (filter_y_end - filter_y_start) *
+                                 (filter_x_end - filter_x_start);
+
+        for (int channel = 0; channel < depth; channel += kChannelBlock) {
+          const int block =
+              depth - channel < kChannelBlock ? depth - channel : kChannelBlock;
+          int32_t acc[kChannelBlock] = {};
+          for (int filter_y = filter_y_start; filter_y < filter_y_end;
+               ++filter_y) {
+            const int8_t* in =
+                batch_input +
+                ((in_y_origin + filter_y) * input_width + in_x_origin +
+                 filter_x_start) *
+                    depth +
+                channel;
+            for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                 ++filter_x) {
+              for (int i = 0; i < block; ++i) {
+                acc[i] += in[i];
+              }
+              in += depth;
+            }
+          }
+          for (int i = 0; i < block; ++i) {
+            out[channel + i] = RoundedAverage(acc[i], filter_count,
+                                              activation_min, activation_max);
+          }
+        }
+        out += depth;
+      }
+    }
+  }
+}
+
+}  // namespace m0plus
+}  // namespace tflite
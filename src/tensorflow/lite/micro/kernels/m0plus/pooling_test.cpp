@@ -0,0 +1,112 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/kernels/m0plus/pooling.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kMaxInputSize = 9 * 9 * 80;
+constexpr int kMaxOutputSize = 9 * 9 * 80;
+
+int8_t g_input[kMaxInputSize];
+int8_t g_expected[kMaxOutputSize];
+int8_t g_output[kMaxOutputSize];
+
+tflite::testing::Random g_random;
+
+// Runs both kernels on random data and expects identical outputs.
+void TestMatchesReference(int height, int width, int depth, int filter_size,
+                          int stride, int padding, int activation_min,
+                          int activation_max) {
+  const int out_height = (height + 2 * padding - filter_size) / stride + 1;
+  const int out_width = (width + 2 * padding - filter_size) / stride + 1;
+  const tflite::RuntimeShape input_shape({1, height, width, depth});
+  const tflite::RuntimeShape output_shape({1, out_height, out_width, depth});
+  TF_LITE_MICRO_EXPECT_LE(input_shape.FlatSize(), kMaxInputSize);
+  TF_LITE_MICRO_EXPECT_LE(output_shape.FlatSize(), kMaxOutputSize);
+
+  for (int i = 0; i < input_shape.FlatSize(); ++i) {
+    g_input[i] = static_cast<int8_t>(g_random.Int(-128, 127));
+  }
+
+  tflite::PoolParams params;
+  params.stride_height = stride;
+  params.stride_width = stride;
+  params.filter_height = filter_size;
+  params.filter_width = filter_size;
+  params.padding_values.height = padding;
+  params.padding_values.width = padding;
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+
+  tflite::reference_integer_ops::AveragePool(params, input_shape, g_input,
+                                             output_shape, g_expected);
+  tflite::m0plus::AveragePool(params, input_shape, g_input, output_shape,
+                              g_output);
+
+  for (int i = 0; i < output_shape.FlatSize(); ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(g_expected[i], g_output[i]);
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(GlobalAveragePoolMatchesReference) {
+  TestMatchesReference(3, 3, 80, 3, 2, 0, -128, 127);
+  TestMatchesReference(6, 6, 33, 6, 1, 0, -128, 127);
+  // The classifier head of the person detection model.
+  TestMatchesReference(3, 3, 256, 3, 1, 0, -128, 127);
+  TestMatchesReference(4, 4, 5, 4, 1, 0, -30, 60);
+}
+
+TF_LITE_MICRO_TEST(AveragePoolWithPaddingMatchesReference) {
+  TestMatchesReference(9, 9, 8, 3, 2, 1, -128, 127);
+  TestMatchesReference(8, 7, 40, 2, 2, 0, -20, 100);
+  TestMatchesReference(5, 5, 3, 3, 1, 1, 0, 127);
+}
+
+TF_LITE_MICRO_TEST(AveragePoolOfPaddingOnlyWindowIsZero) {
+  // With a stride of 3 and 3 pixels of padding, the first window on each
+  // axis lies entirely in the padding.
+  const tflite::RuntimeShape input_shape({1, 2, 2, 4});
+  const tflite::RuntimeShape output_shape({1, 3, 3, 4});
+  for (int i = 0; i < input_shape.FlatSize(); ++i) {
+    g_input[i] = static_cast<int8_t>(g_random.Int(-128, 127));
+  }
+  tflite::PoolParams params;
+  params.stride_height = 3;
+  params.stride_width = 3;
+  params.filter_height = 2;
+  params.filter_width = 2;
+  params.padding_values.height = 3;
+  params.padding_values.width = 3;
+  params.quantized_activation_min = -10;
+  params.quantized_activation_max = 127;
+  tflite::m0plus::AveragePool(params, input_shape, g_input, output_shape,
+                              g_output);
+  for (int channel = 0; channel < 4; ++channel) {
+    TF_LITE_MICRO_EXPECT_EQ(0, g_output[channel]);
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
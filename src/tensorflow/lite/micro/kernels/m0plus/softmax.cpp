@@ -0,0 +1,72 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/kernels/m0plus/softmax.h"
+
+#include "CMSIS/NN/Include/arm_nnsupportfunctions.h"
+
+namespace tflite {
+namespace m0plus {
+namespace {
+
+// Integer bits of the exponential sum, as in arm_softmax_s8().
+constexpr int32_t kAccumulationBits = 12;
+
+}  // namespace
+
+void SoftmaxTwoClass(const int8_t* input, int num_rows, int32_t mult,
+                     int32_t shift, int32_t diff_min, int8_t* output) {
+  const int32_t mask = 1 << shift;
+  for (int row = 0; row < num_rows; ++row) {
+    // Ties pick the first value as the maximum, like arm_softmax_s8(); both
+    // then get exp(0) either way.
+    const int top = input[1] > input[0] ? 1 : 0;
+    const int32_t diff = input[1 - top] - input[top];
+
+    int32_t sum = DIV_POW2(Q31_MAX, kAccumulationBits);
+    int32_t other_exp = 0;
+    if (diff >= diff_min) {
+      other_exp = EXP_ON_NEG(MUL_SAT(diff * mask, mult));
+      sum += DIV_POW2(other_exp, kAccumulationBits);
+    }
+
+    const int32_t headroom = __CLZ(sum);
+    const int32_t bits_over_unit = kAccumulationBits - headroom + 23;
+    const int32_t shifted_scale = ONE_OVER1((sum << headroom) - (1 << 31));
+
+    const int32_t top_score =
+        DIV_POW2(MUL_SAT(shifted_scale, Q31_MAX), bits_over_unit) - 128;
+    output[top] = static_cast<int8_t>(CLAMP(top_score, 127, -128));
+    if (diff >= diff_min) {
+      const int32_t other_score =
+          DIV_POW2(MUL_SAT(shifted_scale, other_exp), bits_over_unit) - 128;
+      output[1 - top] = static_cast<int8_t>(CLAMP(other_score, 127, -128));
+    } else {
+      output[1 - top] = -128;
+    }
+    input += 2;
+    output += 2;
+  }
+}
+
+int8_t TwoClassTopScore(int gap, int32_t mult, int32_t shift,
+                        int32_t diff_min) {
+  const int8_t row[2] = {127, static_cast<int8_t>(127 - gap)};
+  int8_t scores[2];
+  SoftmaxTwoClass(row, 1, mult, shift, diff_min, scores);
+  return scores[0];
+}
+
+}  // namespace m0plus
+}  // namespace tflite
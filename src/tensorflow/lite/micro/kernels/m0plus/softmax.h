@@ -0,0 +1,37 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_SOFTMAX_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_SOFTMAX_H_
+
+#include <cstdint>
+
+namespace tflite {
+namespace m0plus {
+
+// Int8 softmax over rows of two values, bit-exact with arm_softmax_s8(). The
+// larger value of a row always maps to exp(0), so only the smaller one needs
+// an exponential, and it is computed once instead of twice.
+void SoftmaxTwoClass(const int8_t* input, int num_rows, int32_t mult,
+                     int32_t shift, int32_t diff_min, int8_t* output);
+
+// Int8 score that SoftmaxTwoClass() gives the larger value of a row whose two
+// values are `gap` apart, for `gap` in [0, 255].
+int8_t TwoClassTopScore(int gap, int32_t mult, int32_t shift,
+                        int32_t diff_min);
+
+}  // namespace m0plus
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_M0PLUS_SOFTMAX_H_
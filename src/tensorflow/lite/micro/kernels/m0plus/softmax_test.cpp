@@ -0,0 +1,94 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/kernels/m0plus/softmax.h"
+
+#include <cstdint>
+
+#include "CMSIS/NN/Include/arm_nnfunctions.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr int kScaledDiffIntegerBits = 5;
+
+struct SoftmaxScaling {
+  int32_t mult;
+  int32_t shift;
+  int32_t diff_min;
+};
+
+// Computes the int8 parameters the same way as the softmax kernel's Prepare.
+SoftmaxScaling GetScaling(float input_scale, float beta) {
+  SoftmaxScaling scaling;
+  int shift;
+  tflite::PreprocessSoftmaxScaling(static_cast<double>(beta),
+                                   static_cast<double>(input_scale),
+                                   kScaledDiffIntegerBits, &scaling.mult,
+                                   &shift);
+  scaling.shift = shift;
+  scaling.diff_min =
+      -1.0 * tflite::CalculateInputRadius(kScaledDiffIntegerBits, shift);
+  return scaling;
+}
+
+// Runs both kernels on every pair of int8 values and expects identical
+// outputs.
+void TestMatchesCmsisNn(float input_scale, float beta) {
+  const SoftmaxScaling scaling = GetScaling(input_scale, beta);
+  int8_t input[256 * 2];
+  int8_t expected[256 * 2];
+  int8_t output[256 * 2];
+  for (int first = -128; first <= 127; ++first) {
+    for (int second = -128; second <= 127; ++second) {
+      input[(second + 128) * 2] = static_cast<int8_t>(first);
+      input[(second + 128) * 2 + 1] = static_cast<int8_t>(second);
+    }
+    arm_softmax_s8(input, 256, 2, scaling.mult, scaling.shift,
+                   scaling.diff_min, expected);
+    tflite::m0plus::SoftmaxTwoClass(input, 256, scaling.mult, scaling.shift,
+                                    scaling.diff_min, output);
+    for (int i = 0; i < 256 * 2; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(expected[i], output[i]);
+    }
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(SoftmaxTwoClassMatchesCmsisNn) {
+  TestMatchesCmsisNn(0.1f, 1.0f);
+  TestMatchesCmsisNn(0.0625f, 1.0f);
+  TestMatchesCmsisNn(0.5f, 0.5f);
+  TestMatchesCmsisNn(0.0039f, 2.0f);
+}
+
+TF_LITE_MICRO_TEST(TwoClassTopScoreMatchesSoftmax) {
+  const SoftmaxScaling scaling = GetScaling(0.1f, 1.0f);
+  for (int gap = 0; gap <= 255; ++gap) {
+    const int8_t input[2] = {static_cast<int8_t>(-128 + gap), -128};
+    int8_t output[2];
+    arm_softmax_s8(input, 1, 2, scaling.mult, scaling.shift, scaling.diff_min,
+                   output);
+    TF_LITE_MICRO_EXPECT_EQ(output[0],
+                            tflite::m0plus::TwoClassTopScore(
+                                gap, scaling.mult, scaling.shift,
+                                scaling.diff_min));
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -20,6 +20,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 #include "tensorflow/lite/micro/micro_utils.h"
 
 namespace tflite {
@@ -85,6 +86,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   data->quantization_params.scale = static_cast<double>(output->params.scale);
 
   data->input_zero_point = input->params.zero_point;
+
+  // Every conversion reads element i before writing element i, so an output
+  // with elements no wider than the input's can overwrite it. Only narrowing
+  // to a byte type or keeping the type avoids aliasing differently typed
+  // non-char data.
+  if (TfLiteTypeGetSize(output->type) <= TfLiteTypeGetSize(input->type) &&
+      (output->type == input->type || output->type == kTfLiteInt8 ||
+       output->type == kTfLiteUInt8)) {
+    TF_LITE_ENSURE_STATUS(RequestInPlaceOutput(context, node, 0, 0));
+  }
   return kTfLiteOk;
 }
 
@@ -13,6 +13,8 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <cstring>
+
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
@@ -20,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/op_macros.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 #include "tensorflow/lite/micro/micro_utils.h"
 
 namespace tflite {
@@ -75,6 +78,9 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE(context, NumInputs(node) == 1 || NumInputs(node) == 2);
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
   TF_LITE_ENSURE_EQ(context, ReshapeOutput(context, node), kTfLiteOk);
+  // The output only reinterprets the shape of the input.
+  TF_LITE_ENSURE_STATUS(
+      RequestOutputView(context, node, kInputTensor, kOutputTensor));
   return kTfLiteOk;
 }
 
@@ -90,12 +96,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(input->type, &input_bytes));
   input_bytes *= ElementCount(*input->dims);
 
-  // Do nothing for in-place reshape.
+  // Do nothing for in-place reshape. The memory planner places the output on
+  // top of the input whenever both live in the arena.
   if (input->data.raw != output->data.raw) {
     // Otherwise perform reshape with copy.
-    for (size_t i = 0; i < input_bytes; ++i) {
-      output->data.raw[i] = input->data.raw[i];
-    }
+    std::memcpy(output->data.raw, input->data.raw, input_bytes);
   }
   return kTfLiteOk;
 }
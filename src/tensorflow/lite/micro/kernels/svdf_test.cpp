@@ -0,0 +1,267 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include <cstdint>
+#include <cstring>
+
+#include "CMSIS/NN/Include/arm_nnfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace {
+
+constexpr int kBatchSize = 2;
+constexpr int kInputSize = 5;
+constexpr int kRank = 2;
+constexpr int kNumFilters = 8;
+constexpr int kNumUnits = kNumFilters / kRank;
+constexpr int kMaxMemorySize = 10;
+constexpr int kMaxStateSize = kBatchSize * kNumFilters * kMaxMemorySize;
+
+// Enough invocations for the state to wrap around a few times, with the
+// variable tensors reset once in between.
+constexpr int kInvocations = 3 * kMaxMemorySize + 7;
+constexpr int kResetInvocation = kMaxMemorySize + 3;
+
+tflite::testing::Random g_random;
+
+float RandomFloat() { return g_random.Int(-1000, 1000) / 1000.0f; }
+
+// The SVDF kernel as it was before the activation state became a ring: the
+// whole state is shifted left by one entry on every invocation.
+void ShiftedFloatSvdf(int memory_size, const float* input,
+                      const float* weights_feature, const float* weights_time,
+                      const float* bias, float* state, float* output) {
+  const int state_size = kBatchSize * kNumFilters * memory_size;
+  for (int i = 0; i + 1 < state_size; ++i) {
+    state[i] = state[i + 1];
+  }
+  for (int b = 0; b < kBatchSize; ++b) {
+    for (int f = 0; f < kNumFilters; ++f) {
+      float dot = 0.0f;
+      for (int i = 0; i < kInputSize; ++i) {
+        dot += weights_feature[f * kInputSize + i] * input[b * kInputSize + i];
+      }
+      state[(b * kNumFilters + f) * memory_size + memory_size - 1] = dot;
+    }
+  }
+  for (int b = 0; b < kBatchSize; ++b) {
+    for (int u = 0; u < kNumUnits; ++u) {
+      float sum = bias[u];
+      for (int r = 0; r < kRank; ++r) {
+        const int f = u * kRank + r;
+        float dot = 0.0f;
+        for (int j = 0; j < memory_size; ++j) {
+          dot += weights_time[f * memory_size + j] *
+                 state[(b * kNumFilters + f) * memory_size + j];
+        }
+        sum += dot;
+      }
+      output[b * kNumUnits + u] = sum > 0.0f ? sum : 0.0f;
+    }
+  }
+}
+
+void TestFloatMatchesShiftedState(int memory_size) {
+  float input[kBatchSize * kInputSize];
+  float weights_feature[kNumFilters * kInputSize];
+  float weights_time[kNumFilters * kMaxMemorySize];
+  float bias[kNumUnits];
+  float state[kMaxStateSize] = {};
+  float expected_state[kMaxStateSize] = {};
+  float output[kBatchSize * kNumUnits];
+  float expected[kBatchSize * kNumUnits];
+  for (float& value : weights_feature) value = RandomFloat();
+  for (float& value : weights_time) value = RandomFloat();
+  for (float& value : bias) value = RandomFloat();
+
+  const int input_dims[] = {2, kBatchSize, kInputSize};
+  const int weights_feature_dims[] = {2, kNumFilters, kInputSize};
+  const int weights_time_dims[] = {2, kNumFilters, memory_size};
+  const int bias_dims[] = {1, kNumUnits};
+  const int state_dims[] = {2, kBatchSize, memory_size * kNumFilters};
+  const int output_dims[] = {2, kBatchSize, kNumUnits};
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateTensor(
+          input, tflite::testing::IntArrayFromInts(input_dims)),
+      tflite::testing::CreateTensor(
+          weights_feature,
+          tflite::testing::IntArrayFromInts(weights_feature_dims)),
+      tflite::testing::CreateTensor(
+          weights_time, tflite::testing::IntArrayFromInts(weights_time_dims)),
+      tflite::testing::CreateTensor(
+          bias, tflite::testing::IntArrayFromInts(bias_dims)),
+      tflite::testing::CreateTensor(
+          state, tflite::testing::IntArrayFromInts(state_dims),
+          /*is_variable=*/true),
+      tflite::testing::CreateTensor(
+          output, tflite::testing::IntArrayFromInts(output_dims)),
+  };
+
+  TfLiteSVDFParams params = {kRank, kTfLiteActRelu, false};
+  const int inputs[] = {5, 0, 1, 2, 3, 4};
+  const int outputs[] = {1, 5};
+  const TfLiteRegistration registration = tflite::Register_SVDF();
+  tflite::micro::KernelRunner runner(
+      registration, tensors, 6,
+      tflite::testing::IntArrayFromInts(inputs),
+      tflite::testing::IntArrayFromInts(outputs), &params,
+      micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+  for (int n = 0; n < kInvocations; ++n) {
+    if (n == kResetInvocation) {
+      memset(state, 0, sizeof(state));
+      memset(expected_state, 0, sizeof(expected_state));
+    }
+    for (float& value : input) value = RandomFloat();
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+    ShiftedFloatSvdf(memory_size, input, weights_feature, weights_time, bias,
+                     expected_state, expected);
+    for (int i = 0; i < kBatchSize * kNumUnits; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(expected[i], output[i]);
+    }
+  }
+}
+
+void TestInt8MatchesShiftedState(int memory_size) {
+  int8_t input[kBatchSize * kInputSize];
+  int8_t weights_feature[kNumFilters * kInputSize];
+  int16_t weights_time[kNumFilters * kMaxMemorySize];
+  int32_t bias[kNumUnits];
+  int16_t state[kMaxStateSize] = {};
+  // arm_svdf_s8() reads one entry past the state it shifts.
+  int16_t expected_state[kMaxStateSize + 1] = {};
+  int8_t output[kBatchSize * kNumUnits];
+  int8_t expected[kBatchSize * kNumUnits];
+  for (int8_t& value : weights_feature) value = g_random.Int(-127, 127);
+  for (int16_t& value : weights_time) value = g_random.Int(-32767, 32767);
+  for (int32_t& value : bias) value = g_random.Int(-100000, 100000);
+
+  const float input_scale = 0.01f;
+  const float weights_feature_scale = 0.005f;
+  const float state_scale = 0.0001f;
+  const float weights_time_scale = 0.0002f;
+  const float bias_scale = state_scale * weights_time_scale;
+  const float output_scale = 0.2f;
+  const int input_zero_point = g_random.Int(-20, 20);
+  const int output_zero_point = g_random.Int(-20, 20);
+
+  const int input_dims[] = {2, kBatchSize, kInputSize};
+  const int weights_feature_dims[] = {2, kNumFilters, kInputSize};
+  const int weights_time_dims[] = {2, kNumFilters, memory_size};
+  const int bias_dims[] = {1, kNumUnits};
+  const int state_dims[] = {2, kBatchSize, memory_size * kNumFilters};
+  const int output_dims[] = {2, kBatchSize, kNumUnits};
+  TfLiteTensor tensors[] = {
+      tflite::testing::CreateQuantizedTensor(
+          input, tflite::testing::IntArrayFromInts(input_dims), input_scale,
+          input_zero_point),
+      tflite::testing::CreateQuantizedTensor(
+          weights_feature,
+          tflite::testing::IntArrayFromInts(weights_feature_dims),
+          weights_feature_scale, 0),
+      tflite::testing::CreateQuantizedTensor(
+          weights_time, tflite::testing::IntArrayFromInts(weights_time_dims),
+          weights_time_scale, 0),
+      tflite::testing::CreateQuantizedTensor(
+          bias, tflite::testing::IntArrayFromInts(bias_dims), bias_scale, 0),
+      tflite::testing::CreateQuantizedTensor(
+          state, tflite::testing::IntArrayFromInts(state_dims), state_scale,
+          0, /*is_variable=*/true),
+      tflite::testing::CreateQuantizedTensor(
+          output, tflite::testing::IntArrayFromInts(output_dims),
+          output_scale, output_zero_point),
+  };
+
+  TfLiteSVDFParams params = {kRank, kTfLiteActRelu, false};
+  const int inputs[] = {5, 0, 1, 2, 3, 4};
+  const int outputs[] = {1, 5};
+  const TfLiteRegistration registration = tflite::Register_SVDF();
+  tflite::micro::KernelRunner runner(
+      registration, tensors, 6,
+      tflite::testing::IntArrayFromInts(inputs),
+      tflite::testing::IntArrayFromInts(outputs), &params,
+      micro_test::reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.InitAndPrepare());
+
+  // The parameters the kernel passed to arm_svdf_s8().
+  cmsis_nn_svdf_params svdf_params;
+  svdf_params.rank = kRank;
+  svdf_params.input_offset = input_zero_point;
+  svdf_params.output_offset = output_zero_point;
+  svdf_params.input_activation.min = INT16_MIN;
+  svdf_params.input_activation.max = INT16_MAX;
+  svdf_params.output_activation.min = INT8_MIN;
+  svdf_params.output_activation.max = INT8_MAX;
+  cmsis_nn_per_tensor_quant_params in_quant_params;
+  tflite::QuantizeMultiplier(
+      static_cast<double>(input_scale * weights_feature_scale / state_scale),
+      &in_quant_params.multiplier, &in_quant_params.shift);
+  cmsis_nn_per_tensor_quant_params out_quant_params;
+  tflite::QuantizeMultiplier(
+      static_cast<double>(state_scale * weights_time_scale / output_scale),
+      &out_quant_params.multiplier, &out_quant_params.shift);
+  const cmsis_nn_dims input_cmsis_dims = {kBatchSize, kInputSize, 0, 0};
+  const cmsis_nn_dims weights_feature_cmsis_dims = {kNumFilters, kInputSize,
+                                                    0, 0};
+  const cmsis_nn_dims weights_time_cmsis_dims = {kNumFilters, memory_size, 0,
+                                                 0};
+  const cmsis_nn_dims unused_dims = {};
+  int32_t scratch[kBatchSize * kNumFilters];
+  int32_t scratch_output[kBatchSize * kNumUnits];
+  cmsis_nn_context scratch_ctx = {scratch, sizeof(scratch)};
+  cmsis_nn_context scratch_output_ctx = {scratch_output,
+                                         sizeof(scratch_output)};
+
+  for (int n = 0; n < kInvocations; ++n) {
+    if (n == kResetInvocation) {
+      memset(state, 0, sizeof(state));
+      memset(expected_state, 0, sizeof(expected_state));
+    }
+    for (int8_t& value : input) value = g_random.Int(-128, 127);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, runner.Invoke());
+    arm_svdf_s8(&scratch_ctx, &scratch_output_ctx, &svdf_params,
+                &in_quant_params, &out_quant_params, &input_cmsis_dims, input,
+                &unused_dims, expected_state, &weights_feature_cmsis_dims,
+                weights_feature, &weights_time_cmsis_dims, weights_time,
+                &unused_dims, bias, &unused_dims, expected);
+    for (int i = 0; i < kBatchSize * kNumUnits; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(expected[i], output[i]);
+    }
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(SvdfFloatMatchesShiftedState) {
+  for (int memory_size : {1, 4, kMaxMemorySize}) {
+    TestFloatMatchesShiftedState(memory_size);
+  }
+}
+
+TF_LITE_MICRO_TEST(SvdfInt8MatchesShiftedState) {
+  for (int memory_size : {1, 4, kMaxMemorySize}) {
+    TestInt8MatchesShiftedState(memory_size);
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
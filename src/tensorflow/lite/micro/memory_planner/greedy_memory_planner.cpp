@@ -15,27 +15,64 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
 
+#include <limits>
+
 namespace tflite {
+namespace {
 
-// Simple stable in-place sort function. Not time-efficient for large arrays.
-// Would normally be in an anonymous namespace to keep it private, but we want
-// to be able to test it externally.
-void ReverseSortInPlace(int* values, int* ids, int size) {
-  bool any_swapped;
-  do {
-    any_swapped = false;
-    for (int i = 1; i < size; ++i) {
-      if (values[i - 1] < values[i]) {
-        const int value_temp = values[i - 1];
-        values[i - 1] = values[i];
-        values[i] = value_temp;
-        const int id_temp = ids[i - 1];
-        ids[i - 1] = ids[i];
-        ids[i] = id_temp;
-        any_swapped = true;
-      }
+// Value of the last use tree for buffers that haven't been placed yet.
+constexpr int kNotPlaced = std::numeric_limits<int>::min();
+
+// Whether entry `a` comes after entry `b` when sorting in descending order of
+// value and then id.
+bool SortsAfter(const int* values, const int* ids, int a, int b) {
+  if (values[a] != values[b]) {
+    return values[a] < values[b];
+  }
+  return ids[a] < ids[b];
+}
+
+void SwapEntries(int* values, int* ids, int a, int b) {
+  const int value_temp = values[a];
+  values[a] = values[b];
+  values[b] = value_temp;
+  const int id_temp = ids[a];
+  ids[a] = ids[b];
+  ids[b] = id_temp;
+}
+
+// Restores the heap below `root`, which has the entry that sorts last on top.
+void SiftDown(int* values, int* ids, int root, int size) {
+  while (true) {
+    int child = 2 * root + 1;
+    if (child >= size) {
+      return;
     }
-  } while (any_swapped);
+    if (child + 1 < size && SortsAfter(values, ids, child + 1, child)) {
+      ++child;
+    }
+    if (!SortsAfter(values, ids, child, root)) {
+      return;
+    }
+    SwapEntries(values, ids, root, child);
+    root = child;
+  }
+}
+
+}  // namespace
+
+// In-place heap sort into descending order of value. Equal values are ordered
+// by descending id, which keeps the order the planner fills the arrays in, so
+// the sort acts like a stable one there. Would normally be in an anonymous
+// namespace to keep it private, but we want to be able to test it externally.
+void ReverseSortInPlace(int* values, int* ids, int size) {
+  for (int i = size / 2 - 1; i >= 0; --i) {
+    SiftDown(values, ids, i, size);
+  }
+  for (int end = size - 1; end > 0; --end) {
+    SwapEntries(values, ids, 0, end);
+    SiftDown(values, ids, 0, end);
+  }
 }
 
 GreedyMemoryPlanner::GreedyMemoryPlanner(unsigned char* scratch_buffer,
@@ -54,10 +91,23 @@ GreedyMemoryPlanner::GreedyMemoryPlanner(unsigned char* scratch_buffer,
   buffer_ids_sorted_ = reinterpret_cast<int*>(next_free);
   next_free += sizeof(int) * max_buffer_count_;
 
-  buffers_sorted_by_offset_ = reinterpret_cast<ListEntry*>(next_free);
-  next_free += sizeof(ListEntry) * max_buffer_count_;
+  buffer_ids_by_first_use_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * max_buffer_count_;
+
+  last_use_tree_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * 2 * max_buffer_count_;
+
+  active_buffer_ids_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * max_buffer_count_;
+
+  buffer_ids_by_offset_ = reinterpret_cast<int*>(next_free);
+  next_free += sizeof(int) * max_buffer_count_;
 
   buffer_offsets_ = reinterpret_cast<int*>(next_free);
+
+  active_buffer_offsets_ = buffer_sizes_sorted_;
+  active_buffer_count_ = 0;
+  placed_buffer_count_ = 0;
 }
 
 GreedyMemoryPlanner::~GreedyMemoryPlanner() {
@@ -94,47 +144,67 @@ TfLiteStatus GreedyMemoryPlanner::AddBuffer(
   return kTfLiteOk;
 }
 
-bool GreedyMemoryPlanner::DoesEntryOverlapInTime(
-    const GreedyMemoryPlanner::ListEntry* entry, const int first_time_used,
-    const int last_time_used) const {
-  const BufferRequirements* entry_requirements =
-      &requirements_[entry->requirements_index];
-  if (entry_requirements->first_time_used > last_time_used) {
-    return false;
+int GreedyMemoryPlanner::FirstUsePosition(int buffer_id) const {
+  const int first_time_used = requirements_[buffer_id].first_time_used;
+  int low = 0;
+  int high = buffer_count_;
+  while (low < high) {
+    const int middle = (low + high) / 2;
+    const int middle_id = buffer_ids_by_first_use_[middle];
+    const int middle_first_time_used =
+        requirements_[middle_id].first_time_used;
+    if (middle_first_time_used < first_time_used ||
+        (middle_first_time_used == first_time_used && middle_id < buffer_id)) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
   }
-  if (first_time_used > entry_requirements->last_time_used) {
-    return false;
+  return low;
+}
+
+void GreedyMemoryPlanner::AddToLastUseTree(int buffer_id) {
+  int node = buffer_count_ + FirstUsePosition(buffer_id);
+  last_use_tree_[node] = requirements_[buffer_id].last_time_used;
+  for (node /= 2; node > 0; node /= 2) {
+    const int left = last_use_tree_[2 * node];
+    const int right = last_use_tree_[2 * node + 1];
+    last_use_tree_[node] = left > right ? left : right;
   }
-  return true;
 }
 
-GreedyMemoryPlanner::ListEntry*
-GreedyMemoryPlanner::NextSimultaneouslyActiveBuffer(
-    const GreedyMemoryPlanner::ListEntry* start, const int first_time_used,
-    const int last_time_used) {
-  ListEntry* result = nullptr;
-  ListEntry* candidate_next_entry;
-  if (start == nullptr) {
-    candidate_next_entry = &buffers_sorted_by_offset_[first_entry_index_];
-  } else {
-    if (start->next_entry_index == -1) {
-      return nullptr;
-    }
-    candidate_next_entry = &buffers_sorted_by_offset_[start->next_entry_index];
+void GreedyMemoryPlanner::CollectActiveBuffers(int node, int first_time_used) {
+  if (last_use_tree_[node] < first_time_used) {
+    return;
   }
-  do {
-    if (DoesEntryOverlapInTime(candidate_next_entry, first_time_used,
-                               last_time_used)) {
-      result = candidate_next_entry;
-      break;
-    }
-    if (candidate_next_entry->next_entry_index == -1) {
-      break;
+  if (node >= buffer_count_) {
+    const int buffer_id = buffer_ids_by_first_use_[node - buffer_count_];
+    active_buffer_ids_[active_buffer_count_] = buffer_id;
+    active_buffer_offsets_[active_buffer_count_] = buffer_offsets_[buffer_id];
+    ++active_buffer_count_;
+    return;
+  }
+  CollectActiveBuffers(2 * node, first_time_used);
+  CollectActiveBuffers(2 * node + 1, first_time_used);
+}
+
+void GreedyMemoryPlanner::AddToOffsetOrder(int buffer_id) {
+  const int offset = buffer_offsets_[buffer_id];
+  int low = 0;
+  int high = placed_buffer_count_;
+  while (low < high) {
+    const int middle = (low + high) / 2;
+    if (buffer_offsets_[buffer_ids_by_offset_[middle]] <= offset) {
+      low = middle + 1;
+    } else {
+      high = middle;
     }
-    candidate_next_entry =
-        &buffers_sorted_by_offset_[candidate_next_entry->next_entry_index];
-  } while (true);
-  return result;
+  }
+  for (int i = placed_buffer_count_; i > low; --i) {
+    buffer_ids_by_offset_[i] = buffer_ids_by_offset_[i - 1];
+  }
+  buffer_ids_by_offset_[low] = buffer_id;
+  ++placed_buffer_count_;
 }
 
 void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
@@ -143,6 +213,25 @@ void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
   }
   need_to_calculate_offsets_ = false;
 
+  // Order the buffers by when they're first used. The buffers that can be
+  // active at the same time as a given buffer are then all found before the
+  // first one that's used after it, and the last use tree narrows those down
+  // to the ones still in use. buffer_offsets_ holds the sort keys for now.
+  for (int i = 0; i < buffer_count_; ++i) {
+    buffer_offsets_[i] = requirements_[i].first_time_used;
+    buffer_ids_by_first_use_[i] = i;
+  }
+  ReverseSortInPlace(buffer_offsets_, buffer_ids_by_first_use_, buffer_count_);
+  for (int i = 0, j = buffer_count_ - 1; i < j; ++i, --j) {
+    const int id_temp = buffer_ids_by_first_use_[i];
+    buffer_ids_by_first_use_[i] = buffer_ids_by_first_use_[j];
+    buffer_ids_by_first_use_[j] = id_temp;
+  }
+  for (int i = 1; i < 2 * buffer_count_; ++i) {
+    last_use_tree_[i] = kNotPlaced;
+  }
+  placed_buffer_count_ = 0;
+
   // Start off by ordering the buffers in descending order of size.
   // This helps find a more compact layout. Intuitively, you can think
   // about putting the large buffers in place first, and then the
@@ -165,148 +254,115 @@ void GreedyMemoryPlanner::CalculateOffsetsIfNeeded() {
     }
   }
 
-  // This sorting algorithm is naive, and may end up taking a very long time
-  // with hundreds of buffers. Do not sort the offline planned offsets.
+  // Do not sort the offline planned offsets.
   ReverseSortInPlace(&buffer_sizes_sorted_[idx_from_head],
                      &buffer_ids_sorted_[idx_from_head],
                      buffer_count_ - idx_from_head);
 
-  // Initialize the first entry to the first buffer in
-  // buffer_ids_sorted_.
+  // Work through the buffers in that order to find a good gap to place each
+  // one.
   //   - If there are no offline planned offsets, the largest buffer will be
   //     first, and the buffers will be handled in size order.
   //   - If offline offsets are present, these will be handled first in order
   //     for the greedy algorithm to utilized gaps in the offline plan.
-  first_entry_index_ = 0;
-  next_free_entry_ = 1;
-  ListEntry* first_entry = &buffers_sorted_by_offset_[first_entry_index_];
-  first_entry->next_entry_index = -1;  // to mark the entry as end of list
-  int buffer_id = buffer_ids_sorted_[0];
-  first_entry->requirements_index = buffer_id;
-  if (requirements_[buffer_id].offline_offset == kOnlinePlannedBuffer) {
-    buffer_offsets_[buffer_id] = 0;
-  }
-  first_entry->offset = buffer_offsets_[buffer_id];
-
-  // Work through the rest of the buffers to find a good gap to place each one.
-  for (int i = 1; i < buffer_count_; ++i) {
+  for (int i = 0; i < buffer_count_; ++i) {
     // The id is the order the buffer was originally added by the client.
-    buffer_id = buffer_ids_sorted_[i];
+    const int buffer_id = buffer_ids_sorted_[i];
     // Look at what size and time range the buffer needs to be active.
-    BufferRequirements* wanted_requirements = &requirements_[buffer_id];
+    const BufferRequirements* wanted_requirements = &requirements_[buffer_id];
     const int wanted_size = wanted_requirements->size;
     const int wanted_first_time_used = wanted_requirements->first_time_used;
     const int wanted_last_time_used = wanted_requirements->last_time_used;
 
-    // Find the first buffer that's active in our time range. All placed
-    // buffers are stored in the order of their starting position in the arena
-    // so that it's easy to find the next buffer in memory, and so the gap.
-    // The candidate_entry variable holds the buffer that we're considering
-    // placing the current buffer after.
-
     int candidate_offset = 0;
-    // Loop through the offset-ordered list of buffers, looking for gaps.
     if (wanted_requirements->offline_offset == kOnlinePlannedBuffer) {
-      ListEntry* prior_entry = nullptr;
-      while (true) {
-        // Find out what the next active buffer is.
-        ListEntry* next_entry = NextSimultaneouslyActiveBuffer(
-            prior_entry, wanted_first_time_used, wanted_last_time_used);
-
-        if (prior_entry) {
-          BufferRequirements* candidate_requirements =
-              &requirements_[prior_entry->requirements_index];
-          const int prior_entry_offset =
-              prior_entry->offset + candidate_requirements->size;
-          if (prior_entry_offset > candidate_offset) {
-            candidate_offset = prior_entry_offset;
-          }
+      // Find the placed buffers that are active in our time range. They were
+      // first used before `first_use_end` in buffer_ids_by_first_use_, and
+      // are still in use when we're first used.
+      int low = 0;
+      int first_use_end = buffer_count_;
+      while (low < first_use_end) {
+        const int middle = (low + first_use_end) / 2;
+        if (requirements_[buffer_ids_by_first_use_[middle]].first_time_used >
+            wanted_last_time_used) {
+          first_use_end = middle;
+        } else {
+          low = middle + 1;
+        }
+      }
+      active_buffer_count_ = 0;
+      for (int begin = buffer_count_, end = buffer_count_ + first_use_end;
+           begin < end; begin /= 2, end /= 2) {
+        if (begin & 1) {
+          CollectActiveBuffers(begin++, wanted_first_time_used);
         }
-        if (next_entry == nullptr) {
-          // We're at the end of the list, so we can always append the buffer
-          // here.
-          break;
+        if (end & 1) {
+          CollectActiveBuffers(--end, wanted_first_time_used);
         }
-        // Find out how much space there is between us and the next buffer.
-        const int gap = next_entry->offset - candidate_offset;
-        if (gap >= wanted_size) {
-          // This entry has a big enough gap between it and the next, so
-          // use it!
-          break;
+      }
+
+      // Loop through the active buffers in order of offset, looking for the
+      // first gap that's big enough. If there's none, the buffer goes after
+      // the last one. Sorting costs more than walking all the placed buffers
+      // once most of them are active, so walk those then.
+      int sort_cost = 0;
+      for (int count = active_buffer_count_; count > 0; count /= 2) {
+        sort_cost += active_buffer_count_;
+      }
+      if (sort_cost < placed_buffer_count_) {
+        ReverseSortInPlace(active_buffer_offsets_, active_buffer_ids_,
+                           active_buffer_count_);
+        for (int j = active_buffer_count_ - 1; j >= 0; --j) {
+          const int active_offset = active_buffer_offsets_[j];
+          if (active_offset - candidate_offset >= wanted_size) {
+            break;
+          }
+          const int active_end =
+              active_offset + requirements_[active_buffer_ids_[j]].size;
+          if (active_end > candidate_offset) {
+            candidate_offset = active_end;
+          }
+        }
+      } else {
+        for (int j = 0; j < placed_buffer_count_; ++j) {
+          const int placed_id = buffer_ids_by_offset_[j];
+          const BufferRequirements* placed = &requirements_[placed_id];
+          if (placed->first_time_used > wanted_last_time_used ||
+              placed->last_time_used < wanted_first_time_used) {
+            continue;
+          }
+          const int placed_offset = buffer_offsets_[placed_id];
+          if (placed_offset - candidate_offset >= wanted_size) {
+            break;
+          }
+          const int placed_end = placed_offset + placed->size;
+          if (placed_end > candidate_offset) {
+            candidate_offset = placed_end;
+          }
         }
-        // The gap wasn't big enough, so move on to another candidate.
-        prior_entry = next_entry;
       }
     } else {
       // Offline planned offset are to be considered constant
       candidate_offset = wanted_requirements->offline_offset;
     }
-    // At this point, we've either found a gap (possibly at the end of the
-    // list) and want to place the buffer there, or there are no other active
-    // buffers in this time range and so we can put it at offset zero.
-    // Record the buffer's offset in our plan.
+    // Record the buffer's offset in our plan, and make it visible to the
+    // buffers placed after it.
     buffer_offsets_[buffer_id] = candidate_offset;
-    // Add the newly-placed buffer to our offset-ordered list, so that
-    // subsequent passes can fit in their buffers around it.
-    ListEntry* new_entry = &buffers_sorted_by_offset_[next_free_entry_];
-    new_entry->offset = candidate_offset;
-    new_entry->requirements_index = buffer_id;
-    const int new_entry_index = next_free_entry_;
-    ++next_free_entry_;
-
-    if (first_entry->offset > candidate_offset) {
-      // The new entry offset is smaller than the first entry offset =>
-      // replace the first entry
-      first_entry = new_entry;
-      first_entry->next_entry_index = first_entry_index_;
-      first_entry_index_ = new_entry_index;
-    } else {
-      ListEntry* current_entry = first_entry;
-      // Make sure that we insert the buffer at the correct place in the
-      // buffer-offset-ordered list
-      while (true) {
-        const int next_entry_index = current_entry->next_entry_index;
-        if (next_entry_index == -1) {
-          // We're at the end of the list, so just add the new entry here.
-          current_entry->next_entry_index = new_entry_index;
-          new_entry->next_entry_index = -1;
-          break;
-        }
-        // not at the end of the list -> take a look at next entry
-        ListEntry* next_entry = &buffers_sorted_by_offset_[next_entry_index];
-        if (next_entry->offset > candidate_offset) {
-          // We're at the right spot to do an insertion and retain the sorting
-          // order, so place the new entry here.
-          new_entry->next_entry_index = current_entry->next_entry_index;
-          current_entry->next_entry_index = new_entry_index;
-          break;
-        }
-        current_entry = next_entry;
-      }
-    }
+    AddToLastUseTree(buffer_id);
+    AddToOffsetOrder(buffer_id);
   }
 }
 
 size_t GreedyMemoryPlanner::GetMaximumMemorySize() {
   CalculateOffsetsIfNeeded();
-  if (buffer_count_ == 0) {
-    return 0;
-  }
-  ListEntry* entry = &buffers_sorted_by_offset_[first_entry_index_];
   size_t max_size = 0;
-  while (entry) {
-    BufferRequirements* requirements =
-        &requirements_[entry->requirements_index];
+  for (int i = 0; i < buffer_count_; ++i) {
     // TODO(b/148246793): Update all size and offset variables types from
     //                    int to size_t
-    const size_t current_size = entry->offset + requirements->size;
+    const size_t current_size = buffer_offsets_[i] + requirements_[i].size;
     if (current_size > max_size) {
       max_size = current_size;
     }
-    if (entry->next_entry_index == -1) {
-      break;
-    }
-    entry = &buffers_sorted_by_offset_[entry->next_entry_index];
   }
   return max_size;
 }
@@ -34,7 +34,11 @@ constexpr int kOnlinePlannedBuffer = -1;
 //  - The buffers are sorted in descending order of size.
 //  - The largest buffer is placed at offset zero.
 //  - The rest of the buffers are looped through in descending size order.
-//  - The other buffers that need to be in memory at the same time are found.
+//  - The other buffers that need to be in memory at the same time are found
+//    through a tree over the buffers ordered by first use, which holds the
+//    latest last use below each node, and are sorted by offset. If most of
+//    the placed buffers are active, the placed buffers are walked in offset
+//    order instead.
 //  - The first gap between simultaneously active buffers that the current
 //    buffer fits into will be used.
 //  - If no large-enough gap is found, the current buffer is placed after the
@@ -43,6 +47,9 @@ constexpr int kOnlinePlannedBuffer = -1;
 //
 // This is not guaranteed to produce the best placement, since that's an
 // NP-Complete problem, but in practice it should produce one that's decent.
+// Placing a buffer costs O(k log n) for k simultaneously active buffers, and
+// never much more than a walk over the buffers placed so far, so graphs with
+// thousands of buffers can still be planned at boot.
 class GreedyMemoryPlanner : public MemoryPlanner {
  public:
   // You need to pass in an area of memory to be used for planning. This memory
@@ -53,7 +60,7 @@ class GreedyMemoryPlanner : public MemoryPlanner {
   // this scratch memory, so you should enlarge it if you see an error when
   // calling AddBuffer(). The memory can be reused once you're done with the
   // planner, as long as you copy the calculated offsets to another location.
-  // Each buffer requires about 36 bytes of scratch.
+  // Each buffer requires about 48 bytes of scratch.
   GreedyMemoryPlanner(unsigned char* scratch_buffer, int scratch_buffer_size);
   ~GreedyMemoryPlanner() override;
 
@@ -87,34 +94,34 @@ class GreedyMemoryPlanner : public MemoryPlanner {
   // is an O(N^2) complexity operation, so only use for testing.
   bool DoAnyBuffersOverlap(ErrorReporter* error_reporter);
 
-  // Used to store a list of buffers ordered by their offset.
-  struct ListEntry {
-    int offset;
-    int requirements_index;
-    int next_entry_index;
-  };
-
   // Number of bytes required in order to plan a buffer.
   static size_t per_buffer_size() {
     const int per_buffer_size =
         sizeof(BufferRequirements) +  // requirements_
         sizeof(int) +                 // buffer_sizes_sorted_
         sizeof(int) +                 // buffer_ids_sorted_
-        sizeof(ListEntry) +           // buffers_sorted_by_offset_
+        sizeof(int) +                 // buffer_ids_by_first_use_
+        sizeof(int) * 2 +             // last_use_tree_
+        sizeof(int) +                 // active_buffer_ids_
+        sizeof(int) +                 // buffer_ids_by_offset_
         sizeof(int);                  // buffer_offsets_;
     return per_buffer_size;
   }
 
  private:
-  // Whether a buffer is active in a given time range.
-  bool DoesEntryOverlapInTime(const ListEntry* entry, const int first_time_used,
-                              const int last_time_used) const;
+  // Returns the position of `buffer_id` in buffer_ids_by_first_use_.
+  int FirstUsePosition(int buffer_id) const;
+
+  // Marks a buffer as placed, so that it's found by CollectActiveBuffers().
+  void AddToLastUseTree(int buffer_id);
+
+  // Appends the placed buffers below tree node `node` that are still in use at
+  // `first_time_used` to active_buffer_ids_, and their offsets to
+  // active_buffer_offsets_.
+  void CollectActiveBuffers(int node, int first_time_used);
 
-  // Walks the list to return the next buffer that is active in a given time
-  // range, or a null pointer if there are none.
-  ListEntry* NextSimultaneouslyActiveBuffer(const ListEntry* start,
-                                            const int first_time_used,
-                                            const int last_time_used);
+  // Adds a placed buffer to buffer_ids_by_offset_.
+  void AddToOffsetOrder(int buffer_id);
 
   // If there isn't an up to date plan, calculate a new one.
   void CalculateOffsetsIfNeeded();
@@ -143,11 +150,20 @@ class GreedyMemoryPlanner : public MemoryPlanner {
   //   }
   int* buffer_sizes_sorted_;
   int* buffer_ids_sorted_;
-  ListEntry* buffers_sorted_by_offset_;
-  int next_free_entry_;    // Index of the next free entry of
-                           // buffers_sorted_by_offset_
-  int first_entry_index_;  // Index of the first entry (smallest offset) of
-                           // buffers_sorted_by_offset_
+  // Buffer ids in ascending order of first_time_used, ties by id.
+  int* buffer_ids_by_first_use_;
+  // Binary tree with a leaf per entry of buffer_ids_by_first_use_, each node
+  // holding the latest last_time_used of the placed buffers below it.
+  int* last_use_tree_;
+  // The placed buffers that are active at the same time as the buffer being
+  // placed. The offsets reuse buffer_sizes_sorted_, which is no longer needed
+  // once the buffers are sorted by size.
+  int* active_buffer_offsets_;
+  int* active_buffer_ids_;
+  int active_buffer_count_;
+  // The placed buffers in ascending order of offset.
+  int* buffer_ids_by_offset_;
+  int placed_buffer_count_;
 
   // Stores the outcome of the plan, the location of each buffer in the arena.
   int* buffer_offsets_;
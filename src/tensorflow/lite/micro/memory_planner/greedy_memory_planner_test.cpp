@@ -0,0 +1,183 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+
+#include <cstdint>
+
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
+
+namespace tflite {
+// Defined in greedy_memory_planner.cpp, exposed for testing.
+void ReverseSortInPlace(int* values, int* ids, int size);
+}  // namespace tflite
+
+namespace {
+
+constexpr int kMaxRandomBuffers = 500;
+constexpr int kScratchBufferSize = kMaxRandomBuffers * 64;
+unsigned char g_scratch_buffer[kScratchBufferSize];
+int g_sizes[kMaxRandomBuffers];
+int g_first_times[kMaxRandomBuffers];
+int g_last_times[kMaxRandomBuffers];
+
+tflite::testing::Random g_random;
+
+// Reference placement that checks every pair of buffers: each one, in the same
+// size order as the planner, goes at the lowest offset that doesn't collide
+// with a buffer placed before it.
+int ReferenceMaximumSize(int count) {
+  static int offsets[kMaxRandomBuffers];
+  static int order[kMaxRandomBuffers];
+  static int keys[kMaxRandomBuffers];
+  for (int i = 0; i < count; ++i) {
+    order[i] = i;
+    keys[i] = g_sizes[i];
+  }
+  tflite::ReverseSortInPlace(keys, order, count);
+
+  int max_size = 0;
+  for (int i = 0; i < count; ++i) {
+    const int id = order[i];
+    int offset = 0;
+    bool moved = true;
+    while (moved) {
+      moved = false;
+      for (int j = 0; j < i; ++j) {
+        const int other = order[j];
+        const bool overlaps_in_time =
+            g_first_times[other] <= g_last_times[id] &&
+            g_first_times[id] <= g_last_times[other];
+        const bool overlaps_in_memory =
+            offsets[other] < offset + g_sizes[id] &&
+            offset < offsets[other] + g_sizes[other];
+        if (overlaps_in_time && overlaps_in_memory) {
+          offset = offsets[other] + g_sizes[other];
+          moved = true;
+        }
+      }
+    }
+    offsets[id] = offset;
+    if (offset + g_sizes[id] > max_size) {
+      max_size = offset + g_sizes[id];
+    }
+  }
+  return max_size;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestReverseSortInPlace) {
+  int values[] = {3, 7, 1, 7, 5, 3, 9};
+  int ids[] = {0, 1, 2, 3, 4, 5, 6};
+  tflite::ReverseSortInPlace(values, ids, 7);
+  const int expected_values[] = {9, 7, 7, 5, 3, 3, 1};
+  const int expected_ids[] = {6, 3, 1, 4, 5, 0, 2};
+  for (int i = 0; i < 7; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(expected_values[i], values[i]);
+    TF_LITE_MICRO_EXPECT_EQ(expected_ids[i], ids[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestGapsAreReused) {
+  tflite::MicroErrorReporter reporter;
+  tflite::GreedyMemoryPlanner planner(g_scratch_buffer, kScratchBufferSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 100, 0, 1));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 50, 2, 3));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 20, 1, 2));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 80, 3, 4));
+
+  int offset = -1;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 0, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(0, offset);
+  // Only overlaps buffer 3 in time, so sits after it.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 1, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(80, offset);
+  // Overlaps buffers 0 and 1, and the gap between them is too small.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 2, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(130, offset);
+  // Buffer 0 is dead by the time buffer 3 is created.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 3, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(0, offset);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(150),
+                          planner.GetMaximumMemorySize());
+  TF_LITE_MICRO_EXPECT_EQ(false, planner.DoAnyBuffersOverlap(&reporter));
+}
+
+TF_LITE_MICRO_TEST(TestOfflineOffsetsAreKept) {
+  tflite::MicroErrorReporter reporter;
+  tflite::GreedyMemoryPlanner planner(g_scratch_buffer, kScratchBufferSize);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.AddBuffer(&reporter, 16, 0, 3, 32));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 32, 0, 1));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 24, 1, 2));
+
+  int offset = -1;
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 0, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(32, offset);
+  // Fits in the gap below the offline buffer.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 1, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(0, offset);
+  // Overlaps both, so goes after the offline buffer.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          planner.GetOffsetForBuffer(&reporter, 2, &offset));
+  TF_LITE_MICRO_EXPECT_EQ(48, offset);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(72),
+                          planner.GetMaximumMemorySize());
+}
+
+TF_LITE_MICRO_TEST(TestRandomGraphsMatchFirstFitPlacement) {
+  tflite::MicroErrorReporter reporter;
+  for (int trial = 0; trial < 50; ++trial) {
+    const int count = 1 + g_random.Below(kMaxRandomBuffers);
+    const int time_range = 1 + g_random.Below(200);
+    tflite::GreedyMemoryPlanner planner(g_scratch_buffer, kScratchBufferSize);
+    for (int i = 0; i < count; ++i) {
+      g_sizes[i] = 16 * (1 + g_random.Below(64));
+      g_first_times[i] = g_random.Below(time_range);
+      g_last_times[i] = g_first_times[i] + g_random.Below(8);
+      TF_LITE_MICRO_EXPECT_EQ(
+          kTfLiteOk, planner.AddBuffer(&reporter, g_sizes[i], g_first_times[i],
+                                       g_last_times[i]));
+    }
+    TF_LITE_MICRO_EXPECT_EQ(false, planner.DoAnyBuffersOverlap(&reporter));
+    TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(ReferenceMaximumSize(count)),
+                            planner.GetMaximumMemorySize());
+  }
+}
+
+TF_LITE_MICRO_TEST(TestTooManyBuffers) {
+  tflite::MicroErrorReporter reporter;
+  const int max_count = 3;
+  tflite::GreedyMemoryPlanner planner(
+      g_scratch_buffer,
+      max_count * tflite::GreedyMemoryPlanner::per_buffer_size());
+  for (int i = 0; i < max_count; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, planner.AddBuffer(&reporter, 8, i, i));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, planner.AddBuffer(&reporter, 8, 3, 3));
+  TF_LITE_MICRO_EXPECT_EQ(3, planner.GetBufferCount());
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -17,6 +17,7 @@ limitations under the License.
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/common.h"
@@ -46,6 +47,18 @@ constexpr size_t kMaxScratchBuffersPerOp = 12;
 // needs a node id assignment.
 constexpr int kUnassignedScratchBufferRequestIndex = -1;
 
+// Maximum number of tensor alias requests per model. They are only hints to
+// the memory planner, so requests beyond this are dropped.
+constexpr size_t kMaxTensorAliasRequests = 32;
+
+// Bytes reserved at the start of the head section for tensor alias requests
+// while a model is preparing. Scratch buffer requests follow them.
+constexpr size_t kTensorAliasRequestBytes =
+    ((sizeof(internal::TensorAliasRequest) * kMaxTensorAliasRequests +
+      alignof(internal::ScratchBufferRequest) - 1) /
+     alignof(internal::ScratchBufferRequest)) *
+    alignof(internal::ScratchBufferRequest);
+
 // Used to hold information used during allocation calculations.
 struct AllocationInfo {
   size_t bytes;
@@ -54,6 +67,9 @@ struct AllocationInfo {
   int last_used;
   int32_t offline_offset;
   bool needs_allocating;
+  // Index of the entry whose buffer this one shares, or -1. Aliased entries
+  // are not planned; they get the other entry's address once it is committed.
+  int alias_of;
 };
 
 // We align tensor buffers to 16-byte boundaries, since this is a common
@@ -62,12 +78,29 @@ constexpr int kBufferAlignment = 16;
 constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
 const TfLiteIntArray kZeroLengthIntArray = {};
 
+// Largest builtin params struct that is parsed into the staging buffer of
+// MicroBuiltinDataAllocator. TfLiteReshapeParams and TfLiteSqueezeParams are
+// the largest ones at 36 bytes; anything bigger goes straight to the arena.
+constexpr size_t kMaxStagedBuiltinDataSize = 64;
+
+// Builtin data allocator that lets operators with identical options share one
+// copy of their params. The first allocation of each parse lands in a zeroed
+// staging buffer, and Intern() then either points at an identical earlier
+// copy or moves the params into the persistent arena.
 class MicroBuiltinDataAllocator : public BuiltinDataAllocator {
  public:
   explicit MicroBuiltinDataAllocator(SimpleMemoryAllocator* memory_allocator)
       : memory_allocator_(memory_allocator) {}
 
   void* Allocate(size_t size, size_t alignment_hint) override {
+    if (staged_size_ == 0 && size <= kMaxStagedBuiltinDataSize &&
+        alignment_hint <= alignof(StagingBuffer)) {
+      // Zero the padding too, so identical params compare equal.
+      memset(&staging_buffer_, 0, size);
+      staged_size_ = size;
+      staged_alignment_ = alignment_hint;
+      return &staging_buffer_;
+    }
     return memory_allocator_->AllocateFromTail(size, alignment_hint);
   }
   void Deallocate(void* data) override {
@@ -75,8 +108,46 @@ class MicroBuiltinDataAllocator : public BuiltinDataAllocator {
     // of the model.
   }
 
+  // Replaces params returned by a parser for an operator with
+  // `builtin_code` by their persistent copy. Staged params are shared with
+  // the first of the `previous` operators of the same type whose params are
+  // identical, and copied to the arena otherwise. Other params are kept.
+  TfLiteStatus Intern(int32_t builtin_code,
+                      const NodeAndRegistration* previous,
+                      size_t previous_count, void** builtin_data) {
+    const size_t size = staged_size_;
+    staged_size_ = 0;
+    if (*builtin_data != &staging_buffer_) {
+      return kTfLiteOk;
+    }
+    // Operators of the same type have params of the same type and size.
+    for (size_t i = 0; i < previous_count; ++i) {
+      void* data = previous[i].node.builtin_data;
+      if (data != nullptr &&
+          previous[i].registration->builtin_code == builtin_code &&
+          memcmp(data, &staging_buffer_, size) == 0) {
+        *builtin_data = data;
+        return kTfLiteOk;
+      }
+    }
+    void* copy = memory_allocator_->AllocateFromTail(size, staged_alignment_);
+    if (copy == nullptr) {
+      return kTfLiteError;
+    }
+    memcpy(copy, &staging_buffer_, size);
+    *builtin_data = copy;
+    return kTfLiteOk;
+  }
+
  private:
+  struct StagingBuffer {
+    alignas(8) uint8_t bytes[kMaxStagedBuiltinDataSize];
+  };
+
   SimpleMemoryAllocator* memory_allocator_;
+  StagingBuffer staging_buffer_;
+  size_t staged_size_ = 0;
+  size_t staged_alignment_ = 0;
 
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
@@ -167,10 +238,20 @@ class AllocationInfoBuilder {
   TfLiteStatus GetOfflinePlannedOffsets(
       const Model* model, const int32_t** offline_planner_offsets);
 
-  // Add allocaiton information for the tensors.
+  // Add allocaiton information for the tensors. Lifetimes follow the inputs
+  // and outputs of `nodes`, which may differ from the flatbuffer operators
+  // after operator fusion.
   TfLiteStatus AddTensors(const SubGraph* subgraph,
+                          const NodeAndRegistration* nodes,
                           const int32_t* offline_offsets,
-                          TfLiteEvalTensor* eval_tensors);
+                          TfLiteEvalTensor* eval_tensors,
+                          const uint16_t* eval_tensor_slots);
+
+  // Lets the outputs named in `requests` share the buffers of their inputs
+  // wherever lifetimes permit. Must be called after AddTensors().
+  TfLiteStatus AddTensorAliases(const SubGraph* subgraph,
+                                const internal::TensorAliasRequest* requests,
+                                size_t request_count);
 
   // Add allocation information for the scratch buffers.
   TfLiteStatus AddScratchBuffers(
@@ -181,34 +262,58 @@ class AllocationInfoBuilder {
   const AllocationInfo* Finish() const { return info_; }
 
  private:
+  // Returns the tensor that owns the buffer of `tensor_index`.
+  int RootOf(int tensor_index) const;
+
+  // Lets tensor `alias` share the buffer of tensor `source` when both are
+  // planned online and `alias` fits, extending the shared lifetime to cover
+  // both. Unless `is_view` is set, the buffer must also be dead once `alias`
+  // is created and `alias` must fill it. Otherwise `alias` keeps a buffer of
+  // its own.
+  void AliasTensor(const SubGraph* subgraph, int source, int alias,
+                   bool is_view);
+
   AllocationInfo* info_ = nullptr;
   size_t tensor_count_ = 0;
   size_t buffer_count_ = 0;
   ErrorReporter* reporter_ = nullptr;
 };
 
-TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
-                                               const int32_t* offline_offsets,
-                                               TfLiteEvalTensor* eval_tensors) {
+TfLiteStatus AllocationInfoBuilder::AddTensors(
+    const SubGraph* subgraph, const NodeAndRegistration* nodes,
+    const int32_t* offline_offsets, TfLiteEvalTensor* eval_tensors,
+    const uint16_t* eval_tensor_slots) {
+  TFLITE_DCHECK(nodes != nullptr);
   TFLITE_DCHECK(eval_tensors != nullptr);
 
   // Set up allocation info for all tensors.
   for (size_t i = 0; i < tensor_count_; ++i) {
     AllocationInfo* current = &info_[i];
-    current->output_ptr = &(eval_tensors[i].data.data);
-
-    TF_LITE_ENSURE_STATUS(
-        TfLiteEvalTensorByteLength(&eval_tensors[i], &current->bytes));
-
     current->first_created = -1;
     current->last_used = -1;
-    current->needs_allocating = (eval_tensors[i].data.data == nullptr) &&
-                                (!subgraph->tensors()->Get(i)->is_variable());
+    current->alias_of = -1;
     if (offline_offsets) {
       current->offline_offset = offline_offsets[i];
     } else {
       current->offline_offset = kOnlinePlannedBuffer;
     }
+
+    TfLiteEvalTensor* eval_tensor =
+        internal::GetAllocatedEvalTensor(eval_tensors, eval_tensor_slots, i);
+    if (eval_tensor == nullptr) {
+      // Constant tensors of compact models live in the flatbuffer.
+      current->output_ptr = nullptr;
+      current->bytes = 0;
+      current->needs_allocating = false;
+      continue;
+    }
+    current->output_ptr = &(eval_tensor->data.data);
+
+    TF_LITE_ENSURE_STATUS(
+        TfLiteEvalTensorByteLength(eval_tensor, &current->bytes));
+
+    current->needs_allocating = (eval_tensor->data.data == nullptr) &&
+                                (!subgraph->tensors()->Get(i)->is_variable());
   }
 
   for (size_t i = 0; i < subgraph->inputs()->size(); ++i) {
@@ -226,16 +331,22 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
 
   // Figure out when the first and last use of each tensor is.
   for (int i = (subgraph->operators()->size() - 1); i >= 0; --i) {
-    const auto* op = subgraph->operators()->Get(i);
-    for (size_t n = 0; n < op->inputs()->size(); ++n) {
-      const int tensor_index = op->inputs()->Get(n);
+    const TfLiteNode& node = nodes[i].node;
+    for (int n = 0; n < node.inputs->size; ++n) {
+      const int tensor_index = node.inputs->data[n];
+      if (tensor_index < 0) {
+        continue;
+      }
       AllocationInfo* current = &info_[tensor_index];
       if (((current->last_used == -1) || (current->last_used < i))) {
         current->last_used = i;
       }
     }
-    for (size_t n = 0; n < op->outputs()->size(); ++n) {
-      const int tensor_index = op->outputs()->Get(n);
+    for (int n = 0; n < node.outputs->size; ++n) {
+      const int tensor_index = node.outputs->data[n];
+      if (tensor_index < 0) {
+        continue;
+      }
       AllocationInfo* current = &info_[tensor_index];
       if ((current->first_created == -1) || (current->first_created > i)) {
         current->first_created = i;
@@ -246,6 +357,12 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
   // Sanity check for valid tensor lifetime.
   for (size_t i = 0; i < tensor_count_; ++i) {
     AllocationInfo* current = &info_[i];
+    // A tensor that no node touches, such as the intermediate of two fused
+    // operators, needs no memory at all.
+    if ((current->first_created == -1) && (current->last_used == -1)) {
+      current->needs_allocating = false;
+      continue;
+    }
     // Even though tensor appears to be read only it may still need to be
     // allocated.
     const bool appears_read_only =
@@ -265,6 +382,69 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
   return kTfLiteOk;
 }
 
+TfLiteStatus AllocationInfoBuilder::AddTensorAliases(
+    const SubGraph* subgraph, const internal::TensorAliasRequest* requests,
+    size_t request_count) {
+  // Kernels are prepared in execution order, so the requests come in that
+  // order as well.
+  for (size_t i = 0; i < request_count; ++i) {
+    const internal::TensorAliasRequest& request = requests[i];
+    if (request.input_tensor < 0 ||
+        static_cast<size_t>(request.input_tensor) >= tensor_count_ ||
+        request.output_tensor < 0 ||
+        static_cast<size_t>(request.output_tensor) >= tensor_count_) {
+      TF_LITE_REPORT_ERROR(reporter_, "Invalid tensor alias request %d -> %d",
+                           request.input_tensor, request.output_tensor);
+      return kTfLiteError;
+    }
+    AliasTensor(subgraph, request.input_tensor, request.output_tensor,
+                request.is_view);
+  }
+  return kTfLiteOk;
+}
+
+int AllocationInfoBuilder::RootOf(int tensor_index) const {
+  while (info_[tensor_index].alias_of >= 0) {
+    tensor_index = info_[tensor_index].alias_of;
+  }
+  return tensor_index;
+}
+
+void AllocationInfoBuilder::AliasTensor(const SubGraph* subgraph, int source,
+                                        int alias, bool is_view) {
+  // An alias always points at the first tensor of its chain.
+  const int root_index = RootOf(source);
+  AllocationInfo* root = &info_[root_index];
+  AllocationInfo* current = &info_[alias];
+  if (root_index == alias || current->alias_of >= 0 ||
+      !root->needs_allocating || !current->needs_allocating ||
+      root->offline_offset != kOnlinePlannedBuffer ||
+      current->offline_offset != kOnlinePlannedBuffer ||
+      current->bytes > root->bytes) {
+    return;
+  }
+  if (!is_view) {
+    // The kernel overwrites its input, so no later node may read the buffer,
+    // and it must not hold a model output. A narrower output would keep the
+    // whole input buffer alive for its own lifetime, which can raise the peak
+    // instead of lowering it, so only outputs of the same size are placed.
+    if (root->last_used > current->first_created ||
+        current->bytes != root->bytes) {
+      return;
+    }
+    for (size_t i = 0; i < subgraph->outputs()->size(); ++i) {
+      if (RootOf(subgraph->outputs()->Get(i)) == root_index) {
+        return;
+      }
+    }
+  }
+  if (current->last_used > root->last_used) {
+    root->last_used = current->last_used;
+  }
+  current->needs_allocating = false;
+  current->alias_of = root_index;
+}
+
 // The tensor offsets will be encoded in the metadata:[Metadata] field of the
 // Model. The following encoding applies:
 //
@@ -330,6 +510,7 @@ TfLiteStatus AllocationInfoBuilder::AddScratchBuffers(
     current->last_used = current_request->node_idx;
     current->offline_offset = kOnlinePlannedBuffer;
     current->needs_allocating = true;
+    current->alias_of = -1;
   }
   return kTfLiteOk;
 }
@@ -374,6 +555,13 @@ TfLiteStatus CommitPlan(ErrorReporter* error_reporter, MemoryPlanner* planner,
       ++planner_index;
     }
   }
+  // Aliases always point at an entry that is not itself an alias.
+  for (size_t i = 0; i < allocation_info_size; ++i) {
+    const AllocationInfo* current = &allocation_info[i];
+    if (current->alias_of >= 0) {
+      *current->output_ptr = *allocation_info[current->alias_of].output_ptr;
+    }
+  }
   return kTfLiteOk;
 }
 }  // namespace
@@ -627,7 +815,7 @@ MicroAllocator* MicroAllocator::Create(SimpleMemoryAllocator* memory_allocator,
 TfLiteStatus MicroAllocator::StartModelAllocation(
     const Model* model, const MicroOpResolver& op_resolver,
     NodeAndRegistration** node_and_registrations,
-    TfLiteEvalTensor** eval_tensors) {
+    TfLiteEvalTensor** eval_tensors, uint16_t** eval_tensor_slots) {
   TFLITE_DCHECK(model != nullptr);
 
   if (model_is_allocating_) {
@@ -640,17 +828,20 @@ TfLiteStatus MicroAllocator::StartModelAllocation(
   model_is_allocating_ = true;
 
   TF_LITE_ENSURE_STATUS(InitScratchBufferData());
-  TF_LITE_ENSURE_STATUS(AllocateTfLiteEvalTensors(model, eval_tensors));
+  TF_LITE_ENSURE_STATUS(
+      AllocateTfLiteEvalTensors(model, eval_tensors, eval_tensor_slots));
   TF_LITE_ENSURE_STATUS(
       AllocateNodeAndRegistrations(model, node_and_registrations));
   TF_LITE_ENSURE_STATUS(PrepareNodeAndRegistrationDataFromFlatbuffer(
       model, op_resolver, *node_and_registrations));
+  node_and_registrations_ = *node_and_registrations;
 
   return kTfLiteOk;
 }
 
 TfLiteStatus MicroAllocator::FinishModelAllocation(
     const Model* model, TfLiteEvalTensor* eval_tensors,
+    const uint16_t* eval_tensor_slots,
     ScratchBufferHandle** scratch_buffer_handles) {
   if (!model_is_allocating_) {
     TF_LITE_REPORT_ERROR(error_reporter_,
@@ -665,8 +856,10 @@ TfLiteStatus MicroAllocator::FinishModelAllocation(
   TF_LITE_ENSURE_STATUS(AllocateScratchBufferHandles(
       scratch_buffer_handles, scratch_buffer_request_count_));
   TF_LITE_ENSURE_STATUS(CommitStaticMemoryPlan(model, subgraph, eval_tensors,
+                                               eval_tensor_slots,
                                                *scratch_buffer_handles));
-  TF_LITE_ENSURE_STATUS(AllocateVariables(subgraph, eval_tensors));
+  TF_LITE_ENSURE_STATUS(
+      AllocateVariables(subgraph, eval_tensors, eval_tensor_slots));
 
   model_is_allocating_ = false;
   return kTfLiteOk;
@@ -717,6 +910,29 @@ TfLiteStatus MicroAllocator::RequestScratchBufferInArena(size_t bytes,
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroAllocator::RequestTensorAlias(int input_tensor,
+                                                int output_tensor,
+                                                bool is_view) {
+  if (!model_is_allocating_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "MicroAllocator: Tensor alias requested outside of "
+                         "model allocation");
+    return kTfLiteError;
+  }
+  // Aliases only save memory, so a model with more requests than reserved
+  // still runs, just with separate buffers for the rest.
+  if (tensor_alias_request_count_ >= kMaxTensorAliasRequests) {
+    return kTfLiteOk;
+  }
+  internal::TensorAliasRequest* request =
+      &GetTensorAliasRequests()[tensor_alias_request_count_];
+  request->input_tensor = input_tensor;
+  request->output_tensor = output_tensor;
+  request->is_view = is_view;
+  ++tensor_alias_request_count_;
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroAllocator::FinishPrepareNodeAllocations(int node_id) {
   // When a node has finished preparing, all temp allocations performed by the
   // kernel should be cleaned up:
@@ -738,10 +954,9 @@ TfLiteStatus MicroAllocator::FinishPrepareNodeAllocations(int node_id) {
 
   // Ensure that the head is re-adjusted to allow for another at-most
   // kMaxScratchBuffersPerOp scratch buffer requests in the next operator:
-  TF_LITE_ENSURE_STATUS(memory_allocator_->SetHeadBufferSize(
+  TF_LITE_ENSURE_STATUS(SetScratchBufferHeadSize(
       sizeof(internal::ScratchBufferRequest) *
-          (scratch_buffer_request_count_ + kMaxScratchBuffersPerOp),
-      alignof(internal::ScratchBufferRequest)));
+      (scratch_buffer_request_count_ + kMaxScratchBuffersPerOp)));
 
   return kTfLiteOk;
 }
@@ -750,6 +965,42 @@ size_t MicroAllocator::used_bytes() const {
   return memory_allocator_->GetUsedBytes();
 }
 
+uint8_t* MicroAllocator::arena_buffer() const {
+  return memory_allocator_->GetHeadBuffer();
+}
+
+size_t MicroAllocator::arena_buffer_size() const {
+  return memory_allocator_->GetBufferSize();
+}
+
+size_t MicroAllocator::tail_used_bytes() const {
+  return memory_allocator_->GetTailUsedBytes();
+}
+
+TfLiteStatus MicroAllocator::RestorePersistentAllocations(const uint8_t* data,
+                                                          size_t bytes,
+                                                          size_t head_bytes) {
+  if (model_is_allocating_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "MicroAllocator: Cannot restore persistent "
+                         "allocations while a model is allocating");
+    return kTfLiteError;
+  }
+  // No padding with an alignment of 1, so the data lands right below the
+  // current tail.
+  uint8_t* restored = memory_allocator_->AllocateFromTail(bytes, 1);
+  if (restored == nullptr) {
+    return kTfLiteError;
+  }
+  std::memcpy(restored, data, bytes);
+
+  if (max_head_buffer_usage_ < head_bytes) {
+    max_head_buffer_usage_ = head_bytes;
+  }
+  return memory_allocator_->SetHeadBufferSize(max_head_buffer_usage_,
+                                              kBufferAlignment);
+}
+
 TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
     const Model* model, NodeAndRegistration** node_and_registrations) {
   TFLITE_DCHECK(node_and_registrations);
@@ -841,6 +1092,11 @@ TfLiteStatus MicroAllocator::PrepareNodeAndRegistrationDataFromFlatbuffer(
       }
       TF_LITE_ENSURE_STATUS(parser(op, error_reporter_, &builtin_data_allocator,
                                    (void**)(&builtin_data)));
+      // Models repeat the same options on many operators, e.g. every 3x3
+      // depthwise conv with stride 1 and ReLU6, so keep one copy of each.
+      TF_LITE_ENSURE_STATUS(builtin_data_allocator.Intern(
+          registration->builtin_code, node_and_registrations, i,
+          (void**)(&builtin_data)));
     }
 
     TfLiteIntArray* inputs_array;
@@ -864,7 +1120,8 @@ TfLiteStatus MicroAllocator::PrepareNodeAndRegistrationDataFromFlatbuffer(
 }
 
 TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensor(
-    const Model* model, TfLiteEvalTensor* eval_tensors, int tensor_index) {
+    const Model* model, TfLiteEvalTensor* eval_tensors,
+    const uint16_t* eval_tensor_slots, int tensor_index) {
   const SubGraph* subgraph = GetSubGraphFromModel(model);
   TFLITE_DCHECK(subgraph != nullptr);
 
@@ -890,13 +1147,19 @@ TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensor(
     // and not located in the flatbuffer are stored on the pre-allocated list of
     // TfLiteEvalTensors structs. These structs are the source of truth, simply
     // point the corresponding buffer to the new TfLiteTensor data value.
-    tensor->data.data = eval_tensors[tensor_index].data.data;
+    // Constant tensors without a struct keep their flatbuffer data.
+    const TfLiteEvalTensor* eval_tensor = internal::GetAllocatedEvalTensor(
+        eval_tensors, eval_tensor_slots, tensor_index);
+    if (eval_tensor != nullptr) {
+      tensor->data.data = eval_tensor->data.data;
+    }
   }
   return tensor;
 }
 
 TfLiteTensor* MicroAllocator::AllocateTempTfLiteTensor(
-    const Model* model, TfLiteEvalTensor* eval_tensors, int tensor_index) {
+    const Model* model, TfLiteEvalTensor* eval_tensors,
+    const uint16_t* eval_tensor_slots, int tensor_index) {
   const SubGraph* subgraph = GetSubGraphFromModel(model);
   TFLITE_DCHECK(subgraph != nullptr);
 
@@ -923,7 +1186,12 @@ TfLiteTensor* MicroAllocator::AllocateTempTfLiteTensor(
     // and not located in the flatbuffer are stored on the pre-allocated list of
     // TfLiteEvalTensors structs. These structs are the source of truth, simply
     // point the corresponding buffer to the new TfLiteTensor data value.
-    tensor->data.data = eval_tensors[tensor_index].data.data;
+    // Constant tensors without a struct keep their flatbuffer data.
+    const TfLiteEvalTensor* eval_tensor = internal::GetAllocatedEvalTensor(
+        eval_tensors, eval_tensor_slots, tensor_index);
+    if (eval_tensor != nullptr) {
+      tensor->data.data = eval_tensor->data.data;
+    }
   }
   return tensor;
 }
@@ -933,13 +1201,48 @@ void MicroAllocator::ResetTempAllocations() {
 }
 
 TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
-    const Model* model, TfLiteEvalTensor** eval_tensors) {
+    const Model* model, TfLiteEvalTensor** eval_tensors,
+    uint16_t** eval_tensor_slots) {
   TFLITE_DCHECK(eval_tensors != nullptr);
 
   const SubGraph* subgraph = GetSubGraphFromModel(model);
   TFLITE_DCHECK(subgraph != nullptr);
 
-  size_t alloc_count = subgraph->tensors()->size();
+  const size_t tensor_count = subgraph->tensors()->size();
+  uint16_t* slots = nullptr;
+  size_t alloc_count = tensor_count;
+  if (eval_tensor_slots != nullptr) {
+    if (!FLATBUFFERS_LITTLEENDIAN || tensor_count >= kConstantTensorSlot) {
+      TF_LITE_REPORT_ERROR(error_reporter_,
+                           "Compact tensor metadata needs a little-endian "
+                           "target and fewer than %d tensors",
+                           kConstantTensorSlot);
+      return kTfLiteError;
+    }
+    slots = reinterpret_cast<uint16_t*>(memory_allocator_->AllocateFromTail(
+        sizeof(uint16_t) * tensor_count, alignof(uint16_t)));
+    if (slots == nullptr) {
+      TF_LITE_REPORT_ERROR(error_reporter_,
+                           "Failed to allocate memory for the tensor slots, "
+                           "%d bytes required",
+                           sizeof(uint16_t) * tensor_count);
+      return kTfLiteError;
+    }
+    // Constant tensors are rebuilt from the flatbuffer when a kernel asks for
+    // them, everything else is numbered in tensor order.
+    alloc_count = 0;
+    for (size_t i = 0; i < tensor_count; ++i) {
+      const tflite::Tensor* tensor = subgraph->tensors()->Get(i);
+      if (!tensor->is_variable() &&
+          internal::GetFlatbufferTensorBuffer(*tensor, model->buffers()) !=
+              nullptr) {
+        slots[i] = kConstantTensorSlot;
+      } else {
+        slots[i] = static_cast<uint16_t>(alloc_count++);
+      }
+    }
+  }
+
   TfLiteEvalTensor* tensors =
       reinterpret_cast<TfLiteEvalTensor*>(memory_allocator_->AllocateFromTail(
           sizeof(TfLiteEvalTensor) * alloc_count, alignof(TfLiteEvalTensor)));
@@ -951,10 +1254,17 @@ TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
     return kTfLiteError;
   }
 
-  for (size_t i = 0; i < alloc_count; ++i) {
+  for (size_t i = 0; i < tensor_count; ++i) {
+    // Constant tensors are still parsed once so that unsupported types are
+    // reported now rather than while the model runs.
+    TfLiteEvalTensor constant_tensor;
+    TfLiteEvalTensor* result =
+        slots != nullptr && slots[i] == kConstantTensorSlot
+            ? &constant_tensor
+            : &tensors[slots != nullptr ? slots[i] : i];
     TfLiteStatus status = internal::InitializeTfLiteEvalTensorFromFlatbuffer(
         memory_allocator_, *subgraph->tensors()->Get(i), model->buffers(),
-        error_reporter_, &tensors[i]);
+        error_reporter_, result);
     if (status != kTfLiteOk) {
       TF_LITE_REPORT_ERROR(error_reporter_, "Failed to initialize tensor %d",
                            i);
@@ -962,22 +1272,29 @@ TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
     }
   }
   *eval_tensors = tensors;
+  if (eval_tensor_slots != nullptr) {
+    *eval_tensor_slots = slots;
+  }
   return kTfLiteOk;
 }
 
-TfLiteStatus MicroAllocator::AllocateVariables(const SubGraph* subgraph,
-                                               TfLiteEvalTensor* eval_tensors) {
+TfLiteStatus MicroAllocator::AllocateVariables(
+    const SubGraph* subgraph, TfLiteEvalTensor* eval_tensors,
+    const uint16_t* eval_tensor_slots) {
   for (size_t i = 0; i < subgraph->tensors()->size(); ++i) {
     auto* tensor = subgraph->tensors()->Get(i);
     if (tensor->is_variable()) {
+      // Variable tensors always have a struct of their own.
+      TfLiteEvalTensor* eval_tensor =
+          internal::GetAllocatedEvalTensor(eval_tensors, eval_tensor_slots, i);
       size_t buffer_size;
       TF_LITE_ENSURE_STATUS(
-          TfLiteEvalTensorByteLength(&eval_tensors[i], &buffer_size));
+          TfLiteEvalTensorByteLength(eval_tensor, &buffer_size));
 
-      eval_tensors[i].data.data =
+      eval_tensor->data.data =
           memory_allocator_->AllocateFromTail(buffer_size, kBufferAlignment);
 
-      if (eval_tensors[i].data.data == nullptr) {
+      if (eval_tensor->data.data == nullptr) {
         TF_LITE_REPORT_ERROR(error_reporter_,
                              "Failed to allocate variable tensor of size %d",
                              buffer_size);
@@ -1021,7 +1338,7 @@ const SubGraph* MicroAllocator::GetSubGraphFromModel(const Model* model) {
 
 TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
     const Model* model, const SubGraph* subgraph,
-    TfLiteEvalTensor* eval_tensors,
+    TfLiteEvalTensor* eval_tensors, const uint16_t* eval_tensor_slots,
     ScratchBufferHandle* scratch_buffer_handles) {
   size_t head_usage = 0;
   // Create static memory plan
@@ -1059,7 +1376,11 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   TF_LITE_ENSURE_STATUS(
       builder.GetOfflinePlannedOffsets(model, &offline_planner_offsets));
   TF_LITE_ENSURE_STATUS(
-      builder.AddTensors(subgraph, offline_planner_offsets, eval_tensors));
+      builder.AddTensors(subgraph, node_and_registrations_,
+                         offline_planner_offsets, eval_tensors,
+                         eval_tensor_slots));
+  TF_LITE_ENSURE_STATUS(builder.AddTensorAliases(
+      subgraph, GetTensorAliasRequests(), tensor_alias_request_count_));
 
   internal::ScratchBufferRequest* scratch_buffer_requests =
       GetScratchBufferRequests();
@@ -1080,8 +1401,12 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   // Reset all temp allocations used above:
   memory_allocator_->ResetTempAllocations();
 
+  // The plan is committed from the start of the head section, so any space
+  // currently held by the head (scratch buffer requests, or the plans of other
+  // models sharing this arena) is available to this plan as well.
   size_t actual_available_arena_size =
-      memory_allocator_->GetAvailableMemory(kBufferAlignment);
+      memory_allocator_->GetAvailableMemory(kBufferAlignment) +
+      memory_allocator_->GetHeadUsedBytes();
 
   // Make sure we have enough arena size.
   if (planner.GetMaximumMemorySize() > actual_available_arena_size) {
@@ -1138,19 +1463,40 @@ TfLiteStatus MicroAllocator::InitScratchBufferData() {
   // A model is preparing to allocate resources, ensure that scratch buffer
   // request counter is cleared:
   scratch_buffer_request_count_ = 0;
+  tensor_alias_request_count_ = 0;
 
   // All requests will be stored in the head section. Each kernel is allowed at
   // most kMaxScratchBuffersPerOp requests. Adjust the head to reserve at most
   // that many requests to begin:
-  TF_LITE_ENSURE_STATUS(memory_allocator_->SetHeadBufferSize(
-      sizeof(internal::ScratchBufferRequest) * kMaxScratchBuffersPerOp,
-      alignof(internal::ScratchBufferRequest)));
+  TF_LITE_ENSURE_STATUS(SetScratchBufferHeadSize(
+      sizeof(internal::ScratchBufferRequest) * kMaxScratchBuffersPerOp));
 
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroAllocator::SetScratchBufferHeadSize(size_t bytes) {
+  bytes += kTensorAliasRequestBytes;
+  // When the arena is shared between several models, the head still holds the
+  // memory plans of the models that have already been allocated. Never shrink
+  // it below the largest committed plan, otherwise persistent (tail)
+  // allocations of the model being prepared could be placed on top of the
+  // non-persistent buffers of the other tenants.
+  if (bytes < max_head_buffer_usage_) {
+    bytes = max_head_buffer_usage_;
+  }
+  return memory_allocator_->SetHeadBufferSize(
+      bytes, alignof(internal::ScratchBufferRequest));
+}
+
 internal::ScratchBufferRequest* MicroAllocator::GetScratchBufferRequests() {
   return reinterpret_cast<internal::ScratchBufferRequest*>(
+      AlignPointerUp(memory_allocator_->GetHeadBuffer(),
+                     alignof(internal::ScratchBufferRequest)) +
+      kTensorAliasRequestBytes);
+}
+
+internal::TensorAliasRequest* MicroAllocator::GetTensorAliasRequests() {
+  return reinterpret_cast<internal::TensorAliasRequest*>(
       AlignPointerUp(memory_allocator_->GetHeadBuffer(),
                      alignof(internal::ScratchBufferRequest)));
 }
@@ -28,8 +28,21 @@ limitations under the License.
 
 namespace tflite {
 
+// Marks the constant tensors in the slot table of a model allocated with
+// compact tensor metadata (see MicroAllocator::StartModelAllocation()). They
+// have no TfLiteEvalTensor of their own.
+constexpr uint16_t kConstantTensorSlot = 0xFFFF;
+
 namespace internal {
 
+// Sets up all of the data structure members for a TfLiteEvalTensor based on
+// the contents of a serialized tensor in the flatbuffer. On little-endian
+// targets the dims point into the flatbuffer and `allocator` is not used.
+TfLiteStatus InitializeTfLiteEvalTensorFromFlatbuffer(
+    SimpleMemoryAllocator* allocator, const tflite::Tensor& flatbuffer_tensor,
+    const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
+    ErrorReporter* error_reporter, TfLiteEvalTensor* result);
+
 // Sets up all of the data structure members for a TfLiteTensor based on the
 // contents of a serialized tensor in the flatbuffer.
 // TODO(b/162311891): Drop this method when the interpreter has an API for
@@ -60,6 +73,36 @@ typedef struct {
   int node_idx;
 } ScratchBufferRequest;
 
+// Holds a request from a kernel to place one of its outputs on top of one of
+// its inputs. Like ScratchBufferRequest, these are only stored in the head
+// section while the model is preparing and are consumed when the memory plan
+// is committed.
+typedef struct {
+  // Tensor whose buffer is shared.
+  int input_tensor;
+  // Tensor that is placed on top of `input_tensor`.
+  int output_tensor;
+  // True when the output holds exactly the bytes of its input (e.g. RESHAPE),
+  // so the two may share a buffer even if later nodes still read the input.
+  // Otherwise the kernel overwrites its input, which is only allowed when no
+  // later node reads it.
+  bool is_view;
+} TensorAliasRequest;
+
+// Returns the TfLiteEvalTensor allocated for `tensor_index`. Models allocated
+// with compact tensor metadata index `eval_tensors` through
+// `eval_tensor_slots` and have none for their constant tensors, in which case
+// this returns nullptr. Otherwise `eval_tensor_slots` is nullptr.
+inline TfLiteEvalTensor* GetAllocatedEvalTensor(
+    TfLiteEvalTensor* eval_tensors, const uint16_t* eval_tensor_slots,
+    int tensor_index) {
+  if (eval_tensor_slots == nullptr) {
+    return &eval_tensors[tensor_index];
+  }
+  const uint16_t slot = eval_tensor_slots[tensor_index];
+  return slot == kConstantTensorSlot ? nullptr : &eval_tensors[slot];
+}
+
 }  // namespace internal
 
 typedef struct {
@@ -98,6 +141,16 @@ typedef struct {
 //                                               - ->GetDataSize()
 // persistent area (tail)
 // ************** .memory_allocator->GetBuffer() + ->GetMaxBufferSize()
+//
+// A single MicroAllocator can be shared by several MicroInterpreter instances
+// (see the MicroInterpreter constructor taking a MicroAllocator). Each model
+// keeps its own persistent allocations in the tail, while the head is
+// time-shared: every model plans its non-persistent buffers from the start of
+// the head, and the head is sized for the largest plan. The arena therefore
+// needs roughly sum(tail) + max(head) bytes instead of sum(tail + head). Models
+// sharing an allocator must be allocated one after another and must never be
+// invoked concurrently, since invoking one model overwrites the input, output
+// and intermediate tensors of the others.
 class MicroAllocator {
  public:
   // Creates a MicroAllocator instance from a given tensor arena. This arena
@@ -121,41 +174,52 @@ class MicroAllocator {
   // resuming allocation with another model. All persistent tensor buffers are
   // stored in the out-param eval_tensors. This value is allocated from the
   // persistent memory arena and will be used to host runtime tensor buffers.
+  //
+  // If `eval_tensor_slots` is not nullptr, the model is allocated with compact
+  // tensor metadata: constant tensors, whose descriptors can be rebuilt from
+  // the flatbuffer at any time, get no TfLiteEvalTensor. The out-param
+  // eval_tensor_slots then maps every tensor index to its entry in
+  // eval_tensors, or to kConstantTensorSlot (see
+  // internal::GetAllocatedEvalTensor()). This needs a little-endian target,
+  // where dims can point into the flatbuffer.
   TfLiteStatus StartModelAllocation(
       const Model* model, const MicroOpResolver& op_resolver,
       NodeAndRegistration** node_and_registrations,
-      TfLiteEvalTensor** eval_tensors);
+      TfLiteEvalTensor** eval_tensors, uint16_t** eval_tensor_slots);
 
   // Finish allocating internal resources required for model inference.
   // This method will plan non-persistent buffers and commit a memory plan to
   // the 'head' section of the memory arena. All variable tensor data will also
   // be allocated. This method should be called after assigning model resources
-  // in StartModelAllocation(). The eval_tensors pointer should be the value
-  // passed into this class during StartModelAllocation(). Scratch buffer
-  // handles are stored in the out-param `scratch_buffer_handles`. This value
-  // will be used in `GetScratchBuffer` call to retrieve scratch buffers.
+  // in StartModelAllocation(). The eval_tensors and eval_tensor_slots
+  // pointers should be the values passed into this class during
+  // StartModelAllocation(). Scratch buffer handles are stored in the out-param
+  // `scratch_buffer_handles`. This value will be used in `GetScratchBuffer`
+  // call to retrieve scratch buffers.
   TfLiteStatus FinishModelAllocation(
       const Model* model, TfLiteEvalTensor* eval_tensors,
+      const uint16_t* eval_tensor_slots,
       ScratchBufferHandle** scratch_buffer_handles);
 
   // Allocates a TfLiteTensor struct and populates the returned value with
   // properties from the model flatbuffer. This struct is allocated from
   // persistent arena memory is only guaranteed for the lifetime of the
-  // application. The eval_tensors pointer should be the value passed into this
-  // class during StartModelAllocation() and contains the source-of-truth for
-  // buffers.
+  // application. The eval_tensors and eval_tensor_slots pointers should be the
+  // values passed into this class during StartModelAllocation() and contain
+  // the source-of-truth for buffers.
   virtual TfLiteTensor* AllocatePersistentTfLiteTensor(
-      const Model* model, TfLiteEvalTensor* eval_tensors, int tensor_index);
+      const Model* model, TfLiteEvalTensor* eval_tensors,
+      const uint16_t* eval_tensor_slots, int tensor_index);
 
   // Allocates a TfLiteTensor struct and populates the returned value with
   // properties from the model flatbuffer. This struct is allocated from
   // temporary arena memory is only guaranteed until a call is made to
-  // ResetTempAllocations(). The eval_tensors pointer should be the value passed
-  // into this class during StartModelAllocation() and contains the
-  // source-of-truth for buffers.
-  virtual TfLiteTensor* AllocateTempTfLiteTensor(const Model* model,
-                                                 TfLiteEvalTensor* eval_tensors,
-                                                 int tensor_index);
+  // ResetTempAllocations(). The eval_tensors and eval_tensor_slots pointers
+  // should be the values passed into this class during StartModelAllocation()
+  // and contain the source-of-truth for buffers.
+  virtual TfLiteTensor* AllocateTempTfLiteTensor(
+      const Model* model, TfLiteEvalTensor* eval_tensors,
+      const uint16_t* eval_tensor_slots, int tensor_index);
 
   // Resets all temporary allocations. This method should be called after a
   // chain of temp allocations (e.g. chain of TfLiteTensor objects via
@@ -179,10 +243,34 @@ class MicroAllocator {
   // next node prepare block.
   TfLiteStatus FinishPrepareNodeAllocations(int node_id);
 
+  // Asks the memory planner to let `output_tensor` share the buffer of
+  // `input_tensor` (see internal::TensorAliasRequest). Requests are hints: the
+  // planner drops any it cannot honour, so kernels must work whether or not
+  // the buffers end up shared. Only valid while a model is allocating.
+  TfLiteStatus RequestTensorAlias(int input_tensor, int output_tensor,
+                                  bool is_view);
+
   // Returns the arena usage in bytes, only available after
   // `FinishModelAllocation`. Otherwise, it will return 0.
   size_t used_bytes() const;
 
+  // The aligned arena managed by this allocator, how many bytes have been
+  // allocated from its tail and the size of the head section. Arena snapshots
+  // (see arena_snapshot.h) use these to find the persistent allocations of a
+  // model.
+  uint8_t* arena_buffer() const;
+  size_t arena_buffer_size() const;
+  size_t tail_used_bytes() const;
+  size_t head_bytes() const { return max_head_buffer_usage_; }
+
+  // Allocates `bytes` from the tail, fills them with the persistent
+  // allocations of a model saved in an arena snapshot and grows the head to
+  // at least `head_bytes`, as FinishModelAllocation() would have left it. The
+  // allocations must land at the addresses they were saved from, i.e. the
+  // tail must be exactly as it was when the model started allocating.
+  TfLiteStatus RestorePersistentAllocations(const uint8_t* data, size_t bytes,
+                                            size_t head_bytes);
+
  protected:
   MicroAllocator(SimpleMemoryAllocator* memory_allocator,
                  ErrorReporter* error_reporter);
@@ -205,13 +293,16 @@ class MicroAllocator {
   // Allocates the list of persistent TfLiteEvalTensors that are used for the
   // "eval" phase of model inference. These structs will be the source of truth
   // for all tensor buffers. Allocation results are stored in the out-param
-  // eval_tensors.
+  // eval_tensors. If eval_tensor_slots is not nullptr, only the non-constant
+  // tensors get a struct and the out-param receives the slot table.
   virtual TfLiteStatus AllocateTfLiteEvalTensors(
-      const Model* model, TfLiteEvalTensor** eval_tensors);
+      const Model* model, TfLiteEvalTensor** eval_tensors,
+      uint16_t** eval_tensor_slots);
 
   // Allocates persistent tensor buffers for variable tensors in the subgraph.
   virtual TfLiteStatus AllocateVariables(const SubGraph* subgraph,
-                                         TfLiteEvalTensor* eval_tensors);
+                                         TfLiteEvalTensor* eval_tensors,
+                                         const uint16_t* eval_tensor_slots);
 
   // Allocate and return a persistent TfLiteTensor.
   // TODO(b/162311891): Drop this method when the interpreter has an API for
@@ -241,7 +332,7 @@ class MicroAllocator {
   // the head section.
   virtual TfLiteStatus CommitStaticMemoryPlan(
       const Model* model, const SubGraph* subgraph,
-      TfLiteEvalTensor* eval_tensors,
+      TfLiteEvalTensor* eval_tensors, const uint16_t* eval_tensor_slots,
       ScratchBufferHandle* scratch_buffer_handles);
 
   // Allocates an array of ScratchBufferHandle structs in the tail section for a
@@ -254,10 +345,20 @@ class MicroAllocator {
   // preparing.
   TfLiteStatus InitScratchBufferData();
 
+  // Resizes the head section to hold `bytes` of scratch buffer requests. The
+  // head is never shrunk below the largest memory plan committed so far, which
+  // keeps the non-persistent buffers of other models sharing this allocator
+  // intact while another model is being prepared.
+  TfLiteStatus SetScratchBufferHeadSize(size_t bytes);
+
   // Returns the pointer for the array of ScratchBufferRequest allocations in
-  // the head section.
+  // the head section. They follow the TensorAliasRequest array.
   internal::ScratchBufferRequest* GetScratchBufferRequests();
 
+  // Returns the pointer for the array of TensorAliasRequest allocations at
+  // the start of the head section.
+  internal::TensorAliasRequest* GetTensorAliasRequests();
+
   // A simple memory allocator that always allocate from the arena tail or head.
   SimpleMemoryAllocator* memory_allocator_;
 
@@ -268,6 +369,15 @@ class MicroAllocator {
   // section when a model is allocating.
   size_t scratch_buffer_request_count_ = 0;
 
+  // Holds the number of TensorAliasRequest instances stored in the head
+  // section when a model is allocating.
+  size_t tensor_alias_request_count_ = 0;
+
+  // The nodes of the model being allocated. Tensor lifetimes for the memory
+  // plan are taken from these rather than from the flatbuffer, so that the
+  // interpreter can rewrite the graph (e.g. fuse operators) in between.
+  const NodeAndRegistration* node_and_registrations_ = nullptr;
+
   // Holds the byte length of the memory plan with the largest head usage. Used
   // to ensure that multi-tenant allocations can share the head for buffers.
   size_t max_head_buffer_usage_ = 0;
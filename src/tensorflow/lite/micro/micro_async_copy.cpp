@@ -0,0 +1,33 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Reference implementation of background copies, for platforms without a DMA
+// engine and for host builds. Every copy completes before StartAsyncCopy()
+// returns. The RP2 version lives in rp2/micro_async_copy.cpp.
+
+#include "tensorflow/lite/micro/micro_async_copy.h"
+
+#include <cstring>
+
+namespace tflite {
+
+int StartAsyncCopy(void* dst, const void* src, size_t bytes) {
+  std::memcpy(dst, src, bytes);
+  return kAsyncCopyDone;
+}
+
+void WaitAsyncCopy(int handle) {}
+
+}  // namespace tflite
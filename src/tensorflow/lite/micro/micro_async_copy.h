@@ -0,0 +1,39 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_ASYNC_COPY_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_ASYNC_COPY_H_
+
+#include <stddef.h>
+
+namespace tflite {
+
+// Returned by StartAsyncCopy() when the copy already completed synchronously.
+constexpr int kAsyncCopyDone = -1;
+
+// These functions should be implemented by each target platform. A platform
+// without a DMA engine can simply memcpy() and return kAsyncCopyDone.
+//
+// Starts copying `bytes` from `src` to `dst` in the background and returns a
+// handle to pass to WaitAsyncCopy(). Neither buffer may be touched until the
+// copy has been waited for.
+int StartAsyncCopy(void* dst, const void* src, size_t bytes);
+
+// Blocks until the copy identified by `handle` has completed and releases any
+// resources held for it. Waiting on kAsyncCopyDone returns immediately.
+void WaitAsyncCopy(int handle);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_ASYNC_COPY_H_
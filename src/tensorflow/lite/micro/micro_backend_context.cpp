@@ -0,0 +1,103 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_backend_context.h"
+
+#include "tensorflow/lite/micro/micro_allocator.h"
+
+namespace tflite {
+namespace {
+
+TfLiteStatus RefreshBackendContext(TfLiteContext* context) {
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+MicroBackendContext::MicroBackendContext() {
+  type = kTfLiteCpuBackendContext;
+  Refresh = RefreshBackendContext;
+}
+
+void* MicroBackendContext::AllocatePackedBuffer(TfLiteContext* context,
+                                                size_t bytes) {
+  if (bytes > packing_budget_ - packed_bytes_) {
+    return nullptr;
+  }
+  void* buffer = context->AllocatePersistentBuffer(context, bytes);
+  if (buffer != nullptr) {
+    packed_bytes_ += bytes;
+  }
+  return buffer;
+}
+
+TfLiteStatus MicroBackendContext::RequestTensorAlias(const TfLiteNode* node,
+                                                     int input_index,
+                                                     int output_index,
+                                                     bool is_view) {
+  if (allocator_ == nullptr) {
+    return kTfLiteOk;
+  }
+  if (input_index < 0 || input_index >= node->inputs->size ||
+      output_index < 0 || output_index >= node->outputs->size) {
+    return kTfLiteError;
+  }
+  const int input_tensor = node->inputs->data[input_index];
+  const int output_tensor = node->outputs->data[output_index];
+  if (input_tensor < 0 || output_tensor < 0) {
+    // Optional tensors that are not present have nothing to share.
+    return kTfLiteOk;
+  }
+  return allocator_->RequestTensorAlias(input_tensor, output_tensor, is_view);
+}
+
+MicroBackendContext* GetMicroBackendContext(TfLiteContext* context) {
+  if (context->GetExternalContext == nullptr) {
+    return nullptr;
+  }
+  return static_cast<MicroBackendContext*>(
+      context->GetExternalContext(context, kTfLiteCpuBackendContext));
+}
+
+void* AllocatePackedBuffer(TfLiteContext* context, size_t bytes) {
+  MicroBackendContext* backend_context = GetMicroBackendContext(context);
+  if (backend_context == nullptr) {
+    return nullptr;
+  }
+  return backend_context->AllocatePackedBuffer(context, bytes);
+}
+
+TfLiteStatus RequestInPlaceOutput(TfLiteContext* context,
+                                  const TfLiteNode* node, int input_index,
+                                  int output_index) {
+  MicroBackendContext* backend_context = GetMicroBackendContext(context);
+  if (backend_context == nullptr) {
+    return kTfLiteOk;
+  }
+  return backend_context->RequestTensorAlias(node, input_index, output_index,
+                                             /*is_view=*/false);
+}
+
+TfLiteStatus RequestOutputView(TfLiteContext* context, const TfLiteNode* node,
+                               int input_index, int output_index) {
+  MicroBackendContext* backend_context = GetMicroBackendContext(context);
+  if (backend_context == nullptr) {
+    return kTfLiteOk;
+  }
+  return backend_context->RequestTensorAlias(node, input_index, output_index,
+                                             /*is_view=*/true);
+}
+
+}  // namespace tflite
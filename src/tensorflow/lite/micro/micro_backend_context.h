@@ -0,0 +1,96 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_BACKEND_CONTEXT_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_BACKEND_CONTEXT_H_
+
+#include <cstddef>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_workers.h"
+
+namespace tflite {
+
+class MicroAllocator;
+
+// Settings that let kernels trade memory or cores for speed. The interpreter
+// owns one instance and hands it to kernels as the kTfLiteCpuBackendContext
+// external context; kernels look it up with GetMicroBackendContext().
+class MicroBackendContext : public TfLiteExternalContext {
+ public:
+  MicroBackendContext();
+
+  // Workers to split single operations across, or nullptr.
+  MicroWorkers* workers() const { return workers_; }
+  void set_workers(MicroWorkers* workers) { workers_ = workers; }
+
+  // Bytes of persistent arena that kernels may spend on weights packed at
+  // Prepare time (e.g. kernel sums folded into the bias). Defaults to 0,
+  // which leaves every kernel on its unpacked path.
+  void set_packing_budget(size_t bytes) { packing_budget_ = bytes; }
+  size_t packing_budget() const { return packing_budget_; }
+  size_t packed_bytes() const { return packed_bytes_; }
+  // Restores packed_bytes() along with the packed weights from an arena
+  // snapshot.
+  void set_packed_bytes(size_t bytes) { packed_bytes_ = bytes; }
+
+  // Allocates `bytes` of persistent memory for packed weights if they fit in
+  // the remaining budget, and returns nullptr otherwise. Nodes are prepared
+  // in execution order, so the earliest layers are packed first.
+  void* AllocatePackedBuffer(TfLiteContext* context, size_t bytes);
+
+  // The allocator that takes tensor alias requests. The interpreter only sets
+  // it while nodes are being prepared.
+  void set_allocator(MicroAllocator* allocator) { allocator_ = allocator; }
+
+  // Asks the memory planner to place output `output_index` of `node` on top
+  // of input `input_index` (see MicroAllocator::RequestTensorAlias()).
+  TfLiteStatus RequestTensorAlias(const TfLiteNode* node, int input_index,
+                                  int output_index, bool is_view);
+
+ private:
+  MicroAllocator* allocator_ = nullptr;
+  MicroWorkers* workers_ = nullptr;
+  size_t packing_budget_ = 0;
+  size_t packed_bytes_ = 0;
+};
+
+// Returns the backend context of the interpreter that owns `context`, or
+// nullptr if it doesn't provide one (e.g. in kernel unit tests).
+MicroBackendContext* GetMicroBackendContext(TfLiteContext* context);
+
+// Shorthand for GetMicroBackendContext(context)->AllocatePackedBuffer() that
+// returns nullptr when there is no backend context. Only valid in Prepare.
+void* AllocatePackedBuffer(TfLiteContext* context, size_t bytes);
+
+// Declares that the kernel of `node` computes output `output_index` correctly
+// when it shares memory with input `input_index`, i.e. that it reads every
+// input element before writing the output element at the same offset. The
+// memory planner then overwrites the input in place if no later node reads it
+// and the output fits. Kernels must not depend on it happening. Only valid in
+// Prepare; a no-op when there is no backend context.
+TfLiteStatus RequestInPlaceOutput(TfLiteContext* context,
+                                  const TfLiteNode* node, int input_index,
+                                  int output_index);
+
+// Declares that output `output_index` of `node` holds exactly the bytes of
+// input `input_index` (e.g. RESHAPE), so the two can share one buffer even if
+// later nodes read the input. Kernels must still handle separate buffers.
+// Only valid in Prepare; a no-op when there is no backend context.
+TfLiteStatus RequestOutputView(TfLiteContext* context, const TfLiteNode* node,
+                               int input_index, int output_index);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_BACKEND_CONTEXT_H_
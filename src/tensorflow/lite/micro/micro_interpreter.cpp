@@ -17,15 +17,18 @@ limitations under the License.
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/core/api/tensor_utils.h"
+#include "tensorflow/lite/micro/arena_snapshot.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/operator_fusion.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
@@ -41,6 +44,20 @@ const char* OpNameFromRegistration(const TfLiteRegistration* registration) {
 }
 #endif  // !defined(TF_LITE_STRIP_ERROR_STRINGS)
 
+// Adds the kernel functions of `registration` to the code hash of an arena
+// snapshot.
+uint32_t HashKernelFunctions(const TfLiteRegistration* registration,
+                             uint32_t hash) {
+  const uintptr_t functions[] = {
+      reinterpret_cast<uintptr_t>(registration->init),
+      reinterpret_cast<uintptr_t>(registration->free),
+      reinterpret_cast<uintptr_t>(registration->prepare),
+      reinterpret_cast<uintptr_t>(registration->invoke),
+      static_cast<uintptr_t>(registration->builtin_code),
+  };
+  return ArenaSnapshotHash(functions, sizeof(functions), hash);
+}
+
 }  // namespace
 
 namespace internal {
@@ -83,17 +100,71 @@ TfLiteTensor* ContextHelper::GetTensor(const struct TfLiteContext* context,
                                        int tensor_idx) {
   ContextHelper* helper = static_cast<ContextHelper*>(context->impl_);
   return helper->allocator_->AllocateTempTfLiteTensor(
-      helper->model_, helper->eval_tensors_, tensor_idx);
+      helper->model_, helper->eval_tensors_, helper->eval_tensor_slots_,
+      tensor_idx);
 }
 
 TfLiteEvalTensor* ContextHelper::GetEvalTensor(
     const struct TfLiteContext* context, int tensor_idx) {
   ContextHelper* helper = reinterpret_cast<ContextHelper*>(context->impl_);
-  return &helper->eval_tensors_[tensor_idx];
+  if (helper->eval_tensor_slots_ == nullptr) {
+    return &helper->eval_tensors_[tensor_idx];
+  }
+  const uint16_t slot = helper->eval_tensor_slots_[tensor_idx];
+  if (slot != kConstantTensorSlot) {
+    return &helper->eval_tensors_[slot];
+  }
+  return helper->GetConstantEvalTensor(tensor_idx);
 }
 
-void ContextHelper::SetTfLiteEvalTensors(TfLiteEvalTensor* eval_tensors) {
+TfLiteEvalTensor* ContextHelper::GetConstantEvalTensor(int tensor_idx) {
+  const size_t cached = constant_tensors_used_ < constant_tensors_size_
+                            ? constant_tensors_used_
+                            : constant_tensors_size_;
+  for (size_t i = 0; i < cached; ++i) {
+    if (constant_tensor_indices_[i] == tensor_idx) {
+      return &constant_tensors_[i];
+    }
+  }
+  // Kernels that reach for tensors outside their node wrap around.
+  const size_t entry = constant_tensors_used_ % constant_tensors_size_;
+  ++constant_tensors_used_;
+  // Types were checked when the model was allocated and, on the little-endian
+  // targets compact metadata runs on, the dims need no memory of their own.
+  const SubGraph* subgraph = (*model_->subgraphs())[0];
+  if (internal::InitializeTfLiteEvalTensorFromFlatbuffer(
+          /*allocator=*/nullptr, *subgraph->tensors()->Get(tensor_idx),
+          model_->buffers(), error_reporter_, &constant_tensors_[entry]) !=
+      kTfLiteOk) {
+    constant_tensor_indices_[entry] = kConstantTensorSlot;
+    return nullptr;
+  }
+  constant_tensor_indices_[entry] = static_cast<uint16_t>(tensor_idx);
+  return &constant_tensors_[entry];
+}
+
+TfLiteExternalContext* ContextHelper::GetExternalContext(
+    struct TfLiteContext* context, TfLiteExternalContextType type) {
+  ContextHelper* helper = static_cast<ContextHelper*>(context->impl_);
+  if (type == kTfLiteCpuBackendContext) {
+    return &helper->backend_context_;
+  }
+  return nullptr;
+}
+
+void ContextHelper::SetTfLiteEvalTensors(TfLiteEvalTensor* eval_tensors,
+                                         const uint16_t* eval_tensor_slots) {
   eval_tensors_ = eval_tensors;
+  eval_tensor_slots_ = eval_tensor_slots;
+}
+
+void ContextHelper::SetConstantEvalTensors(TfLiteEvalTensor* constant_tensors,
+                                           size_t size) {
+  constant_tensors_ = constant_tensors;
+  constant_tensor_indices_ =
+      reinterpret_cast<uint16_t*>(constant_tensors + size);
+  constant_tensors_size_ = size;
+  constant_tensors_used_ = 0;
 }
 
 void ContextHelper::SetScratchBufferHandles(
@@ -171,6 +242,7 @@ void MicroInterpreter::Init(tflite::Profiler* profiler) {
   context_.ReportError = context_helper_.ReportOpError;
   context_.GetTensor = context_helper_.GetTensor;
   context_.GetEvalTensor = context_helper_.GetEvalTensor;
+  context_.GetExternalContext = context_helper_.GetExternalContext;
   context_.recommended_num_threads = 1;
   context_.profiler = profiler;
 
@@ -221,20 +293,36 @@ void MicroInterpreter::CorrectTensorDataEndianness(T* data, int32_t size) {
 }
 
 TfLiteStatus MicroInterpreter::AllocateTensors() {
-  if (allocator_.StartModelAllocation(model_, op_resolver_,
-                                      &node_and_registrations_,
-                                      &eval_tensors_) != kTfLiteOk) {
+  tail_bytes_before_allocation_ = allocator_.tail_used_bytes();
+  if (allocator_.StartModelAllocation(
+          model_, op_resolver_, &node_and_registrations_, &eval_tensors_,
+          compact_tensor_metadata_ ? &eval_tensor_slots_ : nullptr) !=
+      kTfLiteOk) {
     TF_LITE_REPORT_ERROR(error_reporter_,
                          "Failed starting model allocation.\n");
     initialization_status_ = kTfLiteError;
     return kTfLiteError;
   }
 
+  if (fuse_operators_ &&
+      FuseDepthwisePointwiseConvs(model_, node_and_registrations_, &allocator_,
+                                  error_reporter_,
+                                  &fused_operators_size_) != kTfLiteOk) {
+    initialization_status_ = kTfLiteError;
+    return kTfLiteError;
+  }
+
+  if (eval_tensor_slots_ != nullptr &&
+      AllocateConstantEvalTensors() != kTfLiteOk) {
+    initialization_status_ = kTfLiteError;
+    return kTfLiteError;
+  }
+
   // Update the pointer now that TfLiteEvalTensor allocation has completed on
   // the context helper.
   // TODO(b/16157777): This call would not be needed if ContextHelper rolled
   // into the interpreter.
-  context_helper_.SetTfLiteEvalTensors(eval_tensors_);
+  context_helper_.SetTfLiteEvalTensors(eval_tensors_, eval_tensor_slots_);
   context_.tensors_size = subgraph_->tensors()->size();
 
   // If the system is big endian then convert weights from the flatbuffer from
@@ -276,6 +364,7 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
       init_data = reinterpret_cast<const char*>(node->builtin_data);
       init_data_size = 0;
     }
+    context_helper_.ResetConstantEvalTensors();
     if (registration->init) {
       node->user_data =
           registration->init(&context_, init_data, init_data_size);
@@ -283,12 +372,14 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   }
 
   // Both AllocatePersistentBuffer and RequestScratchBufferInArena is
-  // available in Prepare stage.
+  // available in Prepare stage, as are tensor alias requests.
   context_.RequestScratchBufferInArena =
       context_helper_.RequestScratchBufferInArena;
+  context_helper_.backend_context()->set_allocator(&allocator_);
   for (size_t i = 0; i < subgraph_->operators()->size(); ++i) {
     auto* node = &(node_and_registrations_[i].node);
     auto* registration = node_and_registrations_[i].registration;
+    context_helper_.ResetConstantEvalTensors();
     if (registration->prepare) {
       TfLiteStatus prepare_status = registration->prepare(&context_, node);
       if (prepare_status != kTfLiteOk) {
@@ -306,21 +397,29 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   // allowed. Kernels can only fetch scratch buffers via GetScratchBuffer.
   context_.AllocatePersistentBuffer = nullptr;
   context_.RequestScratchBufferInArena = nullptr;
+  context_helper_.backend_context()->set_allocator(nullptr);
   context_.GetScratchBuffer = context_helper_.GetScratchBuffer;
 
   TF_LITE_ENSURE_OK(&context_,
                     allocator_.FinishModelAllocation(model_, eval_tensors_,
+                                                     eval_tensor_slots_,
                                                      &scratch_buffer_handles_));
   // TODO(b/16157777): Remove this when ContextHelper is rolled into this class.
   context_helper_.SetScratchBufferHandles(scratch_buffer_handles_);
 
   TF_LITE_ENSURE_STATUS(ResetVariableTensors());
 
+  tail_bytes_after_allocation_ = allocator_.tail_used_bytes();
+  invoked_since_allocation_ = false;
   tensors_allocated_ = true;
   return kTfLiteOk;
 }
 
 TfLiteStatus MicroInterpreter::Invoke() {
+  return InvokeUntil(operators_size());
+}
+
+TfLiteStatus MicroInterpreter::InvokeUntil(size_t end) {
   if (initialization_status_ != kTfLiteOk) {
     TF_LITE_REPORT_ERROR(error_reporter_,
                          "Invoke() called after initialization failed\n");
@@ -333,7 +432,32 @@ TfLiteStatus MicroInterpreter::Invoke() {
     TF_LITE_ENSURE_OK(&context_, AllocateTensors());
   }
 
-  for (size_t i = 0; i < subgraph_->operators()->size(); ++i) {
+  if (weight_prefetcher_.enabled()) {
+    weight_prefetcher_.Reset();
+  }
+  invoked_since_allocation_ = true;
+  next_operator_ = 0;
+  return InvokeOperators(end);
+}
+
+TfLiteStatus MicroInterpreter::ContinueInvoke(size_t end) {
+  if (next_operator_ == 0) {
+    return InvokeUntil(end);
+  }
+  return InvokeOperators(end);
+}
+
+TfLiteStatus MicroInterpreter::InvokeOperators(size_t end) {
+  if (end < next_operator_ || end > operators_size()) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Cannot invoke up to operator %d, expected %d to %d",
+                         static_cast<int>(end),
+                         static_cast<int>(next_operator_),
+                         static_cast<int>(operators_size()));
+    return kTfLiteError;
+  }
+
+  for (size_t i = next_operator_; i < end; ++i) {
     auto* node = &(node_and_registrations_[i].node);
     auto* registration = node_and_registrations_[i].registration;
 
@@ -347,7 +471,10 @@ TfLiteStatus MicroInterpreter::Invoke() {
       ScopedOperatorProfile scoped_profiler(
           profiler, OpNameFromRegistration(registration), i);
 #endif
+      weight_prefetcher_.BeforeInvoke(i);
+      context_helper_.ResetConstantEvalTensors();
       invoke_status = registration->invoke(&context_, node);
+      weight_prefetcher_.AfterInvoke(i);
 
       // All TfLiteTensor structs used in the kernel are allocated from temp
       // memory in the allocator. This creates a chain of allocations in the
@@ -359,13 +486,264 @@ TfLiteStatus MicroInterpreter::Invoke() {
         TF_LITE_REPORT_ERROR(
             error_reporter_,
             "Node %s (number %d) failed to invoke with status %d",
-            OpNameFromRegistration(registration), i, invoke_status);
+            OpNameFromRegistration(registration), static_cast<int>(i),
+            invoke_status);
+        weight_prefetcher_.Reset();
+        next_operator_ = 0;
         return kTfLiteError;
       } else if (invoke_status != kTfLiteOk) {
+        weight_prefetcher_.Reset();
+        next_operator_ = 0;
         return invoke_status;
       }
     }
   }
+  next_operator_ = end;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::EnableWeightPrefetch(size_t staging_bytes) {
+  if (!tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "EnableWeightPrefetch() called before tensors were "
+                         "allocated\n");
+    return kTfLiteError;
+  }
+  if (eval_tensor_slots_ != nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "EnableWeightPrefetch() is not supported with compact "
+                         "tensor metadata\n");
+    return kTfLiteError;
+  }
+  return weight_prefetcher_.Init(model_, node_and_registrations_,
+                                 subgraph_->operators()->size(), eval_tensors_,
+                                 staging_bytes, &allocator_, error_reporter_);
+}
+
+TfLiteStatus MicroInterpreter::SetWorkers(MicroWorkers* workers) {
+  if (tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "SetWorkers() called after tensors were allocated\n");
+    return kTfLiteError;
+  }
+  context_helper_.backend_context()->set_workers(workers);
+  context_.recommended_num_threads =
+      workers != nullptr ? workers->num_workers() : 1;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetWeightPackingBudget(size_t bytes) {
+  if (tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(
+        error_reporter_,
+        "SetWeightPackingBudget() called after tensors were allocated\n");
+    return kTfLiteError;
+  }
+  context_helper_.backend_context()->set_packing_budget(bytes);
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetOperatorFusion(bool enabled) {
+  if (tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(
+        error_reporter_,
+        "SetOperatorFusion() called after tensors were allocated\n");
+    return kTfLiteError;
+  }
+  fuse_operators_ = enabled;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetCompactTensorMetadata(bool enabled) {
+  if (tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(
+        error_reporter_,
+        "SetCompactTensorMetadata() called after tensors were allocated\n");
+    return kTfLiteError;
+  }
+  compact_tensor_metadata_ = enabled;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::AllocateConstantEvalTensors() {
+  // Kernels only look up the tensors of their own node, and the fused
+  // operators are in place by now.
+  size_t size = 1;
+  for (size_t i = 0; i < operators_size(); ++i) {
+    const TfLiteIntArray* inputs = node_and_registrations_[i].node.inputs;
+    size_t constant_inputs = 0;
+    for (int n = 0; n < inputs->size; ++n) {
+      if (inputs->data[n] >= 0 &&
+          eval_tensor_slots_[inputs->data[n]] == kConstantTensorSlot) {
+        ++constant_inputs;
+      }
+    }
+    if (constant_inputs > size) {
+      size = constant_inputs;
+    }
+  }
+  constant_tensors_ =
+      reinterpret_cast<TfLiteEvalTensor*>(allocator_.AllocatePersistentBuffer(
+          (sizeof(TfLiteEvalTensor) + sizeof(uint16_t)) * size));
+  if (constant_tensors_ == nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Failed to allocate %d constant tensor structs", size);
+    return kTfLiteError;
+  }
+  constant_tensors_size_ = size;
+  context_helper_.SetConstantEvalTensors(constant_tensors_, size);
+  return kTfLiteOk;
+}
+
+uint32_t MicroInterpreter::HashArenaSnapshotSettings(uint32_t hash) const {
+  const MicroBackendContext* backend_context =
+      context_helper_.backend_context();
+  const uintptr_t settings[] = {
+      reinterpret_cast<uintptr_t>(backend_context->workers()),
+      static_cast<uintptr_t>(context_.recommended_num_threads),
+      backend_context->packing_budget(),
+      fuse_operators_,
+      compact_tensor_metadata_,
+  };
+  return ArenaSnapshotHash(settings, sizeof(settings), hash);
+}
+
+TfLiteStatus MicroInterpreter::GetArenaSnapshot(uint32_t model_hash,
+                                                ArenaSnapshot* snapshot) {
+  if (!tensors_allocated_ || invoked_since_allocation_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "GetArenaSnapshot() must be called after "
+                         "AllocateTensors() and before Invoke()\n");
+    return kTfLiteError;
+  }
+  uint32_t code_hash = kArenaSnapshotHashSeed;
+  for (size_t i = 0; i < operators_size(); ++i) {
+    code_hash = HashKernelFunctions(node_and_registrations_[i].registration,
+                                    code_hash);
+  }
+
+  ArenaSnapshotHeader& header = snapshot->header;
+  header = {};
+  header.magic = kArenaSnapshotMagic;
+  header.version = kArenaSnapshotVersion;
+  header.model_hash = model_hash;
+  header.code_hash = HashArenaSnapshotSettings(code_hash);
+  header.model_address = reinterpret_cast<uintptr_t>(model_);
+  header.op_resolver_address = reinterpret_cast<uintptr_t>(&op_resolver_);
+  header.arena_address = reinterpret_cast<uintptr_t>(allocator_.arena_buffer());
+  header.arena_bytes = allocator_.arena_buffer_size();
+  header.tail_bytes_before = tail_bytes_before_allocation_;
+  header.tail_bytes_after = tail_bytes_after_allocation_;
+  header.head_bytes = allocator_.head_bytes();
+  header.node_and_registrations =
+      reinterpret_cast<uintptr_t>(node_and_registrations_);
+  header.eval_tensors = reinterpret_cast<uintptr_t>(eval_tensors_);
+  header.eval_tensor_slots = reinterpret_cast<uintptr_t>(eval_tensor_slots_);
+  header.constant_tensors = reinterpret_cast<uintptr_t>(constant_tensors_);
+  header.constant_tensors_size = constant_tensors_size_;
+  header.scratch_buffer_handles =
+      reinterpret_cast<uintptr_t>(scratch_buffer_handles_);
+  header.fused_operators_size = fused_operators_size_;
+  header.packed_weight_bytes = packed_weight_bytes();
+  snapshot->data = allocator_.arena_buffer() + header.arena_bytes -
+                   header.tail_bytes_after;
+  header.data_hash = ArenaSnapshotHash(snapshot->data, header.data_bytes());
+  header.header_hash = ArenaSnapshotHeaderHash(header);
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::RestoreArenaSnapshot(
+    uint32_t model_hash, const ArenaSnapshotHeader& header,
+    const uint8_t* data) {
+  if (initialization_status_ != kTfLiteOk || tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "RestoreArenaSnapshot() called after tensors were "
+                         "allocated\n");
+    return kTfLiteError;
+  }
+  // Everything is checked before the arena is touched, so that a snapshot
+  // that doesn't match leaves the interpreter ready for AllocateTensors().
+  if (header.magic != kArenaSnapshotMagic ||
+      header.version != kArenaSnapshotVersion ||
+      header.header_hash != ArenaSnapshotHeaderHash(header) ||
+      header.tail_bytes_after < header.tail_bytes_before ||
+      header.data_hash != ArenaSnapshotHash(data, header.data_bytes())) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Arena snapshot is corrupt\n");
+    return kTfLiteError;
+  }
+  // The restored data lands where it was saved from, so all the pointers in
+  // it stay valid.
+  const uintptr_t data_address =
+      header.arena_address + header.arena_bytes - header.tail_bytes_after;
+  const size_t nodes_bytes = sizeof(NodeAndRegistration) * operators_size();
+  if (header.model_hash != model_hash ||
+      header.model_address != reinterpret_cast<uintptr_t>(model_) ||
+      header.op_resolver_address !=
+          reinterpret_cast<uintptr_t>(&op_resolver_) ||
+      header.arena_address !=
+          reinterpret_cast<uintptr_t>(allocator_.arena_buffer()) ||
+      header.arena_bytes != allocator_.arena_buffer_size() ||
+      header.tail_bytes_before != allocator_.tail_used_bytes() ||
+      header.node_and_registrations < data_address ||
+      header.node_and_registrations - data_address + nodes_bytes >
+          header.data_bytes()) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Arena snapshot is for a different model or "
+                         "arena\n");
+    return kTfLiteError;
+  }
+  // The registrations live in the op resolver, or in the firmware for fused
+  // nodes, so the kernel functions of the running firmware are compared.
+  const uint8_t* saved_nodes =
+      data + (header.node_and_registrations - data_address);
+  uint32_t code_hash = kArenaSnapshotHashSeed;
+  for (size_t i = 0; i < operators_size(); ++i) {
+    const TfLiteRegistration* registration;
+    std::memcpy(&registration,
+                saved_nodes + i * sizeof(NodeAndRegistration) +
+                    offsetof(NodeAndRegistration, registration),
+                sizeof(registration));
+    code_hash = HashKernelFunctions(registration, code_hash);
+  }
+  if (HashArenaSnapshotSettings(code_hash) != header.code_hash) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Arena snapshot is for different kernels or "
+                         "settings\n");
+    return kTfLiteError;
+  }
+
+  TF_LITE_ENSURE_STATUS(allocator_.RestorePersistentAllocations(
+      data, header.data_bytes(), header.head_bytes));
+  node_and_registrations_ =
+      reinterpret_cast<NodeAndRegistration*>(header.node_and_registrations);
+  eval_tensors_ = reinterpret_cast<TfLiteEvalTensor*>(header.eval_tensors);
+  eval_tensor_slots_ = reinterpret_cast<uint16_t*>(header.eval_tensor_slots);
+  constant_tensors_ =
+      reinterpret_cast<TfLiteEvalTensor*>(header.constant_tensors);
+  constant_tensors_size_ = header.constant_tensors_size;
+  scratch_buffer_handles_ =
+      reinterpret_cast<ScratchBufferHandle*>(header.scratch_buffer_handles);
+  fused_operators_size_ = header.fused_operators_size;
+  context_helper_.backend_context()->set_packed_bytes(
+      header.packed_weight_bytes);
+  context_helper_.SetTfLiteEvalTensors(eval_tensors_, eval_tensor_slots_);
+  if (eval_tensor_slots_ != nullptr) {
+    context_helper_.SetConstantEvalTensors(constant_tensors_,
+                                           constant_tensors_size_);
+  }
+  context_helper_.SetScratchBufferHandles(scratch_buffer_handles_);
+  context_.tensors_size = subgraph_->tensors()->size();
+
+  // Same state as at the end of AllocateTensors().
+  context_.AllocatePersistentBuffer = nullptr;
+  context_.RequestScratchBufferInArena = nullptr;
+  context_.GetScratchBuffer = context_helper_.GetScratchBuffer;
+  TF_LITE_ENSURE_STATUS(ResetVariableTensors());
+
+  tail_bytes_before_allocation_ = header.tail_bytes_before;
+  tail_bytes_after_allocation_ = header.tail_bytes_after;
+  invoked_since_allocation_ = false;
+  tensors_allocated_ = true;
   return kTfLiteOk;
 }
 
@@ -383,12 +761,12 @@ TfLiteTensor* MicroInterpreter::input(size_t index) {
         "Input tensors not at index 0 are allocated from the "
         "persistent memory arena. Repeat calls will cause excess "
         "allocation!");
-    return allocator_.AllocatePersistentTfLiteTensor(model_, eval_tensors_,
-                                                     inputs().Get(index));
+    return allocator_.AllocatePersistentTfLiteTensor(
+        model_, eval_tensors_, eval_tensor_slots_, inputs().Get(index));
   }
   if (input_tensor_ == nullptr) {
     input_tensor_ = allocator_.AllocatePersistentTfLiteTensor(
-        model_, eval_tensors_, inputs().Get(index));
+        model_, eval_tensors_, eval_tensor_slots_, inputs().Get(index));
   }
   return input_tensor_;
 }
@@ -407,14 +785,14 @@ TfLiteTensor* MicroInterpreter::output(size_t index) {
         "Output tensors not at index 0 are allocated from the "
         "persistent memory arena. Repeat calls will cause excess "
         "allocation!");
-    return allocator_.AllocatePersistentTfLiteTensor(model_, eval_tensors_,
-                                                     outputs().Get(index));
+    return allocator_.AllocatePersistentTfLiteTensor(
+        model_, eval_tensors_, eval_tensor_slots_, outputs().Get(index));
   }
   if (output_tensor_ == nullptr) {
     // TODO(b/162311891): Drop these allocations when the interpreter supports
     // handling buffers from TfLiteEvalTensor.
     output_tensor_ = allocator_.AllocatePersistentTfLiteTensor(
-        model_, eval_tensors_, outputs().Get(index));
+        model_, eval_tensors_, eval_tensor_slots_, outputs().Get(index));
   }
   return output_tensor_;
 }
@@ -427,23 +805,25 @@ TfLiteTensor* MicroInterpreter::tensor(size_t index) {
                          length);
     return nullptr;
   }
-  return allocator_.AllocatePersistentTfLiteTensor(model_, eval_tensors_,
-                                                   index);
+  return allocator_.AllocatePersistentTfLiteTensor(
+      model_, eval_tensors_, eval_tensor_slots_, index);
 }
 
 TfLiteStatus MicroInterpreter::ResetVariableTensors() {
   for (size_t i = 0; i < subgraph_->tensors()->size(); ++i) {
     auto* tensor = subgraph_->tensors()->Get(i);
     if (tensor->is_variable()) {
+      TfLiteEvalTensor* eval_tensor = internal::GetAllocatedEvalTensor(
+          eval_tensors_, eval_tensor_slots_, i);
       size_t buffer_size;
       TF_LITE_ENSURE_STATUS(
-          TfLiteEvalTensorByteLength(&eval_tensors_[i], &buffer_size));
+          TfLiteEvalTensorByteLength(eval_tensor, &buffer_size));
 
       int value = 0;
       if (tensor->type() == tflite::TensorType_INT8) {
         value = tensor->quantization()->zero_point()->Get(0);
       }
-      memset(eval_tensors_[i].data.raw, value, buffer_size);
+      memset(eval_tensor->data.raw, value, buffer_size);
     }
   }
 
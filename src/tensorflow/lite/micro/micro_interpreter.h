@@ -23,8 +23,12 @@ limitations under the License.
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/core/api/profiler.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/micro/arena_snapshot.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_backend_context.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/micro_workers.h"
+#include "tensorflow/lite/micro/weight_prefetcher.h"
 #include "tensorflow/lite/portable_type_to_tflitetype.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
@@ -53,19 +57,50 @@ class ContextHelper {
                                  int tensor_idx);
   static TfLiteEvalTensor* GetEvalTensor(const struct TfLiteContext* context,
                                          int tensor_idx);
+  static TfLiteExternalContext* GetExternalContext(
+      struct TfLiteContext* context, TfLiteExternalContextType type);
 
-  // Sets the pointer to a list of TfLiteEvalTensor instances.
-  void SetTfLiteEvalTensors(TfLiteEvalTensor* eval_tensors);
+  // Sets the pointer to a list of TfLiteEvalTensor instances and, for models
+  // allocated with compact tensor metadata, to their slot table.
+  void SetTfLiteEvalTensors(TfLiteEvalTensor* eval_tensors,
+                            const uint16_t* eval_tensor_slots);
+
+  // Sets the `size` structs that GetEvalTensor() rebuilds the constant tensors
+  // of compact models into, followed by `size` tensor indices that tag them.
+  void SetConstantEvalTensors(TfLiteEvalTensor* constant_tensors, size_t size);
+
+  // Forgets the constant tensors rebuilt so far. Called before each operator
+  // is prepared or invoked.
+  void ResetConstantEvalTensors() { constant_tensors_used_ = 0; }
 
   // Sets the pointer to a list of ScratchBufferHandle instances.
   void SetScratchBufferHandles(ScratchBufferHandle* scratch_buffer_handles);
 
+  // The context returned as the kTfLiteCpuBackendContext.
+  MicroBackendContext* backend_context() { return &backend_context_; }
+  const MicroBackendContext* backend_context() const {
+    return &backend_context_;
+  }
+
  private:
   MicroAllocator* allocator_ = nullptr;
+  // Returns a struct describing constant tensor `tensor_idx`, reusing the
+  // one built earlier for the same operator if there is one.
+  TfLiteEvalTensor* GetConstantEvalTensor(int tensor_idx);
+
   ErrorReporter* error_reporter_ = nullptr;
   const Model* model_ = nullptr;
   TfLiteEvalTensor* eval_tensors_ = nullptr;
+  const uint16_t* eval_tensor_slots_ = nullptr;
+  // Constant tensors rebuilt for the current operator. No operator has more
+  // constant inputs than there are structs, so none of its pointers are
+  // reused before it returns.
+  TfLiteEvalTensor* constant_tensors_ = nullptr;
+  uint16_t* constant_tensor_indices_ = nullptr;
+  size_t constant_tensors_size_ = 0;
+  size_t constant_tensors_used_ = 0;
   ScratchBufferHandle* scratch_buffer_handles_ = nullptr;
+  MicroBackendContext backend_context_;
 };
 
 }  // namespace internal
@@ -89,6 +124,11 @@ class MicroInterpreter {
   // have allocation handled in more than one interpreter or for recording
   // allocations inside the interpreter. The lifetime of the allocator must be
   // as long as that of the interpreter object.
+  //
+  // Interpreters sharing one allocator share the non-persistent section of the
+  // arena, so their input and output tensors are only valid until another of
+  // those interpreters is invoked. Call AllocateTensors() on each of them
+  // before invoking any, and fill the inputs right before each Invoke().
   MicroInterpreter(const Model* model, const MicroOpResolver& op_resolver,
                    MicroAllocator* allocator, ErrorReporter* error_reporter,
                    tflite::Profiler* profiler = nullptr);
@@ -104,6 +144,91 @@ class MicroInterpreter {
   // TODO(b/149795762): Add this to the TfLiteStatus enum.
   TfLiteStatus Invoke();
 
+  // Starts a new invocation but only runs operators [0, end), so that the
+  // application can look at intermediate tensors - e.g. the output of an
+  // early-exit head - and decide whether the rest of the model is worth
+  // running. Abandoning the invocation needs no call; the next Invoke() or
+  // InvokeUntil() starts over. A tensor stays valid from the operator that
+  // writes it until the last operator that reads it, after which the memory
+  // planner may reuse its memory. Invoking another interpreter that shares
+  // the arena clobbers all of them.
+  TfLiteStatus InvokeUntil(size_t end);
+
+  // Continues the current invocation from next_operator() up to, but not
+  // including, `end` without rerunning any operator, or starts a new one if
+  // no operator has run yet. The result of running a model in several steps
+  // is identical to a single Invoke().
+  TfLiteStatus ContinueInvoke(size_t end);
+  TfLiteStatus ContinueInvoke() { return ContinueInvoke(operators_size()); }
+
+  // Index of the first operator that has not run in the current invocation.
+  size_t next_operator() const { return next_operator_; }
+
+  // Stages constant weights into SRAM ahead of the nodes that read them, using
+  // two slots of `staging_bytes` each from the persistent section of the
+  // arena. Intended for models executed in place from flash; see
+  // WeightPrefetcher. Must be called after AllocateTensors().
+  TfLiteStatus EnableWeightPrefetch(size_t staging_bytes);
+
+  // Lets kernels that support it split each operation across `workers`
+  // (e.g. both RP2040 cores). Kernels size their scratch buffers for every
+  // worker during preparation, so this must be called before
+  // AllocateTensors(). The workers must outlive the interpreter.
+  TfLiteStatus SetWorkers(MicroWorkers* workers);
+
+  // Allows kernels to spend up to `bytes` of the persistent section of the
+  // arena on weights packed during preparation, such as per-channel kernel
+  // sums folded into the bias. Layers are packed in execution order until the
+  // budget runs out; results are bit-exact either way. Must be called before
+  // AllocateTensors().
+  TfLiteStatus SetWeightPackingBudget(size_t bytes);
+
+  // Fuses each int8 depthwise convolution with the 1x1 convolution that
+  // consumes its output when tensors are allocated (see
+  // FuseDepthwisePointwiseConvs()). The fused kernel never materializes the
+  // depthwise output, which saves its memory traffic and arena space; results
+  // are bit-exact either way. The depthwise outputs of fused pairs have no
+  // data. Must be called before AllocateTensors().
+  TfLiteStatus SetOperatorFusion(bool enabled);
+
+  // Returns how many depthwise + pointwise pairs were fused.
+  size_t fused_operators_size() const { return fused_operators_size_; }
+
+  // Gives only the non-constant tensors a TfLiteEvalTensor of their own when
+  // tensors are allocated (see MicroAllocator::StartModelAllocation()). The
+  // struct of a constant tensor is rebuilt from the flatbuffer, whose dims and
+  // data it points to, when a kernel asks for it; a small ring sized for the
+  // operator with the most constant inputs holds the results. This saves
+  // sizeof(TfLiteEvalTensor) per constant tensor of the persistent section
+  // for a little work per lookup. Only supported on little-endian targets and
+  // not together with EnableWeightPrefetch(). Must be called before
+  // AllocateTensors().
+  TfLiteStatus SetCompactTensorMetadata(bool enabled);
+
+  // Describes the persistent state prepared by AllocateTensors() as an arena
+  // snapshot (see arena_snapshot.h) for the application to save, e.g. to
+  // flash. `model_hash` should identify the contents of the model, such as
+  // ArenaSnapshotHash() of the flatbuffer. Kernels may update their state
+  // while running, so this must be called after AllocateTensors() and before
+  // the first Invoke().
+  TfLiteStatus GetArenaSnapshot(uint32_t model_hash, ArenaSnapshot* snapshot);
+
+  // Restores a snapshot from GetArenaSnapshot() in place of AllocateTensors(),
+  // which skips parsing the model, preparing the kernels and planning memory.
+  // Settings such as SetWorkers() must be applied first, as for
+  // AllocateTensors(). If the snapshot is corrupt or doesn't match this
+  // interpreter - a different model, op resolver, arena, setting or firmware -
+  // this fails without touching the arena, and AllocateTensors() can be
+  // called as usual. `data` needs no particular alignment.
+  TfLiteStatus RestoreArenaSnapshot(uint32_t model_hash,
+                                    const ArenaSnapshotHeader& header,
+                                    const uint8_t* data);
+
+  // Returns how much of the weight packing budget the kernels used.
+  size_t packed_weight_bytes() const {
+    return context_helper_.backend_context()->packed_bytes();
+  }
+
   size_t tensors_size() const { return context_.tensors_size; }
   TfLiteTensor* tensor(size_t tensor_index);
   template <class T>
@@ -182,6 +307,17 @@ class MicroInterpreter {
   template <class T>
   void CorrectTensorDataEndianness(T* data, int32_t size);
 
+  // Runs operators [next_operator_, end).
+  TfLiteStatus InvokeOperators(size_t end);
+
+  // Allocates the ring that GetEvalTensor() rebuilds the constant tensors of
+  // a model with compact tensor metadata into.
+  TfLiteStatus AllocateConstantEvalTensors();
+
+  // Adds the interpreter settings that change how kernels are prepared to
+  // the code hash of an arena snapshot.
+  uint32_t HashArenaSnapshotSettings(uint32_t hash) const;
+
   NodeAndRegistration* node_and_registrations_ = nullptr;
 
   const Model* model_;
@@ -190,13 +326,28 @@ class MicroInterpreter {
   TfLiteContext context_ = {};
   MicroAllocator& allocator_;
   bool tensors_allocated_;
+  bool fuse_operators_ = false;
+  size_t fused_operators_size_ = 0;
+  bool compact_tensor_metadata_ = false;
+  size_t next_operator_ = 0;
+
+  // Bytes allocated from the tail of the arena before and after
+  // AllocateTensors(), which bound the persistent state of this model.
+  size_t tail_bytes_before_allocation_ = 0;
+  size_t tail_bytes_after_allocation_ = 0;
+  bool invoked_since_allocation_ = false;
 
   TfLiteStatus initialization_status_;
 
   const SubGraph* subgraph_ = nullptr;
   TfLiteEvalTensor* eval_tensors_ = nullptr;
+  uint16_t* eval_tensor_slots_ = nullptr;
+  TfLiteEvalTensor* constant_tensors_ = nullptr;
+  size_t constant_tensors_size_ = 0;
   ScratchBufferHandle* scratch_buffer_handles_ = nullptr;
 
+  WeightPrefetcher weight_prefetcher_;
+
   // TODO(b/16157777): Drop this reference:
   internal::ContextHelper context_helper_;
 
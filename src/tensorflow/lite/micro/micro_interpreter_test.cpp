@@ -0,0 +1,726 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/arena_snapshot.h"
+#include "tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h"
+#include "tensorflow/lite/micro/kernels/depthwise_pointwise_conv.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/recording_micro_allocator.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr size_t kPersonArenaSize = 96 * 1024;
+constexpr size_t kKeywordArenaSize = 24 * 1024;
+constexpr size_t kSharedArenaSize = kPersonArenaSize + kKeywordArenaSize;
+alignas(16) uint8_t g_shared_arena[kSharedArenaSize];
+
+constexpr int kPersonOutputSize = 2;
+constexpr int kKeywordOutputSize = 4;
+
+// Stands in for the flash an arena snapshot is saved to.
+constexpr size_t kSnapshotDataSize = 32 * 1024;
+uint8_t g_snapshot_data[kSnapshotDataSize];
+
+void FillInput(TfLiteTensor* input, int seed) {
+  for (size_t i = 0; i < input->bytes; ++i) {
+    input->data.int8[i] = static_cast<int8_t>((i * 7 + seed) & 0xff);
+  }
+}
+
+// Runs `model` standalone in its own arena and stores the first `count`
+// outputs in `golden`. Returns the number of arena bytes that were used.
+size_t RunStandalone(const unsigned char* model_data, size_t arena_size,
+                     int count, int8_t* golden) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(tflite::GetModel(model_data), resolver,
+                                       g_shared_arena, arena_size, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  FillInput(interpreter.input(0), 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  TfLiteTensor* output = interpreter.output(0);
+  for (int i = 0; i < count; ++i) {
+    golden[i] = output->data.int8[i];
+  }
+  return interpreter.arena_used_bytes();
+}
+
+// Runs `model` with the given weight packing budget and expects the outputs
+// to match `golden`. Returns the number of bytes that were packed.
+size_t RunWithPackingBudget(const unsigned char* model_data, size_t arena_size,
+                            size_t budget, int count, const int8_t* golden) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(tflite::GetModel(model_data), resolver,
+                                       g_shared_arena, arena_size, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.SetWeightPackingBudget(budget));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          interpreter.SetWeightPackingBudget(budget));
+  TF_LITE_MICRO_EXPECT_LE(interpreter.packed_weight_bytes(), budget);
+  FillInput(interpreter.input(0), 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  for (int i = 0; i < count; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(golden[i], interpreter.output(0)->data.int8[i]);
+  }
+  return interpreter.packed_weight_bytes();
+}
+
+// Runs `model` with or without compact tensor metadata and expects the
+// outputs to match `golden`. Returns the arena bytes recorded for
+// TfLiteEvalTensor structs.
+size_t RunWithTensorMetadata(const unsigned char* model_data,
+                             size_t arena_size, bool compact,
+                             bool fuse_operators, int count,
+                             const int8_t* golden) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::RecordingMicroAllocator* allocator =
+      tflite::RecordingMicroAllocator::Create(g_shared_arena, arena_size,
+                                              &reporter);
+  tflite::MicroInterpreter interpreter(tflite::GetModel(model_data), resolver,
+                                       allocator, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.SetCompactTensorMetadata(compact));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.SetOperatorFusion(fuse_operators));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          interpreter.SetCompactTensorMetadata(compact));
+  // Prefetching swaps weight pointers in the structs constants no longer
+  // have.
+  TF_LITE_MICRO_EXPECT_EQ(compact ? kTfLiteError : kTfLiteOk,
+                          interpreter.EnableWeightPrefetch(4 * 1024));
+  // Repeated runs carry state in variable tensors and reuse the rebuilt
+  // constant tensors.
+  for (int run = 0; run < 2; ++run) {
+    FillInput(interpreter.input(0), 3);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    for (int i = 0; run == 0 && i < count; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(golden[i], interpreter.output(0)->data.int8[i]);
+    }
+  }
+  return allocator
+      ->GetRecordedAllocation(
+          tflite::RecordedAllocationType::kTfLiteEvalTensorData)
+      .used_bytes;
+}
+
+// Allocates `model_data` in a fresh interpreter, saves an arena snapshot and
+// runs the model twice, so that any variable tensors carry state into the
+// second run. Then wipes the arena, as a reboot would, and expects an
+// interpreter restored from the snapshot to produce the same outputs.
+void ExpectArenaSnapshotRoundTrip(const unsigned char* model_data,
+                                  size_t model_size, size_t arena_size,
+                                  bool compact, int count) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  const tflite::Model* model = tflite::GetModel(model_data);
+  const uint32_t model_hash = tflite::ArenaSnapshotHash(model_data, model_size);
+  // The data may be stored anywhere, so it needn't be aligned.
+  uint8_t* data = g_snapshot_data + 1;
+  tflite::ArenaSnapshotHeader header;
+  int8_t golden[2][kKeywordOutputSize];
+  size_t used_bytes;
+  {
+    tflite::MicroInterpreter interpreter(model, resolver, g_shared_arena,
+                                         arena_size, &reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                            interpreter.SetCompactTensorMetadata(compact));
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    used_bytes = interpreter.arena_used_bytes();
+    tflite::ArenaSnapshot snapshot;
+    TF_LITE_MICRO_EXPECT_EQ(
+        kTfLiteOk, interpreter.GetArenaSnapshot(model_hash, &snapshot));
+    TF_LITE_MICRO_EXPECT_LT(snapshot.header.data_bytes(), kSnapshotDataSize);
+    header = snapshot.header;
+    std::memcpy(data, snapshot.data, header.data_bytes());
+    for (int run = 0; run < 2; ++run) {
+      FillInput(interpreter.input(0), run);
+      TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+      for (int i = 0; i < count; ++i) {
+        golden[run][i] = interpreter.output(0)->data.int8[i];
+      }
+    }
+    TF_LITE_MICRO_EXPECT_EQ(
+        kTfLiteError, interpreter.GetArenaSnapshot(model_hash, &snapshot));
+  }
+
+  std::memset(g_shared_arena, 0x5a, arena_size);
+  tflite::MicroInterpreter interpreter(model, resolver, g_shared_arena,
+                                       arena_size, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.SetCompactTensorMetadata(compact));
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteOk, interpreter.RestoreArenaSnapshot(model_hash, header, data));
+  TF_LITE_MICRO_EXPECT_EQ(used_bytes, interpreter.arena_used_bytes());
+  for (int run = 0; run < 2; ++run) {
+    FillInput(interpreter.input(0), run);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    for (int i = 0; i < count; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(golden[run][i],
+                              interpreter.output(0)->data.int8[i]);
+    }
+  }
+}
+
+// Expects restoring `header` and `data` into a new interpreter to fail and
+// to leave it ready for AllocateTensors(), which then uses `used_bytes`.
+void ExpectArenaSnapshotRejected(const tflite::Model* model,
+                                 const tflite::MicroOpResolver& resolver,
+                                 size_t arena_size, bool fuse_operators,
+                                 uint32_t model_hash,
+                                 const tflite::ArenaSnapshotHeader& header,
+                                 const uint8_t* data, size_t used_bytes) {
+  tflite::MicroErrorReporter reporter;
+  tflite::MicroInterpreter interpreter(model, resolver, g_shared_arena,
+                                       arena_size, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.SetOperatorFusion(fuse_operators));
+  TF_LITE_MICRO_EXPECT_EQ(
+      kTfLiteError, interpreter.RestoreArenaSnapshot(model_hash, header, data));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(used_bytes, interpreter.arena_used_bytes());
+}
+
+// Returns the index of the first node with the given builtin operator, or
+// the number of operators if there is none.
+size_t FindOperator(const tflite::MicroInterpreter& interpreter,
+                    tflite::BuiltinOperator op) {
+  for (size_t i = 0; i < interpreter.operators_size(); ++i) {
+    if (interpreter.node_and_registration(i).registration->builtin_code ==
+        op) {
+      return i;
+    }
+  }
+  return interpreter.operators_size();
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestSharedArenaWithBundledModels) {
+  int8_t person_golden[kPersonOutputSize];
+  int8_t keyword_golden[kKeywordOutputSize];
+  const size_t person_used = RunStandalone(
+      g_person_detect_model_data, kPersonArenaSize, kPersonOutputSize,
+      person_golden);
+  const size_t keyword_used =
+      RunStandalone(g_keyword_scrambled_model_data, kKeywordArenaSize,
+                    kKeywordOutputSize, keyword_golden);
+
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(
+      g_shared_arena, kSharedArenaSize, &reporter);
+  tflite::MicroInterpreter person(tflite::GetModel(g_person_detect_model_data),
+                                  resolver, allocator, &reporter);
+  tflite::MicroInterpreter keyword(
+      tflite::GetModel(g_keyword_scrambled_model_data), resolver, allocator,
+      &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, person.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, keyword.AllocateTensors());
+
+  // The non-persistent section is shared, so the combined arena must be
+  // noticeably smaller than running both models in separate arenas.
+  const size_t shared_used = allocator->used_bytes();
+  TF_LITE_MICRO_EXPECT_LT(shared_used, person_used + keyword_used);
+
+  // Interleave invocations; every run must match its standalone result.
+  for (int iteration = 0; iteration < 2; ++iteration) {
+    FillInput(person.input(0), 3);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, person.Invoke());
+    for (int i = 0; i < kPersonOutputSize; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(person_golden[i],
+                              person.output(0)->data.int8[i]);
+    }
+
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, keyword.ResetVariableTensors());
+    FillInput(keyword.input(0), 3);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, keyword.Invoke());
+    for (int i = 0; i < kKeywordOutputSize; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(keyword_golden[i],
+                              keyword.output(0)->data.int8[i]);
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(TestSharedArenaTooSmallForSecondModel) {
+  int8_t person_golden[kPersonOutputSize];
+  const size_t person_used = RunStandalone(
+      g_person_detect_model_data, kPersonArenaSize, kPersonOutputSize,
+      person_golden);
+
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(
+      g_shared_arena, person_used + 2 * 1024, &reporter);
+  tflite::MicroInterpreter person(tflite::GetModel(g_person_detect_model_data),
+                                  resolver, allocator, &reporter);
+  tflite::MicroInterpreter keyword(
+      tflite::GetModel(g_keyword_scrambled_model_data), resolver, allocator,
+      &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, person.AllocateTensors());
+  TfLiteTensor* input = person.input(0);
+  TfLiteTensor* output = person.output(0);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, keyword.AllocateTensors());
+
+  // The failed allocation must not have touched the first model's buffers.
+  FillInput(input, 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, person.Invoke());
+  for (int i = 0; i < kPersonOutputSize; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(person_golden[i], output->data.int8[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestWeightPrefetchMatchesInPlaceWeights) {
+  int8_t person_golden[kPersonOutputSize];
+  RunStandalone(g_person_detect_model_data, kPersonArenaSize,
+                kPersonOutputSize, person_golden);
+
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_shared_arena,
+      kPersonArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          interpreter.EnableWeightPrefetch(4 * 1024));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.EnableWeightPrefetch(4 * 1024));
+
+  // Weights must be back in place between invocations, and every run must
+  // produce exactly the in-place result.
+  for (int iteration = 0; iteration < 2; ++iteration) {
+    FillInput(interpreter.input(0), 3);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+    for (int i = 0; i < kPersonOutputSize; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(person_golden[i],
+                              interpreter.output(0)->data.int8[i]);
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(TestWeightPackingMatchesUnpackedKernels) {
+  int8_t person_golden[kPersonOutputSize];
+  int8_t keyword_golden[kKeywordOutputSize];
+  RunStandalone(g_person_detect_model_data, kPersonArenaSize,
+                kPersonOutputSize, person_golden);
+  RunStandalone(g_keyword_scrambled_model_data, kKeywordArenaSize,
+                kKeywordOutputSize, keyword_golden);
+
+  // The person model packs its convolutions, the keyword model its fully
+  // connected layers. A budget too small for all of them packs only the
+  // earliest layers.
+  const size_t person_packed =
+      RunWithPackingBudget(g_person_detect_model_data, kSharedArenaSize,
+                           64 * 1024, kPersonOutputSize, person_golden);
+  TF_LITE_MICRO_EXPECT_LT(0, person_packed);
+  const size_t person_partial =
+      RunWithPackingBudget(g_person_detect_model_data, kSharedArenaSize,
+                           person_packed / 2, kPersonOutputSize,
+                           person_golden);
+  TF_LITE_MICRO_EXPECT_LT(0, person_partial);
+  TF_LITE_MICRO_EXPECT_LT(person_partial, person_packed);
+  TF_LITE_MICRO_EXPECT_EQ(
+      static_cast<size_t>(0),
+      RunWithPackingBudget(g_person_detect_model_data, kSharedArenaSize, 0,
+                           kPersonOutputSize, person_golden));
+
+  TF_LITE_MICRO_EXPECT_LT(
+      0, RunWithPackingBudget(g_keyword_scrambled_model_data,
+                              kSharedArenaSize, 64 * 1024,
+                              kKeywordOutputSize, keyword_golden));
+}
+
+TF_LITE_MICRO_TEST(TestResumedInvocationMatchesFullInvoke) {
+  int8_t person_golden[kPersonOutputSize];
+  RunStandalone(g_person_detect_model_data, kPersonArenaSize,
+                kPersonOutputSize, person_golden);
+
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_shared_arena,
+      kPersonArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  const size_t operators = interpreter.operators_size();
+
+  // Stop after every possible operator, then run the rest.
+  for (size_t split = 0; split <= operators; ++split) {
+    FillInput(interpreter.input(0), 3);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(split));
+    TF_LITE_MICRO_EXPECT_EQ(split, interpreter.next_operator());
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.ContinueInvoke());
+    TF_LITE_MICRO_EXPECT_EQ(operators, interpreter.next_operator());
+    for (int i = 0; i < kPersonOutputSize; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(person_golden[i],
+                              interpreter.output(0)->data.int8[i]);
+    }
+  }
+
+  // One operator at a time.
+  FillInput(interpreter.input(0), 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(1));
+  for (size_t end = 2; end <= operators; ++end) {
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.ContinueInvoke(end));
+  }
+  for (int i = 0; i < kPersonOutputSize; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(person_golden[i],
+                            interpreter.output(0)->data.int8[i]);
+  }
+
+  // Operators cannot be rerun or skipped past the end of the model.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(operators / 2));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          interpreter.ContinueInvoke(operators / 2 - 1));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError,
+                          interpreter.ContinueInvoke(operators + 1));
+  TF_LITE_MICRO_EXPECT_EQ(operators / 2, interpreter.next_operator());
+}
+
+TF_LITE_MICRO_TEST(TestAbandonedInvocationDoesNotAffectNextInvoke) {
+  int8_t person_golden[kPersonOutputSize];
+  RunStandalone(g_person_detect_model_data, kPersonArenaSize,
+                kPersonOutputSize, person_golden);
+
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_shared_arena,
+      kPersonArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.EnableWeightPrefetch(4 * 1024));
+
+  // Reject a frame halfway, with weight copies possibly in flight, and make
+  // sure the next frame is unaffected.
+  const size_t split = interpreter.operators_size() / 2;
+  FillInput(interpreter.input(0), 5);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(split));
+  const int split_output =
+      interpreter.node_and_registration(split - 1).node.outputs->data[0];
+  TfLiteTensor* intermediate = interpreter.tensor(split_output);
+  TF_LITE_MICRO_EXPECT(intermediate != nullptr);
+  TF_LITE_MICRO_EXPECT_LT(0, intermediate->bytes);
+
+  FillInput(interpreter.input(0), 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  for (int i = 0; i < kPersonOutputSize; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(person_golden[i],
+                            interpreter.output(0)->data.int8[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestOperatorFusionMatchesUnfusedKernels) {
+  // Compares the features going into the average pool, which every fused
+  // pair feeds, as well as the model output.
+  constexpr size_t kMaxFeatureBytes = 4 * 1024;
+  static int8_t features_golden[kMaxFeatureBytes];
+  int8_t person_golden[kPersonOutputSize];
+  size_t feature_bytes;
+  size_t unfused_used;
+  {
+    tflite::MicroErrorReporter reporter;
+    tflite::AllOpsResolver resolver;
+    tflite::MicroInterpreter interpreter(
+        tflite::GetModel(g_person_detect_model_data), resolver,
+        g_shared_arena, kPersonArenaSize, &reporter);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(0),
+                            interpreter.fused_operators_size());
+    unfused_used = interpreter.arena_used_bytes();
+
+    const size_t pool =
+        FindOperator(interpreter, tflite::BuiltinOperator_AVERAGE_POOL_2D);
+    TF_LITE_MICRO_EXPECT_LT(pool, interpreter.operators_size());
+    FillInput(interpreter.input(0), 3);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(pool));
+    const TfLiteTensor* features = interpreter.tensor(
+        interpreter.node_and_registration(pool).node.inputs->data[0]);
+    feature_bytes = features->bytes;
+    TF_LITE_MICRO_EXPECT_LE(feature_bytes, kMaxFeatureBytes);
+    memcpy(features_golden, features->data.int8, feature_bytes);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.ContinueInvoke());
+    for (int i = 0; i < kPersonOutputSize; ++i) {
+      person_golden[i] = interpreter.output(0)->data.int8[i];
+    }
+  }
+
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_shared_arena,
+      kPersonArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.SetOperatorFusion(true));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.SetOperatorFusion(false));
+  TF_LITE_MICRO_EXPECT_LT(0, interpreter.fused_operators_size());
+
+  // Fused pairs add their params and input lists, but no activation memory.
+  constexpr size_t kFusionOverheadPerPair = 64;
+  TF_LITE_MICRO_EXPECT_LE(
+      interpreter.arena_used_bytes(),
+      unfused_used +
+          interpreter.fused_operators_size() * kFusionOverheadPerPair);
+
+  // The depthwise outputs of fused pairs are left out of the memory plan.
+  size_t elided = 0;
+  for (size_t i = 0; i < interpreter.operators_size(); ++i) {
+    const tflite::NodeAndRegistration fused =
+        interpreter.node_and_registration(i);
+    if (fused.registration == tflite::Register_DEPTHWISE_POINTWISE_CONV_2D()) {
+      const auto* params =
+          static_cast<const tflite::DepthwisePointwiseConvParams*>(
+              fused.node.builtin_data);
+      TF_LITE_MICRO_EXPECT(
+          interpreter.tensor(params->depthwise_output)->data.data == nullptr);
+      ++elided;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_EQ(interpreter.fused_operators_size(), elided);
+
+  // Operator indices are kept, so partial invocations stop at the same place.
+  const size_t pool =
+      FindOperator(interpreter, tflite::BuiltinOperator_AVERAGE_POOL_2D);
+  FillInput(interpreter.input(0), 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(pool));
+  const TfLiteTensor* features = interpreter.tensor(
+      interpreter.node_and_registration(pool).node.inputs->data[0]);
+  TF_LITE_MICRO_EXPECT_EQ(feature_bytes, features->bytes);
+  for (size_t i = 0; i < feature_bytes; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(features_golden[i], features->data.int8[i]);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.ContinueInvoke());
+  for (int i = 0; i < kPersonOutputSize; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(person_golden[i],
+                            interpreter.output(0)->data.int8[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestReshapeSharesItsInputBuffer) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_shared_arena,
+      kPersonArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  const size_t reshape =
+      FindOperator(interpreter, tflite::BuiltinOperator_RESHAPE);
+  TF_LITE_MICRO_EXPECT_LT(reshape, interpreter.operators_size());
+  const TfLiteNode& node = interpreter.node_and_registration(reshape).node;
+  const TfLiteTensor* input = interpreter.tensor(node.inputs->data[0]);
+  const TfLiteTensor* output = interpreter.tensor(node.outputs->data[0]);
+  TF_LITE_MICRO_EXPECT(input->data.data != nullptr);
+  TF_LITE_MICRO_EXPECT(input->data.data == output->data.data);
+
+  // The shared buffer stays valid until the reshaped tensor is read.
+  FillInput(interpreter.input(0), 3);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.InvokeUntil(reshape));
+  int8_t logits[kPersonOutputSize];
+  for (int i = 0; i < kPersonOutputSize; ++i) {
+    logits[i] = input->data.int8[i];
+  }
+  // Run just the reshape: the softmax after it overwrites the buffer again.
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk,
+                          interpreter.ContinueInvoke(reshape + 1));
+  for (int i = 0; i < kPersonOutputSize; ++i) {
+    TF_LITE_MICRO_EXPECT_EQ(logits[i], output->data.int8[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestInPlaceOpsOverwriteDeadInputs) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::testing::GetSimpleModelWithInPlaceOps(), resolver,
+      g_shared_arena, kSharedArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  const float* t0 = interpreter.tensor(0)->data.f;
+  const float* t1 = interpreter.tensor(1)->data.f;
+  const float* t2 = interpreter.tensor(2)->data.f;
+  const float* t3 = interpreter.tensor(3)->data.f;
+  const float* t4 = interpreter.tensor(4)->data.f;
+  // n0 overwrites the model input, and n3 overwrites t1 as its last reader.
+  TF_LITE_MICRO_EXPECT(t1 == t0);
+  TF_LITE_MICRO_EXPECT(t3 == t0);
+  // t1 is still read by n3 when n1 runs, and t2 is a model output.
+  TF_LITE_MICRO_EXPECT(t2 != t1);
+  TF_LITE_MICRO_EXPECT(t4 != t2);
+
+  constexpr int kSize = 12;
+  float* input = interpreter.input(0)->data.f;
+  for (int i = 0; i < kSize; ++i) {
+    input[i] = 1.5f * (i - 4);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  for (int i = 0; i < kSize; ++i) {
+    const float relu = i > 4 ? 1.5f * (i - 4) : 0.0f;
+    const float relu6 = relu < 6.0f ? relu : 6.0f;
+    TF_LITE_MICRO_EXPECT_EQ(relu6, t2[i]);
+    TF_LITE_MICRO_EXPECT_EQ(relu, t3[i]);
+    TF_LITE_MICRO_EXPECT_EQ(relu6, t4[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestIdenticalOperatorParamsAreShared) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_shared_arena,
+      kPersonArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  // Operators of the same type share params exactly when they are equal.
+  int shared = 0;
+  for (size_t i = 0; i < interpreter.operators_size(); ++i) {
+    const tflite::NodeAndRegistration& a = interpreter.node_and_registration(i);
+    size_t size = 0;
+    if (a.registration->builtin_code == tflite::BuiltinOperator_CONV_2D) {
+      size = sizeof(TfLiteConvParams);
+    } else if (a.registration->builtin_code ==
+               tflite::BuiltinOperator_DEPTHWISE_CONV_2D) {
+      size = sizeof(TfLiteDepthwiseConvParams);
+    }
+    for (size_t j = i + 1; size != 0 && j < interpreter.operators_size();
+         ++j) {
+      const tflite::NodeAndRegistration& b =
+          interpreter.node_and_registration(j);
+      if (b.registration->builtin_code != a.registration->builtin_code) {
+        continue;
+      }
+      const bool equal =
+          std::memcmp(a.node.builtin_data, b.node.builtin_data, size) == 0;
+      TF_LITE_MICRO_EXPECT_EQ(equal,
+                              a.node.builtin_data == b.node.builtin_data);
+      shared += equal ? 1 : 0;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_GT(shared, 0);
+}
+
+TF_LITE_MICRO_TEST(TestCompactTensorMetadataMatchesFullMetadata) {
+  int8_t person_golden[kPersonOutputSize];
+  int8_t keyword_golden[kKeywordOutputSize];
+  RunStandalone(g_person_detect_model_data, kPersonArenaSize,
+                kPersonOutputSize, person_golden);
+  RunStandalone(g_keyword_scrambled_model_data, kKeywordArenaSize,
+                kKeywordOutputSize, keyword_golden);
+
+  const size_t person_full = RunWithTensorMetadata(
+      g_person_detect_model_data, kPersonArenaSize, false, false,
+      kPersonOutputSize, person_golden);
+  const size_t person_compact = RunWithTensorMetadata(
+      g_person_detect_model_data, kPersonArenaSize, true, false,
+      kPersonOutputSize, person_golden);
+  TF_LITE_MICRO_EXPECT_LT(person_compact, person_full);
+  // Fused operators have more constant inputs than any other.
+  TF_LITE_MICRO_EXPECT_EQ(
+      person_compact,
+      RunWithTensorMetadata(g_person_detect_model_data, kPersonArenaSize, true,
+                            true, kPersonOutputSize, person_golden));
+
+  const size_t keyword_full = RunWithTensorMetadata(
+      g_keyword_scrambled_model_data, kKeywordArenaSize, false, false,
+      kKeywordOutputSize, keyword_golden);
+  TF_LITE_MICRO_EXPECT_LT(
+      RunWithTensorMetadata(g_keyword_scrambled_model_data, kKeywordArenaSize,
+                            true, false, kKeywordOutputSize, keyword_golden),
+      keyword_full);
+}
+
+TF_LITE_MICRO_TEST(TestArenaSnapshotRestoresPreparedModels) {
+  for (int compact = 0; compact < 2; ++compact) {
+    ExpectArenaSnapshotRoundTrip(g_person_detect_model_data,
+                                 g_person_detect_model_data_len,
+                                 kPersonArenaSize, compact, kPersonOutputSize);
+    ExpectArenaSnapshotRoundTrip(g_keyword_scrambled_model_data,
+                                 g_keyword_scrambled_model_data_length,
+                                 kKeywordArenaSize, compact,
+                                 kKeywordOutputSize);
+  }
+}
+
+TF_LITE_MICRO_TEST(TestArenaSnapshotRejectsMismatches) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  const tflite::Model* model = tflite::GetModel(g_keyword_scrambled_model_data);
+  const uint32_t model_hash =
+      tflite::ArenaSnapshotHash(g_keyword_scrambled_model_data,
+                                g_keyword_scrambled_model_data_length);
+  tflite::ArenaSnapshotHeader header;
+  size_t used_bytes;
+  {
+    tflite::MicroInterpreter interpreter(model, resolver, g_shared_arena,
+                                         kKeywordArenaSize, &reporter);
+    tflite::ArenaSnapshot snapshot;
+    TF_LITE_MICRO_EXPECT_EQ(
+        kTfLiteError, interpreter.GetArenaSnapshot(model_hash, &snapshot));
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+    used_bytes = interpreter.arena_used_bytes();
+    TF_LITE_MICRO_EXPECT_EQ(
+        kTfLiteOk, interpreter.GetArenaSnapshot(model_hash, &snapshot));
+    header = snapshot.header;
+    std::memcpy(g_snapshot_data, snapshot.data, header.data_bytes());
+  }
+
+  // A different model.
+  ExpectArenaSnapshotRejected(model, resolver, kKeywordArenaSize, false,
+                              model_hash + 1, header, g_snapshot_data,
+                              used_bytes);
+  // Different settings, even though the keyword model has nothing to fuse.
+  ExpectArenaSnapshotRejected(model, resolver, kKeywordArenaSize, true,
+                              model_hash, header, g_snapshot_data, used_bytes);
+  // A different op resolver.
+  tflite::AllOpsResolver other_resolver;
+  ExpectArenaSnapshotRejected(model, other_resolver, kKeywordArenaSize, false,
+                              model_hash, header, g_snapshot_data, used_bytes);
+  // Corrupt data.
+  g_snapshot_data[header.data_bytes() / 2] ^= 1;
+  ExpectArenaSnapshotRejected(model, resolver, kKeywordArenaSize, false,
+                              model_hash, header, g_snapshot_data, used_bytes);
+  g_snapshot_data[header.data_bytes() / 2] ^= 1;
+  // A corrupt header.
+  tflite::ArenaSnapshotHeader corrupt_header = header;
+  ++corrupt_header.head_bytes;
+  ExpectArenaSnapshotRejected(model, resolver, kKeywordArenaSize, false,
+                              model_hash, corrupt_header, g_snapshot_data,
+                              used_bytes);
+
+  // The snapshot itself is still good.
+  tflite::MicroInterpreter interpreter(model, resolver, g_shared_arena,
+                                       kKeywordArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.RestoreArenaSnapshot(
+                                         model_hash, header, g_snapshot_data));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.RestoreArenaSnapshot(
+                                            model_hash, header,
+                                            g_snapshot_data));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,42 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_workers.h"
+
+#include "tensorflow/lite/micro/micro_backend_context.h"
+
+namespace tflite {
+
+MicroWorkers* GetMicroWorkers(TfLiteContext* context) {
+  MicroBackendContext* backend_context = GetMicroBackendContext(context);
+  if (backend_context == nullptr) {
+    return nullptr;
+  }
+  MicroWorkers* workers = backend_context->workers();
+  if (workers == nullptr || workers->num_workers() < 2) {
+    return nullptr;
+  }
+  return workers;
+}
+
+void GetWorkerRange(int size, int worker, int num_workers, int* begin,
+                    int* end) {
+  const int share = size / num_workers;
+  const int remainder = size % num_workers;
+  *begin = worker * share + (worker < remainder ? worker : remainder);
+  *end = *begin + share + (worker < remainder ? 1 : 0);
+}
+
+}  // namespace tflite
@@ -0,0 +1,55 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_WORKERS_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_WORKERS_H_
+
+#include "tensorflow/lite/c/common.h"
+
+namespace tflite {
+
+// A fixed set of workers, one per core, that kernels can split a single
+// operation across. The calling core is always worker 0, so a two-worker
+// implementation only has to drive one other core.
+//
+// Workers reach kernels through the interpreter's MicroBackendContext; see
+// MicroInterpreter::SetWorkers() and GetMicroWorkers().
+class MicroWorkers {
+ public:
+  // Computes the share of `worker` out of `num_workers`. Must only touch
+  // memory that no other worker writes.
+  typedef void (*Task)(void* data, int worker, int num_workers);
+
+  virtual ~MicroWorkers() {}
+
+  virtual int num_workers() const = 0;
+
+  // Calls task(data, i, num_workers()) once for every worker and returns once
+  // all of them have finished, so results written by any worker are visible
+  // to the caller afterwards.
+  virtual void Run(Task task, void* data) = 0;
+};
+
+// Returns the workers registered with the interpreter that owns `context`, or
+// nullptr if kernels should run on the calling core only.
+MicroWorkers* GetMicroWorkers(TfLiteContext* context);
+
+// Splits [0, size) into `num_workers` contiguous ranges that differ in size
+// by at most one and returns the range of `worker` in [*begin, *end).
+void GetWorkerRange(int size, int worker, int num_workers, int* begin,
+                    int* end);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_WORKERS_H_
@@ -0,0 +1,136 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host-only test: the workers below are backed by std::thread, which the
+// RP2040 toolchain does not provide, so this file is not part of the device
+// test library. On the device rp2/multicore_workers.cpp drives core 1.
+
+#include "tensorflow/lite/micro/micro_workers.h"
+
+#include <cstdint>
+#include <thread>  // NOLINT
+
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 112 * 1024;
+alignas(16) uint8_t g_arena[kArenaSize];
+
+constexpr int kOutputSize = 2;
+constexpr int kMaxWorkers = 4;
+
+// Runs worker 0 on the calling thread and every other worker on its own
+// thread; joining the threads is the barrier.
+class ThreadWorkers : public tflite::MicroWorkers {
+ public:
+  explicit ThreadWorkers(int num_workers) : num_workers_(num_workers) {}
+
+  int num_workers() const override { return num_workers_; }
+
+  void Run(Task task, void* data) override {
+    std::thread threads[kMaxWorkers];
+    for (int i = 1; i < num_workers_; ++i) {
+      threads[i] = std::thread(task, data, i, num_workers_);
+    }
+    task(data, 0, num_workers_);
+    for (int i = 1; i < num_workers_; ++i) {
+      threads[i].join();
+    }
+    ++runs_;
+  }
+
+  int runs() const { return runs_; }
+
+ private:
+  int num_workers_;
+  int runs_ = 0;
+};
+
+void FillInput(TfLiteTensor* input, int seed) {
+  for (size_t i = 0; i < input->bytes; ++i) {
+    input->data.int8[i] = static_cast<int8_t>((i * 13 + seed) & 0xff);
+  }
+}
+
+// Runs the person detection model, split across `workers` if not null and
+// with depthwise + pointwise pairs fused if `fuse` is set, and stores its
+// outputs in `output`.
+void RunPersonModel(tflite::MicroWorkers* workers, bool fuse, int seed,
+                    int8_t* output) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver, g_arena,
+      kArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.SetWorkers(workers));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.SetOperatorFusion(fuse));
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, interpreter.SetWorkers(workers));
+  FillInput(interpreter.input(0), seed);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.Invoke());
+  for (int i = 0; i < kOutputSize; ++i) {
+    output[i] = interpreter.output(0)->data.int8[i];
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestWorkerRangesCoverEveryRowOnce) {
+  for (int size = 0; size < 10; ++size) {
+    for (int num_workers = 1; num_workers <= kMaxWorkers; ++num_workers) {
+      int expected_begin = 0;
+      for (int worker = 0; worker < num_workers; ++worker) {
+        int begin;
+        int end;
+        tflite::GetWorkerRange(size, worker, num_workers, &begin, &end);
+        TF_LITE_MICRO_EXPECT_EQ(expected_begin, begin);
+        TF_LITE_MICRO_EXPECT_LE(begin, end);
+        TF_LITE_MICRO_EXPECT_LE(end - begin, size / num_workers + 1);
+        expected_begin = end;
+      }
+      TF_LITE_MICRO_EXPECT_EQ(size, expected_begin);
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(TestSplitPersonModelMatchesSingleCore) {
+  // Three and four workers leave some workers with a single row, or none at
+  // all on the 3x3 layers, which exercises the padded and empty bands.
+  for (int num_workers = 2; num_workers <= kMaxWorkers; ++num_workers) {
+    for (int seed = 1; seed <= 3; ++seed) {
+      int8_t golden[kOutputSize];
+      RunPersonModel(nullptr, /*fuse=*/false, seed, golden);
+
+      for (int fuse = 0; fuse <= 1; ++fuse) {
+        ThreadWorkers workers(num_workers);
+        int8_t output[kOutputSize];
+        RunPersonModel(&workers, fuse, seed, output);
+        TF_LITE_MICRO_EXPECT_LT(0, workers.runs());
+        for (int i = 0; i < kOutputSize; ++i) {
+          TF_LITE_MICRO_EXPECT_EQ(golden[i], output[i]);
+        }
+      }
+    }
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
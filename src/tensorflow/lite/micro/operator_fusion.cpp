@@ -0,0 +1,225 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/operator_fusion.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/kernels/depthwise_pointwise_conv.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kDepthwiseInputs = 3;
+constexpr int kPointwiseInputs = 3;
+constexpr int kFusedInputs = 5;
+
+// Takes the place of a pointwise node folded into the depthwise node before
+// it. Without any kernel functions the interpreter skips it.
+const TfLiteRegistration kFusedAwayRegistration = {
+    /*init=*/nullptr,
+    /*free=*/nullptr,
+    /*prepare=*/nullptr,
+    /*invoke=*/nullptr,
+    /*profiling_string=*/nullptr,
+    /*builtin_code=*/BuiltinOperator_CUSTOM,
+    /*custom_name=*/"FUSED",
+    /*version=*/0};
+
+// Persistent data of one fused pair. The int arrays are laid out like
+// TfLiteIntArray (size followed by elements), the same way the allocator
+// points node arrays straight at flatbuffer vectors.
+struct FusedNodeData {
+  DepthwisePointwiseConvParams params;
+  int inputs[1 + kFusedInputs];
+  int outputs[1 + 1];
+  int no_tensors[1];
+};
+
+TfLiteIntArray* AsIntArray(int* data) {
+  return reinterpret_cast<TfLiteIntArray*>(data);
+}
+
+const Tensor* GetTensor(const SubGraph* subgraph, int tensor_index) {
+  if (tensor_index < 0 ||
+      static_cast<size_t>(tensor_index) >= subgraph->tensors()->size()) {
+    return nullptr;
+  }
+  return subgraph->tensors()->Get(tensor_index);
+}
+
+bool HasType(const SubGraph* subgraph, int tensor_index, TensorType type) {
+  const Tensor* tensor = GetTensor(subgraph, tensor_index);
+  return tensor != nullptr && tensor->type() == type;
+}
+
+// Returns true if the tensor has the four dimensions d0 to d3, where negative
+// values match any size.
+bool HasShape(const SubGraph* subgraph, int tensor_index, int d0, int d1,
+              int d2, int d3) {
+  const Tensor* tensor = GetTensor(subgraph, tensor_index);
+  if (tensor == nullptr || tensor->shape() == nullptr ||
+      tensor->shape()->size() != 4) {
+    return false;
+  }
+  const int dims[4] = {d0, d1, d2, d3};
+  for (int i = 0; i < 4; ++i) {
+    if (dims[i] >= 0 && tensor->shape()->Get(i) != dims[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int CountReaders(const NodeAndRegistration* nodes, size_t nodes_size,
+                 int tensor_index) {
+  int readers = 0;
+  for (size_t i = 0; i < nodes_size; ++i) {
+    const TfLiteIntArray* inputs = nodes[i].node.inputs;
+    for (int n = 0; n < inputs->size; ++n) {
+      if (inputs->data[n] == tensor_index) {
+        ++readers;
+      }
+    }
+  }
+  return readers;
+}
+
+bool IsSubgraphOutput(const SubGraph* subgraph, int tensor_index) {
+  for (size_t i = 0; i < subgraph->outputs()->size(); ++i) {
+    if (subgraph->outputs()->Get(i) == tensor_index) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CanFuse(const SubGraph* subgraph, const NodeAndRegistration* nodes,
+             size_t nodes_size, size_t index) {
+  const NodeAndRegistration& depthwise = nodes[index];
+  const NodeAndRegistration& pointwise = nodes[index + 1];
+  if (depthwise.registration->builtin_code !=
+          BuiltinOperator_DEPTHWISE_CONV_2D ||
+      pointwise.registration->builtin_code != BuiltinOperator_CONV_2D) {
+    return false;
+  }
+  const TfLiteIntArray* depthwise_inputs = depthwise.node.inputs;
+  const TfLiteIntArray* pointwise_inputs = pointwise.node.inputs;
+  if (depthwise_inputs->size != kDepthwiseInputs ||
+      depthwise.node.outputs->size != 1 ||
+      pointwise_inputs->size != kPointwiseInputs ||
+      pointwise.node.outputs->size != 1) {
+    return false;
+  }
+
+  // The depthwise output must only live between the two nodes.
+  const int intermediate = depthwise.node.outputs->data[0];
+  if (pointwise_inputs->data[0] != intermediate ||
+      CountReaders(nodes, nodes_size, intermediate) != 1 ||
+      IsSubgraphOutput(subgraph, intermediate) ||
+      GetTensor(subgraph, intermediate)->is_variable()) {
+    return false;
+  }
+
+  const int input = depthwise_inputs->data[0];
+  const int output = pointwise.node.outputs->data[0];
+  if (!HasType(subgraph, input, TensorType_INT8) ||
+      !HasType(subgraph, intermediate, TensorType_INT8) ||
+      !HasType(subgraph, output, TensorType_INT8) ||
+      !HasType(subgraph, depthwise_inputs->data[1], TensorType_INT8) ||
+      !HasType(subgraph, depthwise_inputs->data[2], TensorType_INT32) ||
+      !HasType(subgraph, pointwise_inputs->data[1], TensorType_INT8) ||
+      !HasType(subgraph, pointwise_inputs->data[2], TensorType_INT32)) {
+    return false;
+  }
+
+  // Single batch, 3x3 depthwise filter and 1x1 pointwise filter, the shapes
+  // the fused kernel supports.
+  const auto* depthwise_params = static_cast<const TfLiteDepthwiseConvParams*>(
+      depthwise.node.builtin_data);
+  const auto* pointwise_params =
+      static_cast<const TfLiteConvParams*>(pointwise.node.builtin_data);
+  return depthwise_params != nullptr && pointwise_params != nullptr &&
+         HasShape(subgraph, input, 1, -1, -1, -1) &&
+         HasShape(subgraph, depthwise_inputs->data[1], 1, 3, 3, -1) &&
+         HasShape(subgraph, pointwise_inputs->data[1], -1, 1, 1, -1) &&
+         depthwise_params->dilation_height_factor == 1 &&
+         depthwise_params->dilation_width_factor == 1 &&
+         pointwise_params->stride_height == 1 &&
+         pointwise_params->stride_width == 1 &&
+         pointwise_params->dilation_height_factor == 1 &&
+         pointwise_params->dilation_width_factor == 1;
+}
+
+}  // namespace
+
+TfLiteStatus FuseDepthwisePointwiseConvs(const Model* model,
+                                         NodeAndRegistration* nodes,
+                                         MicroAllocator* allocator,
+                                         ErrorReporter* error_reporter,
+                                         size_t* fused_count) {
+  TFLITE_DCHECK(model != nullptr);
+  TFLITE_DCHECK(nodes != nullptr);
+  TFLITE_DCHECK(allocator != nullptr);
+  TFLITE_DCHECK(fused_count != nullptr);
+
+  *fused_count = 0;
+  const SubGraph* subgraph = (*model->subgraphs())[0];
+  const size_t nodes_size = subgraph->operators()->size();
+  for (size_t i = 0; i + 1 < nodes_size; ++i) {
+    if (!CanFuse(subgraph, nodes, nodes_size, i)) {
+      continue;
+    }
+
+    FusedNodeData* data = static_cast<FusedNodeData*>(
+        allocator->AllocatePersistentBuffer(sizeof(FusedNodeData)));
+    if (data == nullptr) {
+      TF_LITE_REPORT_ERROR(error_reporter,
+                           "Failed to allocate memory for fused node %d", i);
+      return kTfLiteError;
+    }
+
+    TfLiteNode& depthwise = nodes[i].node;
+    TfLiteNode& pointwise = nodes[i + 1].node;
+    data->params.depthwise =
+        static_cast<const TfLiteDepthwiseConvParams*>(depthwise.builtin_data);
+    data->params.pointwise =
+        static_cast<const TfLiteConvParams*>(pointwise.builtin_data);
+    data->params.depthwise_output = depthwise.outputs->data[0];
+    data->inputs[0] = kFusedInputs;
+    data->inputs[1] = depthwise.inputs->data[0];
+    data->inputs[2] = depthwise.inputs->data[1];
+    data->inputs[3] = depthwise.inputs->data[2];
+    data->inputs[4] = pointwise.inputs->data[1];
+    data->inputs[5] = pointwise.inputs->data[2];
+    data->outputs[0] = 1;
+    data->outputs[1] = pointwise.outputs->data[0];
+    data->no_tensors[0] = 0;
+
+    depthwise.inputs = AsIntArray(data->inputs);
+    depthwise.outputs = AsIntArray(data->outputs);
+    depthwise.builtin_data = &data->params;
+    nodes[i].registration = Register_DEPTHWISE_POINTWISE_CONV_2D();
+
+    pointwise.inputs = AsIntArray(data->no_tensors);
+    pointwise.outputs = AsIntArray(data->no_tensors);
+    nodes[i + 1].registration = &kFusedAwayRegistration;
+
+    ++*fused_count;
+    ++i;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
@@ -0,0 +1,47 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_OPERATOR_FUSION_H_
+#define TENSORFLOW_LITE_MICRO_OPERATOR_FUSION_H_
+
+#include <cstddef>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Rewrites every int8 3x3 DEPTHWISE_CONV_2D whose output is read only by the
+// 1x1 CONV_2D right after it into a single DEPTHWISE_POINTWISE_CONV_2D node
+// (see kernels/depthwise_pointwise_conv.h). The fused node takes the place of
+// the depthwise node; the pointwise node keeps its index but loses its inputs,
+// outputs and kernel functions, so that operator indices (e.g. for
+// InvokeUntil()) stay the same. No node refers to the depthwise output any
+// more, so the memory planner leaves it out and it has no data.
+//
+// Must run after MicroAllocator::StartModelAllocation() and before the
+// kernels are initialized. Bookkeeping for the fused nodes is allocated from
+// the persistent section of `allocator`. The number of fused pairs is stored
+// in `fused_count`.
+TfLiteStatus FuseDepthwisePointwiseConvs(const Model* model,
+                                         NodeAndRegistration* nodes,
+                                         MicroAllocator* allocator,
+                                         ErrorReporter* error_reporter,
+                                         size_t* fused_count);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_OPERATOR_FUSION_H_
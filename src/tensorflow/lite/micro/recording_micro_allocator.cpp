@@ -167,11 +167,12 @@ RecordingMicroAllocator::PrepareNodeAndRegistrationDataFromFlatbuffer(
 }
 
 TfLiteStatus RecordingMicroAllocator::AllocateTfLiteEvalTensors(
-    const Model* model, TfLiteEvalTensor** eval_tensors) {
+    const Model* model, TfLiteEvalTensor** eval_tensors,
+    uint16_t** eval_tensor_slots) {
   RecordedAllocation allocations = SnapshotAllocationUsage();
 
-  TfLiteStatus status =
-      MicroAllocator::AllocateTfLiteEvalTensors(model, eval_tensors);
+  TfLiteStatus status = MicroAllocator::AllocateTfLiteEvalTensors(
+      model, eval_tensors, eval_tensor_slots);
 
   RecordAllocationUsage(allocations, recorded_tflite_eval_tensor_data_);
   // The allocation for this recording will always be 1. This is because the
@@ -180,17 +181,28 @@ TfLiteStatus RecordingMicroAllocator::AllocateTfLiteEvalTensors(
   // To prevent extra overhead and potential for fragmentation, manually adjust
   // the accounting by decrementing by 1 and adding the actual number of tensors
   // used in the graph:
-  recorded_tflite_eval_tensor_data_.count +=
-      GetSubGraphFromModel(model)->tensors()->size() - 1;
+  const size_t tensor_count = GetSubGraphFromModel(model)->tensors()->size();
+  recorded_tflite_eval_tensor_data_.count += tensor_count - 1;
+  if (status == kTfLiteOk && eval_tensor_slots != nullptr) {
+    // Compact tensor metadata adds the slot table as a second allocation and
+    // leaves out the constant tensors.
+    recorded_tflite_eval_tensor_data_.count -= 1;
+    for (size_t i = 0; i < tensor_count; ++i) {
+      if ((*eval_tensor_slots)[i] == kConstantTensorSlot) {
+        recorded_tflite_eval_tensor_data_.count -= 1;
+      }
+    }
+  }
   return status;
 }
 
 TfLiteStatus RecordingMicroAllocator::AllocateVariables(
-    const SubGraph* subgraph, TfLiteEvalTensor* eval_tensors) {
+    const SubGraph* subgraph, TfLiteEvalTensor* eval_tensors,
+    const uint16_t* eval_tensor_slots) {
   RecordedAllocation allocations = SnapshotAllocationUsage();
 
-  TfLiteStatus status =
-      MicroAllocator::AllocateVariables(subgraph, eval_tensors);
+  TfLiteStatus status = MicroAllocator::AllocateVariables(
+      subgraph, eval_tensors, eval_tensor_slots);
 
   RecordAllocationUsage(allocations,
                         recorded_tflite_tensor_variable_buffer_data_);
@@ -78,9 +78,11 @@ class RecordingMicroAllocator : public MicroAllocator {
       const Model* model, const MicroOpResolver& op_resolver,
       NodeAndRegistration* node_and_registrations) override;
   TfLiteStatus AllocateTfLiteEvalTensors(
-      const Model* model, TfLiteEvalTensor** eval_tensors) override;
+      const Model* model, TfLiteEvalTensor** eval_tensors,
+      uint16_t** eval_tensor_slots) override;
   TfLiteStatus AllocateVariables(const SubGraph* subgraph,
-                                 TfLiteEvalTensor* eval_tensors) override;
+                                 TfLiteEvalTensor* eval_tensors,
+                                 const uint16_t* eval_tensor_slots) override;
   // TODO(b/162311891): Once all kernels have been updated to the new API drop
   // this method. It is only used to record TfLiteTensor persistent allocations.
   TfLiteTensor* AllocatePersistentTfLiteTensorInternal(
@@ -0,0 +1,86 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Raspberry Pi Pico-specific storage of arena snapshots in flash.
+
+#include "tensorflow/lite/micro/rp2/flash_arena_snapshot.h"
+
+#include <cstring>
+
+// These are headers from the RP2's SDK.
+#include "hardware/flash.h"            // NOLINT
+#include "hardware/regs/addressmap.h"  // NOLINT
+#include "hardware/sync.h"             // NOLINT
+
+namespace tflite {
+namespace {
+
+size_t RoundUp(size_t bytes, size_t multiple) {
+  return (bytes + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+TfLiteStatus WriteArenaSnapshotToFlash(const ArenaSnapshot& snapshot,
+                                       uint32_t flash_offset,
+                                       size_t region_bytes) {
+  static_assert(sizeof(ArenaSnapshotHeader) <= FLASH_PAGE_SIZE,
+                "The header must fit in one flash page");
+  const size_t data_bytes = snapshot.header.data_bytes();
+  const size_t snapshot_bytes =
+      FLASH_PAGE_SIZE + RoundUp(data_bytes, FLASH_PAGE_SIZE);
+  if (flash_offset % FLASH_SECTOR_SIZE != 0 || snapshot_bytes > region_bytes) {
+    return kTfLiteError;
+  }
+
+  // Flash is programmed in whole pages from RAM. The data comes straight from
+  // the arena apart from its last partial page.
+  uint8_t page[FLASH_PAGE_SIZE];
+  const size_t full_page_bytes = data_bytes - data_bytes % FLASH_PAGE_SIZE;
+  const uint32_t data_offset = flash_offset + FLASH_PAGE_SIZE;
+
+  const uint32_t interrupts = save_and_disable_interrupts();
+  flash_range_erase(flash_offset, RoundUp(snapshot_bytes, FLASH_SECTOR_SIZE));
+  if (full_page_bytes > 0) {
+    flash_range_program(data_offset, snapshot.data, full_page_bytes);
+  }
+  if (full_page_bytes < data_bytes) {
+    std::memset(page, 0xff, sizeof(page));
+    std::memcpy(page, snapshot.data + full_page_bytes,
+                data_bytes - full_page_bytes);
+    flash_range_program(data_offset + full_page_bytes, page, sizeof(page));
+  }
+  std::memset(page, 0xff, sizeof(page));
+  std::memcpy(page, &snapshot.header, sizeof(snapshot.header));
+  flash_range_program(flash_offset, page, sizeof(page));
+  restore_interrupts(interrupts);
+  return kTfLiteOk;
+}
+
+const ArenaSnapshotHeader* FindArenaSnapshotInFlash(uint32_t flash_offset,
+                                                    const uint8_t** data) {
+  const uint8_t* region =
+      reinterpret_cast<const uint8_t*>(XIP_BASE + flash_offset);
+  const ArenaSnapshotHeader* header =
+      reinterpret_cast<const ArenaSnapshotHeader*>(region);
+  // Erased flash reads as all ones.
+  if (header->magic != kArenaSnapshotMagic) {
+    return nullptr;
+  }
+  *data = region + FLASH_PAGE_SIZE;
+  return header;
+}
+
+}  // namespace tflite
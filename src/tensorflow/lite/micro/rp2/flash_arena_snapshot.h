@@ -0,0 +1,49 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_RP2_FLASH_ARENA_SNAPSHOT_H_
+#define TENSORFLOW_LITE_MICRO_RP2_FLASH_ARENA_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/arena_snapshot.h"
+
+namespace tflite {
+
+// Keeps an arena snapshot (see arena_snapshot.h) in a region of flash that the
+// application reserves for it, e.g. the last sectors, `flash_offset` bytes
+// from the start of flash. The header takes the first page of the region and
+// the data follows from the second one.
+
+// Erases the region and programs `snapshot` into it. Fails if `flash_offset`
+// isn't sector aligned or the snapshot doesn't fit in `region_bytes`. The
+// header is programmed last, so a write cut short by a reset leaves no
+// snapshot behind rather than a broken one. Execution from flash stalls while
+// flash is erased and programmed, so this disables interrupts and must not be
+// called while the other core runs from flash, e.g. before core 1 is launched.
+TfLiteStatus WriteArenaSnapshotToFlash(const ArenaSnapshot& snapshot,
+                                       uint32_t flash_offset,
+                                       size_t region_bytes);
+
+// Returns the header of the snapshot at `flash_offset` through the XIP
+// window, and its data in `data`, or nullptr if nothing was written there.
+// MicroInterpreter::RestoreArenaSnapshot() validates the rest.
+const ArenaSnapshotHeader* FindArenaSnapshotInFlash(uint32_t flash_offset,
+                                                    const uint8_t** data);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_RP2_FLASH_ARENA_SNAPSHOT_H_
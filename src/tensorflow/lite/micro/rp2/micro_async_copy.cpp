@@ -0,0 +1,74 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Raspberry Pi Pico-specific implementation of background copies using DMA.
+
+#include "tensorflow/lite/micro/micro_async_copy.h"
+
+#include <cstdint>
+#include <cstring>
+
+// These are headers from the RP2's SDK.
+#include "hardware/dma.h"               // NOLINT
+#include "hardware/regs/addressmap.h"  // NOLINT
+
+namespace tflite {
+namespace {
+
+// Reads from the cached XIP window are redirected to the non-caching,
+// non-allocating alias of the same flash location, so that streaming weights
+// through DMA doesn't evict the code and data the CPU is working on from the
+// 16 KB XIP cache.
+const void* NoAllocateAlias(const void* src) {
+  const uintptr_t address = reinterpret_cast<uintptr_t>(src);
+  if (address >= XIP_BASE && address < XIP_NOALLOC_BASE) {
+    return reinterpret_cast<const void*>(address - XIP_BASE +
+                                         XIP_NOCACHE_NOALLOC_BASE);
+  }
+  return src;
+}
+
+}  // namespace
+
+int StartAsyncCopy(void* dst, const void* src, size_t bytes) {
+  const int channel = dma_claim_unused_channel(/*required=*/false);
+  if (channel < 0) {
+    std::memcpy(dst, src, bytes);
+    return kAsyncCopyDone;
+  }
+
+  const bool word_aligned =
+      ((reinterpret_cast<uintptr_t>(dst) | reinterpret_cast<uintptr_t>(src) |
+        bytes) &
+       3) == 0;
+  dma_channel_config config = dma_channel_get_default_config(channel);
+  channel_config_set_transfer_data_size(
+      &config, word_aligned ? DMA_SIZE_32 : DMA_SIZE_8);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, true);
+  dma_channel_configure(channel, &config, dst, NoAllocateAlias(src),
+                        word_aligned ? bytes / 4 : bytes, /*trigger=*/true);
+  return channel;
+}
+
+void WaitAsyncCopy(int handle) {
+  if (handle == kAsyncCopyDone) {
+    return;
+  }
+  dma_channel_wait_for_finish_blocking(handle);
+  dma_channel_unclaim(handle);
+}
+
+}  // namespace tflite
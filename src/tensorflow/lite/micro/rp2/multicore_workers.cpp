@@ -0,0 +1,60 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Raspberry Pi Pico-specific implementation of MicroWorkers using both cores.
+
+#include "tensorflow/lite/micro/rp2/multicore_workers.h"
+
+#include <cstdint>
+
+// These are headers from the RP2's SDK.
+#include "hardware/sync.h"   // NOLINT
+#include "pico/multicore.h"  // NOLINT
+
+namespace tflite {
+namespace {
+
+constexpr uint32_t kTaskDone = 1;
+
+// Core 1 waits for a task and its data pointer, runs its share and reports
+// back. The FIFO pop blocks in WFE, so an idle core 1 sleeps between layers.
+void WorkerLoop() {
+  while (true) {
+    MicroWorkers::Task task =
+        reinterpret_cast<MicroWorkers::Task>(multicore_fifo_pop_blocking());
+    void* data = reinterpret_cast<void*>(multicore_fifo_pop_blocking());
+    task(data, 1, 2);
+    // Make the outputs of core 1 visible before core 0 continues.
+    __dmb();
+    multicore_fifo_push_blocking(kTaskDone);
+  }
+}
+
+}  // namespace
+
+void MulticoreWorkers::Start() { multicore_launch_core1(WorkerLoop); }
+
+void MulticoreWorkers::Run(Task task, void* data) {
+  // The task description lives on the caller's stack; publish it before
+  // handing its address to core 1.
+  __dmb();
+  multicore_fifo_push_blocking(reinterpret_cast<uintptr_t>(task));
+  multicore_fifo_push_blocking(reinterpret_cast<uintptr_t>(data));
+  task(data, 0, 2);
+  multicore_fifo_pop_blocking();
+  __dmb();
+}
+
+}  // namespace tflite
@@ -0,0 +1,40 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_RP2_MULTICORE_WORKERS_H_
+#define TENSORFLOW_LITE_MICRO_RP2_MULTICORE_WORKERS_H_
+
+#include "tensorflow/lite/micro/micro_workers.h"
+
+namespace tflite {
+
+// Runs kernel tasks on both RP2040 cores: the calling core is worker 0 and
+// core 1 is worker 1. Tasks are handed over and completed through the
+// inter-core FIFOs, which doubles as the barrier at the end of each Run().
+//
+// Start() launches core 1 into a loop that waits for tasks, so core 1 and its
+// FIFO must not be used for anything else while the workers are in use.
+class MulticoreWorkers : public MicroWorkers {
+ public:
+  // Launches the worker loop on core 1. Must be called once from core 0
+  // before the first Run().
+  void Start();
+
+  int num_workers() const override { return 2; }
+  void Run(Task task, void* data) override;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_RP2_MULTICORE_WORKERS_H_
@@ -87,6 +87,9 @@ class SimpleMemoryAllocator {
   // account any temporary allocations.
   size_t GetUsedBytes() const;
 
+  // Returns the size of the whole buffer managed by the allocator.
+  size_t GetBufferSize() const;
+
  protected:
   // Returns a pointer to the current end of the head buffer.
   uint8_t* head() const;
@@ -95,8 +98,6 @@ class SimpleMemoryAllocator {
   uint8_t* tail() const;
 
  private:
-  size_t GetBufferSize() const;
-
   ErrorReporter* error_reporter_;
   uint8_t* buffer_head_;
   uint8_t* buffer_tail_;
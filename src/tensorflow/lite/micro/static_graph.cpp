@@ -0,0 +1,380 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/micro/static_graph.h"
+
+#include <cstdarg>
+#include <cstring>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace {
+
+#ifndef TF_LITE_STRIP_ERROR_STRINGS
+const char* OpNameFromRegistration(const TfLiteRegistration* registration) {
+  if (registration->builtin_code == BuiltinOperator_CUSTOM) {
+    return registration->custom_name;
+  } else {
+    return EnumNameBuiltinOperator(BuiltinOperator(registration->builtin_code));
+  }
+}
+#endif  // !defined(TF_LITE_STRIP_ERROR_STRINGS)
+
+static_assert(sizeof(StaticAffineQuantization) ==
+                  sizeof(TfLiteAffineQuantization),
+              "StaticAffineQuantization must match TfLiteAffineQuantization");
+static_assert(sizeof(StaticIntArray<1>) == sizeof(int) * 2,
+              "StaticIntArray must match TfLiteIntArray");
+
+const TfLiteIntArray* AsIntArray(const void* data) {
+  return static_cast<const TfLiteIntArray*>(data);
+}
+
+const TfLiteAffineQuantization* AsQuantization(const void* data) {
+  return static_cast<const TfLiteAffineQuantization*>(data);
+}
+
+}  // namespace
+
+StaticGraph::StaticGraph(const StaticGraphPlan& plan, const uint8_t* model_data,
+                         size_t model_size, TfLiteEvalTensor* eval_tensors,
+                         void** user_data, uint8_t* arena, size_t arena_size,
+                         ErrorReporter* error_reporter)
+    : plan_(plan),
+      model_data_(model_data),
+      model_size_(model_size),
+      eval_tensors_(eval_tensors),
+      user_data_(user_data),
+      arena_(AlignPointerUp(arena, kArenaAlignment)),
+      arena_size_(arena_size - (arena_ - arena)),
+      error_reporter_(error_reporter) {
+  context_.impl_ = static_cast<void*>(this);
+  context_.tensors_size = plan_.tensors_size;
+  context_.ReportError = ReportOpError;
+  context_.GetTensor = GetTensor;
+  context_.GetEvalTensor = GetEvalTensor;
+  context_.recommended_num_threads = 1;
+}
+
+StaticGraph::~StaticGraph() {
+  if (!kernels_initialized_) {
+    return;
+  }
+  for (int i = 0; i < plan_.operators_size; ++i) {
+    const TfLiteRegistration* registration = plan_.operators[i].registration;
+    if (registration->free != nullptr) {
+      registration->free(&context_, user_data_[i]);
+    }
+  }
+}
+
+TfLiteStatus StaticGraph::AllocateTensors() {
+  if (kernels_initialized_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "AllocateTensors() can only be called once.");
+    return kTfLiteError;
+  }
+  if (model_size_ != plan_.model_size) {
+    TF_LITE_REPORT_ERROR(
+        error_reporter_,
+        "Static graph was generated for a model of %d bytes, got %d bytes.",
+        plan_.model_size, model_size_);
+    return kTfLiteError;
+  }
+
+  uint8_t* temp_start = AlignPointerUp(arena_ + plan_.planned_bytes,
+                                       alignof(TfLiteTensor));
+  uint8_t* temp_end = temp_start + plan_.max_temp_tensors * sizeof(TfLiteTensor);
+  if (temp_end > arena_ + arena_size_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Arena size is too small for the static graph, needs "
+                         "at least %d bytes.",
+                         temp_end - arena_);
+    return kTfLiteError;
+  }
+  temp_tensors_ = reinterpret_cast<TfLiteTensor*>(temp_start);
+  persistent_head_ = arena_ + arena_size_;
+
+  for (int i = 0; i < plan_.tensors_size; ++i) {
+    const StaticTensor& tensor = plan_.tensors[i];
+    TfLiteEvalTensor* eval_tensor = &eval_tensors_[i];
+    switch (tensor.location) {
+      case kStaticTensorConstant:
+        eval_tensor->data.data =
+            const_cast<uint8_t*>(model_data_ + tensor.offset);
+        break;
+      case kStaticTensorArena:
+      case kStaticTensorVariable:
+        eval_tensor->data.data = arena_ + tensor.offset;
+        break;
+      default:
+        eval_tensor->data.data = nullptr;
+        break;
+    }
+    eval_tensor->dims = const_cast<TfLiteIntArray*>(AsIntArray(tensor.dims));
+    eval_tensor->type = tensor.type;
+  }
+
+  // Only allow AllocatePersistentBuffer in Init stage.
+  context_.AllocatePersistentBuffer = AllocatePersistentBuffer;
+  context_.RequestScratchBufferInArena = nullptr;
+  context_.GetScratchBuffer = nullptr;
+
+  for (int i = 0; i < plan_.operators_size; ++i) {
+    const StaticOperator& op = plan_.operators[i];
+    const TfLiteRegistration* registration = op.registration;
+    size_t init_data_size;
+    const char* init_data;
+    if (op.custom_data_offset >= 0) {
+      init_data =
+          reinterpret_cast<const char*>(model_data_ + op.custom_data_offset);
+      init_data_size = op.custom_data_size;
+    } else {
+      init_data = static_cast<const char*>(op.builtin_data);
+      init_data_size = 0;
+    }
+    user_data_[i] = nullptr;
+    if (registration->init) {
+      user_data_[i] = registration->init(&context_, init_data, init_data_size);
+    }
+    temp_tensors_used_ = 0;
+  }
+  kernels_initialized_ = true;
+
+  context_.RequestScratchBufferInArena = RequestScratchBufferInArena;
+  for (int i = 0; i < plan_.operators_size; ++i) {
+    const TfLiteRegistration* registration = plan_.operators[i].registration;
+    if (registration->prepare) {
+      TfLiteNode node;
+      FillNode(i, &node);
+      TfLiteStatus prepare_status = registration->prepare(&context_, &node);
+      temp_tensors_used_ = 0;
+      if (prepare_status != kTfLiteOk) {
+        TF_LITE_REPORT_ERROR(
+            error_reporter_,
+            "Node %s (number %d) failed to prepare with status %d",
+            OpNameFromRegistration(registration), i, prepare_status);
+        return kTfLiteError;
+      }
+    }
+  }
+
+  // Prepare is done, kernels can only fetch scratch buffers from now on.
+  context_.AllocatePersistentBuffer = nullptr;
+  context_.RequestScratchBufferInArena = nullptr;
+  context_.GetScratchBuffer = GetScratchBuffer;
+
+  TF_LITE_ENSURE_STATUS(ResetVariableTensors());
+
+  tensors_allocated_ = true;
+  return kTfLiteOk;
+}
+
+TfLiteStatus StaticGraph::Invoke() {
+  if (!tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Invoke() called before AllocateTensors().");
+    return kTfLiteError;
+  }
+
+  for (int i = 0; i < plan_.operators_size; ++i) {
+    const TfLiteRegistration* registration = plan_.operators[i].registration;
+    if (registration->invoke) {
+      TfLiteNode node;
+      FillNode(i, &node);
+      TfLiteStatus invoke_status = registration->invoke(&context_, &node);
+      temp_tensors_used_ = 0;
+      if (invoke_status == kTfLiteError) {
+        TF_LITE_REPORT_ERROR(
+            error_reporter_,
+            "Node %s (number %d) failed to invoke with status %d",
+            OpNameFromRegistration(registration), i, invoke_status);
+        return kTfLiteError;
+      } else if (invoke_status != kTfLiteOk) {
+        return invoke_status;
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus StaticGraph::ResetVariableTensors() {
+  for (int i = 0; i < plan_.tensors_size; ++i) {
+    const StaticTensor& tensor = plan_.tensors[i];
+    if (tensor.location == kStaticTensorVariable) {
+      int value = 0;
+      if (tensor.type == kTfLiteInt8 && tensor.quantization != nullptr) {
+        value = AsQuantization(tensor.quantization)->zero_point->data[0];
+      }
+      memset(eval_tensors_[i].data.raw, value, tensor.bytes);
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteEvalTensor* StaticGraph::input(size_t index) {
+  const size_t length = inputs_size();
+  if (index >= length) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Input index %d out of range (length is %d)", index,
+                         length);
+    return nullptr;
+  }
+  return &eval_tensors_[InputIndices()->data[index]];
+}
+
+TfLiteEvalTensor* StaticGraph::output(size_t index) {
+  const size_t length = outputs_size();
+  if (index >= length) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Output index %d out of range (length is %d)", index,
+                         length);
+    return nullptr;
+  }
+  return &eval_tensors_[OutputIndices()->data[index]];
+}
+
+TfLiteEvalTensor* StaticGraph::tensor(size_t index) {
+  const size_t length = tensors_size();
+  if (index >= length) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Tensor index %d out of range (length is %d)", index,
+                         length);
+    return nullptr;
+  }
+  return &eval_tensors_[index];
+}
+
+size_t StaticGraph::arena_used_bytes() const {
+  if (temp_tensors_ == nullptr) {
+    return 0;
+  }
+  const uint8_t* temp_end = reinterpret_cast<const uint8_t*>(
+      temp_tensors_ + plan_.max_temp_tensors);
+  return (temp_end - arena_) + (arena_ + arena_size_ - persistent_head_);
+}
+
+void StaticGraph::FillNode(int operator_index, TfLiteNode* node) const {
+  const StaticOperator& op = plan_.operators[operator_index];
+  memset(node, 0, sizeof(*node));
+  node->inputs = const_cast<TfLiteIntArray*>(AsIntArray(op.inputs));
+  node->outputs = const_cast<TfLiteIntArray*>(AsIntArray(op.outputs));
+  node->user_data = user_data_[operator_index];
+  node->builtin_data = const_cast<void*>(op.builtin_data);
+  if (op.custom_data_offset >= 0) {
+    node->custom_initial_data = model_data_ + op.custom_data_offset;
+    node->custom_initial_data_size = op.custom_data_size;
+  }
+}
+
+void* StaticGraph::AllocatePersistentBuffer(TfLiteContext* context,
+                                            size_t bytes) {
+  StaticGraph* graph = static_cast<StaticGraph*>(context->impl_);
+  const uint8_t* temp_end =
+      reinterpret_cast<const uint8_t*>(graph->temp_tensors_ +
+                                       graph->plan_.max_temp_tensors);
+  const size_t available = graph->persistent_head_ - temp_end;
+  uint8_t* aligned_result =
+      bytes > available
+          ? nullptr
+          : AlignPointerDown(graph->persistent_head_ - bytes, kArenaAlignment);
+  if (aligned_result == nullptr || aligned_result < temp_end) {
+    TF_LITE_REPORT_ERROR(graph->error_reporter_,
+                         "Failed to allocate persistent buffer of %d bytes, "
+                         "only %d bytes available in the arena.",
+                         bytes, available);
+    return nullptr;
+  }
+  graph->persistent_head_ = aligned_result;
+  return aligned_result;
+}
+
+TfLiteStatus StaticGraph::RequestScratchBufferInArena(TfLiteContext* context,
+                                                      size_t bytes,
+                                                      int* buffer_idx) {
+  StaticGraph* graph = static_cast<StaticGraph*>(context->impl_);
+  const int index = graph->scratch_buffers_requested_;
+  if (index >= graph->plan_.scratch_buffers_size ||
+      bytes > static_cast<size_t>(graph->plan_.scratch_buffer_sizes[index])) {
+    TF_LITE_REPORT_ERROR(graph->error_reporter_,
+                         "Scratch buffer %d of %d bytes is not in the static "
+                         "memory plan, regenerate the static graph.",
+                         index, bytes);
+    return kTfLiteError;
+  }
+  graph->scratch_buffers_requested_++;
+  *buffer_idx = index;
+  return kTfLiteOk;
+}
+
+void* StaticGraph::GetScratchBuffer(TfLiteContext* context, int buffer_idx) {
+  StaticGraph* graph = static_cast<StaticGraph*>(context->impl_);
+  return graph->arena_ + graph->plan_.scratch_buffer_offsets[buffer_idx];
+}
+
+void StaticGraph::ReportOpError(struct TfLiteContext* context,
+                                const char* format, ...) {
+#ifndef TF_LITE_STRIP_ERROR_STRINGS
+  StaticGraph* graph = static_cast<StaticGraph*>(context->impl_);
+  va_list args;
+  va_start(args, format);
+  TF_LITE_REPORT_ERROR(graph->error_reporter_, format, args);
+  va_end(args);
+#endif
+}
+
+TfLiteTensor* StaticGraph::GetTensor(const struct TfLiteContext* context,
+                                     int tensor_idx) {
+  StaticGraph* graph = static_cast<StaticGraph*>(context->impl_);
+  if (graph->temp_tensors_used_ >= graph->plan_.max_temp_tensors) {
+    TF_LITE_REPORT_ERROR(graph->error_reporter_,
+                         "Kernel asked for more than %d tensors at once.",
+                         graph->plan_.max_temp_tensors);
+    return nullptr;
+  }
+  const StaticTensor& tensor = graph->plan_.tensors[tensor_idx];
+  const TfLiteEvalTensor& eval_tensor = graph->eval_tensors_[tensor_idx];
+  TfLiteTensor* result = &graph->temp_tensors_[graph->temp_tensors_used_++];
+  memset(result, 0, sizeof(*result));
+  result->data = eval_tensor.data;
+  result->dims = eval_tensor.dims;
+  result->type = eval_tensor.type;
+  result->bytes = tensor.bytes;
+  result->is_variable = tensor.location == kStaticTensorVariable;
+  result->allocation_type = tensor.location == kStaticTensorConstant
+                                ? kTfLiteMmapRo
+                                : kTfLiteArenaRw;
+  if (tensor.quantization != nullptr) {
+    const TfLiteAffineQuantization* quantization =
+        AsQuantization(tensor.quantization);
+    result->quantization.type = kTfLiteAffineQuantization;
+    result->quantization.params = const_cast<TfLiteAffineQuantization*>(
+        quantization);
+    result->params.scale = quantization->scale->data[0];
+    result->params.zero_point = quantization->zero_point->data[0];
+  }
+  return result;
+}
+
+TfLiteEvalTensor* StaticGraph::GetEvalTensor(
+    const struct TfLiteContext* context, int tensor_idx) {
+  StaticGraph* graph = static_cast<StaticGraph*>(context->impl_);
+  return &graph->eval_tensors_[tensor_idx];
+}
+
+}  // namespace tflite
@@ -0,0 +1,191 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_STATIC_GRAPH_H_
+#define TENSORFLOW_LITE_MICRO_STATIC_GRAPH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+
+namespace tflite {
+
+// Tables describing a model whose kernels, operator parameters and memory plan
+// have been resolved ahead of time by tools/generate_static_graph. They are
+// plain aggregates of constants so that the generated tables are placed in
+// flash and cost no RAM or start-up time. Arrays are referenced through
+// `const void*` with the layout of TfLiteIntArray / TfLiteFloatArray, since
+// casting to those types would prevent constant initialization.
+
+template <int N>
+struct StaticIntArray {
+  int size;
+  int data[N];
+};
+
+template <int N>
+struct StaticFloatArray {
+  int size;
+  float data[N];
+};
+
+// Same layout as TfLiteAffineQuantization.
+struct StaticAffineQuantization {
+  const void* scale;
+  const void* zero_point;
+  int32_t quantized_dimension;
+};
+
+enum StaticTensorLocation : uint8_t {
+  // No data, e.g. an empty tensor.
+  kStaticTensorNone = 0,
+  // `offset` is relative to the start of the model flatbuffer.
+  kStaticTensorConstant,
+  // `offset` is relative to the start of the arena.
+  kStaticTensorArena,
+  // Like kStaticTensorArena, but the contents persist between invocations.
+  kStaticTensorVariable,
+};
+
+struct StaticTensor {
+  const void* dims;
+  // StaticAffineQuantization, or nullptr if the tensor is not quantized.
+  const void* quantization;
+  int32_t offset;
+  uint32_t bytes;
+  TfLiteType type;
+  StaticTensorLocation location;
+};
+
+struct StaticOperator {
+  const TfLiteRegistration* registration;
+  const void* inputs;
+  const void* outputs;
+  // Parameters in the struct from builtin_op_data.h, or nullptr.
+  const void* builtin_data;
+  // Custom options, relative to the start of the model flatbuffer.
+  int32_t custom_data_offset;
+  int32_t custom_data_size;
+};
+
+struct StaticGraphPlan {
+  const StaticTensor* tensors;
+  int tensors_size;
+  const StaticOperator* operators;
+  int operators_size;
+  const void* inputs;
+  const void* outputs;
+  // Scratch buffers in the order the kernels request them while preparing.
+  const int32_t* scratch_buffer_offsets;
+  const int32_t* scratch_buffer_sizes;
+  int scratch_buffers_size;
+  // Bytes at the start of the arena taken by tensors, scratch buffers and
+  // variables.
+  uint32_t planned_bytes;
+  // Most TfLiteTensor structs a single kernel call asks for at once.
+  int max_temp_tensors;
+  // Size of the model the tables were generated from.
+  uint32_t model_size;
+};
+
+// Runs a model from a StaticGraphPlan instead of interpreting the flatbuffer.
+// There is no op resolver, no TfLiteNode array and no parsing of operator
+// parameters, and the memory plan is fixed, so AllocateTensors() only has to
+// run the kernels' Init and Prepare functions. Kernels are the same as the
+// ones used by MicroInterpreter, so the results are identical.
+//
+// The arena holds the planned tensors at the start, followed by the temporary
+// TfLiteTensor structs handed to kernels while they run and, at the end, the
+// kernels' persistent buffers. Generated graphs derive from this class, own
+// the per-tensor and per-operator state and export the arena size needed.
+class StaticGraph {
+ public:
+  // `eval_tensors` must have room for plan.tensors_size entries and
+  // `user_data` for plan.operators_size entries.
+  StaticGraph(const StaticGraphPlan& plan, const uint8_t* model_data,
+              size_t model_size, TfLiteEvalTensor* eval_tensors,
+              void** user_data, uint8_t* arena, size_t arena_size,
+              ErrorReporter* error_reporter);
+
+  ~StaticGraph();
+
+  // Initializes and prepares every kernel and resets the variable tensors.
+  TfLiteStatus AllocateTensors();
+
+  TfLiteStatus Invoke();
+
+  TfLiteStatus ResetVariableTensors();
+
+  size_t inputs_size() const { return InputIndices()->size; }
+  size_t outputs_size() const { return OutputIndices()->size; }
+  TfLiteEvalTensor* input(size_t index);
+  TfLiteEvalTensor* output(size_t index);
+
+  size_t tensors_size() const { return plan_.tensors_size; }
+  TfLiteEvalTensor* tensor(size_t index);
+  size_t operators_size() const { return plan_.operators_size; }
+
+  // Bytes of the arena in use after AllocateTensors().
+  size_t arena_used_bytes() const;
+
+  // Required extra alignment slack to add to the arena size.
+  static constexpr size_t kArenaAlignment = 16;
+
+ private:
+  static void* AllocatePersistentBuffer(TfLiteContext* context, size_t bytes);
+  static TfLiteStatus RequestScratchBufferInArena(TfLiteContext* context,
+                                                  size_t bytes,
+                                                  int* buffer_idx);
+  static void* GetScratchBuffer(TfLiteContext* context, int buffer_idx);
+  static void ReportOpError(struct TfLiteContext* context, const char* format,
+                            ...);
+  static TfLiteTensor* GetTensor(const struct TfLiteContext* context,
+                                 int tensor_idx);
+  static TfLiteEvalTensor* GetEvalTensor(const struct TfLiteContext* context,
+                                         int tensor_idx);
+
+  const TfLiteIntArray* InputIndices() const {
+    return static_cast<const TfLiteIntArray*>(plan_.inputs);
+  }
+  const TfLiteIntArray* OutputIndices() const {
+    return static_cast<const TfLiteIntArray*>(plan_.outputs);
+  }
+
+  // TfLiteNode is only built on the stack for the duration of a kernel call.
+  void FillNode(int operator_index, TfLiteNode* node) const;
+
+  const StaticGraphPlan& plan_;
+  const uint8_t* model_data_;
+  size_t model_size_;
+  TfLiteEvalTensor* eval_tensors_;
+  void** user_data_;
+  uint8_t* arena_;
+  size_t arena_size_;
+  ErrorReporter* error_reporter_;
+  TfLiteContext context_ = {};
+
+  TfLiteTensor* temp_tensors_ = nullptr;
+  int temp_tensors_used_ = 0;
+  // Start of the persistent buffers, which grow down from the arena end.
+  uint8_t* persistent_head_ = nullptr;
+  int scratch_buffers_requested_ = 0;
+  bool kernels_initialized_ = false;
+  bool tensors_allocated_ = false;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_STATIC_GRAPH_H_
@@ -0,0 +1,141 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/static_graph.h"
+
+#include <cstdint>
+
+#include "person_detect_model_data.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h"
+#include "tensorflow/lite/micro/benchmarks/keyword_static_graph.h"
+#include "tensorflow/lite/micro/benchmarks/person_detect_static_graph.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+constexpr size_t kInterpreterArenaSize = 96 * 1024;
+alignas(16) uint8_t g_interpreter_arena[kInterpreterArenaSize];
+alignas(16) uint8_t g_static_arena[PersonDetectStaticGraph::kArenaSize];
+
+void FillInput(int8_t* input, size_t bytes, int seed) {
+  for (size_t i = 0; i < bytes; ++i) {
+    input[i] = static_cast<int8_t>((i * 7 + seed) & 0xff);
+  }
+}
+
+// Invokes `interpreter` and `graph` with the same inputs `iterations` times,
+// without resetting state in between, and expects identical outputs.
+template <typename Graph>
+void ExpectSameOutputs(tflite::MicroInterpreter* interpreter, Graph* graph,
+                       int iterations) {
+  TF_LITE_MICRO_EXPECT_EQ(interpreter->inputs_size(), graph->inputs_size());
+  TF_LITE_MICRO_EXPECT_EQ(interpreter->outputs_size(), graph->outputs_size());
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    TfLiteTensor* expected_input = interpreter->input(0);
+    TfLiteEvalTensor* input = graph->input(0);
+    FillInput(expected_input->data.int8, expected_input->bytes, iteration);
+    FillInput(input->data.int8, expected_input->bytes, iteration);
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter->Invoke());
+    TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, graph->Invoke());
+
+    TfLiteTensor* expected_output = interpreter->output(0);
+    TfLiteEvalTensor* output = graph->output(0);
+    TF_LITE_MICRO_EXPECT_EQ(expected_output->type, output->type);
+    TF_LITE_MICRO_EXPECT_EQ(expected_output->dims->size, output->dims->size);
+    for (size_t i = 0; i < expected_output->bytes; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(expected_output->data.int8[i],
+                              output->data.int8[i]);
+    }
+  }
+}
+
+// Expects the variable tensors, e.g. the SVDF state, to hold the same values.
+template <typename Graph>
+void ExpectSameVariables(tflite::MicroInterpreter* interpreter, Graph* graph) {
+  int variables = 0;
+  for (size_t t = 0; t < interpreter->tensors_size(); ++t) {
+    TfLiteTensor* expected = interpreter->tensor(t);
+    if (!expected->is_variable) {
+      continue;
+    }
+    ++variables;
+    TfLiteEvalTensor* actual = graph->tensor(t);
+    TF_LITE_MICRO_EXPECT_EQ(expected->type, actual->type);
+    for (size_t i = 0; i < expected->bytes; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(expected->data.int8[i], actual->data.int8[i]);
+    }
+  }
+  TF_LITE_MICRO_EXPECT_GT(variables, 0);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TestPersonDetectStaticGraphMatchesInterpreter) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_person_detect_model_data), resolver,
+      g_interpreter_arena, kInterpreterArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  PersonDetectStaticGraph graph(g_static_arena,
+                                PersonDetectStaticGraph::kArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, graph.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_LE(graph.arena_used_bytes(),
+                          PersonDetectStaticGraph::kArenaSize);
+  TF_LITE_MICRO_EXPECT_LT(graph.arena_used_bytes(),
+                          interpreter.arena_used_bytes());
+
+  ExpectSameOutputs(&interpreter, &graph, 3);
+}
+
+TF_LITE_MICRO_TEST(TestKeywordStaticGraphKeepsVariablesInSync) {
+  tflite::MicroErrorReporter reporter;
+  tflite::AllOpsResolver resolver;
+  tflite::MicroInterpreter interpreter(
+      tflite::GetModel(g_keyword_scrambled_model_data), resolver,
+      g_interpreter_arena, kInterpreterArenaSize, &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.AllocateTensors());
+
+  KeywordStaticGraph graph(g_static_arena, KeywordStaticGraph::kArenaSize,
+                           &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, graph.AllocateTensors());
+
+  // The SVDF state carries over between invocations, so several runs also
+  // check that the variable tensors are laid out and updated the same way.
+  ExpectSameOutputs(&interpreter, &graph, 4);
+  ExpectSameVariables(&interpreter, &graph);
+
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, interpreter.ResetVariableTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteOk, graph.ResetVariableTensors());
+  ExpectSameVariables(&interpreter, &graph);
+  ExpectSameOutputs(&interpreter, &graph, 2);
+  ExpectSameVariables(&interpreter, &graph);
+}
+
+TF_LITE_MICRO_TEST(TestStaticGraphArenaTooSmall) {
+  tflite::MicroErrorReporter reporter;
+  KeywordStaticGraph graph(g_static_arena, KeywordStaticGraph::kArenaSize / 2,
+                           &reporter);
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, graph.AllocateTensors());
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, graph.Invoke());
+}
+
+TF_LITE_MICRO_TESTS_END
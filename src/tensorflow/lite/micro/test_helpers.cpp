@@ -312,6 +312,46 @@ const Model* BuildSimpleModelWithBranch() {
   return model_builder.BuildModel({t0}, {t3});
 }
 
+const Model* BuildSimpleModelWithInPlaceOps() {
+  using flatbuffers::Offset;
+  flatbuffers::FlatBufferBuilder* fb_builder = BuilderInstance();
+
+  ModelBuilder model_builder(fb_builder);
+  /* Model structure
+           | t0
+           v
+        +------+
+        |  n0  | RELU
+        +------+
+           | t1
+     +-----+-------------+
+     v                   |
+  +------+               |
+  |  n1  | RELU6         |
+  +------+               |
+     | t2                |
+     +------+            |
+     |      v            v
+     |   +------+     +------+
+     |   |  n2  |     |  n3  | RELU
+     |   +------+     +------+
+     |  RELU | t4        | t3
+     v       v           v
+  */
+  const int relu = model_builder.RegisterOp(BuiltinOperator_RELU, nullptr);
+  const int relu6 = model_builder.RegisterOp(BuiltinOperator_RELU6, nullptr);
+  const int t0 = model_builder.AddTensor(TensorType_FLOAT32, {2, 2, 3});
+  const int t1 = model_builder.AddTensor(TensorType_FLOAT32, {2, 2, 3});
+  const int t2 = model_builder.AddTensor(TensorType_FLOAT32, {2, 2, 3});
+  const int t3 = model_builder.AddTensor(TensorType_FLOAT32, {2, 2, 3});
+  const int t4 = model_builder.AddTensor(TensorType_FLOAT32, {2, 2, 3});
+  model_builder.AddNode(relu, {t0}, {t1});   // n0
+  model_builder.AddNode(relu6, {t1}, {t2});  // n1
+  model_builder.AddNode(relu, {t2}, {t4});   // n2
+  model_builder.AddNode(relu, {t1}, {t3});   // n3
+  return model_builder.BuildModel({t0}, {t2, t3, t4});
+}
+
 const Model* BuildModelWithOfflinePlanning(int number_of_tensors,
                                            const int32_t* metadata_buffer,
                                            NodeConnection* node_conn,
@@ -867,6 +907,14 @@ const Model* GetSimpleModelWithBranch() {
   return model;
 }
 
+const Model* GetSimpleModelWithInPlaceOps() {
+  static Model* model = nullptr;
+  if (!model) {
+    model = const_cast<Model*>(BuildSimpleModelWithInPlaceOps());
+  }
+  return model;
+}
+
 const Model* GetModelWithOfflinePlanning(int num_tensors,
                                          const int32_t* metadata_buffer,
                                          NodeConnection* node_conn,
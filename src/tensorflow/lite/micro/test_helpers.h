@@ -104,6 +104,11 @@ const Model* GetComplexMockModel();
 // Returns a simple flatbuffer model with two branches.
 const Model* GetSimpleModelWithBranch();
 
+// Returns a flatbuffer model of float RELU and RELU6 operators, some of which
+// can overwrite their inputs. Tensor t1 is read by two operators and t2 is
+// both a model output and the input of another operator.
+const Model* GetSimpleModelWithInPlaceOps();
+
 // Returns a simple example flatbuffer TensorFlow Lite model. Contains 3 inputs,
 // 1 output Tensor, and 1 operator.
 const Model* GetSimpleMultipleInputsModel();
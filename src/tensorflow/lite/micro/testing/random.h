@@ -0,0 +1,65 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_TESTING_RANDOM_H_
+#define TENSORFLOW_LITE_MICRO_TESTING_RANDOM_H_
+
+#include <cstdint>
+
+namespace tflite {
+namespace testing {
+
+// Small deterministic generator for tests, benchmarks and simulations, so
+// that they see the same data on every platform without depending on the C
+// library.
+class Random {
+ public:
+  explicit Random(uint32_t seed = 1) : state_(seed) {}
+
+  // Returns 24 random bits. The low bits of a linear congruential generator
+  // repeat too soon to be used.
+  uint32_t Next() {
+    state_ = state_ * 1664525u + 1013904223u;
+    return state_ >> 8;
+  }
+
+  // Returns a value in [0, count). count must not be 0.
+  uint32_t Below(uint32_t count) {
+    return static_cast<uint32_t>(Bits(count) % count);
+  }
+
+  // Returns a value in [min, max], for any min <= max.
+  int32_t Int(int32_t min, int32_t max) {
+    const uint64_t span =
+        static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+    return static_cast<int32_t>(min + static_cast<int64_t>(Bits(span) % span));
+  }
+
+ private:
+  // Enough bits to cover `span` values evenly enough for tests.
+  uint64_t Bits(uint64_t span) {
+    uint64_t bits = Next();
+    if (span > (uint64_t{1} << 24)) {
+      bits = (bits << 24) | Next();
+    }
+    return bits;
+  }
+
+  uint32_t state_;
+};
+
+}  // namespace testing
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_TESTING_RANDOM_H_
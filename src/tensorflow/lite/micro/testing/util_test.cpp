@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 
 #include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/micro/testing/random.h"
 
 TF_LITE_MICRO_TESTS_BEGIN
 
@@ -26,4 +27,24 @@ TF_LITE_MICRO_TEST(ArgumentsExecutedOnlyOnce) {
   TF_LITE_MICRO_EXPECT_NEAR(count++, 3, 0.1f);
 }
 
+TF_LITE_MICRO_TEST(RandomStaysInRange) {
+  tflite::testing::Random random;
+  bool wide_above_zero = false;
+  for (int i = 0; i < 1000; ++i) {
+    const int32_t small = random.Int(-3, 3);
+    TF_LITE_MICRO_EXPECT_GE(small, -3);
+    TF_LITE_MICRO_EXPECT_LE(small, 3);
+    // Spans that overflow int32_t.
+    const int32_t wide = random.Int(-(1 << 30), 1 << 30);
+    TF_LITE_MICRO_EXPECT_GE(wide, -(1 << 30));
+    TF_LITE_MICRO_EXPECT_LE(wide, 1 << 30);
+    wide_above_zero |= wide > 0;
+    random.Int(INT32_MIN, INT32_MAX);
+    TF_LITE_MICRO_EXPECT_LT(random.Below(7), 7u);
+  }
+  TF_LITE_MICRO_EXPECT_TRUE(wide_above_zero);
+  TF_LITE_MICRO_EXPECT_EQ(5, random.Int(5, 5));
+  TF_LITE_MICRO_EXPECT_EQ(INT32_MAX, random.Int(INT32_MAX, INT32_MAX));
+}
+
 TF_LITE_MICRO_TESTS_END
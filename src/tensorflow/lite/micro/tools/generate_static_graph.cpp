@@ -0,0 +1,1188 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool that turns a .tflite model into a static graph: C++ tables that
+// StaticGraph (static_graph.h) executes without an op resolver, flatbuffer
+// parsing or memory planning on the device. The tool resolves every operator
+// to its kernel registration, parses the operator parameters into the structs
+// from builtin_op_data.h, records the scratch buffers the kernels request and
+// plans the arena with the same GreedyMemoryPlanner as MicroAllocator. All of
+// it is emitted as constant data, so it stays in flash.
+//
+// Weights are not copied: constant tensors point into the model array that is
+// already compiled into the firmware, so the generated code must be built
+// together with the exact model it was generated from. StaticGraph checks the
+// model size at start-up.
+//
+// The tool runs the kernels once on the host to record their requests, so it
+// needs the same kernels as the firmware. It is not part of the firmware
+// build. Build it on the host with:
+//
+//   g++ -std=c++17 -O2 -DTF_LITE_STATIC_MEMORY -DCMSIS_NN
+//     -DTF_LITE_DISABLE_X86_NEON -Isrc -Isrc/third_party/flatbuffers/include
+//     -Isrc/third_party/gemmlowp -Isrc/third_party/ruy
+//     -Isrc/third_party/cmsis -Isrc/third_party/cmsis/CMSIS/NN/Include
+//     -Isrc/third_party/cmsis/CMSIS/DSP/Include
+//     -Isrc/third_party/cmsis/CMSIS/Core/Include
+//     src/tensorflow/lite/micro/tools/generate_static_graph.cpp
+//     <TFLM and CMSIS-NN sources> -o generate_static_graph
+//
+// Usage:
+//
+//   generate_static_graph <in.tflite> <model_header> <model_array>
+//     <model_length> <out_prefix> <class_name>
+//
+// writes <out_prefix>.h and <out_prefix>.cpp declaring `class_name`, e.g.
+//
+//   generate_static_graph person_detect.tflite person_detect_model_data.h
+//     g_person_detect_model_data g_person_detect_model_data_len
+//     src/tensorflow/lite/micro/benchmarks/person_detect_static_graph
+//     PersonDetectStaticGraph
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "tensorflow/lite/core/api/op_resolver.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/kernels/block_sparse_fully_connected.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace {
+
+constexpr int kBufferAlignment = 16;
+
+bool ReadFile(const char* path, std::vector<uint8_t>* contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  contents->assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+  return true;
+}
+
+bool WriteFile(const std::string& path, const std::string& contents) {
+  std::ofstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  file << contents;
+  return static_cast<bool>(file);
+}
+
+std::string Format(const char* format, ...) {
+  char buffer[512];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  return buffer;
+}
+
+// Expression that returns the TfLiteRegistration of a builtin, as in
+// MicroMutableOpResolver. Empty if the static graph cannot use the op.
+std::string RegistrationExpression(tflite::BuiltinOperator op) {
+  using tflite::BuiltinOperator;
+  switch (op) {
+#define MICRO_OP(name) \
+  case tflite::BuiltinOperator_##name: \
+    return "tflite::ops::micro::Register_" #name "()";
+#define TFLITE_OP(name) \
+  case tflite::BuiltinOperator_##name: \
+    return "tflite::Register_" #name "()";
+    MICRO_OP(ABS)
+    MICRO_OP(ADD)
+    MICRO_OP(ARG_MAX)
+    MICRO_OP(ARG_MIN)
+    MICRO_OP(AVERAGE_POOL_2D)
+    MICRO_OP(CEIL)
+    MICRO_OP(CONCATENATION)
+    TFLITE_OP(CONV_2D)
+    MICRO_OP(COS)
+    TFLITE_OP(DEPTHWISE_CONV_2D)
+    MICRO_OP(DEQUANTIZE)
+    MICRO_OP(EQUAL)
+    MICRO_OP(FLOOR)
+    TFLITE_OP(FULLY_CONNECTED)
+    MICRO_OP(GREATER)
+    MICRO_OP(GREATER_EQUAL)
+    MICRO_OP(HARD_SWISH)
+    MICRO_OP(L2_NORMALIZATION)
+    MICRO_OP(LESS)
+    MICRO_OP(LESS_EQUAL)
+    MICRO_OP(LOG)
+    MICRO_OP(LOGICAL_AND)
+    MICRO_OP(LOGICAL_NOT)
+    MICRO_OP(LOGICAL_OR)
+    MICRO_OP(LOGISTIC)
+    MICRO_OP(MAXIMUM)
+    MICRO_OP(MAX_POOL_2D)
+    MICRO_OP(MEAN)
+    MICRO_OP(MINIMUM)
+    MICRO_OP(MUL)
+    MICRO_OP(NEG)
+    MICRO_OP(NOT_EQUAL)
+    MICRO_OP(PACK)
+    MICRO_OP(PAD)
+    MICRO_OP(PADV2)
+    MICRO_OP(PRELU)
+    TFLITE_OP(QUANTIZE)
+    MICRO_OP(REDUCE_MAX)
+    MICRO_OP(RELU)
+    MICRO_OP(RELU6)
+    MICRO_OP(RESHAPE)
+    MICRO_OP(RESIZE_NEAREST_NEIGHBOR)
+    MICRO_OP(ROUND)
+    MICRO_OP(RSQRT)
+    TFLITE_OP(SHAPE)
+    MICRO_OP(SIN)
+    TFLITE_OP(SOFTMAX)
+    MICRO_OP(SPLIT)
+    MICRO_OP(SPLIT_V)
+    MICRO_OP(SQRT)
+    MICRO_OP(SQUARE)
+    MICRO_OP(STRIDED_SLICE)
+    MICRO_OP(SUB)
+    TFLITE_OP(SVDF)
+    MICRO_OP(TANH)
+    MICRO_OP(UNPACK)
+#undef MICRO_OP
+#undef TFLITE_OP
+    default:
+      return "";
+  }
+}
+
+std::string RegistrationExpression(const char* custom_name) {
+  if (strcmp(custom_name, "TFLite_Detection_PostProcess") == 0) {
+    return "*tflite::Register_DETECTION_POSTPROCESS()";
+  }
+  if (strcmp(custom_name, tflite::kBlockSparseFullyConnectedName) == 0) {
+    return "*tflite::Register_BLOCK_SPARSE_FULLY_CONNECTED()";
+  }
+  return "";
+}
+
+const char* TypeName(TfLiteType type) {
+  switch (type) {
+    case kTfLiteNoType:
+      return "kTfLiteNoType";
+    case kTfLiteFloat32:
+      return "kTfLiteFloat32";
+    case kTfLiteInt32:
+      return "kTfLiteInt32";
+    case kTfLiteUInt8:
+      return "kTfLiteUInt8";
+    case kTfLiteInt64:
+      return "kTfLiteInt64";
+    case kTfLiteString:
+      return "kTfLiteString";
+    case kTfLiteBool:
+      return "kTfLiteBool";
+    case kTfLiteInt16:
+      return "kTfLiteInt16";
+    case kTfLiteComplex64:
+      return "kTfLiteComplex64";
+    case kTfLiteInt8:
+      return "kTfLiteInt8";
+    case kTfLiteFloat16:
+      return "kTfLiteFloat16";
+    case kTfLiteFloat64:
+      return "kTfLiteFloat64";
+    default:
+      return nullptr;
+  }
+}
+
+const char* PaddingName(TfLitePadding padding) {
+  switch (padding) {
+    case kTfLitePaddingSame:
+      return "kTfLitePaddingSame";
+    case kTfLitePaddingValid:
+      return "kTfLitePaddingValid";
+    default:
+      return "kTfLitePaddingUnknown";
+  }
+}
+
+const char* ActivationName(TfLiteFusedActivation activation) {
+  switch (activation) {
+    case kTfLiteActRelu:
+      return "kTfLiteActRelu";
+    case kTfLiteActReluN1To1:
+      return "kTfLiteActReluN1To1";
+    case kTfLiteActRelu6:
+      return "kTfLiteActRelu6";
+    case kTfLiteActTanh:
+      return "kTfLiteActTanh";
+    case kTfLiteActSignBit:
+      return "kTfLiteActSignBit";
+    case kTfLiteActSigmoid:
+      return "kTfLiteActSigmoid";
+    default:
+      return "kTfLiteActNone";
+  }
+}
+
+const char* Bool(bool value) { return value ? "true" : "false"; }
+
+// Prints `value` so that it reads back as exactly the same float.
+std::string FloatLiteral(float value) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.9g", value);
+  std::string result = buffer;
+  if (result.find_first_of(".e") == std::string::npos) {
+    result += ".0";
+  }
+  if (result == "inf") return "INFINITY";
+  if (result == "-inf") return "-INFINITY";
+  return result + "f";
+}
+
+// Emits the initializer of the parameter struct of `op`, or returns false if
+// the tool does not know the struct.
+bool ParamsInitializer(tflite::BuiltinOperator op, const void* data,
+                       std::string* type, std::string* initializer) {
+  using tflite::BuiltinOperator;
+  switch (op) {
+    case tflite::BuiltinOperator_CONV_2D: {
+      auto* p = static_cast<const TfLiteConvParams*>(data);
+      *type = "TfLiteConvParams";
+      *initializer = Format(
+          "{%s, /*stride_width=*/%d, /*stride_height=*/%d, %s,\n"
+          "     /*dilation_width_factor=*/%d, /*dilation_height_factor=*/%d}",
+          PaddingName(p->padding), p->stride_width, p->stride_height,
+          ActivationName(p->activation), p->dilation_width_factor,
+          p->dilation_height_factor);
+      return true;
+    }
+    case tflite::BuiltinOperator_DEPTHWISE_CONV_2D: {
+      auto* p = static_cast<const TfLiteDepthwiseConvParams*>(data);
+      *type = "TfLiteDepthwiseConvParams";
+      *initializer = Format(
+          "{%s, /*stride_width=*/%d, /*stride_height=*/%d,\n"
+          "     /*depth_multiplier=*/%d, %s, /*dilation_width_factor=*/%d,\n"
+          "     /*dilation_height_factor=*/%d}",
+          PaddingName(p->padding), p->stride_width, p->stride_height,
+          p->depth_multiplier, ActivationName(p->activation),
+          p->dilation_width_factor, p->dilation_height_factor);
+      return true;
+    }
+    case tflite::BuiltinOperator_AVERAGE_POOL_2D:
+    case tflite::BuiltinOperator_MAX_POOL_2D: {
+      auto* p = static_cast<const TfLitePoolParams*>(data);
+      *type = "TfLitePoolParams";
+      *initializer = Format(
+          "{%s, /*stride_width=*/%d, /*stride_height=*/%d,\n"
+          "     /*filter_width=*/%d, /*filter_height=*/%d, %s, {}}",
+          PaddingName(p->padding), p->stride_width, p->stride_height,
+          p->filter_width, p->filter_height, ActivationName(p->activation));
+      return true;
+    }
+    case tflite::BuiltinOperator_FULLY_CONNECTED: {
+      auto* p = static_cast<const TfLiteFullyConnectedParams*>(data);
+      *type = "TfLiteFullyConnectedParams";
+      *initializer = Format(
+          "{%s,\n"
+          "     static_cast<TfLiteFullyConnectedWeightsFormat>(%d),\n"
+          "     /*keep_num_dims=*/%s, /*asymmetric_quantize_inputs=*/%s}",
+          ActivationName(p->activation), p->weights_format,
+          Bool(p->keep_num_dims), Bool(p->asymmetric_quantize_inputs));
+      return true;
+    }
+    case tflite::BuiltinOperator_SOFTMAX: {
+      auto* p = static_cast<const TfLiteSoftmaxParams*>(data);
+      *type = "TfLiteSoftmaxParams";
+      *initializer = Format("{/*beta=*/%s}", FloatLiteral(p->beta).c_str());
+      return true;
+    }
+    case tflite::BuiltinOperator_RESHAPE: {
+      auto* p = static_cast<const TfLiteReshapeParams*>(data);
+      *type = "TfLiteReshapeParams";
+      std::string shape;
+      for (int i = 0; i < p->num_dimensions; ++i) {
+        shape += Format(i == 0 ? "%d" : ", %d", p->shape[i]);
+      }
+      *initializer = Format("{{%s}, /*num_dimensions=*/%d}", shape.c_str(),
+                            p->num_dimensions);
+      return true;
+    }
+    case tflite::BuiltinOperator_SVDF: {
+      auto* p = static_cast<const TfLiteSVDFParams*>(data);
+      *type = "TfLiteSVDFParams";
+      *initializer =
+          Format("{/*rank=*/%d, %s, /*asymmetric_quantize_inputs=*/%s}",
+                 p->rank, ActivationName(p->activation),
+                 Bool(p->asymmetric_quantize_inputs));
+      return true;
+    }
+    case tflite::BuiltinOperator_ADD: {
+      auto* p = static_cast<const TfLiteAddParams*>(data);
+      *type = "TfLiteAddParams";
+      *initializer = Format("{%s, /*pot_scale_int16=*/%s}",
+                            ActivationName(p->activation),
+                            Bool(p->pot_scale_int16));
+      return true;
+    }
+    case tflite::BuiltinOperator_SUB: {
+      auto* p = static_cast<const TfLiteSubParams*>(data);
+      *type = "TfLiteSubParams";
+      *initializer = Format("{%s, /*pot_scale_int16=*/%s}",
+                            ActivationName(p->activation),
+                            Bool(p->pot_scale_int16));
+      return true;
+    }
+    case tflite::BuiltinOperator_MUL: {
+      auto* p = static_cast<const TfLiteMulParams*>(data);
+      *type = "TfLiteMulParams";
+      *initializer = Format("{%s}", ActivationName(p->activation));
+      return true;
+    }
+    case tflite::BuiltinOperator_L2_NORMALIZATION: {
+      auto* p = static_cast<const TfLiteL2NormParams*>(data);
+      *type = "TfLiteL2NormParams";
+      *initializer = Format("{%s}", ActivationName(p->activation));
+      return true;
+    }
+    case tflite::BuiltinOperator_CONCATENATION: {
+      auto* p = static_cast<const TfLiteConcatenationParams*>(data);
+      *type = "TfLiteConcatenationParams";
+      *initializer = Format("{/*axis=*/%d, %s}", p->axis,
+                            ActivationName(p->activation));
+      return true;
+    }
+    case tflite::BuiltinOperator_ARG_MAX:
+    case tflite::BuiltinOperator_ARG_MIN: {
+      // TfLiteArgMaxParams and TfLiteArgMinParams have the same layout.
+      auto* p = static_cast<const TfLiteArgMaxParams*>(data);
+      *type = op == tflite::BuiltinOperator_ARG_MAX ? "TfLiteArgMaxParams"
+                                                    : "TfLiteArgMinParams";
+      *initializer = Format("{%s}", TypeName(p->output_type));
+      return true;
+    }
+    case tflite::BuiltinOperator_SHAPE: {
+      auto* p = static_cast<const TfLiteShapeParams*>(data);
+      *type = "TfLiteShapeParams";
+      *initializer = Format("{%s}", TypeName(p->out_type));
+      return true;
+    }
+    case tflite::BuiltinOperator_PACK: {
+      auto* p = static_cast<const TfLitePackParams*>(data);
+      *type = "TfLitePackParams";
+      *initializer = Format("{/*values_count=*/%d, /*axis=*/%d}",
+                            p->values_count, p->axis);
+      return true;
+    }
+    case tflite::BuiltinOperator_UNPACK: {
+      auto* p = static_cast<const TfLiteUnpackParams*>(data);
+      *type = "TfLiteUnpackParams";
+      *initializer = Format("{/*num=*/%d, /*axis=*/%d}", p->num, p->axis);
+      return true;
+    }
+    case tflite::BuiltinOperator_SPLIT: {
+      auto* p = static_cast<const TfLiteSplitParams*>(data);
+      *type = "TfLiteSplitParams";
+      *initializer = Format("{/*num_splits=*/%d}", p->num_splits);
+      return true;
+    }
+    case tflite::BuiltinOperator_SPLIT_V: {
+      auto* p = static_cast<const TfLiteSplitVParams*>(data);
+      *type = "TfLiteSplitVParams";
+      *initializer = Format("{/*num_splits=*/%d}", p->num_splits);
+      return true;
+    }
+    case tflite::BuiltinOperator_STRIDED_SLICE: {
+      auto* p = static_cast<const TfLiteStridedSliceParams*>(data);
+      *type = "TfLiteStridedSliceParams";
+      *initializer = Format(
+          "{/*begin_mask=*/%d, /*end_mask=*/%d, /*ellipsis_mask=*/%d,\n"
+          "     /*new_axis_mask=*/%d, /*shrink_axis_mask=*/%d}",
+          p->begin_mask, p->end_mask, p->ellipsis_mask, p->new_axis_mask,
+          p->shrink_axis_mask);
+      return true;
+    }
+    case tflite::BuiltinOperator_MEAN:
+    case tflite::BuiltinOperator_REDUCE_MAX: {
+      auto* p = static_cast<const TfLiteReducerParams*>(data);
+      *type = "TfLiteReducerParams";
+      *initializer = Format("{/*keep_dims=*/%s}", Bool(p->keep_dims));
+      return true;
+    }
+    case tflite::BuiltinOperator_RESIZE_NEAREST_NEIGHBOR: {
+      auto* p = static_cast<const TfLiteResizeNearestNeighborParams*>(data);
+      *type = "TfLiteResizeNearestNeighborParams";
+      *initializer =
+          Format("{/*align_corners=*/%s, /*half_pixel_centers=*/%s}",
+                 Bool(p->align_corners), Bool(p->half_pixel_centers));
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+class MallocDataAllocator : public tflite::BuiltinDataAllocator {
+ public:
+  void* Allocate(size_t size, size_t alignment_hint) override {
+    return malloc(size);
+  }
+  void Deallocate(void* data) override { free(data); }
+};
+
+struct TensorInfo {
+  std::vector<int> dims;
+  TfLiteType type = kTfLiteNoType;
+  size_t bytes = 0;
+  // Offset of the data in the model, or -1 if the tensor is not constant.
+  int32_t constant_offset = -1;
+  bool is_variable = false;
+  std::vector<float> scales;
+  std::vector<int> zero_points;
+  int32_t quantized_dimension = 0;
+  // Host storage used while recording the kernels' requests.
+  std::vector<uint8_t> host_data;
+  int first_created = -1;
+  int last_used = -1;
+  int32_t arena_offset = -1;
+};
+
+struct OperatorInfo {
+  tflite::BuiltinOperator op = tflite::BuiltinOperator_CUSTOM;
+  const TfLiteRegistration* registration = nullptr;
+  std::string registration_expression;
+  std::vector<int> inputs;
+  std::vector<int> outputs;
+  void* builtin_data = nullptr;
+  int32_t custom_data_offset = -1;
+  int32_t custom_data_size = 0;
+  void* user_data = nullptr;
+};
+
+struct ScratchBufferInfo {
+  int operator_index;
+  size_t bytes;
+  int32_t arena_offset;
+  std::vector<uint8_t> host_data;
+};
+
+// Mirrors what StaticGraph provides to the kernels, backed by host memory,
+// and records what the kernels ask for.
+class Recorder {
+ public:
+  Recorder(std::vector<TensorInfo>* tensors,
+           tflite::ErrorReporter* error_reporter)
+      : tensors_(tensors), error_reporter_(error_reporter) {
+    context_.impl_ = this;
+    context_.tensors_size = tensors->size();
+    context_.ReportError = ReportOpError;
+    context_.GetTensor = GetTensor;
+    context_.GetEvalTensor = GetEvalTensor;
+    context_.recommended_num_threads = 1;
+    eval_tensors_.resize(tensors->size());
+    for (size_t i = 0; i < tensors->size(); ++i) {
+      TensorInfo& info = (*tensors)[i];
+      dims_.push_back(MakeIntArray(info.dims));
+      if (!info.scales.empty()) {
+        TfLiteAffineQuantization* quantization =
+            static_cast<TfLiteAffineQuantization*>(
+                calloc(1, sizeof(TfLiteAffineQuantization)));
+        quantization->scale = static_cast<TfLiteFloatArray*>(
+            calloc(1, sizeof(int) + info.scales.size() * sizeof(float)));
+        quantization->scale->size = info.scales.size();
+        std::copy(info.scales.begin(), info.scales.end(),
+                  quantization->scale->data);
+        quantization->zero_point = MakeIntArray(info.zero_points);
+        quantization->quantized_dimension = info.quantized_dimension;
+        quantizations_.push_back(quantization);
+      } else {
+        quantizations_.push_back(nullptr);
+      }
+    }
+  }
+
+  TfLiteContext* context() { return &context_; }
+  TfLiteEvalTensor* eval_tensors() { return eval_tensors_.data(); }
+  std::vector<ScratchBufferInfo>& scratch_buffers() { return scratch_buffers_; }
+  size_t persistent_bytes() const { return persistent_bytes_; }
+  int max_temp_tensors() const { return max_temp_tensors_; }
+
+  void SetStage(int operator_index, bool init, bool prepare) {
+    operator_index_ = operator_index;
+    temp_tensors_.clear();
+    context_.AllocatePersistentBuffer =
+        (init || prepare) ? AllocatePersistentBuffer : nullptr;
+    context_.RequestScratchBufferInArena =
+        prepare ? RequestScratchBufferInArena : nullptr;
+    context_.GetScratchBuffer = (init || prepare) ? nullptr : GetScratchBuffer;
+  }
+
+  static TfLiteIntArray* MakeIntArray(const std::vector<int>& values) {
+    TfLiteIntArray* array = static_cast<TfLiteIntArray*>(
+        calloc(1, sizeof(int) * (values.size() + 1)));
+    array->size = values.size();
+    std::copy(values.begin(), values.end(), array->data);
+    return array;
+  }
+
+ private:
+  static Recorder* Get(const TfLiteContext* context) {
+    return static_cast<Recorder*>(context->impl_);
+  }
+
+  static void* AllocatePersistentBuffer(TfLiteContext* context, size_t bytes) {
+    Recorder* recorder = Get(context);
+    recorder->persistent_bytes_ += tflite::AlignSizeUp(bytes, kBufferAlignment);
+    void* result = calloc(1, std::max<size_t>(bytes, 1));
+    recorder->allocations_.push_back(result);
+    return result;
+  }
+
+  static TfLiteStatus RequestScratchBufferInArena(TfLiteContext* context,
+                                                  size_t bytes,
+                                                  int* buffer_idx) {
+    Recorder* recorder = Get(context);
+    ScratchBufferInfo info;
+    info.operator_index = recorder->operator_index_;
+    info.bytes = bytes;
+    info.arena_offset = -1;
+    info.host_data.resize(std::max<size_t>(bytes, 1));
+    *buffer_idx = recorder->scratch_buffers_.size();
+    recorder->scratch_buffers_.push_back(std::move(info));
+    return kTfLiteOk;
+  }
+
+  static void* GetScratchBuffer(TfLiteContext* context, int buffer_idx) {
+    return Get(context)->scratch_buffers_[buffer_idx].host_data.data();
+  }
+
+  static void ReportOpError(struct TfLiteContext* context, const char* format,
+                            ...) {
+    va_list args;
+    va_start(args, format);
+    Get(context)->error_reporter_->Report(format, args);
+    va_end(args);
+  }
+
+  static TfLiteTensor* GetTensor(const struct TfLiteContext* context,
+                                 int tensor_idx) {
+    Recorder* recorder = Get(context);
+    const TensorInfo& info = (*recorder->tensors_)[tensor_idx];
+    const TfLiteEvalTensor& eval_tensor = recorder->eval_tensors_[tensor_idx];
+    TfLiteTensor* result =
+        static_cast<TfLiteTensor*>(calloc(1, sizeof(TfLiteTensor)));
+    recorder->allocations_.push_back(result);
+    recorder->temp_tensors_.push_back(result);
+    recorder->max_temp_tensors_ = std::max(
+        recorder->max_temp_tensors_,
+        static_cast<int>(recorder->temp_tensors_.size()));
+    result->data = eval_tensor.data;
+    result->dims = eval_tensor.dims;
+    result->type = eval_tensor.type;
+    result->bytes = info.bytes;
+    result->is_variable = info.is_variable;
+    result->allocation_type =
+        info.constant_offset >= 0 ? kTfLiteMmapRo : kTfLiteArenaRw;
+    TfLiteAffineQuantization* quantization =
+        recorder->quantizations_[tensor_idx];
+    if (quantization != nullptr) {
+      result->quantization.type = kTfLiteAffineQuantization;
+      result->quantization.params = quantization;
+      result->params.scale = quantization->scale->data[0];
+      result->params.zero_point = quantization->zero_point->data[0];
+    }
+    return result;
+  }
+
+  static TfLiteEvalTensor* GetEvalTensor(const struct TfLiteContext* context,
+                                         int tensor_idx) {
+    return &Get(context)->eval_tensors_[tensor_idx];
+  }
+
+ public:
+  // Points the eval tensors at the model data or at host buffers.
+  void BindTensors(const uint8_t* model_data) {
+    for (size_t i = 0; i < tensors_->size(); ++i) {
+      TensorInfo& info = (*tensors_)[i];
+      TfLiteEvalTensor* eval_tensor = &eval_tensors_[i];
+      if (info.constant_offset >= 0) {
+        eval_tensor->data.data =
+            const_cast<uint8_t*>(model_data + info.constant_offset);
+      } else if (info.bytes > 0) {
+        info.host_data.assign(info.bytes, 0);
+        eval_tensor->data.data = info.host_data.data();
+      } else {
+        eval_tensor->data.data = nullptr;
+      }
+      eval_tensor->dims = dims_[i];
+      eval_tensor->type = info.type;
+    }
+  }
+
+ private:
+  std::vector<TensorInfo>* tensors_;
+  tflite::ErrorReporter* error_reporter_;
+  TfLiteContext context_ = {};
+  std::vector<TfLiteEvalTensor> eval_tensors_;
+  std::vector<TfLiteIntArray*> dims_;
+  std::vector<TfLiteAffineQuantization*> quantizations_;
+  std::vector<ScratchBufferInfo> scratch_buffers_;
+  std::vector<void*> allocations_;
+  std::vector<TfLiteTensor*> temp_tensors_;
+  int operator_index_ = 0;
+  size_t persistent_bytes_ = 0;
+  int max_temp_tensors_ = 0;
+};
+
+// Deduplicates the constant arrays and structs of the generated file.
+class ConstantPool {
+ public:
+  std::string Add(const std::string& type, const std::string& initializer,
+                  const char* prefix) {
+    const std::string key = type + "=" + initializer;
+    auto it = names_.find(key);
+    if (it != names_.end()) {
+      return it->second;
+    }
+    const std::string name = Format("k%s%d", prefix, counts_[prefix]++);
+    names_[key] = name;
+    definitions_ += "const " + type + " " + name + " = " + initializer + ";\n";
+    return name;
+  }
+
+  std::string IntArray(const std::vector<int>& values) {
+    std::string initializer = Format("{%d, {", static_cast<int>(values.size()));
+    for (size_t i = 0; i < values.size(); ++i) {
+      initializer += Format(i == 0 ? "%d" : ", %d", values[i]);
+    }
+    initializer += "}}";
+    return Add(Format("tflite::StaticIntArray<%d>",
+                      std::max<int>(values.size(), 1)),
+               initializer, "IntArray");
+  }
+
+  std::string FloatArray(const std::vector<float>& values) {
+    std::string initializer = Format("{%d, {", static_cast<int>(values.size()));
+    for (size_t i = 0; i < values.size(); ++i) {
+      initializer += (i == 0 ? "" : ", ") + FloatLiteral(values[i]);
+    }
+    initializer += "}}";
+    return Add(Format("tflite::StaticFloatArray<%d>",
+                      std::max<int>(values.size(), 1)),
+               initializer, "FloatArray");
+  }
+
+  const std::string& definitions() const { return definitions_; }
+
+ private:
+  std::map<std::string, std::string> names_;
+  std::map<std::string, int> counts_;
+  std::string definitions_;
+};
+
+std::string IncludeGuard(const std::string& include_path) {
+  std::string guard;
+  for (char c : include_path) {
+    guard += std::isalnum(static_cast<unsigned char>(c))
+                 ? static_cast<char>(std::toupper(static_cast<unsigned char>(c)))
+                 : '_';
+  }
+  return guard + "_";
+}
+
+std::string IncludePath(const std::string& out_prefix) {
+  const std::string src = "src/";
+  size_t pos = out_prefix.rfind(src);
+  if (pos == 0 || (pos != std::string::npos && out_prefix[pos - 1] == '/')) {
+    return out_prefix.substr(pos + src.size()) + ".h";
+  }
+  return out_prefix + ".h";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 7) {
+    fprintf(stderr,
+            "Usage: %s <in.tflite> <model_header> <model_array> "
+            "<model_length> <out_prefix> <class_name>\n",
+            argv[0]);
+    return 1;
+  }
+  const char* model_header = argv[2];
+  const char* model_array = argv[3];
+  const char* model_length = argv[4];
+  const std::string out_prefix = argv[5];
+  const char* class_name = argv[6];
+
+  std::vector<uint8_t> model_data;
+  if (!ReadFile(argv[1], &model_data)) {
+    fprintf(stderr, "Couldn't read %s\n", argv[1]);
+    return 1;
+  }
+  flatbuffers::Verifier verifier(model_data.data(), model_data.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid model\n", argv[1]);
+    return 1;
+  }
+  const tflite::Model* model = tflite::GetModel(model_data.data());
+  if (model->subgraphs()->size() != 1) {
+    fprintf(stderr, "Only 1 subgraph is currently supported.\n");
+    return 1;
+  }
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+
+  tflite::MicroErrorReporter micro_error_reporter;
+  tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+  tflite::AllOpsResolver resolver;
+  MallocDataAllocator builtin_data_allocator;
+
+  // Tensors.
+  std::vector<TensorInfo> tensors(subgraph->tensors()->size());
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    const tflite::Tensor* tensor = subgraph->tensors()->Get(i);
+    TensorInfo& info = tensors[i];
+    if (tensor->shape() != nullptr) {
+      info.dims.assign(tensor->shape()->begin(), tensor->shape()->end());
+    }
+    if (tflite::ConvertTensorType(tensor->type(), &info.type,
+                                  error_reporter) != kTfLiteOk ||
+        TypeName(info.type) == nullptr) {
+      fprintf(stderr, "Tensor %zu has an unsupported type\n", i);
+      return 1;
+    }
+    size_t type_size;
+    if (tflite::BytesRequiredForTensor(*tensor, &info.bytes, &type_size,
+                                       error_reporter) != kTfLiteOk) {
+      return 1;
+    }
+    info.is_variable = tensor->is_variable();
+    const tflite::Buffer* buffer = model->buffers()->Get(tensor->buffer());
+    if (buffer != nullptr && buffer->data() != nullptr &&
+        buffer->data()->size() > 0) {
+      info.constant_offset = buffer->data()->data() - model_data.data();
+    }
+    const tflite::QuantizationParameters* quantization =
+        tensor->quantization();
+    if (quantization != nullptr && quantization->scale() != nullptr &&
+        quantization->scale()->size() > 0 &&
+        quantization->zero_point() != nullptr &&
+        quantization->zero_point()->size() > 0) {
+      info.scales.assign(quantization->scale()->begin(),
+                         quantization->scale()->end());
+      for (int64_t zero_point : *quantization->zero_point()) {
+        info.zero_points.push_back(static_cast<int>(zero_point));
+      }
+      info.quantized_dimension = quantization->quantized_dimension();
+    }
+  }
+
+  // Operators.
+  std::vector<OperatorInfo> operators(subgraph->operators()->size());
+  for (size_t i = 0; i < operators.size(); ++i) {
+    const tflite::Operator* op = subgraph->operators()->Get(i);
+    OperatorInfo& info = operators[i];
+    const tflite::OperatorCode* opcode =
+        model->operator_codes()->Get(op->opcode_index());
+    if (tflite::GetRegistrationFromOpCode(opcode, resolver, error_reporter,
+                                          &info.registration) != kTfLiteOk) {
+      return 1;
+    }
+    info.op = tflite::GetBuiltinCode(opcode);
+    info.inputs.assign(op->inputs()->begin(), op->inputs()->end());
+    info.outputs.assign(op->outputs()->begin(), op->outputs()->end());
+    if (info.op == tflite::BuiltinOperator_CUSTOM) {
+      info.registration_expression =
+          RegistrationExpression(opcode->custom_code()->c_str());
+      if (op->custom_options() != nullptr) {
+        info.custom_data_offset =
+            op->custom_options()->data() - model_data.data();
+        info.custom_data_size = op->custom_options()->size();
+      } else {
+        info.custom_data_offset = 0;
+      }
+    } else {
+      info.registration_expression = RegistrationExpression(info.op);
+      tflite::MicroOpResolver::BuiltinParseFunction parser =
+          resolver.GetOpDataParser(info.op);
+      if (parser == nullptr ||
+          parser(op, error_reporter, &builtin_data_allocator,
+                 &info.builtin_data) != kTfLiteOk) {
+        fprintf(stderr, "Couldn't parse the parameters of operator %zu\n", i);
+        return 1;
+      }
+    }
+    if (info.registration_expression.empty()) {
+      fprintf(stderr, "Operator %zu (%s) is not supported\n", i,
+              info.op == tflite::BuiltinOperator_CUSTOM
+                  ? opcode->custom_code()->c_str()
+                  : tflite::EnumNameBuiltinOperator(info.op));
+      return 1;
+    }
+  }
+
+  // Run the kernels once, as StaticGraph will, to record their requests.
+  Recorder recorder(&tensors, error_reporter);
+  recorder.BindTensors(model_data.data());
+  TfLiteContext* context = recorder.context();
+  for (size_t i = 0; i < operators.size(); ++i) {
+    OperatorInfo& info = operators[i];
+    recorder.SetStage(i, /*init=*/true, /*prepare=*/false);
+    const char* init_data;
+    size_t init_data_size = 0;
+    if (info.custom_data_offset >= 0) {
+      init_data = reinterpret_cast<const char*>(model_data.data() +
+                                                info.custom_data_offset);
+      init_data_size = info.custom_data_size;
+    } else {
+      init_data = static_cast<const char*>(info.builtin_data);
+    }
+    if (info.registration->init) {
+      info.user_data =
+          info.registration->init(context, init_data, init_data_size);
+    }
+  }
+  std::vector<TfLiteNode> nodes(operators.size());
+  for (size_t i = 0; i < operators.size(); ++i) {
+    OperatorInfo& info = operators[i];
+    TfLiteNode& node = nodes[i];
+    node.inputs = Recorder::MakeIntArray(info.inputs);
+    node.outputs = Recorder::MakeIntArray(info.outputs);
+    node.user_data = info.user_data;
+    node.builtin_data = info.builtin_data;
+    if (info.custom_data_offset >= 0) {
+      node.custom_initial_data = model_data.data() + info.custom_data_offset;
+      node.custom_initial_data_size = info.custom_data_size;
+    }
+  }
+  for (size_t i = 0; i < operators.size(); ++i) {
+    recorder.SetStage(i, /*init=*/false, /*prepare=*/true);
+    if (operators[i].registration->prepare &&
+        operators[i].registration->prepare(context, &nodes[i]) != kTfLiteOk) {
+      fprintf(stderr, "Operator %zu failed to prepare\n", i);
+      return 1;
+    }
+  }
+  for (size_t i = 0; i < operators.size(); ++i) {
+    recorder.SetStage(i, /*init=*/false, /*prepare=*/false);
+    if (operators[i].registration->invoke &&
+        operators[i].registration->invoke(context, &nodes[i]) != kTfLiteOk) {
+      fprintf(stderr, "Operator %zu failed to invoke\n", i);
+      return 1;
+    }
+  }
+  std::vector<ScratchBufferInfo>& scratch_buffers = recorder.scratch_buffers();
+
+  // Tensor lifetimes, as computed by MicroAllocator.
+  const int last_operator = static_cast<int>(operators.size()) - 1;
+  for (int32_t tensor_index : *subgraph->inputs()) {
+    tensors[tensor_index].first_created = 0;
+  }
+  for (int32_t tensor_index : *subgraph->outputs()) {
+    tensors[tensor_index].last_used = last_operator;
+  }
+  for (int i = last_operator; i >= 0; --i) {
+    for (int tensor_index : operators[i].inputs) {
+      if (tensor_index < 0) continue;
+      TensorInfo& info = tensors[tensor_index];
+      if (info.last_used == -1 || info.last_used < i) {
+        info.last_used = i;
+      }
+    }
+    for (int tensor_index : operators[i].outputs) {
+      TensorInfo& info = tensors[tensor_index];
+      if (info.first_created == -1 || info.first_created > i) {
+        info.first_created = i;
+      }
+    }
+  }
+
+  // Plan the arena: tensors and scratch buffers, then the variables.
+  std::vector<int*> planned_offsets;
+  const size_t planned_count = tensors.size() + scratch_buffers.size();
+  std::vector<unsigned char> planner_scratch(
+      planned_count * tflite::GreedyMemoryPlanner::per_buffer_size());
+  tflite::GreedyMemoryPlanner planner(planner_scratch.data(),
+                                      planner_scratch.size());
+  for (TensorInfo& info : tensors) {
+    if (info.constant_offset >= 0 || info.is_variable || info.bytes == 0) {
+      continue;
+    }
+    // Like MicroAllocator, give no memory to tensors no operator touches,
+    // such as a dense filter replaced by its block sparse encoding.
+    if (info.first_created == -1 && info.last_used == -1) {
+      continue;
+    }
+    if (info.first_created == -1 || info.last_used == -1) {
+      fprintf(stderr, "Tensor has an invalid lifetime\n");
+      return 1;
+    }
+    if (planner.AddBuffer(error_reporter,
+                          tflite::AlignSizeUp(info.bytes, kBufferAlignment),
+                          info.first_created, info.last_used) != kTfLiteOk) {
+      return 1;
+    }
+    planned_offsets.push_back(&info.arena_offset);
+  }
+  for (ScratchBufferInfo& info : scratch_buffers) {
+    if (planner.AddBuffer(error_reporter,
+                          tflite::AlignSizeUp(info.bytes, kBufferAlignment),
+                          info.operator_index,
+                          info.operator_index) != kTfLiteOk) {
+      return 1;
+    }
+    planned_offsets.push_back(&info.arena_offset);
+  }
+  for (size_t i = 0; i < planned_offsets.size(); ++i) {
+    int offset;
+    if (planner.GetOffsetForBuffer(error_reporter, i, &offset) != kTfLiteOk) {
+      return 1;
+    }
+    *planned_offsets[i] = offset;
+  }
+  size_t planned_bytes =
+      tflite::AlignSizeUp(planner.GetMaximumMemorySize(), kBufferAlignment);
+  for (TensorInfo& info : tensors) {
+    if (info.is_variable) {
+      info.arena_offset = planned_bytes;
+      planned_bytes += tflite::AlignSizeUp(info.bytes, kBufferAlignment);
+    }
+  }
+
+  // Header.
+  const std::string include_path = IncludePath(out_prefix);
+  const std::string guard = IncludeGuard(include_path);
+  const std::string banner = Format(
+      "// Generated by tensorflow/lite/micro/tools/generate_static_graph from "
+      "the model in\n// %s.\n// Regenerate it whenever the model "
+      "changes.\n\n",
+      model_header);
+  std::string header = banner;
+  header += "#ifndef " + guard + "\n#define " + guard + "\n\n";
+  header +=
+      "#include <cstddef>\n#include <cstdint>\n\n"
+      "#include \"tensorflow/lite/c/common.h\"\n"
+      "#include \"tensorflow/lite/core/api/error_reporter.h\"\n"
+      "#include \"tensorflow/lite/micro/static_graph.h\"\n\n";
+  header += Format("class %s : public tflite::StaticGraph {\n public:\n",
+                   class_name);
+  header += Format(
+      "  // Planned tensors and scratch buffers, the TfLiteTensor structs "
+      "handed to\n"
+      "  // kernels and the kernels' persistent buffers. The last term was "
+      "measured\n"
+      "  // on a 64-bit host, so it is an upper bound on the device.\n"
+      "  static constexpr size_t kArenaSize =\n"
+      "      kArenaAlignment + %zu + %d * sizeof(TfLiteTensor) + %zu;\n\n",
+      planned_bytes, recorder.max_temp_tensors(),
+      recorder.persistent_bytes() + kBufferAlignment);
+  header += Format(
+      "  %s(uint8_t* arena, size_t arena_size,\n"
+      "  %*s tflite::ErrorReporter* error_reporter);\n\n",
+      class_name, static_cast<int>(strlen(class_name)), "");
+  header += Format(
+      " private:\n"
+      "  TfLiteEvalTensor eval_tensors_[%zu];\n"
+      "  void* user_data_[%zu];\n"
+      "};\n\n",
+      tensors.size(), operators.size());
+  header += "#endif  // " + guard + "\n";
+
+  // Source.
+  ConstantPool pool;
+  std::map<std::string, std::string> registrations;
+  std::string registration_definitions;
+  for (const OperatorInfo& info : operators) {
+    if (registrations.count(info.registration_expression)) continue;
+    std::string name = "kRegistration";
+    if (info.op == tflite::BuiltinOperator_CUSTOM) {
+      name += Format("Custom%zu", registrations.size());
+    } else {
+      // CONV_2D -> Conv2D.
+      bool upper = true;
+      for (const char* c = tflite::EnumNameBuiltinOperator(info.op); *c; ++c) {
+        if (*c == '_') {
+          upper = true;
+          continue;
+        }
+        name += upper ? *c : static_cast<char>(std::tolower(*c));
+        upper = false;
+      }
+    }
+    registrations[info.registration_expression] = name;
+    registration_definitions += "const TfLiteRegistration " + name +
+                                " =\n    " + info.registration_expression +
+                                ";\n";
+  }
+
+  std::string tensor_table = "const tflite::StaticTensor kTensors[] = {\n";
+  for (const TensorInfo& info : tensors) {
+    std::string quantization = "nullptr";
+    if (!info.scales.empty()) {
+      quantization =
+          "&" + pool.Add("tflite::StaticAffineQuantization",
+                         Format("{&%s, &%s, %d}",
+                                pool.FloatArray(info.scales).c_str(),
+                                pool.IntArray(info.zero_points).c_str(),
+                                info.quantized_dimension),
+                         "Quantization");
+    }
+    const char* location;
+    int32_t offset = 0;
+    if (info.constant_offset >= 0) {
+      location = "tflite::kStaticTensorConstant";
+      offset = info.constant_offset;
+    } else if (info.is_variable) {
+      location = "tflite::kStaticTensorVariable";
+      offset = info.arena_offset;
+    } else if (info.arena_offset >= 0) {
+      location = "tflite::kStaticTensorArena";
+      offset = info.arena_offset;
+    } else {
+      location = "tflite::kStaticTensorNone";
+    }
+    tensor_table +=
+        Format("    {&%s, %s, %d, %zu, %s,\n     %s},\n",
+               pool.IntArray(info.dims).c_str(), quantization.c_str(), offset,
+               info.bytes, TypeName(info.type), location);
+  }
+  tensor_table += "};\n";
+
+  std::string operator_table =
+      "const tflite::StaticOperator kOperators[] = {\n";
+  for (size_t i = 0; i < operators.size(); ++i) {
+    const OperatorInfo& info = operators[i];
+    std::string params = "nullptr";
+    if (info.builtin_data != nullptr) {
+      std::string type, initializer;
+      if (!ParamsInitializer(info.op, info.builtin_data, &type,
+                             &initializer)) {
+        fprintf(stderr, "Parameters of operator %zu (%s) are not supported\n",
+                i, tflite::EnumNameBuiltinOperator(info.op));
+        return 1;
+      }
+      params = "&" + pool.Add(type, initializer, "Params");
+    }
+    const std::string inputs = pool.IntArray(info.inputs);
+    const std::string outputs = pool.IntArray(info.outputs);
+    operator_table += Format(
+        "    {&%s, &%s, &%s, %s, %d, %d},\n",
+        registrations[info.registration_expression].c_str(), inputs.c_str(),
+        outputs.c_str(), params.c_str(), info.custom_data_offset,
+        info.custom_data_size);
+  }
+  operator_table += "};\n";
+
+  std::vector<int> graph_inputs(subgraph->inputs()->begin(),
+                                subgraph->inputs()->end());
+  std::vector<int> graph_outputs(subgraph->outputs()->begin(),
+                                 subgraph->outputs()->end());
+  const std::string inputs = pool.IntArray(graph_inputs);
+  const std::string outputs = pool.IntArray(graph_outputs);
+
+  std::string scratch_tables;
+  if (!scratch_buffers.empty()) {
+    std::string offsets, sizes;
+    for (size_t i = 0; i < scratch_buffers.size(); ++i) {
+      offsets += Format(i == 0 ? "%d" : ", %d", scratch_buffers[i].arena_offset);
+      sizes += Format(i == 0 ? "%d" : ", %d",
+                      static_cast<int>(scratch_buffers[i].bytes));
+    }
+    scratch_tables =
+        "const int32_t kScratchBufferOffsets[] = {" + offsets + "};\n" +
+        "const int32_t kScratchBufferSizes[] = {" + sizes + "};\n";
+  }
+
+  std::string source = banner;
+  source += "#include \"" + include_path + "\"\n\n";
+  source += Format("#include \"%s\"\n", model_header);
+  source +=
+      "#include \"tensorflow/lite/c/builtin_op_data.h\"\n"
+      "#include \"tensorflow/lite/c/common.h\"\n";
+  if (registrations.count(
+          RegistrationExpression(tflite::kBlockSparseFullyConnectedName))) {
+    source +=
+        "#include "
+        "\"tensorflow/lite/micro/kernels/block_sparse_fully_connected.h\"\n";
+  }
+  source +=
+      "#include \"tensorflow/lite/micro/kernels/fully_connected.h\"\n"
+      "#include \"tensorflow/lite/micro/kernels/micro_ops.h\"\n"
+      "#include \"tensorflow/lite/micro/static_graph.h\"\n\n";
+  if (registrations.count(
+          RegistrationExpression("TFLite_Detection_PostProcess"))) {
+    source += "namespace tflite {\nTfLiteRegistration* "
+              "Register_DETECTION_POSTPROCESS();\n}  // namespace tflite\n\n";
+  }
+  source += "namespace {\n\n";
+  source += registration_definitions + "\n";
+  source += pool.definitions() + "\n";
+  source += tensor_table + "\n";
+  source += operator_table + "\n";
+  if (!scratch_tables.empty()) {
+    source += scratch_tables + "\n";
+  }
+  source += Format(
+      "const tflite::StaticGraphPlan kPlan = {\n"
+      "    kTensors, %zu, kOperators, %zu, &%s, &%s,\n"
+      "    %s, %s, %zu,\n"
+      "    /*planned_bytes=*/%zu, /*max_temp_tensors=*/%d,\n"
+      "    /*model_size=*/%zu};\n\n",
+      tensors.size(), operators.size(), inputs.c_str(), outputs.c_str(),
+      scratch_tables.empty() ? "nullptr" : "kScratchBufferOffsets",
+      scratch_tables.empty() ? "nullptr" : "kScratchBufferSizes",
+      scratch_buffers.size(), planned_bytes, recorder.max_temp_tensors(),
+      model_data.size());
+  source += "}  // namespace\n\n";
+  source += Format(
+      "%s::%s(uint8_t* arena, size_t arena_size,\n"
+      "%*s tflite::ErrorReporter* error_reporter)\n"
+      "    : tflite::StaticGraph(kPlan, %s,\n"
+      "                          %s, eval_tensors_,\n"
+      "                          user_data_, arena, arena_size, "
+      "error_reporter) {}\n",
+      class_name, class_name, static_cast<int>(2 * strlen(class_name) + 2),
+      "", model_array, model_length);
+
+  if (!WriteFile(out_prefix + ".h", header) ||
+      !WriteFile(out_prefix + ".cpp", source)) {
+    fprintf(stderr, "Couldn't write %s.h/.cpp\n", out_prefix.c_str());
+    return 1;
+  }
+  printf(
+      "%s: %zu tensors, %zu operators, %zu scratch buffers, %zu planned "
+      "bytes, %zu persistent bytes\n",
+      class_name, tensors.size(), operators.size(), scratch_buffers.size(),
+      planned_bytes, recorder.persistent_bytes());
+  return 0;
+}
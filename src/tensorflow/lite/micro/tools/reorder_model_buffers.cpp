@@ -0,0 +1,209 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool that rewrites a .tflite model so that its constant buffers are
+// laid out in flash in the order the interpreter first reads them. When the
+// model is executed in place from QSPI flash, weights are then streamed
+// through the XIP cache (or copied by WeightPrefetcher) sequentially instead
+// of jumping around the image, which keeps the flash in burst mode and avoids
+// evicting code that is still needed.
+//
+// The tool is not part of the firmware build. Build it on the host with:
+//
+//   g++ -std=c++11 -O2 -Isrc -Isrc/third_party/flatbuffers/include
+//     src/tensorflow/lite/micro/tools/reorder_model_buffers.cpp
+//     -o reorder_model_buffers
+//
+// Usage:
+//
+//   reorder_model_buffers <in.tflite> <out.tflite> [<out.cpp> <array_name>]
+//
+// The optional C++ output follows the layout of the bundled model data files,
+// with the array aligned to 16 bytes so that DMA can copy weights in words.
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+bool ReadFile(const char* path, std::vector<uint8_t>* contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  contents->assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+  return true;
+}
+
+bool WriteFile(const char* path, const uint8_t* data, size_t size) {
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(data), size);
+  return static_cast<bool>(file);
+}
+
+bool WriteCSource(const char* path, const std::string& name,
+                  const uint8_t* data, size_t size) {
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file,
+          "// This is a TensorFlow Lite model file whose constant buffers have "
+          "been\n// reordered into execution order by "
+          "reorder_model_buffers.\n\n");
+  fprintf(file, "extern const unsigned char %s[];\n", name.c_str());
+  fprintf(file, "extern const int %s_len;\n\n", name.c_str());
+  fprintf(file,
+          "// Keep model aligned to 16 bytes so that weights can be copied "
+          "with\n// word-sized DMA transfers.\n");
+  fprintf(file, "alignas(16) const unsigned char %s[] = {", name.c_str());
+  for (size_t i = 0; i < size; ++i) {
+    fprintf(file, "%s0x%02x,", (i % 12) == 0 ? "\n    " : " ", data[i]);
+  }
+  fprintf(file, "\n};\nconst int %s_len = %zu;\n", name.c_str(), size);
+  return fclose(file) == 0;
+}
+
+bool HasData(const tflite::ModelT& model, int buffer_index) {
+  return buffer_index > 0 &&
+         buffer_index < static_cast<int>(model.buffers.size()) &&
+         !model.buffers[buffer_index]->data.empty();
+}
+
+// Returns the constant buffer indices of `model` in the order the operators of
+// every subgraph first read them.
+std::vector<int> BuffersInExecutionOrder(const tflite::ModelT& model) {
+  std::vector<bool> seen(model.buffers.size(), false);
+  std::vector<int> order;
+  for (const auto& subgraph : model.subgraphs) {
+    for (const auto& op : subgraph->operators) {
+      for (int tensor_index : op->inputs) {
+        if (tensor_index < 0) {
+          continue;
+        }
+        const int buffer_index = subgraph->tensors[tensor_index]->buffer;
+        if (HasData(model, buffer_index) && !seen[buffer_index]) {
+          seen[buffer_index] = true;
+          order.push_back(buffer_index);
+        }
+      }
+    }
+  }
+  return order;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3 && argc != 5) {
+    fprintf(stderr,
+            "Usage: %s <in.tflite> <out.tflite> [<out.cpp> <array_name>]\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::vector<uint8_t> input;
+  if (!ReadFile(argv[1], &input)) {
+    fprintf(stderr, "Failed to read %s\n", argv[1]);
+    return 1;
+  }
+  flatbuffers::Verifier verifier(input.data(), input.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid TensorFlow Lite model\n", argv[1]);
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(input.data());
+
+  // FlatBufferBuilder serializes back to front, so buffer N ends up at a
+  // lower address than buffer N - 1. Give the first weights read the highest
+  // indices to make their addresses ascend in execution order. Buffer 0 is the
+  // conventional empty sentinel and stays in place; buffers that are never
+  // read by an operator keep their relative order in between.
+  const std::vector<int> execution_order = BuffersInExecutionOrder(*model);
+  std::vector<bool> is_weight(model->buffers.size(), false);
+  for (int buffer_index : execution_order) {
+    is_weight[buffer_index] = true;
+  }
+  std::vector<int> new_order;
+  new_order.push_back(0);
+  for (size_t i = 1; i < model->buffers.size(); ++i) {
+    if (!is_weight[i]) {
+      new_order.push_back(i);
+    }
+  }
+  new_order.insert(new_order.end(), execution_order.rbegin(),
+                   execution_order.rend());
+
+  std::vector<int> remap(model->buffers.size());
+  std::vector<std::unique_ptr<tflite::BufferT>> buffers(model->buffers.size());
+  for (size_t i = 0; i < new_order.size(); ++i) {
+    remap[new_order[i]] = i;
+    buffers[i] = std::move(model->buffers[new_order[i]]);
+  }
+  model->buffers = std::move(buffers);
+  for (auto& subgraph : model->subgraphs) {
+    for (auto& tensor : subgraph->tensors) {
+      tensor->buffer = remap[tensor->buffer];
+    }
+  }
+  for (auto& metadata : model->metadata) {
+    metadata->buffer = remap[metadata->buffer];
+  }
+  for (int& buffer_index : model->metadata_buffer) {
+    buffer_index = remap[buffer_index];
+  }
+
+  flatbuffers::FlatBufferBuilder builder;
+  tflite::FinishModelBuffer(builder,
+                            tflite::Model::Pack(builder, model.get()));
+  const uint8_t* output = builder.GetBufferPointer();
+  const size_t output_size = builder.GetSize();
+
+  // Report how sequential the weight stream is in the rewritten model.
+  const tflite::Model* packed = tflite::GetModel(output);
+  const uint8_t* previous_end = nullptr;
+  size_t weight_bytes = 0;
+  size_t backward_jumps = 0;
+  for (auto it = execution_order.begin(); it != execution_order.end(); ++it) {
+    const flatbuffers::Vector<uint8_t>* data =
+        packed->buffers()->Get(remap[*it])->data();
+    if (previous_end != nullptr && data->data() < previous_end) {
+      ++backward_jumps;
+    }
+    previous_end = data->data() + data->size();
+    weight_bytes += data->size();
+  }
+  printf("%zu constant buffers, %zu bytes of weights, %zu backward jumps\n",
+         execution_order.size(), weight_bytes, backward_jumps);
+
+  if (!WriteFile(argv[2], output, output_size)) {
+    fprintf(stderr, "Failed to write %s\n", argv[2]);
+    return 1;
+  }
+  if (argc == 5 && !WriteCSource(argv[3], argv[4], output, output_size)) {
+    fprintf(stderr, "Failed to write %s\n", argv[3]);
+    return 1;
+  }
+  return 0;
+}
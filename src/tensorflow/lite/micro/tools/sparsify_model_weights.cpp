@@ -0,0 +1,396 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Host tool that rewrites the pruned FULLY_CONNECTED and pointwise CONV_2D
+// operators of a .tflite model into BLOCK_SPARSE_FULLY_CONNECTED custom
+// operators (kernels/block_sparse_fully_connected.h). Only the filter blocks
+// holding a nonzero weight are kept, so a model pruned in blocks along the
+// input depth gets smaller in flash and skips the MACs of the zero blocks.
+// The outputs are bit-exact with the dense operators.
+//
+// An operator is rewritten when it has int8 activations, a constant int8
+// filter with zero points of 0 and an optional constant int32 bias, when a
+// CONV_2D filter is 1x1 with strides of 1, and when at least
+// <min_zero_fraction> of its filter blocks are zero. The input zero point is
+// folded into the new bias here, which keeps that work off the device. The
+// dense filter and bias buffers are emptied when no other operator reads
+// them; their tensors stay in the model, unused, and get no arena space.
+//
+// The tool is not part of the firmware build. Build it on the host with:
+//
+//   g++ -std=c++17 -O2 -Isrc -Isrc/third_party/flatbuffers/include
+//     src/tensorflow/lite/micro/tools/sparsify_model_weights.cpp
+//     src/tensorflow/lite/schema/schema_utils.cpp -o sparsify_model_weights
+//
+// Usage:
+//
+//   sparsify_model_weights <in.tflite> <out.tflite> [<block_size>
+//     [<min_zero_fraction>]]
+//
+// block_size defaults to 8 and min_zero_fraction to 0.5. Run
+// reorder_model_buffers on the result to lay out the weights for flash and to
+// write the C++ model array. The firmware resolver needs
+// AddBlockSparseFullyConnected().
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "flatbuffers/flexbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/micro/kernels/block_sparse_fully_connected.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace {
+
+bool ReadFile(const char* path, std::vector<uint8_t>* contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  contents->assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+  return true;
+}
+
+bool WriteFile(const char* path, const uint8_t* data, size_t size) {
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(data), size);
+  return static_cast<bool>(file);
+}
+
+const std::vector<uint8_t>* ConstantData(const tflite::ModelT& model,
+                                         const tflite::TensorT& tensor) {
+  if (tensor.buffer == 0 || tensor.buffer >= model.buffers.size() ||
+      model.buffers[tensor.buffer]->data.empty()) {
+    return nullptr;
+  }
+  return &model.buffers[tensor.buffer]->data;
+}
+
+bool IsInt8Activation(const tflite::TensorT& tensor) {
+  return tensor.type == tflite::TensorType_INT8 && tensor.quantization &&
+         tensor.quantization->scale.size() == 1 &&
+         tensor.quantization->zero_point.size() == 1;
+}
+
+// The activations the custom operator can clamp to. The custom option stores
+// the matching TfLiteFusedActivation, which has the same values.
+bool IsSupportedActivation(tflite::ActivationFunctionType activation) {
+  return activation == tflite::ActivationFunctionType_NONE ||
+         activation == tflite::ActivationFunctionType_RELU ||
+         activation == tflite::ActivationFunctionType_RELU_N1_TO_1 ||
+         activation == tflite::ActivationFunctionType_RELU6;
+}
+
+// A FULLY_CONNECTED or CONV_2D operator that the custom operator can replace.
+struct Candidate {
+  int channels;
+  int depth;
+  tflite::ActivationFunctionType activation;
+  const std::vector<uint8_t>* filter;
+  const std::vector<uint8_t>* bias;
+};
+
+bool GetCandidate(const tflite::ModelT& model, const tflite::SubGraphT& graph,
+                  const tflite::OperatorT& op, Candidate* candidate) {
+  const tflite::BuiltinOperator code =
+      tflite::GetBuiltinCode(model.operator_codes[op.opcode_index].get());
+  if (op.inputs.size() < 2 || op.outputs.size() != 1 || op.inputs[1] < 0) {
+    return false;
+  }
+  const tflite::TensorT& input = *graph.tensors[op.inputs[0]];
+  const tflite::TensorT& filter = *graph.tensors[op.inputs[1]];
+  const tflite::TensorT& output = *graph.tensors[op.outputs[0]];
+  if (code == tflite::BuiltinOperator_FULLY_CONNECTED) {
+    const tflite::FullyConnectedOptionsT* options =
+        op.builtin_options.AsFullyConnectedOptions();
+    if (options == nullptr ||
+        options->weights_format !=
+            tflite::FullyConnectedOptionsWeightsFormat_DEFAULT ||
+        filter.shape.size() != 2) {
+      return false;
+    }
+    candidate->activation = options->fused_activation_function;
+  } else if (code == tflite::BuiltinOperator_CONV_2D) {
+    const tflite::Conv2DOptionsT* options =
+        op.builtin_options.AsConv2DOptions();
+    if (options == nullptr || options->stride_w != 1 ||
+        options->stride_h != 1 || filter.shape.size() != 4 ||
+        filter.shape[1] != 1 || filter.shape[2] != 1) {
+      return false;
+    }
+    candidate->activation = options->fused_activation_function;
+  } else {
+    return false;
+  }
+  if (!IsInt8Activation(input) || !IsInt8Activation(output) ||
+      filter.type != tflite::TensorType_INT8 || !filter.quantization ||
+      !IsSupportedActivation(candidate->activation)) {
+    return false;
+  }
+  for (int64_t zero_point : filter.quantization->zero_point) {
+    if (zero_point != 0) {
+      return false;
+    }
+  }
+  candidate->channels = filter.shape.front();
+  candidate->depth = filter.shape.back();
+  const size_t scales = filter.quantization->scale.size();
+  if (scales != 1 && scales != static_cast<size_t>(candidate->channels)) {
+    return false;
+  }
+  candidate->filter = ConstantData(model, filter);
+  if (candidate->filter == nullptr ||
+      candidate->filter->size() !=
+          static_cast<size_t>(candidate->channels * candidate->depth)) {
+    return false;
+  }
+  candidate->bias = nullptr;
+  if (op.inputs.size() > 2 && op.inputs[2] >= 0) {
+    const tflite::TensorT& bias = *graph.tensors[op.inputs[2]];
+    candidate->bias = ConstantData(model, bias);
+    if (bias.type != tflite::TensorType_INT32 || candidate->bias == nullptr ||
+        candidate->bias->size() != candidate->channels * sizeof(int32_t)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Appends a constant tensor holding `bytes` and returns its index.
+int AddConstantTensor(tflite::ModelT* model, tflite::SubGraphT* graph,
+                      const std::string& name, tflite::TensorType type,
+                      int elements, const void* bytes, size_t size) {
+  std::unique_ptr<tflite::BufferT> buffer(new tflite::BufferT);
+  const uint8_t* data = static_cast<const uint8_t*>(bytes);
+  buffer->data.assign(data, data + size);
+  model->buffers.push_back(std::move(buffer));
+
+  std::unique_ptr<tflite::TensorT> tensor(new tflite::TensorT);
+  tensor->shape = {elements};
+  tensor->type = type;
+  tensor->buffer = model->buffers.size() - 1;
+  tensor->name = name;
+  graph->tensors.push_back(std::move(tensor));
+  return graph->tensors.size() - 1;
+}
+
+int GetCustomOpcode(tflite::ModelT* model) {
+  for (size_t i = 0; i < model->operator_codes.size(); ++i) {
+    const tflite::OperatorCodeT& code = *model->operator_codes[i];
+    if (tflite::GetBuiltinCode(&code) == tflite::BuiltinOperator_CUSTOM &&
+        code.custom_code == tflite::kBlockSparseFullyConnectedName) {
+      return i;
+    }
+  }
+  std::unique_ptr<tflite::OperatorCodeT> code(new tflite::OperatorCodeT);
+  code->deprecated_builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->builtin_code = tflite::BuiltinOperator_CUSTOM;
+  code->custom_code = tflite::kBlockSparseFullyConnectedName;
+  code->version = 1;
+  model->operator_codes.push_back(std::move(code));
+  return model->operator_codes.size() - 1;
+}
+
+// Replaces `op` with the custom operator on the encoded filter.
+void Rewrite(const Candidate& candidate, int block_size, int blocks,
+             tflite::ModelT* model, tflite::SubGraphT* graph,
+             tflite::OperatorT* op) {
+  const int channels = candidate.channels;
+  const int depth = candidate.depth;
+  std::vector<int8_t> values(blocks * block_size);
+  std::vector<uint8_t> block_indices(blocks);
+  std::vector<int32_t> row_offsets(channels + 1);
+  tflite::EncodeBlockSparse(
+      reinterpret_cast<const int8_t*>(candidate.filter->data()), channels,
+      depth, block_size, values.data(), block_indices.data(),
+      row_offsets.data());
+  const tflite::BlockSparseFilter filter = {
+      channels,           depth, block_size, values.data(),
+      block_indices.data(), row_offsets.data()};
+  const tflite::TensorT& input = *graph->tensors[op->inputs[0]];
+  const int32_t input_offset = -input.quantization->zero_point[0];
+  std::vector<int32_t> bias(channels);
+  tflite::FoldBlockSparseInputOffset(
+      filter,
+      candidate.bias
+          ? reinterpret_cast<const int32_t*>(candidate.bias->data())
+          : nullptr,
+      input_offset, bias.data());
+
+  const tflite::TensorT& dense = *graph->tensors[op->inputs[1]];
+  const std::string name = dense.name;
+  std::unique_ptr<tflite::QuantizationParametersT> quantization(
+      new tflite::QuantizationParametersT(*dense.quantization));
+  quantization->quantized_dimension = 0;
+  const int values_index =
+      AddConstantTensor(model, graph, name + "/block_sparse_values",
+                        tflite::TensorType_INT8, values.size(), values.data(),
+                        values.size());
+  graph->tensors[values_index]->quantization = std::move(quantization);
+  const int block_indices_index = AddConstantTensor(
+      model, graph, name + "/block_sparse_indices", tflite::TensorType_UINT8,
+      block_indices.size(), block_indices.data(), block_indices.size());
+  const int row_offsets_index = AddConstantTensor(
+      model, graph, name + "/block_sparse_row_offsets",
+      tflite::TensorType_INT32, row_offsets.size(), row_offsets.data(),
+      row_offsets.size() * sizeof(int32_t));
+  const int bias_index = AddConstantTensor(
+      model, graph, name + "/block_sparse_bias", tflite::TensorType_INT32,
+      bias.size(), bias.data(), bias.size() * sizeof(int32_t));
+
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.Int("block_size", block_size);
+    fbb.Int("fused_activation_function", candidate.activation);
+  });
+  fbb.Finish();
+
+  op->opcode_index = GetCustomOpcode(model);
+  op->inputs = {op->inputs[0], values_index, block_indices_index,
+                row_offsets_index, bias_index};
+  op->builtin_options.Reset();
+  op->custom_options = fbb.GetBuffer();
+  op->custom_options_format = tflite::CustomOptionsFormat_FLEXBUFFERS;
+}
+
+// Empties the buffers that only unused tensors refer to.
+size_t ClearUnusedBuffers(tflite::ModelT* model) {
+  std::vector<bool> used(model->buffers.size(), false);
+  for (const auto& graph : model->subgraphs) {
+    std::vector<int> tensors(graph->inputs);
+    tensors.insert(tensors.end(), graph->outputs.begin(),
+                   graph->outputs.end());
+    for (const auto& op : graph->operators) {
+      tensors.insert(tensors.end(), op->inputs.begin(), op->inputs.end());
+      tensors.insert(tensors.end(), op->outputs.begin(), op->outputs.end());
+    }
+    for (int tensor_index : tensors) {
+      if (tensor_index >= 0) {
+        used[graph->tensors[tensor_index]->buffer] = true;
+      }
+    }
+  }
+  for (const auto& metadata : model->metadata) {
+    used[metadata->buffer] = true;
+  }
+  for (int buffer_index : model->metadata_buffer) {
+    used[buffer_index] = true;
+  }
+  size_t cleared = 0;
+  for (size_t i = 0; i < model->buffers.size(); ++i) {
+    if (!used[i]) {
+      cleared += model->buffers[i]->data.size();
+      model->buffers[i]->data.clear();
+    }
+  }
+  return cleared;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3 || argc > 5) {
+    fprintf(stderr,
+            "Usage: %s <in.tflite> <out.tflite> [<block_size> "
+            "[<min_zero_fraction>]]\n",
+            argv[0]);
+    return 1;
+  }
+  const int block_size = argc > 3 ? atoi(argv[3]) : 8;
+  const double min_zero_fraction = argc > 4 ? atof(argv[4]) : 0.5;
+  if (block_size <= 0 || block_size > 255) {
+    fprintf(stderr, "Invalid block size %s\n", argv[3]);
+    return 1;
+  }
+
+  std::vector<uint8_t> input;
+  if (!ReadFile(argv[1], &input)) {
+    fprintf(stderr, "Failed to read %s\n", argv[1]);
+    return 1;
+  }
+  flatbuffers::Verifier verifier(input.data(), input.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid TensorFlow Lite model\n", argv[1]);
+    return 1;
+  }
+  std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(input.data());
+
+  size_t dense_bytes = 0;
+  size_t sparse_bytes = 0;
+  int rewritten = 0;
+  for (size_t g = 0; g < model->subgraphs.size(); ++g) {
+    tflite::SubGraphT* graph = model->subgraphs[g].get();
+    for (size_t i = 0; i < graph->operators.size(); ++i) {
+      tflite::OperatorT* op = graph->operators[i].get();
+      Candidate candidate;
+      if (!GetCandidate(*model, *graph, *op, &candidate)) {
+        continue;
+      }
+      const int channels = candidate.channels;
+      const int depth = candidate.depth;
+      if (!tflite::IsBlockSparseEncodable(depth, block_size)) {
+        printf("op %zu: depth %d does not fit block size %d, skipped\n", i,
+               depth, block_size);
+        continue;
+      }
+      const int total_blocks = channels * depth / block_size;
+      const int blocks = tflite::CountNonZeroBlocks(
+          reinterpret_cast<const int8_t*>(candidate.filter->data()),
+          channels, depth, block_size);
+      const double zero_fraction =
+          1.0 - static_cast<double>(blocks) / total_blocks;
+      // The encoded filter, indices and offsets replace the dense filter.
+      const size_t encoded_bytes =
+          blocks * (block_size + 1) + (channels + 1) * sizeof(int32_t);
+      const size_t filter_bytes = candidate.filter->size();
+      printf("op %zu: %dx%d filter, %.1f%% zero blocks, %zu -> %zu bytes",
+             i, channels, depth, zero_fraction * 100, filter_bytes,
+             encoded_bytes);
+      if (zero_fraction < min_zero_fraction || blocks == 0 ||
+          encoded_bytes >= filter_bytes) {
+        printf(", kept dense\n");
+        continue;
+      }
+      printf("\n");
+      Rewrite(candidate, block_size, blocks, model.get(), graph, op);
+      dense_bytes += filter_bytes;
+      sparse_bytes += encoded_bytes;
+      ++rewritten;
+    }
+  }
+  const size_t cleared = ClearUnusedBuffers(model.get());
+
+  flatbuffers::FlatBufferBuilder builder;
+  tflite::FinishModelBuffer(builder,
+                            tflite::Model::Pack(builder, model.get()));
+  printf("%d operators rewritten, filters %zu -> %zu bytes, %zu bytes of "
+         "unused buffers dropped, model %zu -> %u bytes\n",
+         rewritten, dense_bytes, sparse_bytes, cleared, input.size(),
+         builder.GetSize());
+
+  if (!WriteFile(argv[2], builder.GetBufferPointer(), builder.GetSize())) {
+    fprintf(stderr, "Failed to write %s\n", argv[2]);
+    return 1;
+  }
+  return 0;
+}
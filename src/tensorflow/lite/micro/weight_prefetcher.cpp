@@ -0,0 +1,169 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/weight_prefetcher.h"
+
+
+namespace tflite {
+namespace {
+
+// Returns the size of the constant buffer backing `tensor_index`, or 0 if the
+// tensor is not a constant.
+size_t ConstantBufferBytes(const Model* model, const SubGraph* subgraph,
+                           int tensor_index) {
+  const tflite::Tensor* tensor = subgraph->tensors()->Get(tensor_index);
+  const tflite::Buffer* buffer = model->buffers()->Get(tensor->buffer());
+  if (buffer == nullptr || buffer->data() == nullptr) {
+    return 0;
+  }
+  return buffer->data()->size();
+}
+
+// Picks the input of `node` to prefetch, or returns -1 if none qualifies.
+int ChooseTensor(const Model* model, const SubGraph* subgraph,
+                 const TfLiteNode& node, size_t staging_bytes,
+                 size_t* bytes) {
+  int chosen = -1;
+  *bytes = 0;
+  for (int i = 0; i < node.inputs->size; ++i) {
+    const int tensor_index = node.inputs->data[i];
+    if (tensor_index < 0) {
+      continue;
+    }
+    const size_t tensor_bytes =
+        ConstantBufferBytes(model, subgraph, tensor_index);
+    if (tensor_bytes >= WeightPrefetcher::kMinPrefetchBytes &&
+        tensor_bytes <= staging_bytes && tensor_bytes > *bytes) {
+      chosen = tensor_index;
+      *bytes = tensor_bytes;
+    }
+  }
+  return chosen;
+}
+
+}  // namespace
+
+TfLiteStatus WeightPrefetcher::Init(const Model* model,
+                                    const NodeAndRegistration* nodes,
+                                    size_t nodes_size,
+                                    TfLiteEvalTensor* eval_tensors,
+                                    size_t staging_bytes,
+                                    MicroAllocator* allocator,
+                                    ErrorReporter* error_reporter) {
+  const SubGraph* subgraph = model->subgraphs()->Get(0);
+  size_t bytes;
+
+  size_t entries_size = 0;
+  for (size_t i = 0; i < nodes_size; ++i) {
+    if (ChooseTensor(model, subgraph, nodes[i].node, staging_bytes, &bytes) >=
+        0) {
+      ++entries_size;
+    }
+  }
+  if (entries_size == 0) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "No weights between %d and %d bytes to prefetch",
+                         kMinPrefetchBytes, staging_bytes);
+    return kTfLiteError;
+  }
+
+  Entry* entries = reinterpret_cast<Entry*>(
+      allocator->AllocatePersistentBuffer(sizeof(Entry) * entries_size));
+  uint8_t* slot0 =
+      static_cast<uint8_t*>(allocator->AllocatePersistentBuffer(staging_bytes));
+  uint8_t* slot1 =
+      static_cast<uint8_t*>(allocator->AllocatePersistentBuffer(staging_bytes));
+  if (entries == nullptr || slot0 == nullptr || slot1 == nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "Failed to allocate 2x%d bytes of prefetch staging",
+                         staging_bytes);
+    return kTfLiteError;
+  }
+
+  prefetched_bytes_ = 0;
+  size_t entry_index = 0;
+  for (size_t i = 0; i < nodes_size; ++i) {
+    const int tensor_index =
+        ChooseTensor(model, subgraph, nodes[i].node, staging_bytes, &bytes);
+    if (tensor_index >= 0) {
+      entries[entry_index].node_index = i;
+      entries[entry_index].tensor_index = tensor_index;
+      entries[entry_index].bytes = bytes;
+      prefetched_bytes_ += bytes;
+      ++entry_index;
+    }
+  }
+
+  eval_tensors_ = eval_tensors;
+  entries_ = entries;
+  entries_size_ = entries_size;
+  slots_[0] = slot0;
+  slots_[1] = slot1;
+  Reset();
+  return kTfLiteOk;
+}
+
+void WeightPrefetcher::Reset() {
+  for (int i = 0; i < 2; ++i) {
+    WaitAsyncCopy(copy_handles_[i]);
+    copy_handles_[i] = kAsyncCopyDone;
+  }
+  if (original_data_ != nullptr) {
+    eval_tensors_[entries_[next_use_].tensor_index].data.data = original_data_;
+    original_data_ = nullptr;
+  }
+  next_start_ = 0;
+  next_use_ = 0;
+}
+
+void WeightPrefetcher::StartCopy(size_t entry_index) {
+  const Entry& entry = entries_[entry_index];
+  copy_handles_[entry_index & 1] =
+      StartAsyncCopy(slots_[entry_index & 1],
+                     eval_tensors_[entry.tensor_index].data.data, entry.bytes);
+}
+
+void WeightPrefetcher::BeforeInvoke(size_t node_index) {
+  if (entries_size_ == 0) {
+    return;
+  }
+  // The slot of entry next_use_ + 1 was last used by entry next_use_ - 1,
+  // which has already run, so up to two copies can be in flight.
+  while (next_start_ < entries_size_ && next_start_ <= next_use_ + 1) {
+    StartCopy(next_start_++);
+  }
+  if (next_use_ < entries_size_ &&
+      entries_[next_use_].node_index == node_index) {
+    const int slot = next_use_ & 1;
+    WaitAsyncCopy(copy_handles_[slot]);
+    copy_handles_[slot] = kAsyncCopyDone;
+    TfLiteEvalTensor* tensor =
+        &eval_tensors_[entries_[next_use_].tensor_index];
+    original_data_ = tensor->data.data;
+    tensor->data.data = slots_[slot];
+  }
+}
+
+void WeightPrefetcher::AfterInvoke(size_t node_index) {
+  if (original_data_ == nullptr ||
+      entries_[next_use_].node_index != node_index) {
+    return;
+  }
+  eval_tensors_[entries_[next_use_].tensor_index].data.data = original_data_;
+  original_data_ = nullptr;
+  ++next_use_;
+}
+
+}  // namespace tflite
@@ -0,0 +1,92 @@
+/* Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_WEIGHT_PREFETCHER_H_
+#define TENSORFLOW_LITE_MICRO_WEIGHT_PREFETCHER_H_
+
+#include <cstddef>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_async_copy.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Copies constant weight tensors from flash into SRAM ahead of the node that
+// reads them, so that on execute-in-place targets a layer's weights are
+// fetched by DMA while the previous layer is still running.
+//
+// For every node the largest constant input that fits into a staging slot is
+// chosen. Two slots are allocated from the persistent section of the arena
+// and used alternately: while node k runs from one slot, the weights of the
+// next prefetched node are copied into the other. The eval tensor data pointer
+// is redirected to the slot only for the duration of that node's Invoke, so
+// kernels need no changes. Weights are best laid out in flash in execution
+// order (see tools/reorder_model_buffers.cpp) to keep the copies sequential.
+class WeightPrefetcher {
+ public:
+  // Weights smaller than this are cheaper to read in place than to copy.
+  static constexpr size_t kMinPrefetchBytes = 512;
+
+  // Plans the copies for `model` and allocates two staging slots of
+  // `staging_bytes` each from `allocator`. Must be called after the model's
+  // tensors have been allocated.
+  TfLiteStatus Init(const Model* model, const NodeAndRegistration* nodes,
+                    size_t nodes_size, TfLiteEvalTensor* eval_tensors,
+                    size_t staging_bytes, MicroAllocator* allocator,
+                    ErrorReporter* error_reporter);
+
+  // Waits for any outstanding copies and rewinds to the first node. Called at
+  // the start of every Invoke() and after a failed one.
+  void Reset();
+
+  // Called around each node's Invoke(). BeforeInvoke() waits for the node's
+  // own weights and starts copying the next prefetched node's weights;
+  // AfterInvoke() restores the original tensor data pointer.
+  void BeforeInvoke(size_t node_index);
+  void AfterInvoke(size_t node_index);
+
+  bool enabled() const { return entries_size_ > 0; }
+  size_t entries_size() const { return entries_size_; }
+  size_t prefetched_bytes() const { return prefetched_bytes_; }
+
+ private:
+  struct Entry {
+    size_t node_index;
+    int tensor_index;
+    size_t bytes;
+  };
+
+  void StartCopy(size_t entry_index);
+
+  TfLiteEvalTensor* eval_tensors_ = nullptr;
+  Entry* entries_ = nullptr;
+  size_t entries_size_ = 0;
+  size_t prefetched_bytes_ = 0;
+
+  uint8_t* slots_[2] = {nullptr, nullptr};
+  int copy_handles_[2] = {kAsyncCopyDone, kAsyncCopyDone};
+  void* original_data_ = nullptr;
+
+  // Index of the next entry whose copy has not been started yet, and of the
+  // next entry whose node has not run yet.
+  size_t next_start_ = 0;
+  size_t next_use_ = 0;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_WEIGHT_PREFETCHER_H_